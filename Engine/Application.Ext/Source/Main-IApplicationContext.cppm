@@ -16,6 +16,7 @@ export module PonyEngine.Application.Ext:IApplicationContext;
 import std;
 
 import PonyEngine.Log;
+import PonyEngine.Memory;
 import PonyEngine.Meta;
 
 import :FlowState;
@@ -191,6 +192,14 @@ export namespace PonyEngine::Application
 		/// @note The function is thread-safe.
 		[[nodiscard("Pure function")]]
 		virtual std::uint64_t FrameCount() const noexcept = 0;
+
+		/// @brief Gets the allocation statistics of the @p tag.
+		/// @param tag Allocation tag. It must be registered.
+		/// @return Allocation statistics. They're zero if the allocation tracking is disabled.
+		/// @remark The allocation tracking is enabled by the @p PONY_ENGINE_MEMORY_TRACKING build option.
+		/// @note The function is thread-safe.
+		[[nodiscard("Pure function")]]
+		virtual Memory::AllocationStatistics AllocationStatistics(Memory::AllocationTag tag) const noexcept = 0;
 	};
 }
 
@@ -16,6 +16,7 @@ export module PonyEngine.Application.Ext:ILoggerModuleContext;
 import std;
 
 import PonyEngine.Log;
+import PonyEngine.Type;
 
 import :ILoggerContext;
 import :LoggerHandle;
@@ -32,7 +33,7 @@ export namespace PonyEngine::Application
 		/// @return Logger handle. Must be used to unset a logger before a destruction of the application.
 		/// @note The function must be called on a main thread.
 		[[nodiscard("Must be used to unset")]]
-		virtual LoggerHandle SetLogger(const std::function<std::shared_ptr<Log::ILogger>(ILoggerContext&)>& factory) = 0;
+		virtual LoggerHandle SetLogger(Type::FunctionRef<std::shared_ptr<Log::ILogger>(ILoggerContext&)> factory) = 0;
 		/// @brief Unsets the logger.
 		/// @param handle Logger handle.
 		/// @note The function must be called on a main thread.
@@ -15,6 +15,8 @@ export module PonyEngine.Application.Ext:IServiceModuleContext;
 
 import std;
 
+import PonyEngine.Type;
+
 import :IApplicationContext;
 import :IService;
 import :ServiceHandle;
@@ -31,7 +33,7 @@ export namespace PonyEngine::Application
 		/// @return Service handle. Must be used to remove a service before a destruction of the application.
 		/// @note The function must be called on a main thread.
 		[[nodiscard("Must be used to remove")]]
-		virtual ServiceHandle AddService(const std::function<std::shared_ptr<IService>(IApplicationContext&)>& factory) = 0;
+		virtual ServiceHandle AddService(Type::FunctionRef<std::shared_ptr<IService>(IApplicationContext&)> factory) = 0;
 		/// @brief Removes a service.
 		/// @param handle Service handle.
 		/// @note The function must be called on a main thread.
@@ -0,0 +1,214 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+import std;
+
+import PonyEngine.Memory;
+
+namespace
+{
+	/// @brief Allocation header. It's placed right before the memory returned to a user.
+	struct AllocationHeader final
+	{
+		std::size_t size; ///< Requested size.
+		std::uint32_t offset; ///< Offset from the raw allocation to the user memory.
+		std::uint32_t tag; ///< Allocation tag ID or @p UntrackedTag.
+	};
+
+	constexpr std::uint32_t UntrackedTag = std::numeric_limits<std::uint32_t>::max(); ///< Tag ID of allocations made while the tracking was disabled.
+	constexpr std::size_t DefaultAlignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__; ///< Alignment of the raw allocations.
+	static_assert(sizeof(AllocationHeader) <= DefaultAlignment, "Allocation header is too big");
+
+	/// @brief Allocates tracked memory.
+	/// @param size Size.
+	/// @param alignment Alignment.
+	/// @return Memory or nullptr if there's not enough memory.
+	void* Allocate(std::size_t size, std::size_t alignment) noexcept;
+	/// @brief Allocates tracked memory. It calls the new handler while there's not enough memory.
+	/// @param size Size.
+	/// @param alignment Alignment.
+	/// @return Memory.
+	void* AllocateOrThrow(std::size_t size, std::size_t alignment);
+	/// @brief Deallocates tracked memory.
+	/// @param memory Memory. May be nullptr.
+	void Deallocate(void* memory) noexcept;
+
+	/// @brief Enables the allocation tracking on the program start.
+	[[maybe_unused]]
+	const bool TrackingEnabler = (PonyEngine::Memory::EnableAllocationTracking(true), true);
+}
+
+void* operator new(const std::size_t size)
+{
+	return AllocateOrThrow(size, DefaultAlignment);
+}
+
+void* operator new[](const std::size_t size)
+{
+	return AllocateOrThrow(size, DefaultAlignment);
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment)
+{
+	return AllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment)
+{
+	return AllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(const std::size_t size, const std::nothrow_t&) noexcept
+{
+	return Allocate(size, DefaultAlignment);
+}
+
+void* operator new[](const std::size_t size, const std::nothrow_t&) noexcept
+{
+	return Allocate(size, DefaultAlignment);
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* const memory) noexcept
+{
+	Deallocate(memory);
+}
+
+void operator delete[](void* const memory) noexcept
+{
+	Deallocate(memory);
+}
+
+void operator delete(void* const memory, std::size_t) noexcept
+{
+	Deallocate(memory);
+}
+
+void operator delete[](void* const memory, std::size_t) noexcept
+{
+	Deallocate(memory);
+}
+
+void operator delete(void* const memory, std::align_val_t) noexcept
+{
+	Deallocate(memory);
+}
+
+void operator delete[](void* const memory, std::align_val_t) noexcept
+{
+	Deallocate(memory);
+}
+
+void operator delete(void* const memory, std::size_t, std::align_val_t) noexcept
+{
+	Deallocate(memory);
+}
+
+void operator delete[](void* const memory, std::size_t, std::align_val_t) noexcept
+{
+	Deallocate(memory);
+}
+
+void operator delete(void* const memory, const std::nothrow_t&) noexcept
+{
+	Deallocate(memory);
+}
+
+void operator delete[](void* const memory, const std::nothrow_t&) noexcept
+{
+	Deallocate(memory);
+}
+
+void operator delete(void* const memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+	Deallocate(memory);
+}
+
+void operator delete[](void* const memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+	Deallocate(memory);
+}
+
+namespace
+{
+	void* Allocate(const std::size_t size, std::size_t alignment) noexcept
+	{
+		alignment = std::max(alignment, DefaultAlignment);
+		// The raw memory is aligned by the default alignment, so the header and the alignment padding always fit into the alignment size.
+		const std::size_t maxOffset = alignment;
+		if (size > std::numeric_limits<std::size_t>::max() - maxOffset) [[unlikely]]
+		{
+			return nullptr;
+		}
+
+		std::byte* const raw = static_cast<std::byte*>(std::malloc(size + maxOffset));
+		if (!raw) [[unlikely]]
+		{
+			return nullptr;
+		}
+
+		const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(raw) + DefaultAlignment;
+		std::byte* const memory = raw + (((address + alignment - 1uz) & ~(alignment - 1uz)) - reinterpret_cast<std::uintptr_t>(raw));
+		const PonyEngine::Memory::AllocationTag tag = PonyEngine::Memory::CurrentAllocationTag();
+		new (memory - sizeof(AllocationHeader)) AllocationHeader
+		{
+			.size = size,
+			.offset = static_cast<std::uint32_t>(memory - raw),
+			.tag = PonyEngine::Memory::TrackAllocation(tag, size) ? tag.id : UntrackedTag
+		};
+
+		return memory;
+	}
+
+	void* AllocateOrThrow(const std::size_t size, const std::size_t alignment)
+	{
+		while (true)
+		{
+			if (void* const memory = Allocate(size, alignment)) [[likely]]
+			{
+				return memory;
+			}
+
+			if (const std::new_handler handler = std::get_new_handler())
+			{
+				handler();
+			}
+			else
+			{
+				throw std::bad_alloc();
+			}
+		}
+	}
+
+	void Deallocate(void* const memory) noexcept
+	{
+		if (!memory)
+		{
+			return;
+		}
+
+		std::byte* const userMemory = static_cast<std::byte*>(memory);
+		const AllocationHeader header = *std::launder(reinterpret_cast<AllocationHeader*>(userMemory - sizeof(AllocationHeader)));
+		if (header.tag != UntrackedTag)
+		{
+			PonyEngine::Memory::TrackDeallocation(PonyEngine::Memory::AllocationTag{.id = header.tag}, header.size);
+		}
+
+		std::free(userMemory - header.offset);
+	}
+}
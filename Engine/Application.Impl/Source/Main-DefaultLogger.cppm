@@ -24,10 +24,18 @@ export namespace PonyEngine::Application
 
 		virtual ~DefaultLogger() noexcept = default;
 
+		[[nodiscard("Pure function")]]
+		virtual Log::LogFilter& Filter() noexcept override final;
+		[[nodiscard("Pure function")]]
+		virtual const Log::LogFilter& Filter() const noexcept override final;
+
 		virtual void Log(Log::LogType logType, std::string_view message) const noexcept override final;
 		virtual void Log(Log::LogType logType, std::string_view message, const std::stacktrace& stacktrace) const noexcept override final;
 		virtual void Log(Log::LogType logType, std::string_view format, std::format_args formatArgs) const noexcept override final;
 		virtual void Log(Log::LogType logType, std::string_view format, std::format_args formatArgs, const std::stacktrace& stacktrace) const noexcept override final;
+		virtual void Log(Log::LogType logType, const Log::DeferredMessage& message) const noexcept override final;
+		virtual void Log(Log::LogType logType, const Log::DeferredMessage& message, const std::stacktrace& stacktrace) const noexcept override final;
+		virtual void Log(Log::LogType logType, std::string_view message, std::span<const Log::LogField> fields) const noexcept override final;
 
 		virtual void Log(const std::exception_ptr& exception) const noexcept override final;
 		virtual void Log(const std::exception_ptr& exception, std::string_view message) const noexcept override final;
@@ -59,12 +67,23 @@ export namespace PonyEngine::Application
 		static constexpr std::string_view NullptrException = "Nullptr exception."; ///< Nullptr exception text.
 
 		inline static thread_local std::string stringTemp; ///< Temporal string.
+		Log::LogFilter filter; ///< Runtime log filter.
 		mutable std::mutex logMutex; ///< Log mutex.
 	};
 }
 
 namespace PonyEngine::Application
 {
+	Log::LogFilter& DefaultLogger::Filter() noexcept
+	{
+		return filter;
+	}
+
+	const Log::LogFilter& DefaultLogger::Filter() const noexcept
+	{
+		return filter;
+	}
+
 	void DefaultLogger::Log(const Log::LogType logType, const std::string_view message) const noexcept
 	{
 #if PONY_ENGINE_DEFAULT_LOGGER
@@ -133,6 +152,63 @@ namespace PonyEngine::Application
 #endif
 	}
 
+	void DefaultLogger::Log(const Log::LogType logType, const Log::DeferredMessage& message) const noexcept
+	{
+#if PONY_ENGINE_DEFAULT_LOGGER
+		try
+		{
+			stringTemp.clear();
+			std::format_to(std::back_inserter(stringTemp), "{}: ", logType);
+			message.FormatTo(stringTemp);
+			stringTemp.push_back('\n');
+			LogToConsole(logType, stringTemp);
+		}
+		catch (...)
+		{
+			LogInternal(logType, AllocationError);
+		}
+#endif
+	}
+
+	void DefaultLogger::Log(const Log::LogType logType, const Log::DeferredMessage& message, const std::stacktrace& stacktrace) const noexcept
+	{
+#if PONY_ENGINE_DEFAULT_LOGGER
+		try
+		{
+			stringTemp.clear();
+			std::format_to(std::back_inserter(stringTemp), "{}: ", logType);
+			message.FormatTo(stringTemp);
+			std::format_to(std::back_inserter(stringTemp), "\n{}\n", stacktrace);
+			LogToConsole(logType, stringTemp);
+		}
+		catch (...)
+		{
+			LogInternal(logType, AllocationError);
+		}
+#endif
+	}
+
+	void DefaultLogger::Log(const Log::LogType logType, const std::string_view message, const std::span<const Log::LogField> fields) const noexcept
+	{
+#if PONY_ENGINE_DEFAULT_LOGGER
+		try
+		{
+			stringTemp.clear();
+			std::format_to(std::back_inserter(stringTemp), "{}: {}", logType, message);
+			for (const Log::LogField& field : fields)
+			{
+				std::format_to(std::back_inserter(stringTemp), " {}", field);
+			}
+			stringTemp.push_back('\n');
+			LogToConsole(logType, stringTemp);
+		}
+		catch (...)
+		{
+			LogInternal(logType, AllocationError);
+		}
+#endif
+	}
+
 	void DefaultLogger::Log(const std::exception_ptr& exception) const noexcept
 	{
 #if PONY_ENGINE_DEFAULT_LOGGER
@@ -19,6 +19,8 @@ import std;
 
 import PonyEngine.Application.Ext;
 import PonyEngine.Log;
+import PonyEngine.Memory;
+import PonyEngine.Type;
 
 import :ExitCodes;
 
@@ -52,10 +54,10 @@ export namespace PonyEngine::Application
 
 		/// @brief Runs the flow.
 		/// @param begin Begin function.
-		/// @param end End function. Must be noexcept.
+		/// @param end End function.
 		/// @param tick Tick function.
 		/// @return Exit code.
-		int Run(const std::function<void()>& begin, const std::function<void()>& end, const std::function<void()>& tick);
+		int Run(Type::FunctionRef<void()> begin, Type::FunctionRef<void() noexcept> end, Type::FunctionRef<void()> tick);
 		/// @brief Stops the flow.
 		/// @param exitCode Exit code.
 		void Stop(int exitCode);
@@ -68,10 +70,10 @@ export namespace PonyEngine::Application
 	private:
 		/// @brief Begins the flow.
 		/// @param begin Begin function.
-		void Begin(const std::function<void()>& begin);
+		void Begin(Type::FunctionRef<void()> begin);
 		/// @brief Ends the flow.
 		/// @param end End function.
-		void End(const std::function<void()>& end) noexcept;
+		void End(Type::FunctionRef<void() noexcept> end) noexcept;
 
 		/// @brief Starts a run.
 		void StartRun();
@@ -81,6 +83,12 @@ export namespace PonyEngine::Application
 		bool IsRunning() const noexcept;
 		/// @brief Increments the frame count.
 		void NextFrame() noexcept;
+#if PONY_ENGINE_MEMORY_TRACKING
+		/// @brief Finishes an allocation frame and periodically logs the allocation statistics.
+		void TrackAllocations() noexcept;
+		/// @brief Logs the allocation statistics of all the tags that have allocations.
+		void LogAllocations() const noexcept;
+#endif
 
 		/// @brief Sets the flow state.
 		/// @param state Flow state to set.
@@ -93,6 +101,10 @@ export namespace PonyEngine::Application
 			enum FlowState flowState; ///< Flow state.
 		};
 
+#if PONY_ENGINE_MEMORY_TRACKING
+		static constexpr std::uint64_t AllocationLogPeriod = PONY_ENGINE_MEMORY_TRACKING_LOG_PERIOD; ///< Frame count between allocation statistics logs. Zero disables them.
+#endif
+
 		IApplicationContext* application; ///< Application context.
 
 		std::atomic<std::uint64_t> frameCount; ///< Frame count.
@@ -127,7 +139,7 @@ namespace PonyEngine::Application
 		return flowInfo.load(std::memory_order::relaxed).flowState;
 	}
 
-	int FlowManager::Run(const std::function<void()>& begin, const std::function<void()>& end, const std::function<void()>& tick)
+	int FlowManager::Run(Type::FunctionRef<void()> begin, Type::FunctionRef<void() noexcept> end, Type::FunctionRef<void()> tick)
 	{
 		assert(FlowState() == FlowState::StartingUp && "The flow state is incorrect for running.");
 
@@ -140,6 +152,9 @@ namespace PonyEngine::Application
 			{
 				PONY_LOG(application->Logger(), Log::LogType::Verbose, "Starting application frame: '{}'.", FrameCount());
 				tick();
+#if PONY_ENGINE_MEMORY_TRACKING
+				TrackAllocations();
+#endif
 				PONY_LOG(application->Logger(), Log::LogType::Verbose, "Finishing application frame: '{}'.", FrameCount());
 			}
 			PONY_LOG(application->Logger(), Log::LogType::Info, "Finishing application main loop. Exit code: '{}'.", FrameCount());
@@ -187,7 +202,7 @@ namespace PonyEngine::Application
 		FlowState(FlowState::ShuttingDown);
 	}
 
-	void FlowManager::Begin(const std::function<void()>& begin)
+	void FlowManager::Begin(Type::FunctionRef<void()> begin)
 	{
 		PONY_LOG(application->Logger(), Log::LogType::Info, "Beginning application...");
 		FlowState(FlowState::Beginning);
@@ -195,7 +210,7 @@ namespace PonyEngine::Application
 		PONY_LOG(application->Logger(), Log::LogType::Info, "Beginning application done.");
 	}
 
-	void FlowManager::End(const std::function<void()>& end) noexcept
+	void FlowManager::End(Type::FunctionRef<void() noexcept> end) noexcept
 	{
 		PONY_LOG(application->Logger(), Log::LogType::Info, "Ending application...");
 		FlowState(FlowState::Ending);
@@ -218,6 +233,34 @@ namespace PonyEngine::Application
 		frameCount.fetch_add(IsRunning(), std::memory_order::relaxed);
 	}
 
+#if PONY_ENGINE_MEMORY_TRACKING
+	void FlowManager::TrackAllocations() noexcept
+	{
+		Memory::FinishAllocationFrame();
+
+		if constexpr (AllocationLogPeriod > 0ull)
+		{
+			if ((FrameCount() + 1ull) % AllocationLogPeriod == 0ull)
+			{
+				LogAllocations();
+			}
+		}
+	}
+
+	void FlowManager::LogAllocations() const noexcept
+	{
+		for (std::size_t i = 0uz, count = Memory::AllocationTagCount(); i < count; ++i)
+		{
+			const auto tag = Memory::AllocationTag{.id = static_cast<std::uint32_t>(i)};
+			if (const Memory::AllocationStatistics statistics = application->AllocationStatistics(tag); statistics.allocationCount > 0ull)
+			{
+				PONY_LOG(application->Logger(), Log::LogType::Info, "Allocations of '{}': live bytes: '{}'; peak bytes: '{}'; live allocations: '{}'; last frame allocations: '{}'; total allocations: '{}'.",
+					Memory::AllocationTagName(tag), statistics.liveBytes, statistics.peakBytes, statistics.liveAllocationCount, statistics.frameAllocationCount, statistics.allocationCount);
+			}
+		}
+	}
+#endif
+
 	void FlowManager::FlowState(const enum FlowState state) noexcept
 	{
 		flowInfo.store(FlowInfo{.exitCode = ExitCode(), .flowState = state}, std::memory_order::relaxed);
@@ -19,6 +19,7 @@ import std;
 
 import PonyEngine.Application.Ext;
 import PonyEngine.Log;
+import PonyEngine.Type;
 
 export namespace PonyEngine::Application
 {
@@ -41,7 +42,7 @@ export namespace PonyEngine::Application
 		const Log::ILogger& Logger() const noexcept;
 
 		[[nodiscard("Must be used to unset")]]
-		virtual LoggerHandle SetLogger(const std::function<std::shared_ptr<Log::ILogger>(ILoggerContext&)>& factory) override final;
+		virtual LoggerHandle SetLogger(Type::FunctionRef<std::shared_ptr<Log::ILogger>(ILoggerContext&)> factory) override final;
 		virtual void UnsetLogger(LoggerHandle handle) override final;
 
 		LoggerManager& operator =(const LoggerManager&) = delete;
@@ -92,7 +93,7 @@ namespace PonyEngine::Application
 		return *logger;
 	}
 
-	LoggerHandle LoggerManager::SetLogger(const std::function<std::shared_ptr<Log::ILogger>(ILoggerContext&)>& factory)
+	LoggerHandle LoggerManager::SetLogger(Type::FunctionRef<std::shared_ptr<Log::ILogger>(ILoggerContext&)> factory)
 	{
 #ifndef NDEBUG
 		if (std::this_thread::get_id() != application->MainThreadID()) [[unlikely]]
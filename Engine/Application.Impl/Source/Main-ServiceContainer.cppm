@@ -16,6 +16,7 @@ export module PonyEngine.Application.Impl:ServiceContainer;
 import std;
 
 import PonyEngine.Application.Ext;
+import PonyEngine.Memory;
 
 import :InterfaceContainer;
 import :TickableServiceInfo;
@@ -23,6 +24,7 @@ import :TickableServiceInfo;
 export namespace PonyEngine::Application
 {
 	/// @brief Service container.
+	/// @details It issues service handles itself. Finding a service by its handle takes constant time.
 	class ServiceContainer
 	{
 	public:
@@ -83,12 +85,12 @@ export namespace PonyEngine::Application
 		const InterfaceContainer& Interfaces(std::size_t index) const noexcept;
 
 		/// @brief Adds data.
-		/// @param handle Service handle.
 		/// @param service Service.
-		/// @return Service index.
-		std::size_t Add(ServiceHandle handle, const std::shared_ptr<IService>& service);
+		/// @return Service handle. The service is added to the end.
+		ServiceHandle Add(const std::shared_ptr<IService>& service);
 		/// @brief Removes data.
 		/// @param index Data index.
+		/// @note It keeps the order of the rest services.
 		void Remove(std::size_t index) noexcept;
 		/// @brief Clears data.
 		void Clear() noexcept;
@@ -97,10 +99,15 @@ export namespace PonyEngine::Application
 		ServiceContainer& operator =(ServiceContainer&& other) noexcept = default;
 
 	private:
-		std::vector<ServiceHandle> serviceHandles; ///< Service handles.
-		std::vector<std::shared_ptr<IService>> services; ///< Services.
-		std::vector<std::vector<TickableServiceInfo>> tickableServices; ///< Tickable services.
-		std::vector<InterfaceContainer> interfaces; ///< Service interfaces.
+		/// @brief Service data.
+		struct ServiceData final
+		{
+			std::shared_ptr<IService> service; ///< Service.
+			std::vector<TickableServiceInfo> tickableServices; ///< Tickable services.
+			InterfaceContainer interfaces; ///< Service interfaces.
+		};
+
+		Memory::SlotMap<ServiceData> services; ///< Services.
 	};
 }
 
@@ -108,98 +115,63 @@ namespace PonyEngine::Application
 {
 	std::size_t ServiceContainer::Size() const noexcept
 	{
-		return serviceHandles.size();
+		return services.Size();
 	}
 
 	std::size_t ServiceContainer::IndexOf(const ServiceHandle handle) const noexcept
 	{
-		return std::ranges::find(serviceHandles, handle) - serviceHandles.cbegin();
+		return services.IndexOf(Memory::SlotKey{.id = handle.id});
 	}
 
 	std::size_t ServiceContainer::IndexOf(const IService& service) const noexcept
 	{
-		return std::ranges::find_if(services, [&](const std::shared_ptr<IService>& s) { return s.get() == &service; }) - services.cbegin();
+		return std::ranges::find_if(services, [&](const ServiceData& s) { return s.service.get() == &service; }) - services.begin();
 	}
 
 	ServiceHandle ServiceContainer::Handle(const std::size_t index) const noexcept
 	{
-		return serviceHandles[index];
+		return ServiceHandle{.id = services.Key(index).id};
 	}
 
 	IService& ServiceContainer::Service(const std::size_t index) const noexcept
 	{
-		return *services[index];
+		return *services[index].service;
 	}
 
 	std::vector<TickableServiceInfo>& ServiceContainer::TickableServices(const std::size_t index) noexcept
 	{
-		return tickableServices[index];
+		return services[index].tickableServices;
 	}
 
 	const std::vector<TickableServiceInfo>& ServiceContainer::TickableServices(const std::size_t index) const noexcept
 	{
-		return tickableServices[index];
+		return services[index].tickableServices;
 	}
 
 	InterfaceContainer& ServiceContainer::Interfaces(const std::size_t index) noexcept
 	{
-		return interfaces[index];
+		return services[index].interfaces;
 	}
 
 	const InterfaceContainer& ServiceContainer::Interfaces(const std::size_t index) const noexcept
 	{
-		return interfaces[index];
+		return services[index].interfaces;
 	}
 
-	std::size_t ServiceContainer::Add(const ServiceHandle handle, const std::shared_ptr<IService>& service)
+	ServiceHandle ServiceContainer::Add(const std::shared_ptr<IService>& service)
 	{
 		assert(service && "The service is nullptr.");
 
-		serviceHandles.push_back(handle);
-		try
-		{
-			services.push_back(service);
-			try
-			{
-				tickableServices.push_back(std::vector<TickableServiceInfo>());
-				try
-				{
-					interfaces.push_back(InterfaceContainer());
-				}
-				catch (...)
-				{
-					tickableServices.pop_back();
-					throw;
-				}
-			}
-			catch (...)
-			{
-				services.pop_back();
-				throw;
-			}
-		}
-		catch (...)
-		{
-			serviceHandles.pop_back();
-			throw;
-		}
-
-		return Size() - 1uz;
+		return ServiceHandle{.id = services.Add(ServiceData{.service = service}).id};
 	}
 
 	void ServiceContainer::Remove(const std::size_t index) noexcept
 	{
-		interfaces.erase(interfaces.cbegin() + index);
-		tickableServices.erase(tickableServices.cbegin() + index);
-		services.erase(services.cbegin() + index);
-		serviceHandles.erase(serviceHandles.cbegin() + index);
+		services.RemoveOrdered(index);
 	}
 
 	void ServiceContainer::Clear() noexcept
 	{
-		serviceHandles.clear();
-		services.clear();
-		tickableServices.clear();
-		interfaces.clear();
+		services.Clear();
 	}
 }
@@ -19,6 +19,8 @@ import std;
 
 import PonyEngine.Application.Ext;
 import PonyEngine.Log;
+import PonyEngine.Memory;
+import PonyEngine.Type;
 
 import :InterfaceContainer;
 import :ServiceContainer;
@@ -58,7 +60,7 @@ export namespace PonyEngine::Application
 		void Tick();
 
 		[[nodiscard("Must be used to remove")]]
-		virtual ServiceHandle AddService(const std::function<std::shared_ptr<IService>(IApplicationContext&)>& factory) override;
+		virtual ServiceHandle AddService(Type::FunctionRef<std::shared_ptr<IService>(IApplicationContext&)> factory) override;
 		virtual void RemoveService(ServiceHandle handle) override;
 
 		ServiceManager& operator =(const ServiceManager&) = delete;
@@ -98,7 +100,7 @@ export namespace PonyEngine::Application
 			/// @param container Service interface container.
 			/// @param globalContainer Global interface container.
 			[[nodiscard("Pure constructor")]]
-			ServiceInterfaceAdder(IApplicationContext& application, InterfaceContainer& container, std::unordered_map<std::type_index, void*>& globalContainer) noexcept;
+			ServiceInterfaceAdder(IApplicationContext& application, InterfaceContainer& container, Memory::FlatHashMap<std::type_index, void*>& globalContainer) noexcept;
 			ServiceInterfaceAdder(const ServiceInterfaceAdder&) = delete;
 			ServiceInterfaceAdder(ServiceInterfaceAdder&&) = delete;
 
@@ -113,7 +115,7 @@ export namespace PonyEngine::Application
 			IApplicationContext* application; ///< Application context.
 
 			InterfaceContainer* container; ///< Service interface container.
-			std::unordered_map<std::type_index, void*>* globalContainer; ///< Global interface container.
+			Memory::FlatHashMap<std::type_index, void*>* globalContainer; ///< Global interface container.
 		};
 
 		/// @brief Updates tickable services vector.
@@ -131,17 +133,14 @@ export namespace PonyEngine::Application
 		ServiceContainer serviceContainer; ///< Service container.
 
 		std::vector<ITickableService*> tickableServices; ///< Tickable services.
-		std::unordered_map<std::type_index, void*> serviceInterfaces; ///< Service interfaces.
-
-		ServiceHandle nextServiceHandle; ///< Next service handle.
+		Memory::FlatHashMap<std::type_index, void*> serviceInterfaces; ///< Service interfaces.
 	};
 }
 
 namespace PonyEngine::Application
 {
 	ServiceManager::ServiceManager(IApplicationContext& application) noexcept :
-		application{&application},
-		nextServiceHandle{.id = 1u}
+		application{&application}
 	{
 	}
 
@@ -159,9 +158,9 @@ namespace PonyEngine::Application
 
 	void* ServiceManager::FindService(const std::type_index type) noexcept
 	{
-		if (const auto pair = serviceInterfaces.find(type); pair != serviceInterfaces.cend()) [[likely]]
+		if (void* const* const service = serviceInterfaces.Find(type)) [[likely]]
 		{
-			return pair->second;
+			return *service;
 		}
 
 		return nullptr;
@@ -169,9 +168,9 @@ namespace PonyEngine::Application
 
 	const void* ServiceManager::FindService(const std::type_index type) const noexcept
 	{
-		if (const auto pair = serviceInterfaces.find(type); pair != serviceInterfaces.cend()) [[likely]]
+		if (const void* const* const service = serviceInterfaces.Find(type)) [[likely]]
 		{
-			return pair->second;
+			return *service;
 		}
 
 		return nullptr;
@@ -222,7 +221,7 @@ namespace PonyEngine::Application
 		}
 	}
 
-	ServiceHandle ServiceManager::AddService(const std::function<std::shared_ptr<IService>(IApplicationContext&)>& factory)
+	ServiceHandle ServiceManager::AddService(Type::FunctionRef<std::shared_ptr<IService>(IApplicationContext&)> factory)
 	{
 #ifndef NDEBUG
 		if (std::this_thread::get_id() != application->MainThreadID()) [[unlikely]]
@@ -230,11 +229,6 @@ namespace PonyEngine::Application
 			throw std::logic_error("Must be called on main thread");
 		}
 
-		if (!nextServiceHandle.IsValid()) [[unlikely]]
-		{
-			throw std::overflow_error("No more service handles available");
-		}
-
 		if (application->FlowState() != FlowState::StartingUp) [[unlikely]]
 		{
 			throw std::logic_error("Service can be added only on start-up");
@@ -257,8 +251,8 @@ namespace PonyEngine::Application
 		}
 #endif
 
-		const ServiceHandle currentHandle = nextServiceHandle;
-		const std::size_t serviceIndex = serviceContainer.Add(currentHandle, service);
+		const ServiceHandle currentHandle = serviceContainer.Add(service);
+		const std::size_t serviceIndex = serviceContainer.IndexOf(currentHandle);
 
 		try
 		{
@@ -287,14 +281,13 @@ namespace PonyEngine::Application
 			PONY_LOG_X(application->Logger(), std::current_exception(), "On adding service interfaces. Service: '{}'.", typeid(*service).name());
 			for (const std::type_index type : serviceContainer.Interfaces(serviceIndex).Types())
 			{
-				serviceInterfaces.erase(type);
+				serviceInterfaces.Remove(type);
 			}
 			serviceContainer.Remove(serviceIndex);
 
 			throw;
 		}
 
-		++nextServiceHandle.id;
 		PONY_LOG(application->Logger(), Log::LogType::Info, "Adding '{}' service done. Handle: '0x{:X}'.", typeid(*service).name(), currentHandle.id);
 
 		return currentHandle;
@@ -320,7 +313,7 @@ namespace PonyEngine::Application
 			PONY_LOG(application->Logger(), Log::LogType::Info, "Removing '{}' service...", serviceName);
 			for (const std::type_index type : serviceContainer.Interfaces(index).Types())
 			{
-				serviceInterfaces.erase(type);
+				serviceInterfaces.Remove(type);
 			}
 			for (const TickableServiceInfo& tickable : serviceContainer.TickableServices(index))
 			{
@@ -358,7 +351,7 @@ namespace PonyEngine::Application
 	}
 
 	ServiceManager::ServiceInterfaceAdder::ServiceInterfaceAdder(IApplicationContext& application, InterfaceContainer& container, 
-		std::unordered_map<std::type_index, void*>& globalContainer) noexcept :
+		Memory::FlatHashMap<std::type_index, void*>& globalContainer) noexcept :
 		application{&application},
 		container{&container},
 		globalContainer{&globalContainer}
@@ -377,7 +370,7 @@ namespace PonyEngine::Application
 		{
 			throw std::invalid_argument(std::format("Interface of type '{}' has already been added", type.name()));
 		}
-		if (globalContainer->contains(type)) [[unlikely]]
+		if (globalContainer->Contains(type)) [[unlikely]]
 		{
 			throw std::invalid_argument(std::format("Interface of type '{}' has already been added by another service", type.name()));
 		}
@@ -391,7 +384,7 @@ namespace PonyEngine::Application
 		container->Add(type, interface);
 		try
 		{
-			globalContainer->emplace(type, interface);
+			globalContainer->Emplace(type, interface);
 		}
 		catch (...)
 		{
@@ -0,0 +1,395 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+module;
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+export module PonyEngine.Hash:WyHash;
+
+import std;
+
+export namespace PonyEngine::Hash
+{
+	/// @brief WyHash data concept that is satisfied only with 1-byte arithmetic type.
+	template<typename T>
+	concept WyData = sizeof(T) == 1 && (std::is_arithmetic_v<T> || std::is_enum_v<T>);
+
+	/// @brief Computes the wyhash 64-bit hash of the @p data.
+	/// @details It's the reference wyhash final version 4 with its default secret, so the hashes match the ones of other wyhash implementations.
+	///          It reads the data by 8-byte words and mixes three independent lanes per 48-byte block,
+	///          so it's much faster than FNV-1a on anything longer than a few bytes. It's not a cryptographic hash.
+	/// @tparam Data Data type.
+	/// @param data Data.
+	/// @param seed Seed.
+	/// @return Hash.
+	template<WyData Data> [[nodiscard("Pure function")]]
+	constexpr std::uint64_t WyHash64(std::span<const Data> data, std::uint64_t seed = 0ull) noexcept;
+	/// @brief Computes the wyhash 64-bit hash of the @p data.
+	/// @details It's the reference wyhash final version 4 with its default secret, so the hashes match the ones of other wyhash implementations.
+	///          It reads the data by 8-byte words and mixes three independent lanes per 48-byte block,
+	///          so it's much faster than FNV-1a on anything longer than a few bytes. It's not a cryptographic hash.
+	/// @param data Data.
+	/// @param seed Seed.
+	/// @return Hash.
+	[[nodiscard("Pure function")]]
+	constexpr std::uint64_t WyHash64(std::string_view data, std::uint64_t seed = 0ull) noexcept;
+
+	/// @brief wyhash 64-bit hash helper.
+	/// @details It lets easily combine hashes of independent spans as if they're one span.
+	///          The result is the same as the one of @p WyHash64() with the concatenated data.
+	class WyHash64Hash final
+	{
+	public:
+		/// @brief Creates a hash helper.
+		/// @param seed Seed.
+		[[nodiscard("Pure constructor")]]
+		explicit constexpr WyHash64Hash(std::uint64_t seed = 0ull) noexcept;
+		[[nodiscard("Pure constructor")]]
+		constexpr WyHash64Hash(const WyHash64Hash& other) noexcept = default;
+		[[nodiscard("Pure constructor")]]
+		constexpr WyHash64Hash(WyHash64Hash&& other) noexcept = default;
+
+		constexpr ~WyHash64Hash() noexcept = default;
+
+		/// @brief Gets the current hash value.
+		/// @return Hash value.
+		[[nodiscard("Pure function")]]
+		constexpr std::uint64_t Hash() const noexcept;
+		/// @brief Updates the hash value with the data.
+		/// @tparam Data Data type.
+		/// @param data Data.
+		/// @return New hash value.
+		template<WyData Data>
+		constexpr std::uint64_t Hash(std::span<const Data> data) noexcept;
+		/// @brief Updates the hash value with the data.
+		/// @param data Data.
+		/// @return New hash value.
+		constexpr std::uint64_t Hash(std::string_view data) noexcept;
+
+		WyHash64Hash& operator =(const WyHash64Hash& other) noexcept = default;
+		WyHash64Hash& operator =(WyHash64Hash&& other) noexcept = default;
+
+	private:
+		static constexpr std::size_t BlockSize = 48uz; ///< Block size.
+		static constexpr std::size_t TailSize = 16uz; ///< Size of the previous block tail kept for the last read.
+
+		std::uint64_t seed; ///< Main lane.
+		std::uint64_t see1; ///< Second lane.
+		std::uint64_t see2; ///< Third lane.
+		std::uint64_t length; ///< Total data length.
+		std::array<std::byte, TailSize + BlockSize> buffer; ///< Previous block tail and pending data.
+		std::size_t pendingSize; ///< Pending data size.
+	};
+}
+
+namespace PonyEngine::Hash
+{
+	/// @brief Default wyhash secret.
+	constexpr std::array<std::uint64_t, 4> WySecret = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+	/// @brief Multiplies the @p a by the @p b and puts the low half of the 128-bit result into the @p a and the high half into the @p b.
+	/// @param a Left operand and low half.
+	/// @param b Right operand and high half.
+	constexpr void WyMultiply(std::uint64_t& a, std::uint64_t& b) noexcept;
+	/// @brief Multiplies the @p a by the @p b and folds the 128-bit result.
+	/// @param a Left operand.
+	/// @param b Right operand.
+	/// @return Folded result.
+	[[nodiscard("Pure function")]]
+	constexpr std::uint64_t WyMix(std::uint64_t a, std::uint64_t b) noexcept;
+	/// @brief Reads a little-endian 8-byte word.
+	/// @tparam Data Data type.
+	/// @param data Data.
+	/// @return Word.
+	template<WyData Data> [[nodiscard("Pure function")]]
+	constexpr std::uint64_t WyRead8(const Data* data) noexcept;
+	/// @brief Reads a little-endian 4-byte word.
+	/// @tparam Data Data type.
+	/// @param data Data.
+	/// @return Word.
+	template<WyData Data> [[nodiscard("Pure function")]]
+	constexpr std::uint64_t WyRead4(const Data* data) noexcept;
+	/// @brief Reads 1-3 bytes.
+	/// @tparam Data Data type.
+	/// @param data Data.
+	/// @param size Data size. Must be in range [1, 3].
+	/// @return Word.
+	template<WyData Data> [[nodiscard("Pure function")]]
+	constexpr std::uint64_t WyRead3(const Data* data, std::size_t size) noexcept;
+	/// @brief Converts a user seed to the initial lane value.
+	/// @param seed User seed.
+	/// @return Initial lane value.
+	[[nodiscard("Pure function")]]
+	constexpr std::uint64_t WySeed(std::uint64_t seed) noexcept;
+	/// @brief Mixes a 48-byte block into the lanes.
+	/// @tparam Data Data type.
+	/// @param data Block.
+	/// @param seed Main lane.
+	/// @param see1 Second lane.
+	/// @param see2 Third lane.
+	template<WyData Data>
+	constexpr void WyBlock(const Data* data, std::uint64_t& seed, std::uint64_t& see1, std::uint64_t& see2) noexcept;
+	/// @brief Computes the hash of data not longer than 16 bytes.
+	/// @tparam Data Data type.
+	/// @param data Data.
+	/// @param size Data size.
+	/// @param seed Main lane.
+	/// @return Hash.
+	template<WyData Data> [[nodiscard("Pure function")]]
+	constexpr std::uint64_t WyShort(const Data* data, std::size_t size, std::uint64_t seed) noexcept;
+	/// @brief Computes the hash of the data that remains after the blocks.
+	/// @tparam Data Data type.
+	/// @param data Remaining data. 16 bytes before it must be readable if the @p size is less than 16.
+	/// @param size Remaining data size.
+	/// @param seed Main lane.
+	/// @param length Total data length.
+	/// @return Hash.
+	template<WyData Data> [[nodiscard("Pure function")]]
+	constexpr std::uint64_t WyTail(const Data* data, std::size_t size, std::uint64_t seed, std::uint64_t length) noexcept;
+	/// @brief Finishes the hash.
+	/// @param a First word.
+	/// @param b Second word.
+	/// @param seed Main lane.
+	/// @param length Total data length.
+	/// @return Hash.
+	[[nodiscard("Pure function")]]
+	constexpr std::uint64_t WyFinish(std::uint64_t a, std::uint64_t b, std::uint64_t seed, std::uint64_t length) noexcept;
+
+	template<WyData Data>
+	constexpr std::uint64_t WyHash64(const std::span<const Data> data, const std::uint64_t seed) noexcept
+	{
+		std::uint64_t lane = WySeed(seed);
+		const Data* current = data.data();
+		std::size_t size = data.size();
+		if (size <= 16uz) [[likely]]
+		{
+			return WyShort(current, size, lane);
+		}
+
+		// The last block always goes to the tail, even if it's a whole one.
+		if (size > 48uz) [[unlikely]]
+		{
+			std::uint64_t see1 = lane;
+			std::uint64_t see2 = lane;
+			do
+			{
+				WyBlock(current, lane, see1, see2);
+				current += 48;
+				size -= 48uz;
+			}
+			while (size > 48uz);
+			lane ^= see1 ^ see2;
+		}
+
+		return WyTail(current, size, lane, data.size());
+	}
+
+	constexpr std::uint64_t WyHash64(const std::string_view data, const std::uint64_t seed) noexcept
+	{
+		return WyHash64(std::span(data), seed);
+	}
+
+	constexpr WyHash64Hash::WyHash64Hash(const std::uint64_t seed) noexcept :
+		seed{WySeed(seed)},
+		see1{this->seed},
+		see2{this->seed},
+		length{0ull},
+		buffer{},
+		pendingSize{0uz}
+	{
+	}
+
+	constexpr std::uint64_t WyHash64Hash::Hash() const noexcept
+	{
+		const std::byte* current = buffer.data() + TailSize;
+		if (length <= 16ull)
+		{
+			return WyShort(current, static_cast<std::size_t>(length), seed);
+		}
+
+		// The pending data is the last block, so it always goes to the tail.
+		const std::uint64_t lane = length > BlockSize ? seed ^ see1 ^ see2 : seed;
+
+		return WyTail(current, pendingSize, lane, length);
+	}
+
+	template<WyData Data>
+	constexpr std::uint64_t WyHash64Hash::Hash(const std::span<const Data> data) noexcept
+	{
+		for (std::size_t offset = 0uz; offset < data.size(); )
+		{
+			if (pendingSize == BlockSize)
+			{
+				// The block is mixed only when more data comes because the last block is handled differently.
+				WyBlock(buffer.data() + TailSize, seed, see1, see2);
+				std::ranges::copy(buffer.end() - TailSize, buffer.end(), buffer.begin());
+				pendingSize = 0uz;
+			}
+
+			const std::size_t count = std::min(BlockSize - pendingSize, data.size() - offset);
+			std::ranges::transform(data.subspan(offset, count), buffer.begin() + TailSize + pendingSize, [](const Data value) { return static_cast<std::byte>(value); });
+			pendingSize += count;
+			offset += count;
+		}
+		length += data.size();
+
+		return Hash();
+	}
+
+	constexpr std::uint64_t WyHash64Hash::Hash(const std::string_view data) noexcept
+	{
+		return Hash(std::span(data));
+	}
+
+	constexpr void WyMultiply(std::uint64_t& a, std::uint64_t& b) noexcept
+	{
+		if !consteval
+		{
+#if defined(__SIZEOF_INT128__)
+			const unsigned __int128 result = static_cast<unsigned __int128>(a) * b;
+			a = static_cast<std::uint64_t>(result);
+			b = static_cast<std::uint64_t>(result >> 64);
+			return;
+#elif defined(_MSC_VER) && defined(_M_X64)
+			a = _umul128(a, b, &b);
+			return;
+#endif
+		}
+
+		const std::uint64_t aHigh = a >> 32;
+		const std::uint64_t aLow = a & 0xFFFFFFFFull;
+		const std::uint64_t bHigh = b >> 32;
+		const std::uint64_t bLow = b & 0xFFFFFFFFull;
+		const std::uint64_t highHigh = aHigh * bHigh;
+		const std::uint64_t highLow = aHigh * bLow;
+		const std::uint64_t lowHigh = aLow * bHigh;
+		const std::uint64_t lowLow = aLow * bLow;
+		const std::uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFFull) + (lowHigh & 0xFFFFFFFFull);
+		a = (middle << 32) | (lowLow & 0xFFFFFFFFull);
+		b = highHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+	}
+
+	constexpr std::uint64_t WyMix(std::uint64_t a, std::uint64_t b) noexcept
+	{
+		WyMultiply(a, b);
+
+		return a ^ b;
+	}
+
+	template<WyData Data>
+	constexpr std::uint64_t WyRead8(const Data* const data) noexcept
+	{
+		if !consteval
+		{
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				std::uint64_t word;
+				std::memcpy(&word, data, sizeof(word));
+
+				return word;
+			}
+		}
+
+		std::uint64_t word = 0ull;
+		for (std::size_t i = 0uz; i < 8uz; ++i)
+		{
+			word |= static_cast<std::uint64_t>(static_cast<std::byte>(data[i])) << (i * 8uz);
+		}
+
+		return word;
+	}
+
+	template<WyData Data>
+	constexpr std::uint64_t WyRead4(const Data* const data) noexcept
+	{
+		if !consteval
+		{
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				std::uint32_t word;
+				std::memcpy(&word, data, sizeof(word));
+
+				return word;
+			}
+		}
+
+		std::uint64_t word = 0ull;
+		for (std::size_t i = 0uz; i < 4uz; ++i)
+		{
+			word |= static_cast<std::uint64_t>(static_cast<std::byte>(data[i])) << (i * 8uz);
+		}
+
+		return word;
+	}
+
+	template<WyData Data>
+	constexpr std::uint64_t WyRead3(const Data* const data, const std::size_t size) noexcept
+	{
+		return static_cast<std::uint64_t>(static_cast<std::byte>(data[0])) << 16 |
+			static_cast<std::uint64_t>(static_cast<std::byte>(data[size >> 1])) << 8 |
+			static_cast<std::uint64_t>(static_cast<std::byte>(data[size - 1uz]));
+	}
+
+	constexpr std::uint64_t WySeed(const std::uint64_t seed) noexcept
+	{
+		return seed ^ WyMix(seed ^ WySecret[0], WySecret[1]);
+	}
+
+	template<WyData Data>
+	constexpr void WyBlock(const Data* const data, std::uint64_t& seed, std::uint64_t& see1, std::uint64_t& see2) noexcept
+	{
+		seed = WyMix(WyRead8(data) ^ WySecret[1], WyRead8(data + 8) ^ seed);
+		see1 = WyMix(WyRead8(data + 16) ^ WySecret[2], WyRead8(data + 24) ^ see1);
+		see2 = WyMix(WyRead8(data + 32) ^ WySecret[3], WyRead8(data + 40) ^ see2);
+	}
+
+	template<WyData Data>
+	constexpr std::uint64_t WyShort(const Data* const data, const std::size_t size, const std::uint64_t seed) noexcept
+	{
+		std::uint64_t a = 0ull;
+		std::uint64_t b = 0ull;
+		if (size >= 4uz) [[likely]]
+		{
+			const std::size_t shift = (size >> 3) << 2;
+			a = WyRead4(data) << 32 | WyRead4(data + shift);
+			b = WyRead4(data + size - 4uz) << 32 | WyRead4(data + size - 4uz - shift);
+		}
+		else if (size > 0uz) [[likely]]
+		{
+			a = WyRead3(data, size);
+		}
+
+		return WyFinish(a, b, seed, size);
+	}
+
+	template<WyData Data>
+	constexpr std::uint64_t WyTail(const Data* data, std::size_t size, std::uint64_t seed, const std::uint64_t length) noexcept
+	{
+		while (size > 16uz)
+		{
+			seed = WyMix(WyRead8(data) ^ WySecret[1], WyRead8(data + 8) ^ seed);
+			data += 16;
+			size -= 16uz;
+		}
+
+		return WyFinish(WyRead8(data + size - 16), WyRead8(data + size - 8), seed, length);
+	}
+
+	constexpr std::uint64_t WyFinish(std::uint64_t a, std::uint64_t b, const std::uint64_t seed, const std::uint64_t length) noexcept
+	{
+		a ^= WySecret[1];
+		b ^= seed;
+		WyMultiply(a, b);
+
+		return WyMix(a ^ WySecret[0] ^ length, b ^ WySecret[1]);
+	}
+}
@@ -10,3 +10,4 @@
 export module PonyEngine.Hash;
 
 export import :FNV1a;
+export import :WyHash;
@@ -0,0 +1,360 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+module;
+
+#include <cassert>
+
+export module PonyEngine.Memory:AllocationTracking;
+
+import std;
+
+import :CacheLine;
+
+export namespace PonyEngine::Memory
+{
+	/// @brief Allocation tag. It groups tracked allocations, usually by an engine module.
+	struct AllocationTag final
+	{
+		std::uint32_t id = 0u; ///< Tag ID. Zero is the general tag.
+
+		[[nodiscard("Pure operator")]]
+		constexpr bool operator ==(const AllocationTag& other) const noexcept = default;
+	};
+
+	/// @brief Allocation statistics of a tag.
+	struct AllocationStatistics final
+	{
+		std::int64_t liveBytes = 0ll; ///< Currently allocated bytes.
+		std::int64_t peakBytes = 0ll; ///< Max live bytes. It's sampled on frame ends and statistics queries.
+		std::int64_t liveAllocationCount = 0ll; ///< Currently alive allocation count.
+		std::uint64_t allocationCount = 0ull; ///< Total allocation count.
+		std::uint64_t frameAllocationCount = 0ull; ///< Allocation count of the last finished frame.
+	};
+
+	constexpr std::size_t MaxAllocationTagCount = 64uz; ///< Max allocation tag count including the general tag.
+	constexpr AllocationTag GeneralAllocationTag = AllocationTag{.id = 0u}; ///< Tag of allocations that don't have a specific tag.
+
+	/// @brief Registers an allocation tag.
+	/// @param name Tag name. It must live till the end of the program, so it's usually a string literal.
+	/// @return Registered tag. If the tag with the same name is already registered, it's returned.
+	/// @note The function is thread-safe.
+	[[nodiscard("Pure function")]]
+	AllocationTag RegisterAllocationTag(std::string_view name);
+	/// @brief Gets the registered tag count including the general tag.
+	/// @return Tag count. Tag IDs are in range [0, count).
+	/// @note The function is thread-safe.
+	[[nodiscard("Pure function")]]
+	std::size_t AllocationTagCount() noexcept;
+	/// @brief Gets the tag name.
+	/// @param tag Registered tag.
+	/// @return Tag name.
+	/// @note The function is thread-safe.
+	[[nodiscard("Pure function")]]
+	std::string_view AllocationTagName(AllocationTag tag) noexcept;
+
+	/// @brief Checks if the allocation tracking is enabled.
+	/// @return @a True if it's enabled; @a false otherwise.
+	/// @note The function is thread-safe.
+	[[nodiscard("Pure function")]]
+	bool IsAllocationTrackingEnabled() noexcept;
+	/// @brief Enables or disables the allocation tracking.
+	/// @remark Allocations tracked before disabling are still untracked on deallocation.
+	/// @param enable Enable or disable.
+	/// @note The function is thread-safe.
+	void EnableAllocationTracking(bool enable) noexcept;
+
+	/// @brief Gets the allocation tag of the current thread.
+	/// @return Current allocation tag.
+	[[nodiscard("Pure function")]]
+	AllocationTag CurrentAllocationTag() noexcept;
+
+	/// @brief Sets the current thread allocation tag till the end of the scope.
+	class AllocationTagScope final
+	{
+	public:
+		/// @brief Sets the @p tag as the current one.
+		/// @param tag Allocation tag.
+		[[nodiscard("Pure constructor")]]
+		explicit AllocationTagScope(AllocationTag tag) noexcept;
+		AllocationTagScope(const AllocationTagScope&) = delete;
+		AllocationTagScope(AllocationTagScope&&) = delete;
+
+		/// @brief Restores the previous tag.
+		~AllocationTagScope() noexcept;
+
+		AllocationTagScope& operator =(const AllocationTagScope&) = delete;
+		AllocationTagScope& operator =(AllocationTagScope&&) = delete;
+
+	private:
+		AllocationTag previousTag; ///< Previous allocation tag.
+	};
+
+	/// @brief Tracks an allocation.
+	/// @details It's an allocator hook. It only touches counters of the current thread, so it never locks or contends.
+	/// @param tag Allocation tag.
+	/// @param size Allocation size.
+	/// @return @a True if it's tracked; @a false if the tracking is disabled. The deallocation must be tracked only in the former case.
+	/// @note The function is thread-safe.
+	bool TrackAllocation(AllocationTag tag, std::size_t size) noexcept;
+	/// @brief Tracks a deallocation.
+	/// @details It's an allocator hook. It may be called on any thread, not necessarily on the allocating one.
+	/// @param tag Allocation tag. It must be the same as on the allocation.
+	/// @param size Allocation size. It must be the same as on the allocation.
+	/// @note The function is thread-safe.
+	void TrackDeallocation(AllocationTag tag, std::size_t size) noexcept;
+
+	/// @brief Gets the allocation statistics of the @p tag.
+	/// @param tag Registered tag.
+	/// @return Allocation statistics.
+	/// @note The function is thread-safe.
+	[[nodiscard("Pure function")]]
+	AllocationStatistics GetAllocationStatistics(AllocationTag tag) noexcept;
+	/// @brief Finishes an allocation frame. It updates the frame allocation counts and the peaks.
+	/// @note Must be called on one thread only, usually the main one on every frame end.
+	void FinishAllocationFrame() noexcept;
+}
+
+namespace PonyEngine::Memory
+{
+	/// @brief Allocation counters of a tag in a shard.
+	/// @details They're written only by the shard owner, so they don't need read-modify-write operations.
+	///          A deallocation on a thread that didn't allocate makes the live values of its shard negative, but the sum of all shards is correct.
+	struct AllocationCounters final
+	{
+		std::atomic<std::int64_t> liveBytes; ///< Live bytes.
+		std::atomic<std::int64_t> liveAllocationCount; ///< Live allocation count.
+		std::atomic<std::uint64_t> allocationCount; ///< Total allocation count.
+	};
+
+	/// @brief Per-thread allocation counters.
+	/// @remark Shards are never destroyed because their counters are needed after their threads are finished.
+	struct alignas(CacheLineSize) AllocationShard final
+	{
+		std::array<AllocationCounters, MaxAllocationTagCount> counters; ///< Counters by tag ID.
+		AllocationShard* next; ///< Next shard.
+	};
+
+	/// @brief Frame state of a tag.
+	struct AllocationFrameState final
+	{
+		std::atomic<std::int64_t> peakBytes; ///< Peak bytes.
+		std::atomic<std::uint64_t> lastAllocationCount; ///< Total allocation count on the last frame end.
+		std::atomic<std::uint64_t> frameAllocationCount; ///< Allocation count of the last finished frame.
+	};
+
+	/// @brief Adds the @p delta to the @p counter. It must be called only by the counter writer.
+	/// @tparam T Counter type.
+	/// @param counter Counter.
+	/// @param delta Delta.
+	template<typename T>
+	void AddToCounter(std::atomic<T>& counter, std::type_identity_t<T> delta) noexcept;
+	/// @brief Raises the @p peak to the @p value.
+	/// @param peak Peak.
+	/// @param value Value.
+	void RaisePeak(std::atomic<std::int64_t>& peak, std::int64_t value) noexcept;
+
+	/// @brief Gets the current thread shard. It creates a shard if the thread doesn't have one.
+	/// @return Shard or nullptr if it's being created.
+	[[nodiscard("Pure function")]]
+	AllocationShard* CurrentAllocationShard() noexcept;
+	/// @brief Sums the counters of the @p tag over all the shards.
+	/// @param tag Allocation tag.
+	/// @return Statistics without frame values.
+	[[nodiscard("Pure function")]]
+	AllocationStatistics SumAllocationCounters(AllocationTag tag) noexcept;
+
+	std::atomic<bool> allocationTrackingEnabled = false; ///< Is the tracking enabled?
+	std::atomic<AllocationShard*> allocationShards = nullptr; ///< Shard list.
+	std::array<AllocationFrameState, MaxAllocationTagCount> allocationFrameStates; ///< Frame states by tag ID.
+
+	std::mutex allocationTagMutex; ///< Tag registration mutex.
+	std::array<std::string_view, MaxAllocationTagCount> allocationTagNames = {"General"}; ///< Tag names by tag ID.
+	std::atomic<std::size_t> allocationTagCount = 1uz; ///< Registered tag count.
+
+	thread_local AllocationTag currentAllocationTag = GeneralAllocationTag; ///< Current thread allocation tag.
+	thread_local AllocationShard* currentAllocationShard = nullptr; ///< Current thread shard.
+	thread_local bool isCreatingAllocationShard = false; ///< Is the current thread creating its shard? Allocations in that time aren't tracked.
+
+	AllocationTag RegisterAllocationTag(const std::string_view name)
+	{
+		const auto lock = std::lock_guard(allocationTagMutex);
+
+		const std::size_t count = allocationTagCount.load(std::memory_order_relaxed);
+		for (std::size_t i = 0uz; i < count; ++i)
+		{
+			if (allocationTagNames[i] == name)
+			{
+				return AllocationTag{.id = static_cast<std::uint32_t>(i)};
+			}
+		}
+
+		if (count >= MaxAllocationTagCount) [[unlikely]]
+		{
+			throw std::length_error("Too many allocation tags");
+		}
+
+		allocationTagNames[count] = name;
+		allocationTagCount.store(count + 1uz, std::memory_order_release);
+
+		return AllocationTag{.id = static_cast<std::uint32_t>(count)};
+	}
+
+	std::size_t AllocationTagCount() noexcept
+	{
+		return allocationTagCount.load(std::memory_order_acquire);
+	}
+
+	std::string_view AllocationTagName(const AllocationTag tag) noexcept
+	{
+		assert(tag.id < AllocationTagCount() && "The allocation tag isn't registered.");
+
+		return allocationTagNames[tag.id];
+	}
+
+	bool IsAllocationTrackingEnabled() noexcept
+	{
+		return allocationTrackingEnabled.load(std::memory_order_relaxed);
+	}
+
+	void EnableAllocationTracking(const bool enable) noexcept
+	{
+		allocationTrackingEnabled.store(enable, std::memory_order_relaxed);
+	}
+
+	AllocationTag CurrentAllocationTag() noexcept
+	{
+		return currentAllocationTag;
+	}
+
+	AllocationTagScope::AllocationTagScope(const AllocationTag tag) noexcept :
+		previousTag{std::exchange(currentAllocationTag, tag)}
+	{
+	}
+
+	AllocationTagScope::~AllocationTagScope() noexcept
+	{
+		currentAllocationTag = previousTag;
+	}
+
+	bool TrackAllocation(const AllocationTag tag, const std::size_t size) noexcept
+	{
+		if (!IsAllocationTrackingEnabled())
+		{
+			return false;
+		}
+
+		AllocationShard* const shard = CurrentAllocationShard();
+		if (!shard)
+		{
+			return false;
+		}
+
+		AllocationCounters& counters = shard->counters[tag.id];
+		AddToCounter(counters.liveBytes, static_cast<std::int64_t>(size));
+		AddToCounter(counters.liveAllocationCount, 1ll);
+		AddToCounter(counters.allocationCount, 1ull);
+
+		return true;
+	}
+
+	void TrackDeallocation(const AllocationTag tag, const std::size_t size) noexcept
+	{
+		AllocationShard* const shard = CurrentAllocationShard();
+		if (!shard) [[unlikely]]
+		{
+			// It happens only if there's no memory for a shard. The statistics become a bit off, but it's better than a crash in an allocator.
+			return;
+		}
+
+		AllocationCounters& counters = shard->counters[tag.id];
+		AddToCounter(counters.liveBytes, -static_cast<std::int64_t>(size));
+		AddToCounter(counters.liveAllocationCount, -1ll);
+	}
+
+	AllocationStatistics GetAllocationStatistics(const AllocationTag tag) noexcept
+	{
+		assert(tag.id < AllocationTagCount() && "The allocation tag isn't registered.");
+
+		AllocationStatistics statistics = SumAllocationCounters(tag);
+		AllocationFrameState& frameState = allocationFrameStates[tag.id];
+		RaisePeak(frameState.peakBytes, statistics.liveBytes);
+		statistics.peakBytes = frameState.peakBytes.load(std::memory_order_relaxed);
+		statistics.frameAllocationCount = frameState.frameAllocationCount.load(std::memory_order_relaxed);
+
+		return statistics;
+	}
+
+	void FinishAllocationFrame() noexcept
+	{
+		for (std::size_t i = 0uz, count = AllocationTagCount(); i < count; ++i)
+		{
+			const AllocationStatistics statistics = SumAllocationCounters(AllocationTag{.id = static_cast<std::uint32_t>(i)});
+			AllocationFrameState& frameState = allocationFrameStates[i];
+			RaisePeak(frameState.peakBytes, statistics.liveBytes);
+			frameState.frameAllocationCount.store(statistics.allocationCount - frameState.lastAllocationCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			frameState.lastAllocationCount.store(statistics.allocationCount, std::memory_order_relaxed);
+		}
+	}
+
+	template<typename T>
+	void AddToCounter(std::atomic<T>& counter, const std::type_identity_t<T> delta) noexcept
+	{
+		counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+	}
+
+	void RaisePeak(std::atomic<std::int64_t>& peak, const std::int64_t value) noexcept
+	{
+		for (std::int64_t current = peak.load(std::memory_order_relaxed); current < value && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed); )
+		{
+		}
+	}
+
+	AllocationShard* CurrentAllocationShard() noexcept
+	{
+		if (currentAllocationShard) [[likely]]
+		{
+			return currentAllocationShard;
+		}
+		if (isCreatingAllocationShard)
+		{
+			return nullptr;
+		}
+
+		isCreatingAllocationShard = true;
+		AllocationShard* const shard = new(std::nothrow) AllocationShard{};
+		isCreatingAllocationShard = false;
+		if (!shard) [[unlikely]]
+		{
+			return nullptr;
+		}
+
+		shard->next = allocationShards.load(std::memory_order_relaxed);
+		while (!allocationShards.compare_exchange_weak(shard->next, shard, std::memory_order_release, std::memory_order_relaxed))
+		{
+		}
+		currentAllocationShard = shard;
+
+		return shard;
+	}
+
+	AllocationStatistics SumAllocationCounters(const AllocationTag tag) noexcept
+	{
+		auto statistics = AllocationStatistics{};
+		for (const AllocationShard* shard = allocationShards.load(std::memory_order_acquire); shard; shard = shard->next)
+		{
+			const AllocationCounters& counters = shard->counters[tag.id];
+			statistics.liveBytes += counters.liveBytes.load(std::memory_order_relaxed);
+			statistics.liveAllocationCount += counters.liveAllocationCount.load(std::memory_order_relaxed);
+			statistics.allocationCount += counters.allocationCount.load(std::memory_order_relaxed);
+		}
+
+		return statistics;
+	}
+}
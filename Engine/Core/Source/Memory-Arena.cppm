@@ -17,6 +17,8 @@ import std;
 
 import PonyEngine.Math;
 
+import :AllocationTracking;
+
 export namespace PonyEngine::Memory
 {
 	/// @brief The concept is satisfied for pure data types.
@@ -55,8 +57,9 @@ export namespace PonyEngine::Memory
 		/// @brief Creates an arena.
 		/// @param alignment Arena array alignment. It must be at least an alignment of @p std::max_align_t.
 		/// @param reserve Reserve size.
+		/// @param tag Allocation tag of the arena memory. The current thread tag is used by default.
 		[[nodiscard("Pure constructor")]]
-		explicit Arena(std::size_t alignment, std::size_t reserve = 0uz);
+		explicit Arena(std::size_t alignment, std::size_t reserve = 0uz, AllocationTag tag = CurrentAllocationTag());
 		[[nodiscard("Pure constructor")]]
 		Arena(const Arena& other);
 		[[nodiscard("Pure constructor")]]
@@ -69,6 +72,11 @@ export namespace PonyEngine::Memory
 		[[nodiscard("Pure function")]]
 		std::size_t Alignment() const noexcept;
 
+		/// @brief Gets the allocation tag.
+		/// @return Allocation tag.
+		[[nodiscard("Pure function")]]
+		AllocationTag Tag() const noexcept;
+
 		/// @brief Gets the size.
 		/// @return Size.
 		[[nodiscard("Pure function")]]
@@ -190,9 +198,10 @@ export namespace PonyEngine::Memory
 		/// @brief Creates data array.
 		/// @param alignment Data alignment.
 		/// @param size Data size.
+		/// @param tag Allocation tag.
 		/// @return Data array.
 		[[nodiscard("Pure function")]]
-		static std::unique_ptr<std::byte[], DataDeleter> CreateData(std::size_t alignment, std::size_t size);
+		static std::unique_ptr<std::byte[], DataDeleter> CreateData(std::size_t alignment, std::size_t size, AllocationTag tag);
 		/// @brief Allocates new data.
 		/// @param alignment Data alignment. It must be power of two and can't be more than the arena alignment.
 		/// @param size Data size.
@@ -202,6 +211,7 @@ export namespace PonyEngine::Memory
 		Slice<std::byte> AllocateRaw(std::size_t alignment, std::size_t size, std::size_t count);
 
 		std::unique_ptr<std::byte[], DataDeleter> data; ///< Data array.
+		AllocationTag tag; ///< Allocation tag.
 		std::size_t capacity; ///< Data capacity.
 		std::size_t size; ///< Data size.
 	};
@@ -209,16 +219,17 @@ export namespace PonyEngine::Memory
 
 namespace PonyEngine::Memory
 {
-	Arena::Arena(const std::size_t alignment, const std::size_t reserve)
+	Arena::Arena(const std::size_t alignment, const std::size_t reserve, const AllocationTag tag) :
+		tag{tag}
 	{
 		const std::size_t actualAlignment = std::bit_ceil(std::max(alignment, alignof(std::max_align_t)));
-		data = CreateData(actualAlignment, reserve);
+		data = CreateData(actualAlignment, reserve, tag);
 		capacity = reserve;
 		size = 0uz;
 	}
 
 	Arena::Arena(const Arena& other) :
-		Arena(other.Alignment(), other.Size())
+		Arena(other.Alignment(), other.Size(), other.Tag())
 	{
 		std::memcpy(data.get(), other.Data(), Capacity());
 		size = Capacity();
@@ -229,6 +240,11 @@ namespace PonyEngine::Memory
 		return data.get_deleter().alignment;
 	}
 
+	AllocationTag Arena::Tag() const noexcept
+	{
+		return tag;
+	}
+
 	std::size_t Arena::Size() const noexcept
 	{
 		return size;
@@ -246,7 +262,7 @@ namespace PonyEngine::Memory
 			return;
 		}
 
-		std::unique_ptr<std::byte[], DataDeleter> newData = CreateData(Alignment(), reserve);
+		std::unique_ptr<std::byte[], DataDeleter> newData = CreateData(Alignment(), reserve, tag);
 		std::memcpy(newData.get(), data.get(), size);
 		data = std::move(newData);
 		capacity = reserve;
@@ -259,7 +275,7 @@ namespace PonyEngine::Memory
 			return;
 		}
 
-		std::unique_ptr<std::byte[], DataDeleter> newData = CreateData(alignment, capacity);
+		std::unique_ptr<std::byte[], DataDeleter> newData = CreateData(alignment, capacity, tag);
 		std::memcpy(newData.get(), data.get(), size);
 		data = std::move(newData);
 	}
@@ -399,8 +415,10 @@ namespace PonyEngine::Memory
 		operator delete[](ptr, std::align_val_t{alignment});
 	}
 
-	std::unique_ptr<std::byte[], Arena::DataDeleter> Arena::CreateData(const std::size_t alignment, const std::size_t size)
+	std::unique_ptr<std::byte[], Arena::DataDeleter> Arena::CreateData(const std::size_t alignment, const std::size_t size, const AllocationTag tag)
 	{
+		const auto tagScope = AllocationTagScope(tag);
+
 		return std::unique_ptr<std::byte[], DataDeleter>(static_cast<std::byte*>(operator new[](size, std::align_val_t{alignment})), DataDeleter{.alignment = alignment});
 	}
 
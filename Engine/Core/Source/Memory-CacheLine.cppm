@@ -0,0 +1,19 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Memory:CacheLine;
+
+import std;
+
+export namespace PonyEngine::Memory
+{
+	/// @brief Cache line size that is used to separate data written by different threads.
+	/// @details It's a fixed value instead of @p std::hardware_destructive_interference_size to keep the layout the same for all compilers and flags.
+	constexpr std::size_t CacheLineSize = 64uz;
+}
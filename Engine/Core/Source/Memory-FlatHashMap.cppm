@@ -0,0 +1,951 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+module;
+
+#include <cassert>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define PONY_ENGINE_FLAT_HASH_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+export module PonyEngine.Memory:FlatHashMap;
+
+import std;
+
+namespace PonyEngine::Memory
+{
+	/// @brief Key type a hash map can look up with.
+	/// @details It's the key type, a type convertible to it or any type if both the hash and the equality comparer are transparent.
+	/// @tparam K Lookup key type.
+	/// @tparam Key Key type.
+	/// @tparam Hash Hash function type.
+	/// @tparam Equal Equality comparer type.
+	template<typename K, typename Key, typename Hash, typename Equal>
+	concept HashLookupKey = std::is_convertible_v<const K&, const Key&> || requires
+	{
+		typename Hash::is_transparent;
+		typename Equal::is_transparent;
+	};
+}
+
+export namespace PonyEngine::Memory
+{
+	/// @brief Open-addressing hash map.
+	/// @details It keeps the entries in one flat array and a parallel array of one-byte control values.
+	///          A control value of a full slot holds 7 bits of the key hash, so a lookup compares a group of 16 control values at once (with SSE2 where it's available)
+	///          and touches an entry only on a probable match. Adding an entry allocates only when the map grows.
+	///          The entries never move until a rehash: pointers and iterators stay valid and the iteration order stays the same till the capacity changes or @p Rehash() is called.
+	///          The max load factor is 7/8. A removed entry may leave a tombstone that is purged on the next rehash.
+	/// @tparam Key Key type. Keys are copied on a rehash if the entry isn't nothrow move constructible.
+	/// @tparam Value Value type.
+	/// @tparam Hash Hash function type. If it and the @p Equal have @p is_transparent, the map supports heterogeneous lookup.
+	/// @tparam Equal Equality comparer type.
+	template<typename Key, typename Value, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
+	class FlatHashMap final
+	{
+	public:
+		using Entry = std::pair<const Key, Value>; ///< Entry type.
+
+		/// @brief Entry iterator.
+		/// @tparam IsConst Is the entry constant?
+		template<bool IsConst>
+		class Iterator final
+		{
+		public:
+			using iterator_concept = std::forward_iterator_tag;
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = Entry;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<IsConst, const Entry*, Entry*>;
+			using reference = std::conditional_t<IsConst, const Entry&, Entry&>;
+
+			[[nodiscard("Pure constructor")]]
+			Iterator() noexcept = default;
+			[[nodiscard("Pure constructor")]]
+			Iterator(const Iterator& other) noexcept = default;
+			[[nodiscard("Pure constructor")]]
+			Iterator(Iterator&& other) noexcept = default;
+
+			~Iterator() noexcept = default;
+
+			/// @brief Converts to a constant iterator.
+			[[nodiscard("Pure operator")]]
+			operator Iterator<true>() const noexcept requires (!IsConst);
+
+			/// @brief Gets the entry.
+			/// @return Entry.
+			[[nodiscard("Pure operator")]]
+			reference operator *() const noexcept;
+			/// @brief Gets the entry.
+			/// @return Entry.
+			[[nodiscard("Pure operator")]]
+			pointer operator ->() const noexcept;
+
+			/// @brief Moves to the next entry.
+			/// @return This.
+			Iterator& operator ++() noexcept;
+			/// @brief Moves to the next entry.
+			/// @return Previous iterator.
+			Iterator operator ++(int) noexcept;
+
+			Iterator& operator =(const Iterator& other) noexcept = default;
+			Iterator& operator =(Iterator&& other) noexcept = default;
+
+			[[nodiscard("Pure operator")]]
+			bool operator ==(const Iterator& other) const noexcept;
+
+		private:
+			/// @brief Creates an iterator and moves it to the first full slot starting from the @p index.
+			/// @param controls Control values.
+			/// @param entries Entries.
+			/// @param index Slot index.
+			/// @param capacity Slot count.
+			[[nodiscard("Pure constructor")]]
+			Iterator(const std::int8_t* controls, pointer entries, std::size_t index, std::size_t capacity) noexcept;
+
+			/// @brief Moves to the first full slot starting from the current one.
+			void SkipFree() noexcept;
+
+			const std::int8_t* controls = nullptr; ///< Control values.
+			pointer entries = nullptr; ///< Entries.
+			std::size_t index = 0uz; ///< Slot index.
+			std::size_t capacity = 0uz; ///< Slot count.
+
+			friend FlatHashMap;
+			friend Iterator<!IsConst>;
+		};
+
+		[[nodiscard("Pure constructor")]]
+		FlatHashMap() noexcept = default;
+		/// @brief Creates an empty map that can hold the @p count entries without a rehash.
+		/// @param count Entry count.
+		[[nodiscard("Pure constructor")]]
+		explicit FlatHashMap(std::size_t count);
+		[[nodiscard("Pure constructor")]]
+		FlatHashMap(const FlatHashMap& other);
+		[[nodiscard("Pure constructor")]]
+		FlatHashMap(FlatHashMap&& other) noexcept;
+
+		~FlatHashMap() noexcept;
+
+		/// @brief Gets the entry count.
+		/// @return Entry count.
+		[[nodiscard("Pure function")]]
+		std::size_t Size() const noexcept;
+		/// @brief Checks if the map is empty.
+		/// @return @a True if it's empty; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool IsEmpty() const noexcept;
+		/// @brief Gets the slot count.
+		/// @return Slot count. It's zero or a power of two.
+		[[nodiscard("Pure function")]]
+		std::size_t Capacity() const noexcept;
+
+		/// @brief Makes the map able to hold the @p count entries without a rehash.
+		/// @param count Entry count.
+		void Reserve(std::size_t count);
+		/// @brief Rehashes the map into the smallest capacity that holds the @p count entries and the current ones. It purges the tombstones.
+		/// @param count Entry count. Zero means to shrink the map to fit the current entries.
+		void Rehash(std::size_t count);
+
+		/// @brief Finds a value by the @p key.
+		/// @tparam K Lookup key type.
+		/// @param key Key.
+		/// @return Value; nullptr if not found.
+		template<HashLookupKey<Key, Hash, Equal> K> [[nodiscard("Pure function")]]
+		Value* Find(const K& key);
+		/// @brief Finds a value by the @p key.
+		/// @tparam K Lookup key type.
+		/// @param key Key.
+		/// @return Value; nullptr if not found.
+		template<HashLookupKey<Key, Hash, Equal> K> [[nodiscard("Pure function")]]
+		const Value* Find(const K& key) const;
+		/// @brief Checks if the map contains the @p key.
+		/// @tparam K Lookup key type.
+		/// @param key Key.
+		/// @return @a True if it contains; @a false otherwise.
+		template<HashLookupKey<Key, Hash, Equal> K> [[nodiscard("Pure function")]]
+		bool Contains(const K& key) const;
+
+		/// @brief Constructs a value in place if the map doesn't contain the @p key.
+		/// @tparam Args Argument types.
+		/// @param key Key.
+		/// @param args Value constructor arguments. They're untouched if the key is already in the map.
+		/// @return Value with the key and @a true if it's added; the existing value and @a false otherwise.
+		template<typename... Args>
+		std::pair<Value*, bool> Emplace(const Key& key, Args&&... args);
+		/// @brief Constructs a value in place if the map doesn't contain the @p key.
+		/// @tparam Args Argument types.
+		/// @param key Key.
+		/// @param args Value constructor arguments. They're untouched if the key is already in the map.
+		/// @return Value with the key and @a true if it's added; the existing value and @a false otherwise.
+		template<typename... Args>
+		std::pair<Value*, bool> Emplace(Key&& key, Args&&... args);
+		/// @brief Adds the @p value or assigns it to the existing one.
+		/// @tparam V Value type.
+		/// @param key Key.
+		/// @param value Value.
+		/// @return Value with the key and @a true if it's added; @a false if it's assigned.
+		template<typename V>
+		std::pair<Value*, bool> InsertOrAssign(const Key& key, V&& value);
+		/// @brief Adds the @p value or assigns it to the existing one.
+		/// @tparam V Value type.
+		/// @param key Key.
+		/// @param value Value.
+		/// @return Value with the key and @a true if it's added; @a false if it's assigned.
+		template<typename V>
+		std::pair<Value*, bool> InsertOrAssign(Key&& key, V&& value);
+		/// @brief Removes an entry with the @p key.
+		/// @tparam K Lookup key type.
+		/// @param key Key.
+		/// @return @a True if it's removed; @a false if the map doesn't contain the key.
+		template<HashLookupKey<Key, Hash, Equal> K>
+		bool Remove(const K& key);
+		/// @brief Removes an entry the @p position points to.
+		/// @param position Entry iterator.
+		/// @return Iterator to the next entry.
+		Iterator<false> Remove(Iterator<true> position) noexcept;
+		/// @brief Removes all the entries. It keeps the capacity.
+		void Clear() noexcept;
+
+		/// @brief Gets an iterator to the first entry.
+		/// @return Iterator.
+		[[nodiscard("Pure function")]]
+		Iterator<false> begin() noexcept;
+		/// @brief Gets an iterator to the first entry.
+		/// @return Iterator.
+		[[nodiscard("Pure function")]]
+		Iterator<true> begin() const noexcept;
+		/// @brief Gets an iterator past the last entry.
+		/// @return Iterator.
+		[[nodiscard("Pure function")]]
+		Iterator<false> end() noexcept;
+		/// @brief Gets an iterator past the last entry.
+		/// @return Iterator.
+		[[nodiscard("Pure function")]]
+		Iterator<true> end() const noexcept;
+
+		FlatHashMap& operator =(const FlatHashMap& other);
+		FlatHashMap& operator =(FlatHashMap&& other) noexcept;
+
+	private:
+		/// @brief Finds a slot of the @p key.
+		/// @tparam K Lookup key type.
+		/// @param key Key.
+		/// @param hash Mixed key hash.
+		/// @return Slot index; @p capacity if not found.
+		template<typename K> [[nodiscard("Pure function")]]
+		std::size_t FindSlot(const K& key, std::size_t hash) const;
+		/// @brief Constructs a value in place if the map doesn't contain the @p key.
+		/// @tparam K Key type.
+		/// @tparam Args Argument types.
+		/// @param key Key.
+		/// @param args Value constructor arguments.
+		/// @return Value with the key and @a true if it's added; the existing value and @a false otherwise.
+		template<typename K, typename... Args>
+		std::pair<Value*, bool> EmplaceKey(K&& key, Args&&... args);
+		/// @brief Removes an entry at the @p slot.
+		/// @param slot Full slot index.
+		void RemoveSlot(std::size_t slot) noexcept;
+
+		/// @brief Moves the entries into new buffers of the @p newCapacity.
+		/// @param newCapacity New capacity. It must be a power of two not less than the group width and hold all the entries.
+		void Resize(std::size_t newCapacity);
+		/// @brief Destroys the entries and frees the buffers.
+		void Free() noexcept;
+
+		/// @brief Computes a mixed hash of the @p key.
+		/// @tparam K Key type.
+		/// @param key Key.
+		/// @return Mixed hash.
+		template<typename K> [[nodiscard("Pure function")]]
+		std::size_t HashOf(const K& key) const;
+
+		std::unique_ptr<std::int8_t[]> controls; ///< Control values. There're group width - 1 extra values at the end that mirror the first ones, so a group never wraps.
+		Entry* entries = nullptr; ///< Entries. Only the full slots are constructed.
+		std::size_t capacity = 0uz; ///< Slot count.
+		std::size_t size = 0uz; ///< Entry count.
+		std::size_t growthLeft = 0uz; ///< Count of the empty slots that may be filled before a rehash.
+		[[no_unique_address]] Hash hasher; ///< Hash function.
+		[[no_unique_address]] Equal equal; ///< Equality comparer.
+	};
+}
+
+namespace PonyEngine::Memory
+{
+	constexpr std::size_t ControlGroupWidth = 16uz; ///< Control value count in a group.
+	constexpr std::int8_t EmptyControl = -128; ///< Control value of an empty slot.
+	constexpr std::int8_t DeletedControl = -2; ///< Control value of a tombstone. A full slot has a non-negative control value.
+
+	/// @brief Group of control values.
+	class ControlGroup final
+	{
+	public:
+		/// @brief Loads a group.
+		/// @param controls First control value. It may be unaligned.
+		[[nodiscard("Pure constructor")]]
+		explicit ControlGroup(const std::int8_t* controls) noexcept;
+
+		/// @brief Finds the control values equal to the @p control.
+		/// @param control Control value.
+		/// @return Bit mask. A bit is set for every match.
+		[[nodiscard("Pure function")]]
+		std::uint32_t Match(std::int8_t control) const noexcept;
+		/// @brief Finds the empty slots.
+		/// @return Bit mask. A bit is set for every empty slot.
+		[[nodiscard("Pure function")]]
+		std::uint32_t MatchEmpty() const noexcept;
+		/// @brief Finds the empty slots and tombstones.
+		/// @return Bit mask. A bit is set for every empty slot and tombstone.
+		[[nodiscard("Pure function")]]
+		std::uint32_t MatchFree() const noexcept;
+
+	private:
+#ifdef PONY_ENGINE_FLAT_HASH_MAP_SSE2
+		__m128i controls; ///< Control values.
+#else
+		std::array<std::int8_t, ControlGroupWidth> controls; ///< Control values.
+#endif
+	};
+
+	/// @brief Mixes the @p hash so that its high and low bits depend on all the bits of the source hash.
+	/// @param hash Hash.
+	/// @return Mixed hash.
+	[[nodiscard("Pure function")]]
+	constexpr std::size_t MixHash(std::size_t hash) noexcept;
+	/// @brief Gets a probe start of the @p hash.
+	/// @param hash Mixed hash.
+	/// @return Probe start.
+	[[nodiscard("Pure function")]]
+	constexpr std::size_t ProbeStart(std::size_t hash) noexcept;
+	/// @brief Gets a control value of the @p hash.
+	/// @param hash Mixed hash.
+	/// @return Control value.
+	[[nodiscard("Pure function")]]
+	constexpr std::int8_t HashControl(std::size_t hash) noexcept;
+
+	/// @brief Gets a max entry count of the @p capacity.
+	/// @param capacity Capacity.
+	/// @return Max entry count.
+	[[nodiscard("Pure function")]]
+	constexpr std::size_t MaxLoad(std::size_t capacity) noexcept;
+	/// @brief Gets the smallest capacity that holds the @p count entries.
+	/// @param count Entry count.
+	/// @return Capacity.
+	[[nodiscard("Pure function")]]
+	constexpr std::size_t CapacityFor(std::size_t count) noexcept;
+
+	/// @brief Finds a free slot for the @p hash.
+	/// @param controls Control values.
+	/// @param capacity Capacity.
+	/// @param hash Mixed hash.
+	/// @return Slot index.
+	[[nodiscard("Pure function")]]
+	std::size_t FindFreeSlot(const std::int8_t* controls, std::size_t capacity, std::size_t hash) noexcept;
+	/// @brief Sets the control value of the @p slot and its mirror.
+	/// @param controls Control values.
+	/// @param capacity Capacity.
+	/// @param slot Slot index.
+	/// @param control Control value.
+	void SetControl(std::int8_t* controls, std::size_t capacity, std::size_t slot, std::int8_t control) noexcept;
+
+	ControlGroup::ControlGroup(const std::int8_t* const controls) noexcept
+	{
+#ifdef PONY_ENGINE_FLAT_HASH_MAP_SSE2
+		this->controls = _mm_loadu_si128(reinterpret_cast<const __m128i*>(controls));
+#else
+		std::copy_n(controls, ControlGroupWidth, this->controls.data());
+#endif
+	}
+
+	std::uint32_t ControlGroup::Match(const std::int8_t control) const noexcept
+	{
+#ifdef PONY_ENGINE_FLAT_HASH_MAP_SSE2
+		return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(controls, _mm_set1_epi8(control))));
+#else
+		std::uint32_t mask = 0u;
+		for (std::size_t i = 0uz; i < ControlGroupWidth; ++i)
+		{
+			mask |= static_cast<std::uint32_t>(controls[i] == control) << i;
+		}
+
+		return mask;
+#endif
+	}
+
+	std::uint32_t ControlGroup::MatchEmpty() const noexcept
+	{
+		return Match(EmptyControl);
+	}
+
+	std::uint32_t ControlGroup::MatchFree() const noexcept
+	{
+#ifdef PONY_ENGINE_FLAT_HASH_MAP_SSE2
+		return static_cast<std::uint32_t>(_mm_movemask_epi8(controls));
+#else
+		std::uint32_t mask = 0u;
+		for (std::size_t i = 0uz; i < ControlGroupWidth; ++i)
+		{
+			mask |= static_cast<std::uint32_t>(controls[i] < 0) << i;
+		}
+
+		return mask;
+#endif
+	}
+
+	constexpr std::size_t MixHash(const std::size_t hash) noexcept
+	{
+		const std::uint64_t mixed = static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+		return static_cast<std::size_t>(mixed ^ mixed >> 32);
+	}
+
+	constexpr std::size_t ProbeStart(const std::size_t hash) noexcept
+	{
+		return hash >> 7;
+	}
+
+	constexpr std::int8_t HashControl(const std::size_t hash) noexcept
+	{
+		return static_cast<std::int8_t>(hash & 0x7Fuz);
+	}
+
+	constexpr std::size_t MaxLoad(const std::size_t capacity) noexcept
+	{
+		return capacity - capacity / 8uz;
+	}
+
+	constexpr std::size_t CapacityFor(const std::size_t count) noexcept
+	{
+		std::size_t capacity = ControlGroupWidth;
+		while (MaxLoad(capacity) < count)
+		{
+			capacity *= 2uz;
+		}
+
+		return capacity;
+	}
+
+	std::size_t FindFreeSlot(const std::int8_t* const controls, const std::size_t capacity, const std::size_t hash) noexcept
+	{
+		const std::size_t mask = capacity - 1uz;
+		std::size_t offset = ProbeStart(hash) & mask;
+		for (std::size_t step = ControlGroupWidth; ; step += ControlGroupWidth)
+		{
+			if (const std::uint32_t free = ControlGroup(controls + offset).MatchFree())
+			{
+				return (offset + std::countr_zero(free)) & mask;
+			}
+
+			offset = (offset + step) & mask;
+		}
+	}
+
+	void SetControl(std::int8_t* const controls, const std::size_t capacity, const std::size_t slot, const std::int8_t control) noexcept
+	{
+		controls[slot] = control;
+		controls[((slot - (ControlGroupWidth - 1uz)) & (capacity - 1uz)) + (ControlGroupWidth - 1uz)] = control;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<bool IsConst>
+	FlatHashMap<Key, Value, Hash, Equal>::Iterator<IsConst>::Iterator(const std::int8_t* const controls, const pointer entries, const std::size_t index, const std::size_t capacity) noexcept :
+		controls{controls},
+		entries{entries},
+		index{index},
+		capacity{capacity}
+	{
+		SkipFree();
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<bool IsConst>
+	FlatHashMap<Key, Value, Hash, Equal>::Iterator<IsConst>::operator Iterator<true>() const noexcept requires (!IsConst)
+	{
+		return Iterator<true>(controls, entries, index, capacity);
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<bool IsConst>
+	typename FlatHashMap<Key, Value, Hash, Equal>::template Iterator<IsConst>::reference FlatHashMap<Key, Value, Hash, Equal>::Iterator<IsConst>::operator *() const noexcept
+	{
+		assert(index < capacity && "The iterator is out of range.");
+
+		return entries[index];
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<bool IsConst>
+	typename FlatHashMap<Key, Value, Hash, Equal>::template Iterator<IsConst>::pointer FlatHashMap<Key, Value, Hash, Equal>::Iterator<IsConst>::operator ->() const noexcept
+	{
+		assert(index < capacity && "The iterator is out of range.");
+
+		return entries + index;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<bool IsConst>
+	typename FlatHashMap<Key, Value, Hash, Equal>::template Iterator<IsConst>& FlatHashMap<Key, Value, Hash, Equal>::Iterator<IsConst>::operator ++() noexcept
+	{
+		assert(index < capacity && "The iterator is out of range.");
+
+		++index;
+		SkipFree();
+
+		return *this;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<bool IsConst>
+	typename FlatHashMap<Key, Value, Hash, Equal>::template Iterator<IsConst> FlatHashMap<Key, Value, Hash, Equal>::Iterator<IsConst>::operator ++(int) noexcept
+	{
+		const Iterator previous = *this;
+		++*this;
+
+		return previous;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<bool IsConst>
+	bool FlatHashMap<Key, Value, Hash, Equal>::Iterator<IsConst>::operator ==(const Iterator& other) const noexcept
+	{
+		return index == other.index;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<bool IsConst>
+	void FlatHashMap<Key, Value, Hash, Equal>::Iterator<IsConst>::SkipFree() noexcept
+	{
+		while (index < capacity && controls[index] < 0)
+		{
+			++index;
+		}
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	FlatHashMap<Key, Value, Hash, Equal>::FlatHashMap(const std::size_t count) :
+		FlatHashMap()
+	{
+		Reserve(count);
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	FlatHashMap<Key, Value, Hash, Equal>::FlatHashMap(const FlatHashMap& other) :
+		hasher(other.hasher),
+		equal(other.equal)
+	{
+		if (other.size == 0uz)
+		{
+			return;
+		}
+
+		const std::size_t controlCount = other.capacity + ControlGroupWidth - 1uz;
+		auto newControls = std::make_unique_for_overwrite<std::int8_t[]>(controlCount);
+		std::copy_n(other.controls.get(), controlCount, newControls.get());
+		Entry* const newEntries = std::allocator<Entry>().allocate(other.capacity);
+
+		std::size_t slot = 0uz;
+		try
+		{
+			for (; slot < other.capacity; ++slot)
+			{
+				if (newControls[slot] >= 0)
+				{
+					std::construct_at(newEntries + slot, other.entries[slot]);
+				}
+			}
+		}
+		catch (...)
+		{
+			for (std::size_t i = 0uz; i < slot; ++i)
+			{
+				if (newControls[i] >= 0)
+				{
+					std::destroy_at(newEntries + i);
+				}
+			}
+			std::allocator<Entry>().deallocate(newEntries, other.capacity);
+			throw;
+		}
+
+		controls = std::move(newControls);
+		entries = newEntries;
+		capacity = other.capacity;
+		size = other.size;
+		growthLeft = other.growthLeft;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	FlatHashMap<Key, Value, Hash, Equal>::FlatHashMap(FlatHashMap&& other) noexcept :
+		controls(std::move(other.controls)),
+		entries{std::exchange(other.entries, nullptr)},
+		capacity{std::exchange(other.capacity, 0uz)},
+		size{std::exchange(other.size, 0uz)},
+		growthLeft{std::exchange(other.growthLeft, 0uz)},
+		hasher(other.hasher),
+		equal(other.equal)
+	{
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	FlatHashMap<Key, Value, Hash, Equal>::~FlatHashMap() noexcept
+	{
+		Free();
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	std::size_t FlatHashMap<Key, Value, Hash, Equal>::Size() const noexcept
+	{
+		return size;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	bool FlatHashMap<Key, Value, Hash, Equal>::IsEmpty() const noexcept
+	{
+		return size == 0uz;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	std::size_t FlatHashMap<Key, Value, Hash, Equal>::Capacity() const noexcept
+	{
+		return capacity;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	void FlatHashMap<Key, Value, Hash, Equal>::Reserve(const std::size_t count)
+	{
+		if (count > size + growthLeft)
+		{
+			Resize(CapacityFor(count));
+		}
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	void FlatHashMap<Key, Value, Hash, Equal>::Rehash(const std::size_t count)
+	{
+		if (const std::size_t entryCount = std::max(count, size); entryCount > 0uz)
+		{
+			Resize(CapacityFor(entryCount));
+		}
+		else
+		{
+			Free();
+		}
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<HashLookupKey<Key, Hash, Equal> K>
+	Value* FlatHashMap<Key, Value, Hash, Equal>::Find(const K& key)
+	{
+		const std::size_t slot = FindSlot(key, HashOf(key));
+		return slot < capacity ? &entries[slot].second : nullptr;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<HashLookupKey<Key, Hash, Equal> K>
+	const Value* FlatHashMap<Key, Value, Hash, Equal>::Find(const K& key) const
+	{
+		const std::size_t slot = FindSlot(key, HashOf(key));
+		return slot < capacity ? &entries[slot].second : nullptr;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<HashLookupKey<Key, Hash, Equal> K>
+	bool FlatHashMap<Key, Value, Hash, Equal>::Contains(const K& key) const
+	{
+		return FindSlot(key, HashOf(key)) < capacity;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<typename... Args>
+	std::pair<Value*, bool> FlatHashMap<Key, Value, Hash, Equal>::Emplace(const Key& key, Args&&... args)
+	{
+		return EmplaceKey(key, std::forward<Args>(args)...);
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<typename... Args>
+	std::pair<Value*, bool> FlatHashMap<Key, Value, Hash, Equal>::Emplace(Key&& key, Args&&... args)
+	{
+		return EmplaceKey(std::move(key), std::forward<Args>(args)...);
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<typename V>
+	std::pair<Value*, bool> FlatHashMap<Key, Value, Hash, Equal>::InsertOrAssign(const Key& key, V&& value)
+	{
+		const std::pair<Value*, bool> result = EmplaceKey(key, std::forward<V>(value));
+		if (!result.second)
+		{
+			*result.first = std::forward<V>(value);
+		}
+
+		return result;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<typename V>
+	std::pair<Value*, bool> FlatHashMap<Key, Value, Hash, Equal>::InsertOrAssign(Key&& key, V&& value)
+	{
+		const std::pair<Value*, bool> result = EmplaceKey(std::move(key), std::forward<V>(value));
+		if (!result.second)
+		{
+			*result.first = std::forward<V>(value);
+		}
+
+		return result;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<HashLookupKey<Key, Hash, Equal> K>
+	bool FlatHashMap<Key, Value, Hash, Equal>::Remove(const K& key)
+	{
+		const std::size_t slot = FindSlot(key, HashOf(key));
+		if (slot >= capacity)
+		{
+			return false;
+		}
+
+		RemoveSlot(slot);
+
+		return true;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	typename FlatHashMap<Key, Value, Hash, Equal>::template Iterator<false> FlatHashMap<Key, Value, Hash, Equal>::Remove(const Iterator<true> position) noexcept
+	{
+		assert(position.entries == entries && position.index < capacity && controls[position.index] >= 0 && "The iterator is invalid.");
+
+		RemoveSlot(position.index);
+
+		return Iterator<false>(controls.get(), entries, position.index + 1uz, capacity);
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	void FlatHashMap<Key, Value, Hash, Equal>::Clear() noexcept
+	{
+		if (capacity == 0uz)
+		{
+			return;
+		}
+
+		for (std::size_t slot = 0uz; slot < capacity; ++slot)
+		{
+			if (controls[slot] >= 0)
+			{
+				std::destroy_at(entries + slot);
+			}
+		}
+		std::fill_n(controls.get(), capacity + ControlGroupWidth - 1uz, EmptyControl);
+		size = 0uz;
+		growthLeft = MaxLoad(capacity);
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	typename FlatHashMap<Key, Value, Hash, Equal>::template Iterator<false> FlatHashMap<Key, Value, Hash, Equal>::begin() noexcept
+	{
+		return Iterator<false>(controls.get(), entries, 0uz, capacity);
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	typename FlatHashMap<Key, Value, Hash, Equal>::template Iterator<true> FlatHashMap<Key, Value, Hash, Equal>::begin() const noexcept
+	{
+		return Iterator<true>(controls.get(), entries, 0uz, capacity);
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	typename FlatHashMap<Key, Value, Hash, Equal>::template Iterator<false> FlatHashMap<Key, Value, Hash, Equal>::end() noexcept
+	{
+		return Iterator<false>(controls.get(), entries, capacity, capacity);
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	typename FlatHashMap<Key, Value, Hash, Equal>::template Iterator<true> FlatHashMap<Key, Value, Hash, Equal>::end() const noexcept
+	{
+		return Iterator<true>(controls.get(), entries, capacity, capacity);
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	FlatHashMap<Key, Value, Hash, Equal>& FlatHashMap<Key, Value, Hash, Equal>::operator =(const FlatHashMap& other)
+	{
+		if (this != &other)
+		{
+			*this = FlatHashMap(other);
+		}
+
+		return *this;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	FlatHashMap<Key, Value, Hash, Equal>& FlatHashMap<Key, Value, Hash, Equal>::operator =(FlatHashMap&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Free();
+			controls = std::move(other.controls);
+			entries = std::exchange(other.entries, nullptr);
+			capacity = std::exchange(other.capacity, 0uz);
+			size = std::exchange(other.size, 0uz);
+			growthLeft = std::exchange(other.growthLeft, 0uz);
+			hasher = other.hasher;
+			equal = other.equal;
+		}
+
+		return *this;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<typename K>
+	std::size_t FlatHashMap<Key, Value, Hash, Equal>::FindSlot(const K& key, const std::size_t hash) const
+	{
+		if (size == 0uz)
+		{
+			return capacity;
+		}
+
+		const std::size_t mask = capacity - 1uz;
+		const std::int8_t control = HashControl(hash);
+		std::size_t offset = ProbeStart(hash) & mask;
+		for (std::size_t step = ControlGroupWidth; ; step += ControlGroupWidth)
+		{
+			const auto group = ControlGroup(controls.get() + offset);
+			for (std::uint32_t match = group.Match(control); match; match &= match - 1u)
+			{
+				if (const std::size_t slot = (offset + std::countr_zero(match)) & mask; equal(entries[slot].first, key)) [[likely]]
+				{
+					return slot;
+				}
+			}
+
+			if (group.MatchEmpty())
+			{
+				return capacity;
+			}
+
+			offset = (offset + step) & mask;
+		}
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<typename K, typename... Args>
+	std::pair<Value*, bool> FlatHashMap<Key, Value, Hash, Equal>::EmplaceKey(K&& key, Args&&... args)
+	{
+		const std::size_t hash = HashOf(key);
+		if (const std::size_t slot = FindSlot(key, hash); slot < capacity)
+		{
+			return std::pair(&entries[slot].second, false);
+		}
+
+		std::size_t slot = capacity > 0uz ? FindFreeSlot(controls.get(), capacity, hash) : 0uz;
+		if (capacity == 0uz || (growthLeft == 0uz && controls[slot] == EmptyControl)) [[unlikely]]
+		{
+			// Tombstones are purged without growing if the map is loaded less than 25/32.
+			Resize(capacity == 0uz ? ControlGroupWidth : size * 32uz <= capacity * 25uz ? capacity : capacity * 2uz);
+			slot = FindFreeSlot(controls.get(), capacity, hash);
+		}
+
+		std::construct_at(entries + slot, std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+		growthLeft -= controls[slot] == EmptyControl;
+		SetControl(controls.get(), capacity, slot, HashControl(hash));
+		++size;
+
+		return std::pair(&entries[slot].second, true);
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	void FlatHashMap<Key, Value, Hash, Equal>::RemoveSlot(const std::size_t slot) noexcept
+	{
+		std::destroy_at(entries + slot);
+		--size;
+
+		// A slot may become empty again only if no probe has ever passed it: every group window that contains it must have an empty slot.
+		const std::uint32_t emptyBefore = ControlGroup(controls.get() + ((slot - ControlGroupWidth) & (capacity - 1uz))).MatchEmpty();
+		const std::uint32_t emptyAfter = ControlGroup(controls.get() + slot).MatchEmpty();
+		const bool wasNeverFull = emptyBefore && emptyAfter &&
+			std::countl_zero(static_cast<std::uint16_t>(emptyBefore)) + std::countr_zero(emptyAfter) < static_cast<int>(ControlGroupWidth);
+		SetControl(controls.get(), capacity, slot, wasNeverFull ? EmptyControl : DeletedControl);
+		growthLeft += wasNeverFull;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	void FlatHashMap<Key, Value, Hash, Equal>::Resize(const std::size_t newCapacity)
+	{
+		assert(std::has_single_bit(newCapacity) && newCapacity >= ControlGroupWidth && MaxLoad(newCapacity) >= size && "The new capacity is invalid.");
+
+		const std::size_t controlCount = newCapacity + ControlGroupWidth - 1uz;
+		auto newControls = std::make_unique_for_overwrite<std::int8_t[]>(controlCount);
+		std::fill_n(newControls.get(), controlCount, EmptyControl);
+		Entry* const newEntries = std::allocator<Entry>().allocate(newCapacity);
+
+		try
+		{
+			for (std::size_t slot = 0uz; slot < capacity; ++slot)
+			{
+				if (controls[slot] >= 0)
+				{
+					const std::size_t hash = HashOf(entries[slot].first);
+					const std::size_t newSlot = FindFreeSlot(newControls.get(), newCapacity, hash);
+					std::construct_at(newEntries + newSlot, std::move_if_noexcept(entries[slot]));
+					SetControl(newControls.get(), newCapacity, newSlot, HashControl(hash));
+				}
+			}
+		}
+		catch (...)
+		{
+			for (std::size_t slot = 0uz; slot < newCapacity; ++slot)
+			{
+				if (newControls[slot] >= 0)
+				{
+					std::destroy_at(newEntries + slot);
+				}
+			}
+			std::allocator<Entry>().deallocate(newEntries, newCapacity);
+			throw;
+		}
+
+		const std::size_t entryCount = size;
+		Free();
+		controls = std::move(newControls);
+		entries = newEntries;
+		capacity = newCapacity;
+		size = entryCount;
+		growthLeft = MaxLoad(newCapacity) - entryCount;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	void FlatHashMap<Key, Value, Hash, Equal>::Free() noexcept
+	{
+		if (capacity == 0uz)
+		{
+			return;
+		}
+
+		for (std::size_t slot = 0uz; slot < capacity; ++slot)
+		{
+			if (controls[slot] >= 0)
+			{
+				std::destroy_at(entries + slot);
+			}
+		}
+		std::allocator<Entry>().deallocate(entries, capacity);
+		controls.reset();
+		entries = nullptr;
+		capacity = 0uz;
+		size = 0uz;
+		growthLeft = 0uz;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	template<typename K>
+	std::size_t FlatHashMap<Key, Value, Hash, Equal>::HashOf(const K& key) const
+	{
+		return MixHash(hasher(key));
+	}
+}
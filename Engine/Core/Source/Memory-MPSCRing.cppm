@@ -0,0 +1,312 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Memory:MPSCRing;
+
+import std;
+
+import :CacheLine;
+
+export namespace PonyEngine::Memory
+{
+	/// @brief Bounded lock-free multi-producer/single-consumer ring buffer.
+	/// @details Any thread may push, but only one thread may pop at the same time.
+	///          It's a Vyukov queue: each slot has a sequence number that tells whose turn it is,
+	///          so producers contend only on the write position and never wait for each other to finish writing.
+	/// @tparam T Value type. It must be nothrow move constructible.
+	template<typename T>
+	class MPSCRing final
+	{
+		static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_destructible_v<T>, "Value must be nothrow move constructible");
+
+	public:
+		/// @brief Creates a ring.
+		/// @param capacity Minimal capacity. It's rounded up to a power of two and is at least 2.
+		[[nodiscard("Pure constructor")]]
+		explicit MPSCRing(std::size_t capacity);
+		MPSCRing(const MPSCRing&) = delete;
+		MPSCRing(MPSCRing&&) = delete;
+
+		~MPSCRing() noexcept;
+
+		/// @brief Gets the capacity.
+		/// @return Capacity.
+		[[nodiscard("Pure function")]]
+		std::size_t Capacity() const noexcept;
+		/// @brief Gets the value count.
+		/// @return Value count. It's only a snapshot if other threads are working with the ring.
+		[[nodiscard("Pure function")]]
+		std::size_t Size() const noexcept;
+		/// @brief Checks if the ring is empty.
+		/// @return @a True if it's empty; @a false otherwise. It's only a snapshot if other threads are working with the ring.
+		[[nodiscard("Pure function")]]
+		bool IsEmpty() const noexcept;
+
+		/// @brief Tries to push the @p value.
+		/// @param value Value.
+		/// @return @a True if it's pushed; @a false if the ring is full.
+		/// @note Producer function.
+		[[nodiscard("Must check the result")]]
+		bool TryPush(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>);
+		/// @brief Tries to push the @p value.
+		/// @param value Value.
+		/// @return @a True if it's pushed; @a false if the ring is full. The @p value isn't moved if it's not pushed.
+		/// @note Producer function.
+		[[nodiscard("Must check the result")]]
+		bool TryPush(T&& value) noexcept;
+		/// @brief Tries to construct a value in the ring.
+		/// @details If the construction may throw, the value is constructed before a slot is taken.
+		/// @tparam Args Argument types.
+		/// @param args Arguments.
+		/// @return @a True if it's pushed; @a false if the ring is full.
+		/// @note Producer function.
+		template<typename... Args> [[nodiscard("Must check the result")]]
+		bool TryEmplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>);
+		/// @brief Tries to push all the @p values as a contiguous batch.
+		/// @details The batch takes its slots with a single atomic operation, so values from other producers never interleave with it.
+		/// @param values Values.
+		/// @return @a True if all the values are pushed; @a false if there's not enough space. Nothing is pushed in that case.
+		/// @note Producer function.
+		[[nodiscard("Must check the result")]]
+		bool TryPushBatch(std::span<const T> values) noexcept requires std::is_nothrow_copy_constructible_v<T>;
+
+		/// @brief Tries to pop a value.
+		/// @return Popped value or @a nullopt if the ring is empty.
+		/// @note Consumer function.
+		[[nodiscard("Must use the result")]]
+		std::optional<T> TryPop() noexcept;
+		/// @brief Pops as many values as available into the @p values.
+		/// @param values Output values. They're move-assigned from the beginning of the span.
+		/// @return Popped value count.
+		/// @note Consumer function.
+		std::size_t TryPopBatch(std::span<T> values) noexcept requires std::is_nothrow_move_assignable_v<T>;
+
+		MPSCRing& operator =(const MPSCRing&) = delete;
+		MPSCRing& operator =(MPSCRing&&) = delete;
+
+	private:
+		/// @brief Ring slot.
+		struct Slot final
+		{
+			std::atomic<std::size_t> sequence; ///< Sequence number. It's the position if the slot is free and the position + 1 if it's written.
+			alignas(T) std::byte storage[sizeof(T)]; ///< Value storage.
+
+			/// @brief Gets the value.
+			/// @return Value.
+			[[nodiscard("Pure function")]]
+			T* Value() noexcept;
+		};
+
+		/// @brief Takes @p count slots for writing.
+		/// @param count Slot count. It must be in range [1, capacity].
+		/// @return First taken position or @a nullopt if there's not enough space.
+		[[nodiscard("Must use the result")]]
+		std::optional<std::size_t> Acquire(std::size_t count) noexcept;
+
+		alignas(CacheLineSize) std::atomic<std::size_t> enqueuePosition; ///< Next write position. It's shared by the producers.
+		alignas(CacheLineSize) std::atomic<std::size_t> dequeuePosition; ///< Next read position. It's written only by the consumer.
+
+		alignas(CacheLineSize) std::unique_ptr<Slot[]> slots; ///< Slots.
+		std::size_t mask; ///< Position mask. It's capacity - 1.
+	};
+}
+
+namespace PonyEngine::Memory
+{
+	template<typename T>
+	MPSCRing<T>::MPSCRing(const std::size_t capacity) :
+		enqueuePosition(0uz),
+		dequeuePosition(0uz)
+	{
+		if (capacity == 0uz || capacity > (std::numeric_limits<std::size_t>::max() >> 1uz) + 1uz) [[unlikely]]
+		{
+			throw std::invalid_argument("Invalid capacity");
+		}
+
+		const std::size_t slotCount = std::bit_ceil(std::max(capacity, 2uz));
+		slots = std::make_unique<Slot[]>(slotCount);
+		mask = slotCount - 1uz;
+		for (std::size_t i = 0uz; i < slotCount; ++i)
+		{
+			slots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	template<typename T>
+	MPSCRing<T>::~MPSCRing() noexcept
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			for (std::size_t position = dequeuePosition.load(std::memory_order_relaxed), end = enqueuePosition.load(std::memory_order_relaxed); position != end; ++position)
+			{
+				std::destroy_at(slots[position & mask].Value());
+			}
+		}
+	}
+
+	template<typename T>
+	std::size_t MPSCRing<T>::Capacity() const noexcept
+	{
+		return mask + 1uz;
+	}
+
+	template<typename T>
+	std::size_t MPSCRing<T>::Size() const noexcept
+	{
+		const std::size_t dequeue = dequeuePosition.load(std::memory_order_acquire);
+		const std::size_t enqueue = enqueuePosition.load(std::memory_order_acquire);
+
+		return enqueue - dequeue;
+	}
+
+	template<typename T>
+	bool MPSCRing<T>::IsEmpty() const noexcept
+	{
+		return Size() == 0uz;
+	}
+
+	template<typename T>
+	bool MPSCRing<T>::TryPush(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
+	{
+		return TryEmplace(value);
+	}
+
+	template<typename T>
+	bool MPSCRing<T>::TryPush(T&& value) noexcept
+	{
+		return TryEmplace(std::move(value));
+	}
+
+	template<typename T>
+	template<typename... Args>
+	bool MPSCRing<T>::TryEmplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
+	{
+		if constexpr (std::is_nothrow_constructible_v<T, Args...>)
+		{
+			const std::optional<std::size_t> position = Acquire(1uz);
+			if (!position)
+			{
+				return false;
+			}
+
+			Slot& slot = slots[*position & mask];
+			std::construct_at(slot.Value(), std::forward<Args>(args)...);
+			slot.sequence.store(*position + 1uz, std::memory_order_release);
+
+			return true;
+		}
+		else
+		{
+			// A taken slot must be written, or the consumer would stall on it. So a throwing construction happens before.
+			return TryEmplace(T(std::forward<Args>(args)...));
+		}
+	}
+
+	template<typename T>
+	bool MPSCRing<T>::TryPushBatch(const std::span<const T> values) noexcept requires std::is_nothrow_copy_constructible_v<T>
+	{
+		if (values.empty())
+		{
+			return true;
+		}
+		if (values.size() > Capacity())
+		{
+			return false;
+		}
+
+		const std::optional<std::size_t> position = Acquire(values.size());
+		if (!position)
+		{
+			return false;
+		}
+
+		for (std::size_t i = 0uz; i < values.size(); ++i)
+		{
+			Slot& slot = slots[(*position + i) & mask];
+			std::construct_at(slot.Value(), values[i]);
+			slot.sequence.store(*position + i + 1uz, std::memory_order_release);
+		}
+
+		return true;
+	}
+
+	template<typename T>
+	std::optional<T> MPSCRing<T>::TryPop() noexcept
+	{
+		const std::size_t position = dequeuePosition.load(std::memory_order_relaxed);
+		Slot& slot = slots[position & mask];
+		if (slot.sequence.load(std::memory_order_acquire) != position + 1uz)
+		{
+			return std::nullopt;
+		}
+
+		std::optional<T> value(std::move(*slot.Value()));
+		std::destroy_at(slot.Value());
+		slot.sequence.store(position + Capacity(), std::memory_order_release);
+		dequeuePosition.store(position + 1uz, std::memory_order_relaxed);
+
+		return value;
+	}
+
+	template<typename T>
+	std::size_t MPSCRing<T>::TryPopBatch(const std::span<T> values) noexcept requires std::is_nothrow_move_assignable_v<T>
+	{
+		const std::size_t position = dequeuePosition.load(std::memory_order_relaxed);
+
+		std::size_t popped = 0uz;
+		for (; popped < values.size(); ++popped)
+		{
+			Slot& slot = slots[(position + popped) & mask];
+			if (slot.sequence.load(std::memory_order_acquire) != position + popped + 1uz)
+			{
+				break;
+			}
+
+			values[popped] = std::move(*slot.Value());
+			std::destroy_at(slot.Value());
+			slot.sequence.store(position + popped + Capacity(), std::memory_order_release);
+		}
+		dequeuePosition.store(position + popped, std::memory_order_relaxed);
+
+		return popped;
+	}
+
+	template<typename T>
+	T* MPSCRing<T>::Slot::Value() noexcept
+	{
+		return std::launder(reinterpret_cast<T*>(storage));
+	}
+
+	template<typename T>
+	std::optional<std::size_t> MPSCRing<T>::Acquire(const std::size_t count) noexcept
+	{
+		std::size_t position = enqueuePosition.load(std::memory_order_relaxed);
+		while (true)
+		{
+			// The consumer frees slots in order, so if the last slot of the range is free, the whole range is free.
+			const std::size_t last = position + count - 1uz;
+			const auto difference = static_cast<std::ptrdiff_t>(slots[last & mask].sequence.load(std::memory_order_acquire) - last);
+			if (difference == 0z)
+			{
+				if (enqueuePosition.compare_exchange_weak(position, position + count, std::memory_order_relaxed))
+				{
+					return position;
+				}
+			}
+			else if (difference < 0z)
+			{
+				return std::nullopt;
+			}
+			else
+			{
+				position = enqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+}
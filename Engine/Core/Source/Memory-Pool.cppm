@@ -11,6 +11,10 @@ export module PonyEngine.Memory:Pool;
 
 import std;
 
+import PonyEngine.Type;
+
+import :AllocationTracking;
+
 export namespace PonyEngine::Memory
 {
 	/// @brief Pool memory.
@@ -19,6 +23,12 @@ export namespace PonyEngine::Memory
 	class Pool final
 	{
 	public:
+		using Deleter = Type::InplaceFunction<void(T*)>; ///< Object deleter type.
+		using Pointer = std::unique_ptr<T, Deleter>; ///< Owning object pointer type.
+		using CreateFunction = Type::InplaceFunction<Pointer()>; ///< Create function type.
+		using Callback = Type::InplaceFunction<void(T&)>; ///< Acquire/release callback type.
+		using UtilityFunction = Type::InplaceFunction<std::uint64_t(const T&)>; ///< Utility function type.
+
 		/// @brief Pool object. It returns an object to a pool automatically when out of scope.
 		/// @note The object must be destroyed before its pool is destroyed.
 		class Object final
@@ -71,9 +81,10 @@ export namespace PonyEngine::Memory
 		/// @param release Release callback.
 		/// @param utility Utility function. It's used to determine what object to delete on reaching a max size.
 		/// @param maxSize Max size. It affects only inactive objects.
+		/// @param tag Allocation tag of the pool objects and containers. The current thread tag is used by default.
+		/// @note The functions are stored inline, so their captures must fit into @p Type::DefaultInplaceFunctionCapacity.
 		[[nodiscard("Pure constructor")]]
-		Pool(const std::function<std::unique_ptr<T, std::function<void(T*)>>()>& create, const std::function<void(T&)>& acquire, const std::function<void(T&)>& release,
-			const std::function<std::uint64_t(const T&)>& utility, std::size_t maxSize);
+		Pool(CreateFunction create, Callback acquire, Callback release, UtilityFunction utility, std::size_t maxSize, AllocationTag tag = CurrentAllocationTag());
 		Pool(const Pool&) = delete;
 		Pool(Pool&&) = delete;
 
@@ -92,6 +103,11 @@ export namespace PonyEngine::Memory
 		[[nodiscard("Wierd call")]]
 		Object Lease();
 
+		/// @brief Gets the allocation tag.
+		/// @return Allocation tag.
+		[[nodiscard("Pure function")]]
+		AllocationTag Tag() const noexcept;
+
 		/// @brief Gets the inactive object max count.
 		/// @return Max size.
 		[[nodiscard("Pure function")]]
@@ -112,20 +128,21 @@ export namespace PonyEngine::Memory
 		/// @brief Takes an object from the inactive pool.
 		/// @return Object.
 		[[nodiscard("Wierd call")]]
-		std::unique_ptr<T, std::function<void(T*)>> GetFromInactive();
+		Pointer GetFromInactive();
 		/// @brief Puts the object into the inactive pool.
 		/// @param object Object.
-		void PutIntoInactive(std::unique_ptr<T, std::function<void(T*)>>&& object);
+		void PutIntoInactive(Pointer&& object);
 
-		std::function<std::unique_ptr<T, std::function<void(T*)>>()> create; ///< Create function.
-		std::function<void(T&)> acquire; ///< Acquire function.
-		std::function<void(T&)> release; ///< Release function.
-		std::function<std::uint64_t(const T&)> utility; ///< Utility function.
+		CreateFunction create; ///< Create function.
+		Callback acquire; ///< Acquire function.
+		Callback release; ///< Release function.
+		UtilityFunction utility; ///< Utility function.
 
 		std::size_t maxSize; ///< Inactive max size.
+		AllocationTag tag; ///< Allocation tag.
 
-		std::vector<std::unique_ptr<T, std::function<void(T*)>>> inactive; ///< Inactive objects.
-		std::vector<std::unique_ptr<T, std::function<void(T*)>>> active; ///< Active objects.
+		std::vector<Pointer> inactive; ///< Inactive objects.
+		std::vector<Pointer> active; ///< Active objects.
 	};
 }
 
@@ -198,20 +215,22 @@ namespace PonyEngine::Memory
 	}
 
 	template<typename T>
-	Pool<T>::Pool(const std::function<std::unique_ptr<T, std::function<void(T*)>>()>& create, const std::function<void(T&)>& acquire,
-		const std::function<void(T&)>& release, const std::function<std::uint64_t(const T&)>& utility, const std::size_t maxSize) :
-		create(create),
-		acquire(acquire),
-		release(release),
-		utility(utility),
-		maxSize{std::max(maxSize, 1uz)}
+	Pool<T>::Pool(CreateFunction create, Callback acquire, Callback release, UtilityFunction utility, const std::size_t maxSize, const AllocationTag tag) :
+		create(std::move(create)),
+		acquire(std::move(acquire)),
+		release(std::move(release)),
+		utility(std::move(utility)),
+		maxSize{std::max(maxSize, 1uz)},
+		tag{tag}
 	{
 	}
 
 	template<typename T>
 	T& Pool<T>::Acquire()
 	{
-		std::unique_ptr<T, std::function<void(T*)>> acquired = inactive.empty() ? create() : GetFromInactive();
+		const auto tagScope = AllocationTagScope(tag);
+
+		Pointer acquired = inactive.empty() ? create() : GetFromInactive();
 		T& ref = *acquired;
 		acquire(ref);
 		active.push_back(std::move(acquired));
@@ -222,10 +241,12 @@ namespace PonyEngine::Memory
 	template<typename T>
 	void Pool<T>::Release(const T& object)
 	{
-		if (const auto position = std::ranges::find_if(active, [&](const std::unique_ptr<T, std::function<void(T*)>>& p){ return p.get() == &object; });
+		const auto tagScope = AllocationTagScope(tag);
+
+		if (const auto position = std::ranges::find_if(active, [&](const Pointer& p){ return p.get() == &object; });
 			position != active.cend()) [[likely]]
 		{
-			std::unique_ptr<T, std::function<void(T*)>> released = std::move(*position);
+			Pointer released = std::move(*position);
 			active.erase(position);
 			release(*released);
 			PutIntoInactive(std::move(released));
@@ -242,6 +263,12 @@ namespace PonyEngine::Memory
 		return Object(Acquire(), *this);
 	}
 
+	template<typename T>
+	AllocationTag Pool<T>::Tag() const noexcept
+	{
+		return tag;
+	}
+
 	template<typename T>
 	std::size_t Pool<T>::MaxSize() const noexcept
 	{
@@ -261,16 +288,16 @@ namespace PonyEngine::Memory
 	}
 
 	template<typename T>
-	std::unique_ptr<T, std::function<void(T*)>> Pool<T>::GetFromInactive()
+	Pool<T>::Pointer Pool<T>::GetFromInactive()
 	{
-		std::unique_ptr<T, std::function<void(T*)>> object = std::move(inactive.back());
+		Pointer object = std::move(inactive.back());
 		inactive.pop_back();
 
 		return object;
 	}
 
 	template<typename T>
-	void Pool<T>::PutIntoInactive(std::unique_ptr<T, std::function<void(T*)>>&& object)
+	void Pool<T>::PutIntoInactive(Pointer&& object)
 	{
 		if (inactive.size() < maxSize)
 		{
@@ -279,7 +306,7 @@ namespace PonyEngine::Memory
 		else
 		{
 			const std::uint64_t objectUtility = utility(*object);
-			const auto position = std::ranges::find_if(inactive, [&](const std::unique_ptr<T, std::function<void(T*)>>& p) { return utility(*p) < objectUtility; });
+			const auto position = std::ranges::find_if(inactive, [&](const Pointer& p) { return utility(*p) < objectUtility; });
 			if (position != inactive.cend())
 			{
 				inactive.erase(position);
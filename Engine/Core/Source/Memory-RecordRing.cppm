@@ -0,0 +1,288 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+module;
+
+#include <cassert>
+
+export module PonyEngine.Memory:RecordRing;
+
+import std;
+
+import :CacheLine;
+
+export namespace PonyEngine::Memory
+{
+	/// @brief Bounded wait-free single-producer/single-consumer ring of variable-size byte records.
+	/// @details The producer reserves space, writes a record in place and commits it; the consumer reads the record in place and releases it.
+	///          So a record is never copied by the ring. Every record is contiguous: if it doesn't fit before the end of the buffer,
+	///          the rest of the buffer is skipped and the record starts from the beginning.
+	class RecordRing final
+	{
+	public:
+		static constexpr std::size_t RecordAlignment = 8uz; ///< Record data alignment.
+		static constexpr std::size_t MinCapacity = 64uz; ///< Minimal capacity in bytes.
+
+		/// @brief Creates a ring.
+		/// @param capacity Minimal capacity in bytes. It's rounded up to a power of two and is at least @p MinCapacity.
+		[[nodiscard("Pure constructor")]]
+		explicit RecordRing(std::size_t capacity);
+		RecordRing(const RecordRing&) = delete;
+		RecordRing(RecordRing&&) = delete;
+
+		~RecordRing() noexcept = default;
+
+		/// @brief Gets the capacity in bytes.
+		/// @return Capacity.
+		[[nodiscard("Pure function")]]
+		std::size_t Capacity() const noexcept;
+		/// @brief Gets the max record size in bytes.
+		/// @details A record of this size always fits into an empty ring wherever it's written.
+		/// @return Max record size.
+		[[nodiscard("Pure function")]]
+		std::size_t MaxRecordSize() const noexcept;
+		/// @brief Gets the used byte count including record headers and skipped space.
+		/// @return Used byte count. It's only a snapshot if the other thread is working with the ring.
+		[[nodiscard("Pure function")]]
+		std::size_t Size() const noexcept;
+		/// @brief Checks if the ring is empty.
+		/// @return @a True if it's empty; @a false otherwise. It's only a snapshot if the other thread is working with the ring.
+		[[nodiscard("Pure function")]]
+		bool IsEmpty() const noexcept;
+
+		/// @brief Reserves space for a record.
+		/// @details The reserved space isn't visible to the consumer till it's committed. A new reservation replaces an uncommitted one.
+		/// @param size Record size in bytes.
+		/// @return Record data or @a nullopt if there's not enough space.
+		/// @note Producer function.
+		[[nodiscard("Must be committed")]]
+		std::optional<std::span<std::byte>> Reserve(std::size_t size) noexcept;
+		/// @brief Commits the reserved record.
+		/// @note Producer function.
+		void Commit() noexcept;
+		/// @brief Commits the first @p size bytes of the reserved record.
+		/// @param size Record size. It must not be greater than the reserved size.
+		/// @note Producer function.
+		void Commit(std::size_t size) noexcept;
+		/// @brief Tries to write the @p record.
+		/// @param record Record.
+		/// @return @a True if it's written; @a false if there's not enough space.
+		/// @note Producer function.
+		[[nodiscard("Must check the result")]]
+		bool TryWrite(std::span<const std::byte> record) noexcept;
+
+		/// @brief Gets the next record.
+		/// @details The record stays in the ring till it's released.
+		/// @return Record data or @a nullopt if the ring is empty.
+		/// @note Consumer function.
+		[[nodiscard("Must be released")]]
+		std::optional<std::span<const std::byte>> Peek() noexcept;
+		/// @brief Releases the record got by the last @p Peek().
+		/// @note Consumer function.
+		void Release() noexcept;
+
+		RecordRing& operator =(const RecordRing&) = delete;
+		RecordRing& operator =(RecordRing&&) = delete;
+
+	private:
+		/// @brief Record header.
+		using Header = std::uint32_t;
+
+		static constexpr std::size_t HeaderSize = RecordAlignment; ///< Header size with a padding.
+		static constexpr Header SkipMarker = std::numeric_limits<Header>::max(); ///< Header value that tells to skip the rest of the buffer.
+		static constexpr std::size_t NoRecord = std::numeric_limits<std::size_t>::max(); ///< Record size that means there's no record.
+
+		/// @brief Gets the size that a record takes in the ring.
+		/// @param size Record data size.
+		/// @return Full record size.
+		[[nodiscard("Pure function")]]
+		static constexpr std::size_t FullRecordSize(std::size_t size) noexcept;
+
+		/// @brief Writes a header.
+		/// @param position Header position.
+		/// @param header Header.
+		void WriteHeader(std::size_t position, Header header) noexcept;
+		/// @brief Reads a header.
+		/// @param position Header position.
+		/// @return Header.
+		[[nodiscard("Pure function")]]
+		Header ReadHeader(std::size_t position) const noexcept;
+
+		alignas(CacheLineSize) std::atomic<std::size_t> head; ///< End of the committed records. It's written by the producer.
+		std::size_t cachedTail; ///< Last seen tail. It's used by the producer.
+		std::size_t reservedPosition; ///< Reserved record position. It's used by the producer.
+		std::size_t reservedSize; ///< Reserved record size. It's used by the producer.
+
+		alignas(CacheLineSize) std::atomic<std::size_t> tail; ///< Start of the unreleased records. It's written by the consumer.
+		std::size_t cachedHead; ///< Last seen head. It's used by the consumer.
+		std::size_t peekedSize; ///< Size of the record got by the last peek. It's used by the consumer.
+
+		alignas(CacheLineSize) std::unique_ptr<std::byte[]> buffer; ///< Record buffer.
+		std::size_t mask; ///< Position mask. It's capacity - 1.
+	};
+}
+
+namespace PonyEngine::Memory
+{
+	RecordRing::RecordRing(const std::size_t capacity) :
+		head(0uz),
+		cachedTail{0uz},
+		reservedPosition{0uz},
+		reservedSize{NoRecord},
+		tail(0uz),
+		cachedHead{0uz},
+		peekedSize{NoRecord}
+	{
+		static_assert(__STDCPP_DEFAULT_NEW_ALIGNMENT__ >= RecordAlignment, "Default new alignment is too small for records");
+
+		if (capacity > (std::numeric_limits<std::size_t>::max() >> 1uz) + 1uz) [[unlikely]]
+		{
+			throw std::invalid_argument("Invalid capacity");
+		}
+
+		const std::size_t byteCount = std::bit_ceil(std::max(capacity, MinCapacity));
+		buffer = std::make_unique_for_overwrite<std::byte[]>(byteCount);
+		mask = byteCount - 1uz;
+	}
+
+	std::size_t RecordRing::Capacity() const noexcept
+	{
+		return mask + 1uz;
+	}
+
+	std::size_t RecordRing::MaxRecordSize() const noexcept
+	{
+		return std::min(Capacity() / 2uz - HeaderSize, static_cast<std::size_t>(SkipMarker - 1u));
+	}
+
+	std::size_t RecordRing::Size() const noexcept
+	{
+		const std::size_t currentTail = tail.load(std::memory_order_acquire);
+		const std::size_t currentHead = head.load(std::memory_order_acquire);
+
+		return currentHead - currentTail;
+	}
+
+	bool RecordRing::IsEmpty() const noexcept
+	{
+		return Size() == 0uz;
+	}
+
+	std::optional<std::span<std::byte>> RecordRing::Reserve(const std::size_t size) noexcept
+	{
+		if (size > MaxRecordSize()) [[unlikely]]
+		{
+			return std::nullopt;
+		}
+
+		const std::size_t currentHead = head.load(std::memory_order_relaxed);
+		const std::size_t contiguousSize = Capacity() - (currentHead & mask);
+		const std::size_t fullSize = FullRecordSize(size);
+		const std::size_t skipSize = fullSize > contiguousSize ? contiguousSize : 0uz;
+		const std::size_t requiredSize = skipSize + fullSize;
+		if (Capacity() - (currentHead - cachedTail) < requiredSize)
+		{
+			cachedTail = tail.load(std::memory_order_acquire);
+			if (Capacity() - (currentHead - cachedTail) < requiredSize)
+			{
+				return std::nullopt;
+			}
+		}
+
+		reservedPosition = currentHead + skipSize;
+		reservedSize = size;
+
+		return std::span<std::byte>(buffer.get() + (reservedPosition & mask) + HeaderSize, size);
+	}
+
+	void RecordRing::Commit() noexcept
+	{
+		Commit(reservedSize);
+	}
+
+	void RecordRing::Commit(const std::size_t size) noexcept
+	{
+		assert(reservedSize != NoRecord && "There's no reserved record.");
+		assert(size <= reservedSize && "The committed size is greater than the reserved one.");
+
+		const std::size_t currentHead = head.load(std::memory_order_relaxed);
+		if (reservedPosition != currentHead)
+		{
+			WriteHeader(currentHead, SkipMarker);
+		}
+		WriteHeader(reservedPosition, static_cast<Header>(size));
+		head.store(reservedPosition + FullRecordSize(size), std::memory_order_release);
+		reservedSize = NoRecord;
+	}
+
+	bool RecordRing::TryWrite(const std::span<const std::byte> record) noexcept
+	{
+		const std::optional<std::span<std::byte>> data = Reserve(record.size());
+		if (!data)
+		{
+			return false;
+		}
+
+		std::ranges::copy(record, data->data());
+		Commit();
+
+		return true;
+	}
+
+	std::optional<std::span<const std::byte>> RecordRing::Peek() noexcept
+	{
+		std::size_t position = tail.load(std::memory_order_relaxed);
+		if (cachedHead == position)
+		{
+			cachedHead = head.load(std::memory_order_acquire);
+			if (cachedHead == position)
+			{
+				return std::nullopt;
+			}
+		}
+
+		Header header = ReadHeader(position);
+		if (header == SkipMarker)
+		{
+			// The skip marker is committed together with the next record, so the record is there already.
+			position += Capacity() - (position & mask);
+			tail.store(position, std::memory_order_release);
+			header = ReadHeader(position);
+		}
+		peekedSize = header;
+
+		return std::span<const std::byte>(buffer.get() + (position & mask) + HeaderSize, header);
+	}
+
+	void RecordRing::Release() noexcept
+	{
+		assert(peekedSize != NoRecord && "There's no peeked record.");
+
+		tail.store(tail.load(std::memory_order_relaxed) + FullRecordSize(peekedSize), std::memory_order_release);
+		peekedSize = NoRecord;
+	}
+
+	constexpr std::size_t RecordRing::FullRecordSize(const std::size_t size) noexcept
+	{
+		return (HeaderSize + size + (RecordAlignment - 1uz)) & ~(RecordAlignment - 1uz);
+	}
+
+	void RecordRing::WriteHeader(const std::size_t position, const Header header) noexcept
+	{
+		std::memcpy(buffer.get() + (position & mask), &header, sizeof(Header));
+	}
+
+	RecordRing::Header RecordRing::ReadHeader(const std::size_t position) const noexcept
+	{
+		Header header;
+		std::memcpy(&header, buffer.get() + (position & mask), sizeof(Header));
+
+		return header;
+	}
+}
@@ -0,0 +1,292 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Memory:SPSCRing;
+
+import std;
+
+import :CacheLine;
+
+export namespace PonyEngine::Memory
+{
+	/// @brief Bounded wait-free single-producer/single-consumer ring buffer.
+	/// @details Only one thread may push and only one thread may pop at the same time.
+	///          The producer and consumer positions live in different cache lines and each side caches the other one's position,
+	///          so the threads touch shared cache lines only when the ring looks full or empty.
+	/// @tparam T Value type. It must be nothrow move constructible.
+	template<typename T>
+	class SPSCRing final
+	{
+		static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_destructible_v<T>, "Value must be nothrow move constructible");
+
+	public:
+		/// @brief Creates a ring.
+		/// @param capacity Minimal capacity. It's rounded up to a power of two.
+		[[nodiscard("Pure constructor")]]
+		explicit SPSCRing(std::size_t capacity);
+		SPSCRing(const SPSCRing&) = delete;
+		SPSCRing(SPSCRing&&) = delete;
+
+		~SPSCRing() noexcept;
+
+		/// @brief Gets the capacity.
+		/// @return Capacity.
+		[[nodiscard("Pure function")]]
+		std::size_t Capacity() const noexcept;
+		/// @brief Gets the value count.
+		/// @return Value count. It's only a snapshot if the other thread is working with the ring.
+		[[nodiscard("Pure function")]]
+		std::size_t Size() const noexcept;
+		/// @brief Checks if the ring is empty.
+		/// @return @a True if it's empty; @a false otherwise. It's only a snapshot if the other thread is working with the ring.
+		[[nodiscard("Pure function")]]
+		bool IsEmpty() const noexcept;
+
+		/// @brief Tries to push the @p value.
+		/// @param value Value.
+		/// @return @a True if it's pushed; @a false if the ring is full.
+		/// @note Producer function.
+		[[nodiscard("Must check the result")]]
+		bool TryPush(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>);
+		/// @brief Tries to push the @p value.
+		/// @param value Value.
+		/// @return @a True if it's pushed; @a false if the ring is full. The @p value isn't moved if it's not pushed.
+		/// @note Producer function.
+		[[nodiscard("Must check the result")]]
+		bool TryPush(T&& value) noexcept;
+		/// @brief Tries to construct a value in the ring.
+		/// @tparam Args Argument types.
+		/// @param args Arguments.
+		/// @return @a True if it's pushed; @a false if the ring is full.
+		/// @note Producer function.
+		template<typename... Args> [[nodiscard("Must check the result")]]
+		bool TryEmplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>);
+		/// @brief Pushes as many @p values as fit.
+		/// @details The values are published together, so the consumer takes a single synchronization for the whole batch.
+		/// @param values Values.
+		/// @return Pushed value count. The values are pushed from the beginning of the span.
+		/// @note Producer function.
+		std::size_t TryPushBatch(std::span<const T> values) noexcept requires std::is_nothrow_copy_constructible_v<T>;
+
+		/// @brief Tries to pop a value.
+		/// @return Popped value or @a nullopt if the ring is empty.
+		/// @note Consumer function.
+		[[nodiscard("Must use the result")]]
+		std::optional<T> TryPop() noexcept;
+		/// @brief Pops as many values as available into the @p values.
+		/// @details The popped slots are released together, so the producer takes a single synchronization for the whole batch.
+		/// @param values Output values. They're move-assigned from the beginning of the span.
+		/// @return Popped value count.
+		/// @note Consumer function.
+		std::size_t TryPopBatch(std::span<T> values) noexcept requires std::is_nothrow_move_assignable_v<T>;
+
+		SPSCRing& operator =(const SPSCRing&) = delete;
+		SPSCRing& operator =(SPSCRing&&) = delete;
+
+	private:
+		/// @brief Gets a slot.
+		/// @param position Position.
+		/// @return Slot.
+		[[nodiscard("Pure function")]]
+		T* Slot(std::size_t position) const noexcept;
+		/// @brief Gets the free slot count for the producer.
+		/// @param currentHead Current head.
+		/// @param required Required free slot count. The tail is reloaded only if the cached one doesn't give enough space.
+		/// @return Free slot count.
+		[[nodiscard("Must use the result")]]
+		std::size_t FreeCount(std::size_t currentHead, std::size_t required) noexcept;
+		/// @brief Gets the available value count for the consumer.
+		/// @param currentTail Current tail.
+		/// @param required Required value count. The head is reloaded only if the cached one doesn't give enough values.
+		/// @return Available value count.
+		[[nodiscard("Must use the result")]]
+		std::size_t AvailableCount(std::size_t currentTail, std::size_t required) noexcept;
+
+		alignas(CacheLineSize) std::atomic<std::size_t> head; ///< Next write position. It's written by the producer.
+		std::size_t cachedTail; ///< Last seen tail. It's used by the producer.
+
+		alignas(CacheLineSize) std::atomic<std::size_t> tail; ///< Next read position. It's written by the consumer.
+		std::size_t cachedHead; ///< Last seen head. It's used by the consumer.
+
+		alignas(CacheLineSize) T* slots; ///< Slots.
+		std::size_t mask; ///< Position mask. It's capacity - 1.
+	};
+}
+
+namespace PonyEngine::Memory
+{
+	template<typename T>
+	SPSCRing<T>::SPSCRing(const std::size_t capacity) :
+		head(0uz),
+		cachedTail{0uz},
+		tail(0uz),
+		cachedHead{0uz}
+	{
+		if (capacity == 0uz || capacity > (std::numeric_limits<std::size_t>::max() >> 1uz) + 1uz) [[unlikely]]
+		{
+			throw std::invalid_argument("Invalid capacity");
+		}
+
+		const std::size_t slotCount = std::bit_ceil(capacity);
+		slots = std::allocator<T>().allocate(slotCount);
+		mask = slotCount - 1uz;
+	}
+
+	template<typename T>
+	SPSCRing<T>::~SPSCRing() noexcept
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			for (std::size_t position = tail.load(std::memory_order_relaxed), end = head.load(std::memory_order_relaxed); position != end; ++position)
+			{
+				std::destroy_at(Slot(position));
+			}
+		}
+
+		std::allocator<T>().deallocate(slots, mask + 1uz);
+	}
+
+	template<typename T>
+	std::size_t SPSCRing<T>::Capacity() const noexcept
+	{
+		return mask + 1uz;
+	}
+
+	template<typename T>
+	std::size_t SPSCRing<T>::Size() const noexcept
+	{
+		const std::size_t currentTail = tail.load(std::memory_order_acquire);
+		const std::size_t currentHead = head.load(std::memory_order_acquire);
+
+		return currentHead - currentTail;
+	}
+
+	template<typename T>
+	bool SPSCRing<T>::IsEmpty() const noexcept
+	{
+		return Size() == 0uz;
+	}
+
+	template<typename T>
+	bool SPSCRing<T>::TryPush(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
+	{
+		return TryEmplace(value);
+	}
+
+	template<typename T>
+	bool SPSCRing<T>::TryPush(T&& value) noexcept
+	{
+		return TryEmplace(std::move(value));
+	}
+
+	template<typename T>
+	template<typename... Args>
+	bool SPSCRing<T>::TryEmplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
+	{
+		const std::size_t currentHead = head.load(std::memory_order_relaxed);
+		if (FreeCount(currentHead, 1uz) == 0uz)
+		{
+			return false;
+		}
+
+		std::construct_at(Slot(currentHead), std::forward<Args>(args)...);
+		head.store(currentHead + 1uz, std::memory_order_release);
+
+		return true;
+	}
+
+	template<typename T>
+	std::size_t SPSCRing<T>::TryPushBatch(const std::span<const T> values) noexcept requires std::is_nothrow_copy_constructible_v<T>
+	{
+		const std::size_t currentHead = head.load(std::memory_order_relaxed);
+		const std::size_t count = std::min(FreeCount(currentHead, values.size()), values.size());
+
+		for (std::size_t i = 0uz; i < count; ++i)
+		{
+			std::construct_at(Slot(currentHead + i), values[i]);
+		}
+
+		if (count > 0uz)
+		{
+			head.store(currentHead + count, std::memory_order_release);
+		}
+
+		return count;
+	}
+
+	template<typename T>
+	std::optional<T> SPSCRing<T>::TryPop() noexcept
+	{
+		const std::size_t currentTail = tail.load(std::memory_order_relaxed);
+		if (AvailableCount(currentTail, 1uz) == 0uz)
+		{
+			return std::nullopt;
+		}
+
+		T* const slot = Slot(currentTail);
+		std::optional<T> value(std::move(*slot));
+		std::destroy_at(slot);
+		tail.store(currentTail + 1uz, std::memory_order_release);
+
+		return value;
+	}
+
+	template<typename T>
+	std::size_t SPSCRing<T>::TryPopBatch(const std::span<T> values) noexcept requires std::is_nothrow_move_assignable_v<T>
+	{
+		const std::size_t currentTail = tail.load(std::memory_order_relaxed);
+		const std::size_t count = std::min(AvailableCount(currentTail, values.size()), values.size());
+
+		for (std::size_t i = 0uz; i < count; ++i)
+		{
+			T* const slot = Slot(currentTail + i);
+			values[i] = std::move(*slot);
+			std::destroy_at(slot);
+		}
+
+		if (count > 0uz)
+		{
+			tail.store(currentTail + count, std::memory_order_release);
+		}
+
+		return count;
+	}
+
+	template<typename T>
+	T* SPSCRing<T>::Slot(const std::size_t position) const noexcept
+	{
+		return slots + (position & mask);
+	}
+
+	template<typename T>
+	std::size_t SPSCRing<T>::FreeCount(const std::size_t currentHead, const std::size_t required) noexcept
+	{
+		std::size_t freeCount = Capacity() - (currentHead - cachedTail);
+		if (freeCount < required)
+		{
+			cachedTail = tail.load(std::memory_order_acquire);
+			freeCount = Capacity() - (currentHead - cachedTail);
+		}
+
+		return freeCount;
+	}
+
+	template<typename T>
+	std::size_t SPSCRing<T>::AvailableCount(const std::size_t currentTail, const std::size_t required) noexcept
+	{
+		std::size_t availableCount = cachedHead - currentTail;
+		if (availableCount < required)
+		{
+			cachedHead = head.load(std::memory_order_acquire);
+			availableCount = cachedHead - currentTail;
+		}
+
+		return availableCount;
+	}
+}
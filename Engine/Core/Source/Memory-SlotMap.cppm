@@ -0,0 +1,492 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+module;
+
+#include <cassert>
+
+export module PonyEngine.Memory:SlotMap;
+
+import std;
+
+export namespace PonyEngine::Memory
+{
+	/// @brief Slot map key.
+	/// @details It packs a slot index and a slot generation into one 32-bit value. A zero key is always invalid.
+	struct SlotKey final
+	{
+		std::uint32_t id = 0u; ///< Packed slot index and generation. It's used only by the owner.
+
+		/// @brief Checks if the key is valid.
+		/// @return @a True if it's valid; @a false otherwise.
+		/// @note It doesn't check if the key is in any slot map.
+		[[nodiscard("Pure function")]]
+		constexpr bool IsValid() const noexcept;
+
+		/// @brief Checks if the key is valid.
+		/// @return @a True if it's valid; @a false otherwise.
+		/// @note It doesn't check if the key is in any slot map.
+		[[nodiscard("Pure operator")]]
+		explicit constexpr operator bool() const noexcept;
+
+		[[nodiscard("Pure operator")]]
+		constexpr auto operator <=>(const SlotKey& other) const noexcept = default;
+	};
+
+	/// @brief Slot map.
+	/// @details It keeps values in a dense array and addresses them with generational keys.
+	///          Adding, removing and finding a value by its key take constant time. Iterating over the values is as fast as iterating over a vector.
+	///          A key of a removed value never matches a new value: a slot generation grows on every removal and the slot is retired when its generation is exhausted.
+	/// @tparam T Value type.
+	template<typename T>
+	class SlotMap final
+	{
+	public:
+		static constexpr std::uint32_t IndexBitCount = 20u; ///< Bit count of a slot index in a key.
+		static constexpr std::uint32_t GenerationBitCount = 32u - IndexBitCount; ///< Bit count of a slot generation in a key.
+		static constexpr std::size_t MaxSize = std::size_t{1} << IndexBitCount; ///< Max value count.
+
+		[[nodiscard("Pure constructor")]]
+		SlotMap() noexcept = default;
+		[[nodiscard("Pure constructor")]]
+		SlotMap(const SlotMap& other) = default;
+		[[nodiscard("Pure constructor")]]
+		SlotMap(SlotMap&& other) noexcept;
+
+		~SlotMap() noexcept = default;
+
+		/// @brief Gets the value count.
+		/// @return Value count.
+		[[nodiscard("Pure function")]]
+		std::size_t Size() const noexcept;
+		/// @brief Checks if the slot map is empty.
+		/// @return @a True if it's empty; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool IsEmpty() const noexcept;
+
+		/// @brief Reserves memory for the @p capacity values.
+		/// @param capacity Value capacity.
+		void Reserve(std::size_t capacity);
+
+		/// @brief Finds a dense index of the @p key.
+		/// @param key Key.
+		/// @return Value index or @p Size() if not found.
+		[[nodiscard("Pure function")]]
+		std::size_t IndexOf(SlotKey key) const noexcept;
+		/// @brief Checks if the slot map contains the @p key.
+		/// @param key Key.
+		/// @return @a True if it contains; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool Contains(SlotKey key) const noexcept;
+		/// @brief Finds a value by the @p key.
+		/// @param key Key.
+		/// @return Value; nullptr if not found.
+		[[nodiscard("Pure function")]]
+		T* Find(SlotKey key) noexcept;
+		/// @brief Finds a value by the @p key.
+		/// @param key Key.
+		/// @return Value; nullptr if not found.
+		[[nodiscard("Pure function")]]
+		const T* Find(SlotKey key) const noexcept;
+
+		/// @brief Gets a key of the value at the @p index.
+		/// @param index Value index.
+		/// @return Key.
+		[[nodiscard("Pure function")]]
+		SlotKey Key(std::size_t index) const noexcept;
+
+		/// @brief Gets the values.
+		/// @return Values. They're invalidated on adding and removing.
+		[[nodiscard("Pure function")]]
+		std::span<T> Values() noexcept;
+		/// @brief Gets the values.
+		/// @return Values. They're invalidated on adding and removing.
+		[[nodiscard("Pure function")]]
+		std::span<const T> Values() const noexcept;
+
+		/// @brief Adds a value.
+		/// @param value Value.
+		/// @return Key of the value.
+		SlotKey Add(const T& value);
+		/// @brief Adds a value.
+		/// @param value Value.
+		/// @return Key of the value.
+		SlotKey Add(T&& value);
+		/// @brief Constructs a value in place.
+		/// @tparam Args Argument types.
+		/// @param args Value constructor arguments.
+		/// @return Key of the value.
+		template<typename... Args>
+		SlotKey Emplace(Args&&... args);
+		/// @brief Removes a value at the @p index.
+		/// @details The last value is moved into the removed place. It's O(1), but it changes the order of values.
+		/// @param index Value index.
+		void Remove(std::size_t index) noexcept;
+		/// @brief Removes a value at the @p index keeping the order of the rest values.
+		/// @details It's O(n). Use it only if the order matters.
+		/// @param index Value index.
+		void RemoveOrdered(std::size_t index) noexcept;
+		/// @brief Removes all the values. All the previously returned keys become invalid.
+		void Clear() noexcept;
+
+		/// @brief Gets a value at the @p index.
+		/// @param index Value index.
+		/// @return Value.
+		[[nodiscard("Pure operator")]]
+		T& operator [](std::size_t index) noexcept;
+		/// @brief Gets a value at the @p index.
+		/// @param index Value index.
+		/// @return Value.
+		[[nodiscard("Pure operator")]]
+		const T& operator [](std::size_t index) const noexcept;
+
+		/// @brief Gets an iterator to the first value.
+		/// @return Iterator.
+		[[nodiscard("Pure function")]]
+		auto begin() noexcept;
+		/// @brief Gets an iterator to the first value.
+		/// @return Iterator.
+		[[nodiscard("Pure function")]]
+		auto begin() const noexcept;
+		/// @brief Gets an iterator past the last value.
+		/// @return Iterator.
+		[[nodiscard("Pure function")]]
+		auto end() noexcept;
+		/// @brief Gets an iterator past the last value.
+		/// @return Iterator.
+		[[nodiscard("Pure function")]]
+		auto end() const noexcept;
+
+		SlotMap& operator =(const SlotMap& other) = default;
+		SlotMap& operator =(SlotMap&& other) noexcept;
+
+	private:
+		/// @brief Slot.
+		struct Slot final
+		{
+			std::uint32_t index; ///< Dense index if the slot is alive; next free slot otherwise.
+			std::uint32_t generation; ///< Slot generation. Zero means the slot is retired.
+		};
+
+		static constexpr std::uint32_t IndexMask = (1u << IndexBitCount) - 1u; ///< Slot index mask.
+		static constexpr std::uint32_t MaxGeneration = (1u << GenerationBitCount) - 1u; ///< Max slot generation.
+		static constexpr std::uint32_t NoSlot = std::numeric_limits<std::uint32_t>::max(); ///< No slot marker.
+
+		/// @brief Makes a key.
+		/// @param slot Slot index.
+		/// @param generation Slot generation.
+		/// @return Key.
+		[[nodiscard("Pure function")]]
+		static constexpr SlotKey MakeKey(std::uint32_t slot, std::uint32_t generation) noexcept;
+
+		/// @brief Frees the slot.
+		/// @param slot Slot index.
+		void FreeSlot(std::uint32_t slot) noexcept;
+
+		std::vector<T> values; ///< Dense values.
+		std::vector<std::uint32_t> valueSlots; ///< Slot indices of the values. It's synced with @p values by index.
+		std::vector<Slot> slots; ///< Slots.
+		std::uint32_t freeSlot = NoSlot; ///< First free slot.
+	};
+}
+
+export template<>
+struct std::hash<PonyEngine::Memory::SlotKey> final
+{
+	[[nodiscard("Pure function")]]
+	size_t operator ()(const PonyEngine::Memory::SlotKey key) const noexcept
+	{
+		return std::hash<std::uint32_t>()(key.id);
+	}
+};
+
+namespace PonyEngine::Memory
+{
+	constexpr bool SlotKey::IsValid() const noexcept
+	{
+		return id;
+	}
+
+	constexpr SlotKey::operator bool() const noexcept
+	{
+		return IsValid();
+	}
+
+	template<typename T>
+	SlotMap<T>::SlotMap(SlotMap&& other) noexcept :
+		values(std::move(other.values)),
+		valueSlots(std::move(other.valueSlots)),
+		slots(std::move(other.slots)),
+		freeSlot{std::exchange(other.freeSlot, NoSlot)}
+	{
+		other.values.clear();
+		other.valueSlots.clear();
+		other.slots.clear();
+	}
+
+	template<typename T>
+	std::size_t SlotMap<T>::Size() const noexcept
+	{
+		return values.size();
+	}
+
+	template<typename T>
+	bool SlotMap<T>::IsEmpty() const noexcept
+	{
+		return values.empty();
+	}
+
+	template<typename T>
+	void SlotMap<T>::Reserve(const std::size_t capacity)
+	{
+		values.reserve(capacity);
+		valueSlots.reserve(capacity);
+		slots.reserve(capacity);
+	}
+
+	template<typename T>
+	std::size_t SlotMap<T>::IndexOf(const SlotKey key) const noexcept
+	{
+		const std::uint32_t slotIndex = key.id & IndexMask;
+		if (slotIndex >= slots.size()) [[unlikely]]
+		{
+			return values.size();
+		}
+
+		const Slot& slot = slots[slotIndex];
+		const bool isAlive = slot.generation == key.id >> IndexBitCount && slot.index < values.size() && valueSlots[slot.index] == slotIndex;
+
+		return isAlive ? slot.index : values.size();
+	}
+
+	template<typename T>
+	bool SlotMap<T>::Contains(const SlotKey key) const noexcept
+	{
+		return IndexOf(key) < values.size();
+	}
+
+	template<typename T>
+	T* SlotMap<T>::Find(const SlotKey key) noexcept
+	{
+		const std::size_t index = IndexOf(key);
+		return index < values.size() ? &values[index] : nullptr;
+	}
+
+	template<typename T>
+	const T* SlotMap<T>::Find(const SlotKey key) const noexcept
+	{
+		const std::size_t index = IndexOf(key);
+		return index < values.size() ? &values[index] : nullptr;
+	}
+
+	template<typename T>
+	SlotKey SlotMap<T>::Key(const std::size_t index) const noexcept
+	{
+		assert(index < values.size() && "The index is out of range.");
+
+		const std::uint32_t slotIndex = valueSlots[index];
+		return MakeKey(slotIndex, slots[slotIndex].generation);
+	}
+
+	template<typename T>
+	std::span<T> SlotMap<T>::Values() noexcept
+	{
+		return values;
+	}
+
+	template<typename T>
+	std::span<const T> SlotMap<T>::Values() const noexcept
+	{
+		return values;
+	}
+
+	template<typename T>
+	SlotKey SlotMap<T>::Add(const T& value)
+	{
+		return Emplace(value);
+	}
+
+	template<typename T>
+	SlotKey SlotMap<T>::Add(T&& value)
+	{
+		return Emplace(std::move(value));
+	}
+
+	template<typename T>
+	template<typename... Args>
+	SlotKey SlotMap<T>::Emplace(Args&&... args)
+	{
+		const bool isNewSlot = freeSlot == NoSlot;
+		const std::uint32_t slotIndex = isNewSlot ? static_cast<std::uint32_t>(slots.size()) : freeSlot;
+		if (isNewSlot)
+		{
+			if (slots.size() >= MaxSize) [[unlikely]]
+			{
+				throw std::overflow_error("No more slots available");
+			}
+
+			slots.push_back(Slot{.index = NoSlot, .generation = 1u});
+		}
+
+		try
+		{
+			valueSlots.push_back(slotIndex);
+			try
+			{
+				values.emplace_back(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				valueSlots.pop_back();
+				throw;
+			}
+		}
+		catch (...)
+		{
+			if (isNewSlot)
+			{
+				slots.pop_back();
+			}
+			throw;
+		}
+
+		Slot& slot = slots[slotIndex];
+		if (!isNewSlot)
+		{
+			freeSlot = slot.index;
+		}
+		slot.index = static_cast<std::uint32_t>(values.size() - 1uz);
+
+		return MakeKey(slotIndex, slot.generation);
+	}
+
+	template<typename T>
+	void SlotMap<T>::Remove(const std::size_t index) noexcept
+	{
+		static_assert(std::is_nothrow_move_assignable_v<T>, "The value type must be nothrow move assignable.");
+		assert(index < values.size() && "The index is out of range.");
+
+		const std::uint32_t slotIndex = valueSlots[index];
+		if (const std::size_t lastIndex = values.size() - 1uz; index != lastIndex)
+		{
+			values[index] = std::move(values[lastIndex]);
+			valueSlots[index] = valueSlots[lastIndex];
+			slots[valueSlots[index]].index = static_cast<std::uint32_t>(index);
+		}
+
+		values.pop_back();
+		valueSlots.pop_back();
+		FreeSlot(slotIndex);
+	}
+
+	template<typename T>
+	void SlotMap<T>::RemoveOrdered(const std::size_t index) noexcept
+	{
+		static_assert(std::is_nothrow_move_assignable_v<T>, "The value type must be nothrow move assignable.");
+		assert(index < values.size() && "The index is out of range.");
+
+		const std::uint32_t slotIndex = valueSlots[index];
+		values.erase(values.cbegin() + index);
+		valueSlots.erase(valueSlots.cbegin() + index);
+		for (std::size_t i = index; i < valueSlots.size(); ++i)
+		{
+			slots[valueSlots[i]].index = static_cast<std::uint32_t>(i);
+		}
+
+		FreeSlot(slotIndex);
+	}
+
+	template<typename T>
+	void SlotMap<T>::Clear() noexcept
+	{
+		for (const std::uint32_t slotIndex : valueSlots)
+		{
+			FreeSlot(slotIndex);
+		}
+
+		values.clear();
+		valueSlots.clear();
+	}
+
+	template<typename T>
+	T& SlotMap<T>::operator [](const std::size_t index) noexcept
+	{
+		assert(index < values.size() && "The index is out of range.");
+		return values[index];
+	}
+
+	template<typename T>
+	const T& SlotMap<T>::operator [](const std::size_t index) const noexcept
+	{
+		assert(index < values.size() && "The index is out of range.");
+		return values[index];
+	}
+
+	template<typename T>
+	auto SlotMap<T>::begin() noexcept
+	{
+		return values.begin();
+	}
+
+	template<typename T>
+	auto SlotMap<T>::begin() const noexcept
+	{
+		return values.cbegin();
+	}
+
+	template<typename T>
+	auto SlotMap<T>::end() noexcept
+	{
+		return values.end();
+	}
+
+	template<typename T>
+	auto SlotMap<T>::end() const noexcept
+	{
+		return values.cend();
+	}
+
+	template<typename T>
+	SlotMap<T>& SlotMap<T>::operator =(SlotMap&& other) noexcept
+	{
+		values = std::move(other.values);
+		valueSlots = std::move(other.valueSlots);
+		slots = std::move(other.slots);
+		freeSlot = std::exchange(other.freeSlot, NoSlot);
+
+		other.values.clear();
+		other.valueSlots.clear();
+		other.slots.clear();
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr SlotKey SlotMap<T>::MakeKey(const std::uint32_t slot, const std::uint32_t generation) noexcept
+	{
+		return SlotKey{.id = generation << IndexBitCount | slot};
+	}
+
+	template<typename T>
+	void SlotMap<T>::FreeSlot(const std::uint32_t slot) noexcept
+	{
+		Slot& freed = slots[slot];
+		if (freed.generation < MaxGeneration) [[likely]]
+		{
+			++freed.generation;
+			freed.index = freeSlot;
+			freeSlot = slot;
+		}
+		else
+		{
+			freed.generation = 0u;
+			freed.index = NoSlot;
+		}
+	}
+}
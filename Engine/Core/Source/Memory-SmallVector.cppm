@@ -0,0 +1,444 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+module;
+
+#include <cassert>
+
+export module PonyEngine.Memory:SmallVector;
+
+import std;
+
+export namespace PonyEngine::Memory
+{
+	/// @brief Vector with an inline storage.
+	/// @details It keeps up to @p N values inside itself and allocates a heap buffer only when it grows bigger.
+	///          It's contiguous, so it converts to @p std::span and works with range algorithms.
+	/// @tparam T Value type. It must be nothrow movable.
+	/// @tparam N Inline capacity.
+	template<typename T, std::size_t N>
+	class SmallVector final
+	{
+		static_assert(N > 0uz, "Inline capacity must be greater than zero");
+		static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>, "Value must be nothrow movable");
+
+	public:
+		static constexpr std::size_t InlineCapacity = N; ///< Inline capacity.
+
+		[[nodiscard("Pure constructor")]]
+		SmallVector() noexcept;
+		/// @brief Creates a vector with the @p values.
+		/// @param values Values.
+		[[nodiscard("Pure constructor")]]
+		SmallVector(std::initializer_list<T> values);
+		[[nodiscard("Pure constructor")]]
+		SmallVector(const SmallVector& other);
+		[[nodiscard("Pure constructor")]]
+		SmallVector(SmallVector&& other) noexcept;
+
+		~SmallVector() noexcept;
+
+		/// @brief Gets the value count.
+		/// @return Value count.
+		[[nodiscard("Pure function")]]
+		std::size_t Size() const noexcept;
+		/// @brief Gets the capacity.
+		/// @return Capacity.
+		[[nodiscard("Pure function")]]
+		std::size_t Capacity() const noexcept;
+		/// @brief Checks if the vector is empty.
+		/// @return @a True if it's empty; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool IsEmpty() const noexcept;
+		/// @brief Checks if the values are in the inline storage.
+		/// @return @a True if they're inline; @a false if they're in a heap buffer.
+		[[nodiscard("Pure function")]]
+		bool IsInline() const noexcept;
+
+		/// @brief Gets the values.
+		/// @return Values.
+		[[nodiscard("Pure function")]]
+		T* Data() noexcept;
+		/// @brief Gets the values.
+		/// @return Values.
+		[[nodiscard("Pure function")]]
+		const T* Data() const noexcept;
+
+		/// @brief Reserves memory for the @p capacity values.
+		/// @param capacity Value capacity.
+		void Reserve(std::size_t capacity);
+		/// @brief Resizes the vector. New values are value-initialized.
+		/// @param size New size.
+		void Resize(std::size_t size);
+
+		/// @brief Adds a value to the end.
+		/// @param value Value.
+		/// @return Added value.
+		T& Add(const T& value);
+		/// @brief Adds a value to the end.
+		/// @param value Value.
+		/// @return Added value.
+		T& Add(T&& value);
+		/// @brief Constructs a value in place at the end.
+		/// @tparam Args Argument types.
+		/// @param args Value constructor arguments.
+		/// @return Added value.
+		template<typename... Args>
+		T& Emplace(Args&&... args);
+		/// @brief Removes a value at the @p index keeping the order of the rest values.
+		/// @param index Value index.
+		void Remove(std::size_t index) noexcept;
+		/// @brief Removes the last value.
+		void RemoveLast() noexcept;
+		/// @brief Removes all the values. It keeps the capacity.
+		void Clear() noexcept;
+
+		/// @brief Gets a value at the @p index.
+		/// @param index Value index.
+		/// @return Value.
+		[[nodiscard("Pure operator")]]
+		T& operator [](std::size_t index) noexcept;
+		/// @brief Gets a value at the @p index.
+		/// @param index Value index.
+		/// @return Value.
+		[[nodiscard("Pure operator")]]
+		const T& operator [](std::size_t index) const noexcept;
+
+		/// @brief Gets a begin iterator.
+		/// @return Begin iterator.
+		[[nodiscard("Pure function")]]
+		T* begin() noexcept;
+		/// @brief Gets a begin iterator.
+		/// @return Begin iterator.
+		[[nodiscard("Pure function")]]
+		const T* begin() const noexcept;
+		/// @brief Gets an end iterator.
+		/// @return End iterator.
+		[[nodiscard("Pure function")]]
+		T* end() noexcept;
+		/// @brief Gets an end iterator.
+		/// @return End iterator.
+		[[nodiscard("Pure function")]]
+		const T* end() const noexcept;
+
+		SmallVector& operator =(const SmallVector& other);
+		SmallVector& operator =(SmallVector&& other) noexcept;
+
+	private:
+		/// @brief Gets an inline storage pointer.
+		/// @return Inline storage.
+		[[nodiscard("Pure function")]]
+		T* InlineData() noexcept;
+		/// @brief Calculates a new capacity for the @p required value count.
+		/// @param required Required value count.
+		/// @return New capacity.
+		[[nodiscard("Pure function")]]
+		std::size_t GrownCapacity(std::size_t required) const noexcept;
+		/// @brief Moves the values into a new heap buffer.
+		/// @param buffer New buffer. It must be able to contain all the values.
+		/// @param capacity New buffer capacity.
+		void Relocate(T* buffer, std::size_t capacity) noexcept;
+		/// @brief Destroys the values and releases the heap buffer if it's used.
+		void Release() noexcept;
+		/// @brief Takes the values of the @p other. This must be empty and inline.
+		/// @param other Source vector.
+		void Steal(SmallVector& other) noexcept;
+
+		alignas(T) std::byte storage[N * sizeof(T)]; ///< Inline storage.
+		T* data; ///< Current values. It points to the inline storage or to a heap buffer.
+		std::size_t size; ///< Value count.
+		std::size_t capacity; ///< Current capacity.
+	};
+}
+
+namespace PonyEngine::Memory
+{
+	template<typename T, std::size_t N>
+	SmallVector<T, N>::SmallVector() noexcept :
+		data{InlineData()},
+		size{0uz},
+		capacity{N}
+	{
+	}
+
+	template<typename T, std::size_t N>
+	SmallVector<T, N>::SmallVector(const std::initializer_list<T> values) :
+		SmallVector()
+	{
+		Reserve(values.size());
+		std::uninitialized_copy(values.begin(), values.end(), data);
+		size = values.size();
+	}
+
+	template<typename T, std::size_t N>
+	SmallVector<T, N>::SmallVector(const SmallVector& other) :
+		SmallVector()
+	{
+		Reserve(other.size);
+		std::uninitialized_copy_n(other.data, other.size, data);
+		size = other.size;
+	}
+
+	template<typename T, std::size_t N>
+	SmallVector<T, N>::SmallVector(SmallVector&& other) noexcept :
+		SmallVector()
+	{
+		Steal(other);
+	}
+
+	template<typename T, std::size_t N>
+	SmallVector<T, N>::~SmallVector() noexcept
+	{
+		Release();
+	}
+
+	template<typename T, std::size_t N>
+	std::size_t SmallVector<T, N>::Size() const noexcept
+	{
+		return size;
+	}
+
+	template<typename T, std::size_t N>
+	std::size_t SmallVector<T, N>::Capacity() const noexcept
+	{
+		return capacity;
+	}
+
+	template<typename T, std::size_t N>
+	bool SmallVector<T, N>::IsEmpty() const noexcept
+	{
+		return size == 0uz;
+	}
+
+	template<typename T, std::size_t N>
+	bool SmallVector<T, N>::IsInline() const noexcept
+	{
+		return static_cast<const void*>(data) == static_cast<const void*>(storage);
+	}
+
+	template<typename T, std::size_t N>
+	T* SmallVector<T, N>::Data() noexcept
+	{
+		return data;
+	}
+
+	template<typename T, std::size_t N>
+	const T* SmallVector<T, N>::Data() const noexcept
+	{
+		return data;
+	}
+
+	template<typename T, std::size_t N>
+	void SmallVector<T, N>::Reserve(const std::size_t capacity)
+	{
+		if (capacity > this->capacity)
+		{
+			Relocate(std::allocator<T>().allocate(capacity), capacity);
+		}
+	}
+
+	template<typename T, std::size_t N>
+	void SmallVector<T, N>::Resize(const std::size_t size)
+	{
+		if (size > this->size)
+		{
+			Reserve(size);
+			std::uninitialized_value_construct(data + this->size, data + size);
+		}
+		else
+		{
+			std::destroy(data + size, data + this->size);
+		}
+
+		this->size = size;
+	}
+
+	template<typename T, std::size_t N>
+	T& SmallVector<T, N>::Add(const T& value)
+	{
+		return Emplace(value);
+	}
+
+	template<typename T, std::size_t N>
+	T& SmallVector<T, N>::Add(T&& value)
+	{
+		return Emplace(std::move(value));
+	}
+
+	template<typename T, std::size_t N>
+	template<typename... Args>
+	T& SmallVector<T, N>::Emplace(Args&&... args)
+	{
+		if (size < capacity) [[likely]]
+		{
+			T* const value = std::construct_at(data + size, std::forward<Args>(args)...);
+			++size;
+
+			return *value;
+		}
+
+		// The new value is constructed before relocating because the arguments may refer to the current values.
+		const std::size_t newCapacity = GrownCapacity(size + 1uz);
+		T* const buffer = std::allocator<T>().allocate(newCapacity);
+		try
+		{
+			std::construct_at(buffer + size, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			std::allocator<T>().deallocate(buffer, newCapacity);
+			throw;
+		}
+		Relocate(buffer, newCapacity);
+		++size;
+
+		return data[size - 1uz];
+	}
+
+	template<typename T, std::size_t N>
+	void SmallVector<T, N>::Remove(const std::size_t index) noexcept
+	{
+		assert(index < size && "The index is out of range.");
+
+		std::move(data + index + 1uz, data + size, data + index);
+		RemoveLast();
+	}
+
+	template<typename T, std::size_t N>
+	void SmallVector<T, N>::RemoveLast() noexcept
+	{
+		assert(size > 0uz && "The vector is empty.");
+
+		std::destroy_at(data + --size);
+	}
+
+	template<typename T, std::size_t N>
+	void SmallVector<T, N>::Clear() noexcept
+	{
+		std::destroy_n(data, size);
+		size = 0uz;
+	}
+
+	template<typename T, std::size_t N>
+	T& SmallVector<T, N>::operator [](const std::size_t index) noexcept
+	{
+		assert(index < size && "The index is out of range.");
+
+		return data[index];
+	}
+
+	template<typename T, std::size_t N>
+	const T& SmallVector<T, N>::operator [](const std::size_t index) const noexcept
+	{
+		assert(index < size && "The index is out of range.");
+
+		return data[index];
+	}
+
+	template<typename T, std::size_t N>
+	T* SmallVector<T, N>::begin() noexcept
+	{
+		return data;
+	}
+
+	template<typename T, std::size_t N>
+	const T* SmallVector<T, N>::begin() const noexcept
+	{
+		return data;
+	}
+
+	template<typename T, std::size_t N>
+	T* SmallVector<T, N>::end() noexcept
+	{
+		return data + size;
+	}
+
+	template<typename T, std::size_t N>
+	const T* SmallVector<T, N>::end() const noexcept
+	{
+		return data + size;
+	}
+
+	template<typename T, std::size_t N>
+	SmallVector<T, N>& SmallVector<T, N>::operator =(const SmallVector& other)
+	{
+		if (this != &other)
+		{
+			Clear();
+			Reserve(other.size);
+			std::uninitialized_copy_n(other.data, other.size, data);
+			size = other.size;
+		}
+
+		return *this;
+	}
+
+	template<typename T, std::size_t N>
+	SmallVector<T, N>& SmallVector<T, N>::operator =(SmallVector&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Release();
+			data = InlineData();
+			size = 0uz;
+			capacity = N;
+			Steal(other);
+		}
+
+		return *this;
+	}
+
+	template<typename T, std::size_t N>
+	T* SmallVector<T, N>::InlineData() noexcept
+	{
+		return reinterpret_cast<T*>(storage);
+	}
+
+	template<typename T, std::size_t N>
+	std::size_t SmallVector<T, N>::GrownCapacity(const std::size_t required) const noexcept
+	{
+		return std::max(capacity * 2uz, required);
+	}
+
+	template<typename T, std::size_t N>
+	void SmallVector<T, N>::Relocate(T* const buffer, const std::size_t capacity) noexcept
+	{
+		std::uninitialized_move_n(data, size, buffer);
+		Release();
+		data = buffer;
+		this->capacity = capacity;
+	}
+
+	template<typename T, std::size_t N>
+	void SmallVector<T, N>::Release() noexcept
+	{
+		std::destroy_n(data, size);
+		if (!IsInline())
+		{
+			std::allocator<T>().deallocate(data, capacity);
+		}
+	}
+
+	template<typename T, std::size_t N>
+	void SmallVector<T, N>::Steal(SmallVector& other) noexcept
+	{
+		if (other.IsInline())
+		{
+			std::uninitialized_move_n(other.data, other.size, data);
+			size = other.size;
+			other.Clear();
+		}
+		else
+		{
+			data = std::exchange(other.data, other.InlineData());
+			size = std::exchange(other.size, 0uz);
+			capacity = std::exchange(other.capacity, N);
+		}
+	}
+}
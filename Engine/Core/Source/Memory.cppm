@@ -9,5 +9,13 @@
 
 export module PonyEngine.Memory;
 
+export import :AllocationTracking;
 export import :Arena;
+export import :CacheLine;
+export import :FlatHashMap;
+export import :MPSCRing;
 export import :Pool;
+export import :RecordRing;
+export import :SlotMap;
+export import :SmallVector;
+export import :SPSCRing;
@@ -7,6 +7,19 @@
  * Repo: https://github.com/ZorPastaman/PonyEngine *
  ***************************************************/
 
+module;
+
+#include <cassert>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define PONY_ENGINE_SERIALIZATION_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__SSSE3__) || defined(__AVX__)
+#define PONY_ENGINE_SERIALIZATION_SSSE3
+#include <tmmintrin.h>
+#endif
+
 export module PonyEngine.Serialization:Array;
 
 import std;
@@ -74,6 +87,184 @@ export namespace PonyEngine::Serialization
 	/// @remark Bool values are read without separators.
 	template<bool Optimized = false, Type::Arithmetic T>
 	const char* DeserializeArrayText(std::span<const char> data, std::span<T> values, char separator = SerializedArrayTextSeparator);
+
+	constexpr std::size_t ParallelArrayTextChunkLength = 256uz * 1024uz; ///< Min text length a thread parses in @p DeserializeArrayTextParallel().
+	constexpr std::size_t ParallelArrayTextChunkSize = 32uz * 1024uz; ///< Min value count a thread serializes in @p SerializeArrayTextParallel().
+
+	/// @brief Counts the @p separator in the text @p data.
+	/// @param data Text data.
+	/// @param separator Separator.
+	/// @return Separator count.
+	/// @remark It compares 16 characters at once where SSE2 is available.
+	[[nodiscard("Pure function")]]
+	std::size_t CountArrayTextSeparators(std::span<const char> data, char separator) noexcept;
+	/// @brief Finds the @p separator in the text @p data.
+	/// @param data Text data.
+	/// @param separator Separator.
+	/// @param positions Separator positions relative to the @p data start. It's filled from the beginning.
+	/// @return Count of the found positions. If it's less than the @p positions size, there're no more separators in the @p data.
+	/// @remark It compares 16 characters at once where SSE2 is available.
+	std::size_t FindArrayTextSeparators(std::span<const char> data, char separator, std::span<std::size_t> positions) noexcept;
+
+	/// @brief Serializes the @p values to the text @p data using several threads.
+	/// @details The values are split into chunks of at least @p ParallelArrayTextChunkSize values. Every chunk is measured and written by its own thread.
+	///          The text is the same as the @p SerializeArrayText() one. The @p data is changed only on success.
+	/// @tparam T Value type.
+	/// @param values Values.
+	/// @param data Text data.
+	/// @param separator Array element separator.
+	/// @param threadCount Max thread count including the calling one.
+	/// @return Pointer after the last element of the written data.
+	/// @remark Bool values are written without separators.
+	template<Type::Arithmetic T>
+	char* SerializeArrayTextParallel(std::span<const T> values, std::span<char> data, char separator = SerializedArrayTextSeparator, std::size_t threadCount = std::thread::hardware_concurrency());
+	/// @brief Deserializes the @p values from the text @p data using several threads.
+	/// @details The text is split into chunks of at least @p ParallelArrayTextChunkLength characters. The separators are counted in bulk to find the first value index of every chunk,
+	///          then every chunk is parsed by its own thread. Unlike @p DeserializeArrayText(), it requires exactly one separator between values,
+	///          and every value but the last one must take the whole text between its separators. An error message contains the index and the text offset of the first invalid value.
+	/// @tparam Optimized If true, it writes directly to the @p values; otherwise it creates a temporary buffer to write to and then copies it to the @p values.
+	///                   So, the main difference is what happens on an exception. If Optimized is @a true, the @p values may be corrupted. If Optimized is @a false, the @p values will be changed only on success.
+	/// @tparam T Value type.
+	/// @param data Text data.
+	/// @param values Values.
+	/// @param separator Array element separator.
+	/// @param threadCount Max thread count including the calling one.
+	/// @return Pointer after the last element of the read data.
+	/// @remark Bool values are read without separators.
+	template<bool Optimized = false, Type::Arithmetic T>
+	const char* DeserializeArrayTextParallel(std::span<const char> data, std::span<T> values, char separator = SerializedArrayTextSeparator, std::size_t threadCount = std::thread::hardware_concurrency());
+
+	/// @brief Max size of a varint (LEB128) of the @p T value.
+	/// @tparam T Value type.
+	template<Type::Integer T>
+	constexpr std::size_t MaxVarintSize = (sizeof(T) * 8uz + 6uz) / 7uz;
+
+	/// @brief Encodes the signed @p value so that values close to zero get small codes: 0, -1, 1, -2, 2 are encoded as 0, 1, 2, 3, 4.
+	/// @tparam T Value type.
+	/// @param value Value.
+	/// @return ZigZag code.
+	template<Type::Integer T> requires (Type::Signed<T>) [[nodiscard("Pure function")]]
+	constexpr std::make_unsigned_t<T> ZigZagEncode(T value) noexcept;
+	/// @brief Decodes the ZigZag @p code.
+	/// @tparam T Code type.
+	/// @param code ZigZag code.
+	/// @return Value.
+	template<Type::Integer T> requires (Type::Unsigned<T>) [[nodiscard("Pure function")]]
+	constexpr std::make_signed_t<T> ZigZagDecode(T code) noexcept;
+
+	/// @brief Gets a required binary size to serialize the @p values as varints.
+	/// @tparam T Value type.
+	/// @param values Values.
+	/// @return Binary size.
+	template<Type::Integer T> [[nodiscard("Pure function")]]
+	constexpr std::size_t GetSerializedArrayVarintSize(std::span<const T> values) noexcept;
+	/// @brief Serializes the @p values to the binary @p data as varints (LEB128). Signed values are ZigZag encoded.
+	/// @details Every value takes 1 byte per 7 significant bits. It's compact for small values: indices, counts, sizes.
+	/// @tparam T Value type.
+	/// @param values Values.
+	/// @param data Binary data. It may be partially written on an exception.
+	/// @return Pointer after the last element of the written data.
+	template<Type::Integer T>
+	std::byte* SerializeArrayVarint(std::span<const T> values, std::span<std::byte> data);
+	/// @brief Deserializes the @p values from the binary @p data written by @p SerializeArrayVarint().
+	/// @tparam T Value type.
+	/// @param data Binary data.
+	/// @param values Values. They may be partially written on an exception.
+	/// @return Pointer after the last element of the read data.
+	template<Type::Integer T>
+	const std::byte* DeserializeArrayVarint(std::span<const std::byte> data, std::span<T> values);
+
+	/// @brief Gets a required binary size to serialize the @p values with the delta encoding.
+	/// @tparam T Value type.
+	/// @param values Values.
+	/// @return Binary size.
+	template<Type::Integer T> [[nodiscard("Pure function")]]
+	constexpr std::size_t GetSerializedArrayDeltaSize(std::span<const T> values) noexcept;
+	/// @brief Serializes the @p values to the binary @p data with the delta encoding.
+	/// @details Every value is written as a ZigZag varint of its difference from the previous one. It's compact for sorted values: ids, offsets.
+	/// @tparam T Value type.
+	/// @param values Values.
+	/// @param data Binary data. It may be partially written on an exception.
+	/// @return Pointer after the last element of the written data.
+	template<Type::Integer T>
+	std::byte* SerializeArrayDelta(std::span<const T> values, std::span<std::byte> data);
+	/// @brief Deserializes the @p values from the binary @p data written by @p SerializeArrayDelta().
+	/// @tparam T Value type.
+	/// @param data Binary data.
+	/// @param values Values. They may be partially written on an exception.
+	/// @return Pointer after the last element of the read data.
+	template<Type::Integer T>
+	const std::byte* DeserializeArrayDelta(std::span<const std::byte> data, std::span<T> values);
+
+	/// @brief Gets a required binary size to serialize the @p values with the delta-of-delta encoding.
+	/// @tparam T Value type.
+	/// @param values Values.
+	/// @return Binary size.
+	template<Type::Integer T> [[nodiscard("Pure function")]]
+	constexpr std::size_t GetSerializedArrayDeltaOfDeltaSize(std::span<const T> values) noexcept;
+	/// @brief Serializes the @p values to the binary @p data with the delta-of-delta encoding.
+	/// @details Every value is written as a ZigZag varint of the difference between its delta and the previous delta.
+	///          It's compact for values growing with a near constant step: timestamps, frame numbers. A constant step takes 1 byte per value.
+	/// @tparam T Value type.
+	/// @param values Values.
+	/// @param data Binary data. It may be partially written on an exception.
+	/// @return Pointer after the last element of the written data.
+	template<Type::Integer T>
+	std::byte* SerializeArrayDeltaOfDelta(std::span<const T> values, std::span<std::byte> data);
+	/// @brief Deserializes the @p values from the binary @p data written by @p SerializeArrayDeltaOfDelta().
+	/// @tparam T Value type.
+	/// @param data Binary data.
+	/// @param values Values. They may be partially written on an exception.
+	/// @return Pointer after the last element of the read data.
+	template<Type::Integer T>
+	const std::byte* DeserializeArrayDeltaOfDelta(std::span<const std::byte> data, std::span<T> values);
+
+	/// @brief Gets a required binary size to serialize the @p values with the frame of reference encoding.
+	/// @tparam T Value type.
+	/// @param values Values.
+	/// @return Binary size.
+	template<Type::Integer T> [[nodiscard("Pure function")]]
+	constexpr std::size_t GetSerializedArrayFrameOfReferenceSize(std::span<const T> values) noexcept;
+	/// @brief Serializes the @p values to the binary @p data with the frame of reference encoding.
+	/// @details The min value is written once, then every value is written as its difference from the min packed to the bit width of the max difference.
+	///          It's compact for values in a narrow range: handles, small enums, quantized values.
+	/// @tparam T Value type.
+	/// @param values Values.
+	/// @param data Binary data.
+	/// @return Pointer after the last element of the written data.
+	template<Type::Integer T>
+	std::byte* SerializeArrayFrameOfReference(std::span<const T> values, std::span<std::byte> data);
+	/// @brief Deserializes the @p values from the binary @p data written by @p SerializeArrayFrameOfReference().
+	/// @tparam T Value type.
+	/// @param data Binary data.
+	/// @param values Values.
+	/// @return Pointer after the last element of the read data.
+	template<Type::Integer T>
+	const std::byte* DeserializeArrayFrameOfReference(std::span<const std::byte> data, std::span<T> values);
+
+	/// @brief Gets a required binary size to serialize the @p values with the stream VByte encoding.
+	/// @tparam T Value type.
+	/// @param values Values.
+	/// @return Binary size.
+	template<Type::Integer T> requires (sizeof(T) == 4uz) [[nodiscard("Pure function")]]
+	constexpr std::size_t GetSerializedArrayStreamVByteSize(std::span<const T> values) noexcept;
+	/// @brief Serializes the @p values to the binary @p data with the stream VByte encoding. Signed values are ZigZag encoded.
+	/// @details The byte lengths of the values are written as 2-bit codes first, then the significant bytes of the values.
+	///          It's a bit less compact than varints, but it's decoded 4 values at once with a byte shuffle.
+	/// @tparam T Value type.
+	/// @param values Values.
+	/// @param data Binary data. It may be partially written on an exception.
+	/// @return Pointer after the last element of the written data.
+	template<Type::Integer T> requires (sizeof(T) == 4uz)
+	std::byte* SerializeArrayStreamVByte(std::span<const T> values, std::span<std::byte> data);
+	/// @brief Deserializes the @p values from the binary @p data written by @p SerializeArrayStreamVByte().
+	/// @tparam T Value type.
+	/// @param data Binary data.
+	/// @param values Values. They may be partially written on an exception.
+	/// @return Pointer after the last element of the read data.
+	/// @remark It decodes 4 values at once where SSSE3 is available.
+	template<Type::Integer T> requires (sizeof(T) == 4uz)
+	const std::byte* DeserializeArrayStreamVByte(std::span<const std::byte> data, std::span<T> values);
 }
 
 namespace PonyEngine::Serialization
@@ -102,6 +293,212 @@ namespace PonyEngine::Serialization
 	template<Type::Arithmetic T>
 	const char* DeserializeArrayTextDirect(std::span<const char> data, std::span<T> values, char separator = ',');
 
+	/// @brief Text array chunk processed by one thread.
+	struct ArrayTextChunk final
+	{
+		std::size_t begin = 0uz; ///< First text position on deserialization; first value index on serialization.
+		std::size_t end = 0uz; ///< Position or index after the last one.
+		std::size_t firstIndex = 0uz; ///< First value index.
+		std::size_t offset = 0uz; ///< Text offset on serialization.
+		std::size_t size = 0uz; ///< Separator count on deserialization; text length on serialization.
+		std::size_t errorIndex = std::numeric_limits<std::size_t>::max(); ///< Index of the first invalid value. Max value means no error.
+		std::size_t errorOffset = 0uz; ///< Text offset of the first invalid value.
+		std::errc errorCode = std::errc(); ///< Error code of the first invalid value.
+		const char* dataEnd = nullptr; ///< Pointer after the last read value. It's set only in the chunk with the last value.
+	};
+
+	/// @brief Gets a chunk count for the @p count items.
+	/// @param count Item count.
+	/// @param chunkSize Min item count in a chunk.
+	/// @param threadCount Max thread count.
+	/// @return Chunk count.
+	[[nodiscard("Pure function")]]
+	constexpr std::size_t GetArrayTextChunkCount(std::size_t count, std::size_t chunkSize, std::size_t threadCount) noexcept;
+	/// @brief Runs the @p function for every chunk. The first chunk is run on the calling thread.
+	/// @tparam Function Function type.
+	/// @param chunkCount Chunk count.
+	/// @param function Function that takes a chunk index. It must not throw.
+	template<std::invocable<std::size_t> Function>
+	void RunArrayTextChunks(std::size_t chunkCount, const Function& function);
+
+	/// @brief Deserializes the values of the @p chunk.
+	/// @tparam T Value type.
+	/// @param data Text data.
+	/// @param values Values.
+	/// @param separator Array element separator.
+	/// @param chunk Chunk. The error and the data end are written to it.
+	/// @param lastIndex Index after the last value of the chunk.
+	template<Type::Arithmetic T>
+	void DeserializeArrayTextChunk(std::span<const char> data, std::span<T> values, char separator, ArrayTextChunk& chunk, std::size_t lastIndex) noexcept;
+	/// @brief Deserializes the @p values from the text @p data using several threads.
+	/// @tparam T Value type.
+	/// @param data Text data.
+	/// @param values Values.
+	/// @param separator Array element separator.
+	/// @param threadCount Max thread count.
+	/// @return Pointer after the last element of the read data.
+	template<Type::Arithmetic T>
+	const char* DeserializeArrayTextParallelDirect(std::span<const char> data, std::span<T> values, char separator, std::size_t threadCount);
+	/// @brief Throws an exception with the first chunk error if there's one.
+	/// @param chunks Chunks.
+	void ThrowArrayTextChunkError(std::span<const ArrayTextChunk> chunks);
+
+	/// @brief Converts the @p value into an unsigned code. Signed values are ZigZag encoded.
+	/// @tparam T Value type.
+	/// @param value Value.
+	/// @return Code.
+	template<Type::Integer T> [[nodiscard("Pure function")]]
+	constexpr std::make_unsigned_t<T> ToUnsignedCode(T value) noexcept;
+	/// @brief Converts the unsigned @p code into a value. Signed values are ZigZag decoded.
+	/// @tparam T Value type.
+	/// @param code Code.
+	/// @return Value.
+	template<Type::Integer T> [[nodiscard("Pure function")]]
+	constexpr T FromUnsignedCode(std::make_unsigned_t<T> code) noexcept;
+
+	/// @brief Gets a varint size of the @p code.
+	/// @tparam T Code type.
+	/// @param code Code.
+	/// @return Varint size.
+	template<Type::Integer T> requires (Type::Unsigned<T>) [[nodiscard("Pure function")]]
+	constexpr std::size_t GetVarintSize(T code) noexcept;
+	/// @brief Writes the @p code as a varint.
+	/// @tparam T Code type.
+	/// @param code Code.
+	/// @param data Target. It must have enough space.
+	/// @return Pointer after the written varint.
+	template<Type::Integer T> requires (Type::Unsigned<T>)
+	std::byte* WriteVarint(T code, std::byte* data) noexcept;
+	/// @brief Reads a varint.
+	/// @tparam T Code type.
+	/// @param data Source.
+	/// @param end Source end.
+	/// @param code Read code.
+	/// @return Pointer after the read varint.
+	template<Type::Integer T> requires (Type::Unsigned<T>)
+	const std::byte* ReadVarint(const std::byte* data, const std::byte* end, T& code);
+
+	/// @brief Delta encoding state.
+	/// @tparam T Value type.
+	template<Type::Integer T>
+	struct DeltaState final
+	{
+		std::make_unsigned_t<T> previous = 0u; ///< Previous value.
+		std::make_unsigned_t<T> previousDelta = 0u; ///< Previous delta. It's used by the delta-of-delta encoding only.
+		bool first = true; ///< Is the next value the first one?
+	};
+
+	/// @brief Encodes the @p value as a delta.
+	/// @tparam Order Delta order. 1 is delta, 2 is delta-of-delta.
+	/// @tparam T Value type.
+	/// @param value Value.
+	/// @param state Delta state.
+	/// @return ZigZag code of the delta.
+	template<std::size_t Order, Type::Integer T> [[nodiscard("Pure function")]]
+	constexpr std::make_unsigned_t<T> EncodeDelta(T value, DeltaState<T>& state) noexcept;
+	/// @brief Decodes the delta @p code.
+	/// @tparam Order Delta order. 1 is delta, 2 is delta-of-delta.
+	/// @tparam T Value type.
+	/// @param code ZigZag code of the delta.
+	/// @param state Delta state.
+	/// @return Value.
+	template<std::size_t Order, Type::Integer T> [[nodiscard("Pure function")]]
+	constexpr T DecodeDelta(std::make_unsigned_t<T> code, DeltaState<T>& state) noexcept;
+	/// @brief Gets a required binary size to serialize the @p values with the delta encoding.
+	/// @tparam Order Delta order. 1 is delta, 2 is delta-of-delta.
+	/// @tparam T Value type.
+	/// @param values Values.
+	/// @return Binary size.
+	template<std::size_t Order, Type::Integer T> [[nodiscard("Pure function")]]
+	constexpr std::size_t GetSerializedDeltaSize(std::span<const T> values) noexcept;
+	/// @brief Serializes the @p values to the binary @p data with the delta encoding.
+	/// @tparam Order Delta order. 1 is delta, 2 is delta-of-delta.
+	/// @tparam T Value type.
+	/// @param values Values.
+	/// @param data Binary data.
+	/// @return Pointer after the last element of the written data.
+	template<std::size_t Order, Type::Integer T>
+	std::byte* SerializeDelta(std::span<const T> values, std::span<std::byte> data);
+	/// @brief Deserializes the @p values from the binary @p data with the delta encoding.
+	/// @tparam Order Delta order. 1 is delta, 2 is delta-of-delta.
+	/// @tparam T Value type.
+	/// @param data Binary data.
+	/// @param values Values.
+	/// @return Pointer after the last element of the read data.
+	template<std::size_t Order, Type::Integer T>
+	const std::byte* DeserializeDelta(std::span<const std::byte> data, std::span<T> values);
+
+	/// @brief Gets a frame of reference of the @p values.
+	/// @tparam T Value type.
+	/// @param values Values.
+	/// @return Min value and bit width of the max difference from it.
+	template<Type::Integer T> [[nodiscard("Pure function")]]
+	constexpr std::pair<T, std::uint32_t> GetFrameOfReference(std::span<const T> values) noexcept;
+
+	/// @brief Bit stream state.
+	struct BitStream final
+	{
+		std::uint64_t buffer = 0ull; ///< Bits that aren't written or read yet.
+		std::uint32_t bitCount = 0u; ///< Bit count in the buffer.
+	};
+
+	/// @brief Writes the lower @p width bits of the @p bits.
+	/// @param bits Bits.
+	/// @param width Bit count. It's in range [0, 32].
+	/// @param stream Bit stream.
+	/// @param data Target. It's moved to the next byte to write.
+	void WriteBits(std::uint32_t bits, std::uint32_t width, BitStream& stream, std::byte*& data) noexcept;
+	/// @brief Writes the bits left in the @p stream.
+	/// @param stream Bit stream.
+	/// @param data Target. It's moved to the next byte to write.
+	void FlushBits(BitStream& stream, std::byte*& data) noexcept;
+	/// @brief Reads @p width bits.
+	/// @param width Bit count. It's in range [0, 32].
+	/// @param stream Bit stream.
+	/// @param data Source. It's moved to the next byte to read.
+	/// @return Read bits.
+	[[nodiscard("Pure function")]]
+	std::uint32_t ReadBits(std::uint32_t width, BitStream& stream, const std::byte*& data) noexcept;
+
+	/// @brief Gets a stream VByte length of the @p code.
+	/// @param code Code.
+	/// @return Length in bytes. It's in range [1, 4].
+	[[nodiscard("Pure function")]]
+	constexpr std::uint32_t GetStreamVByteLength(std::uint32_t code) noexcept;
+	/// @brief Stream VByte group shuffle. It moves the significant bytes of 4 values to their places.
+	struct StreamVByteShuffle final
+	{
+		alignas(16) std::array<std::uint8_t, 16> indices; ///< Source byte indices. 0x80 means zero.
+		std::uint8_t length; ///< Group length in bytes.
+	};
+	/// @brief Makes stream VByte shuffles for every control byte.
+	/// @return Shuffles.
+	[[nodiscard("Pure function")]]
+	consteval std::array<StreamVByteShuffle, 256> MakeStreamVByteShuffles() noexcept;
+
+	consteval std::array<StreamVByteShuffle, 256> MakeStreamVByteShuffles() noexcept
+	{
+		auto shuffles = std::array<StreamVByteShuffle, 256>();
+		for (std::uint32_t control = 0u; control < shuffles.size(); ++control)
+		{
+			std::uint8_t offset = 0u;
+			for (std::uint32_t value = 0u; value < 4u; ++value)
+			{
+				const std::uint32_t length = (control >> (value * 2u) & 3u) + 1u;
+				for (std::uint32_t byte = 0u; byte < 4u; ++byte)
+				{
+					shuffles[control].indices[value * 4u + byte] = byte < length ? static_cast<std::uint8_t>(offset + byte) : std::uint8_t{0x80};
+				}
+				offset += static_cast<std::uint8_t>(length);
+			}
+			shuffles[control].length = offset;
+		}
+
+		return shuffles;
+	}
+
+	constexpr std::array<StreamVByteShuffle, 256> StreamVByteShuffles = MakeStreamVByteShuffles(); ///< Stream VByte shuffles.
+
 	template<Type::Arithmetic T>
 	constexpr std::size_t GetSerializedArrayTextLength(const std::span<const T> values) noexcept
 	{
@@ -204,66 +601,858 @@ namespace PonyEngine::Serialization
 		}
 	}
 
-	template<Type::Arithmetic T>
-	constexpr std::size_t GetSeparatorTextLength(const std::size_t count) noexcept
+	std::size_t CountArrayTextSeparators(const std::span<const char> data, const char separator) noexcept
 	{
-		if constexpr (std::is_same_v<T, bool>)
+		std::size_t count = 0uz;
+		std::size_t index = 0uz;
+#ifdef PONY_ENGINE_SERIALIZATION_SSE2
+		const __m128i separators = _mm_set1_epi8(separator);
+		for (; index + 16uz <= data.size(); index += 16uz)
 		{
-			return 0uz;
+			const __m128i characters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data() + index));
+			count += std::popcount(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(characters, separators))));
 		}
-		else
+#endif
+		for (; index < data.size(); ++index)
 		{
-			return std::max(count, 1uz) - 1uz;
+			count += data[index] == separator;
+		}
+
+		return count;
+	}
+
+	std::size_t FindArrayTextSeparators(const std::span<const char> data, const char separator, const std::span<std::size_t> positions) noexcept
+	{
+		std::size_t count = 0uz;
+		std::size_t index = 0uz;
+#ifdef PONY_ENGINE_SERIALIZATION_SSE2
+		const __m128i separators = _mm_set1_epi8(separator);
+		for (; index + 16uz <= data.size() && count < positions.size(); index += 16uz)
+		{
+			const __m128i characters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data() + index));
+			for (auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(characters, separators))); mask && count < positions.size(); mask &= mask - 1u)
+			{
+				positions[count++] = index + std::countr_zero(mask);
+			}
+		}
+#endif
+		for (; index < data.size() && count < positions.size(); ++index)
+		{
+			if (data[index] == separator)
+			{
+				positions[count++] = index;
+			}
 		}
+
+		return count;
 	}
 
 	template<Type::Arithmetic T>
-	char* SerializeArrayTextDirect(const std::span<const T> values, const std::span<char> data, const char separator)
+	char* SerializeArrayTextParallel(const std::span<const T> values, const std::span<char> data, const char separator, const std::size_t threadCount)
 	{
-		char* dataPoint = data.data();
-		const char* const end = data.data() + data.size();
+		const std::size_t chunkCount = GetArrayTextChunkCount(values.size(), ParallelArrayTextChunkSize, threadCount);
+		auto chunks = std::vector<ArrayTextChunk>(chunkCount);
+		for (std::size_t i = 0uz; i < chunkCount; ++i)
+		{
+			chunks[i].begin = values.size() * i / chunkCount;
+			chunks[i].end = values.size() * (i + 1uz) / chunkCount;
+		}
+		const auto separatorLength = [&](const std::size_t chunkIndex) noexcept
+		{
+			return !std::is_same_v<T, bool> && chunkIndex + 1uz < chunkCount ? 1uz : 0uz;
+		};
 
-		for (std::size_t i = 0uz; i < values.size(); ++i)
+		// Floating point text lengths aren't known before writing, so the chunks are written to a scratch buffer sized for the longest values and then copied.
+		std::unique_ptr<char[]> scratch;
+		if constexpr (std::is_floating_point_v<T>)
 		{
-			dataPoint = SerializeText(values[i], std::span(dataPoint, end));
+			scratch = std::make_unique_for_overwrite<char[]>(GetSerializedArrayTextLength<T>(values.size()) + 1uz);
+		}
+		const auto scratchChunk = [&](const ArrayTextChunk& chunk) noexcept
+		{
+			const std::size_t begin = (GetSerializedTextLength<T>() + 1uz) * chunk.begin;
+			return std::span(scratch.get() + begin, (GetSerializedTextLength<T>() + 1uz) * (chunk.end - chunk.begin));
+		};
 
-			if constexpr (!std::is_same_v<T, bool>)
+		RunArrayTextChunks(chunkCount, [&](const std::size_t chunkIndex) noexcept
+		{
+			ArrayTextChunk& chunk = chunks[chunkIndex];
+			const std::span<const T> chunkValues = values.subspan(chunk.begin, chunk.end - chunk.begin);
+			if constexpr (std::is_floating_point_v<T>)
 			{
-				if (i < values.size() - 1uz) [[likely]]
+				const std::span<char> text = scratchChunk(chunk);
+				char* const end = SerializeArrayTextDirect(chunkValues, text, separator);
+				if (separatorLength(chunkIndex))
 				{
-					if (dataPoint == end) [[unlikely]]
-					{
-						throw std::runtime_error(std::format("Failed to serialize data: ErrorCode = '0x{:X}'", std::to_underlying(std::errc::value_too_large)));
-					}
+					*end = separator;
+				}
+				chunk.size = end - text.data() + separatorLength(chunkIndex);
+			}
+			else
+			{
+				chunk.size = GetSerializedArrayTextLength(chunkValues) + separatorLength(chunkIndex);
+			}
+		});
 
-					*dataPoint = separator;
-					++dataPoint;
+		std::size_t length = 0uz;
+		for (ArrayTextChunk& chunk : chunks)
+		{
+			chunk.offset = length;
+			length += chunk.size;
+		}
+		if (length > data.size()) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to serialize data: ErrorCode = '0x{:X}'", std::to_underlying(std::errc::value_too_large)));
+		}
+
+		RunArrayTextChunks(chunkCount, [&](const std::size_t chunkIndex) noexcept
+		{
+			const ArrayTextChunk& chunk = chunks[chunkIndex];
+			const std::span<char> text = data.subspan(chunk.offset, chunk.size);
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				std::memcpy(text.data(), scratchChunk(chunk).data(), text.size());
+			}
+			else
+			{
+				[[maybe_unused]] char* const end = SerializeArrayTextDirect(values.subspan(chunk.begin, chunk.end - chunk.begin), text, separator);
+				if (separatorLength(chunkIndex))
+				{
+					text.back() = separator;
 				}
+				assert(end + separatorLength(chunkIndex) == text.data() + text.size() && "Unexpected text length.");
 			}
+		});
+
+		return data.data() + length;
+	}
+
+	template<bool Optimized, Type::Arithmetic T>
+	const char* DeserializeArrayTextParallel(const std::span<const char> data, const std::span<T> values, const char separator, const std::size_t threadCount)
+	{
+		if constexpr (Optimized)
+		{
+			return DeserializeArrayTextParallelDirect<T>(data, values, separator, threadCount);
 		}
+		else
+		{
+			const auto buffer = std::make_unique_for_overwrite<T[]>(values.size());
+			const char* const end = DeserializeArrayTextParallelDirect(data, std::span(buffer.get(), values.size()), separator, threadCount);
+			std::copy_n(buffer.get(), values.size(), values.data());
 
-		return dataPoint;
+			return end;
+		}
 	}
 
-	template<Type::Arithmetic T>
-	const char* DeserializeArrayTextDirect(const std::span<const char> data, const std::span<T> values, const char separator)
+	template<Type::Integer T> requires (Type::Signed<T>)
+	constexpr std::make_unsigned_t<T> ZigZagEncode(const T value) noexcept
 	{
-		const char* dataPoint = data.data();
-		const char* const end = data.data() + data.size();
+		using Unsigned = std::make_unsigned_t<T>;
 
-		for (T& value : values)
+		return static_cast<Unsigned>((static_cast<Unsigned>(value) << 1) ^ static_cast<Unsigned>(value >> (sizeof(T) * 8uz - 1uz)));
+	}
+
+	template<Type::Integer T> requires (Type::Unsigned<T>)
+	constexpr std::make_signed_t<T> ZigZagDecode(const T code) noexcept
+	{
+		return static_cast<std::make_signed_t<T>>(static_cast<T>((code >> 1) ^ static_cast<T>(0u - (code & 1u))));
+	}
+
+	template<Type::Integer T>
+	constexpr std::size_t GetSerializedArrayVarintSize(const std::span<const T> values) noexcept
+	{
+		std::size_t size = 0uz;
+		for (const T value : values)
 		{
-			dataPoint = DeserializeText(std::span(dataPoint, end), value);
+			size += GetVarintSize(ToUnsignedCode(value));
+		}
 
-			if constexpr (!std::is_same_v<T, bool>)
+		return size;
+	}
+
+	template<Type::Integer T>
+	std::byte* SerializeArrayVarint(const std::span<const T> values, const std::span<std::byte> data)
+	{
+		std::byte* dataPoint = data.data();
+		const std::byte* const end = data.data() + data.size();
+
+		for (const T value : values)
+		{
+			const std::make_unsigned_t<T> code = ToUnsignedCode(value);
+			if (static_cast<std::size_t>(end - dataPoint) < MaxVarintSize<T> && GetVarintSize(code) > static_cast<std::size_t>(end - dataPoint)) [[unlikely]]
 			{
-				if (dataPoint != end) [[likely]]
-				{
-					dataPoint += *dataPoint == separator;
-				}
+				throw std::invalid_argument("Data is too small");
 			}
+
+			dataPoint = WriteVarint(code, dataPoint);
+		}
+
+		return dataPoint;
+	}
+
+	template<Type::Integer T>
+	const std::byte* DeserializeArrayVarint(const std::span<const std::byte> data, const std::span<T> values)
+	{
+		const std::byte* dataPoint = data.data();
+		const std::byte* const end = data.data() + data.size();
+
+		for (T& value : values)
+		{
+			std::make_unsigned_t<T> code;
+			dataPoint = ReadVarint(dataPoint, end, code);
+			value = FromUnsignedCode<T>(code);
 		}
 
 		return dataPoint;
 	}
+
+	template<Type::Integer T>
+	constexpr std::size_t GetSerializedArrayDeltaSize(const std::span<const T> values) noexcept
+	{
+		return GetSerializedDeltaSize<1uz, T>(values);
+	}
+
+	template<Type::Integer T>
+	std::byte* SerializeArrayDelta(const std::span<const T> values, const std::span<std::byte> data)
+	{
+		return SerializeDelta<1uz, T>(values, data);
+	}
+
+	template<Type::Integer T>
+	const std::byte* DeserializeArrayDelta(const std::span<const std::byte> data, const std::span<T> values)
+	{
+		return DeserializeDelta<1uz, T>(data, values);
+	}
+
+	template<Type::Integer T>
+	constexpr std::size_t GetSerializedArrayDeltaOfDeltaSize(const std::span<const T> values) noexcept
+	{
+		return GetSerializedDeltaSize<2uz, T>(values);
+	}
+
+	template<Type::Integer T>
+	std::byte* SerializeArrayDeltaOfDelta(const std::span<const T> values, const std::span<std::byte> data)
+	{
+		return SerializeDelta<2uz, T>(values, data);
+	}
+
+	template<Type::Integer T>
+	const std::byte* DeserializeArrayDeltaOfDelta(const std::span<const std::byte> data, const std::span<T> values)
+	{
+		return DeserializeDelta<2uz, T>(data, values);
+	}
+
+	template<Type::Integer T>
+	constexpr std::size_t GetSerializedArrayFrameOfReferenceSize(const std::span<const T> values) noexcept
+	{
+		const std::uint32_t width = GetFrameOfReference(values).second;
+
+		return 1uz + sizeof(T) + (values.size() * width + 7uz) / 8uz;
+	}
+
+	template<Type::Integer T>
+	std::byte* SerializeArrayFrameOfReference(const std::span<const T> values, const std::span<std::byte> data)
+	{
+		using Unsigned = std::make_unsigned_t<T>;
+
+		const auto [min, width] = GetFrameOfReference(values);
+		if (1uz + sizeof(T) + (values.size() * width + 7uz) / 8uz > data.size()) [[unlikely]]
+		{
+			throw std::invalid_argument("Data is too small");
+		}
+
+		std::byte* dataPoint = data.data();
+		*dataPoint++ = static_cast<std::byte>(width);
+		for (std::size_t i = 0uz; i < sizeof(T); ++i)
+		{
+			*dataPoint++ = static_cast<std::byte>(static_cast<Unsigned>(min) >> (i * 8uz));
+		}
+
+		auto stream = BitStream();
+		for (const T value : values)
+		{
+			const auto difference = static_cast<std::uint64_t>(static_cast<Unsigned>(static_cast<Unsigned>(value) - static_cast<Unsigned>(min)));
+			if constexpr (sizeof(T) > sizeof(std::uint32_t))
+			{
+				WriteBits(static_cast<std::uint32_t>(difference), std::min(width, 32u), stream, dataPoint);
+				WriteBits(static_cast<std::uint32_t>(difference >> 32), std::max(width, 32u) - 32u, stream, dataPoint);
+			}
+			else
+			{
+				WriteBits(static_cast<std::uint32_t>(difference), width, stream, dataPoint);
+			}
+		}
+		FlushBits(stream, dataPoint);
+
+		return dataPoint;
+	}
+
+	template<Type::Integer T>
+	const std::byte* DeserializeArrayFrameOfReference(const std::span<const std::byte> data, const std::span<T> values)
+	{
+		using Unsigned = std::make_unsigned_t<T>;
+
+		if (data.size() < 1uz + sizeof(T)) [[unlikely]]
+		{
+			throw std::invalid_argument("Data is too small");
+		}
+
+		const std::byte* dataPoint = data.data();
+		const auto width = static_cast<std::uint32_t>(*dataPoint++);
+		if (width > sizeof(T) * 8uz) [[unlikely]]
+		{
+			throw std::invalid_argument("Data is corrupted");
+		}
+		if (1uz + sizeof(T) + (values.size() * width + 7uz) / 8uz > data.size()) [[unlikely]]
+		{
+			throw std::invalid_argument("Data is too small");
+		}
+
+		Unsigned min = 0u;
+		for (std::size_t i = 0uz; i < sizeof(T); ++i)
+		{
+			min |= static_cast<Unsigned>(static_cast<Unsigned>(*dataPoint++) << (i * 8uz));
+		}
+
+		auto stream = BitStream();
+		for (T& value : values)
+		{
+			std::uint64_t difference;
+			if constexpr (sizeof(T) > sizeof(std::uint32_t))
+			{
+				difference = ReadBits(std::min(width, 32u), stream, dataPoint);
+				difference |= static_cast<std::uint64_t>(ReadBits(std::max(width, 32u) - 32u, stream, dataPoint)) << 32;
+			}
+			else
+			{
+				difference = ReadBits(width, stream, dataPoint);
+			}
+			value = static_cast<T>(static_cast<Unsigned>(min + static_cast<Unsigned>(difference)));
+		}
+
+		return dataPoint;
+	}
+
+	template<Type::Integer T> requires (sizeof(T) == 4uz)
+	constexpr std::size_t GetSerializedArrayStreamVByteSize(const std::span<const T> values) noexcept
+	{
+		std::size_t size = (values.size() + 3uz) / 4uz;
+		for (const T value : values)
+		{
+			size += GetStreamVByteLength(ToUnsignedCode(value));
+		}
+
+		return size;
+	}
+
+	template<Type::Integer T> requires (sizeof(T) == 4uz)
+	std::byte* SerializeArrayStreamVByte(const std::span<const T> values, const std::span<std::byte> data)
+	{
+		const std::size_t controlSize = (values.size() + 3uz) / 4uz;
+		if (controlSize > data.size()) [[unlikely]]
+		{
+			throw std::invalid_argument("Data is too small");
+		}
+
+		std::byte* const control = data.data();
+		std::byte* dataPoint = data.data() + controlSize;
+		const std::byte* const end = data.data() + data.size();
+		std::fill_n(control, controlSize, std::byte{0});
+
+		for (std::size_t i = 0uz; i < values.size(); ++i)
+		{
+			const std::uint32_t code = ToUnsignedCode(values[i]);
+			const std::uint32_t length = GetStreamVByteLength(code);
+			if (length > static_cast<std::size_t>(end - dataPoint)) [[unlikely]]
+			{
+				throw std::invalid_argument("Data is too small");
+			}
+
+			control[i / 4uz] |= static_cast<std::byte>((length - 1u) << (i % 4uz * 2uz));
+			for (std::uint32_t j = 0u; j < length; ++j)
+			{
+				*dataPoint++ = static_cast<std::byte>(code >> (j * 8u));
+			}
+		}
+
+		return dataPoint;
+	}
+
+	template<Type::Integer T> requires (sizeof(T) == 4uz)
+	const std::byte* DeserializeArrayStreamVByte(const std::span<const std::byte> data, const std::span<T> values)
+	{
+		const std::size_t controlSize = (values.size() + 3uz) / 4uz;
+		if (controlSize > data.size()) [[unlikely]]
+		{
+			throw std::invalid_argument("Data is too small");
+		}
+
+		const std::byte* const control = data.data();
+		const std::byte* dataPoint = data.data() + controlSize;
+		const std::byte* const end = data.data() + data.size();
+		std::size_t i = 0uz;
+
+#ifdef PONY_ENGINE_SERIALIZATION_SSSE3
+		for (; i + 4uz <= values.size() && end - dataPoint >= 16; i += 4uz)
+		{
+			const StreamVByteShuffle& shuffle = StreamVByteShuffles[std::to_integer<std::size_t>(control[i / 4uz])];
+			__m128i group = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(dataPoint)), _mm_load_si128(reinterpret_cast<const __m128i*>(shuffle.indices.data())));
+			if constexpr (Type::Signed<T>)
+			{
+				group = _mm_xor_si128(_mm_srli_epi32(group, 1), _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(group, _mm_set1_epi32(1))));
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(values.data() + i), group);
+			dataPoint += shuffle.length;
+		}
+#endif
+
+		for (; i < values.size(); ++i)
+		{
+			const std::uint32_t length = (std::to_integer<std::uint32_t>(control[i / 4uz]) >> (i % 4uz * 2uz) & 3u) + 1u;
+			if (length > static_cast<std::size_t>(end - dataPoint)) [[unlikely]]
+			{
+				throw std::invalid_argument("Data is too small");
+			}
+
+			std::uint32_t code = 0u;
+			for (std::uint32_t j = 0u; j < length; ++j)
+			{
+				code |= std::to_integer<std::uint32_t>(*dataPoint++) << (j * 8u);
+			}
+			values[i] = FromUnsignedCode<T>(code);
+		}
+
+		return dataPoint;
+	}
+
+	constexpr std::size_t GetArrayTextChunkCount(const std::size_t count, const std::size_t chunkSize, const std::size_t threadCount) noexcept
+	{
+		return std::clamp(count / chunkSize, 1uz, std::max(threadCount, 1uz));
+	}
+
+	template<std::invocable<std::size_t> Function>
+	void RunArrayTextChunks(const std::size_t chunkCount, const Function& function)
+	{
+		auto threads = std::vector<std::jthread>();
+		threads.reserve(chunkCount - 1uz);
+		for (std::size_t i = 1uz; i < chunkCount; ++i)
+		{
+			threads.emplace_back(function, i);
+		}
+		function(0uz);
+	}
+
+	template<Type::Arithmetic T>
+	void DeserializeArrayTextChunk(const std::span<const char> data, const std::span<T> values, const char separator, ArrayTextChunk& chunk, const std::size_t lastIndex) noexcept
+	{
+		std::size_t position = chunk.begin;
+		if (chunk.firstIndex > 0uz)
+		{
+			std::size_t separatorPosition;
+			[[maybe_unused]] const std::size_t found = FindArrayTextSeparators(data.subspan(position), separator, std::span(&separatorPosition, 1uz));
+			assert(found == 1uz && "The chunk has no separator.");
+			position += separatorPosition + 1uz;
+		}
+
+		const char* point = data.data() + position;
+		const char* const end = data.data() + data.size();
+		for (std::size_t i = chunk.firstIndex; i < lastIndex; ++i)
+		{
+			const auto [pt, ec] = std::from_chars(point, end, values[i]);
+			if (ec != std::errc()) [[unlikely]]
+			{
+				chunk.errorIndex = i;
+				chunk.errorOffset = point - data.data();
+				chunk.errorCode = ec;
+				return;
+			}
+
+			const bool hasSeparator = pt != end && *pt == separator;
+			if (i == values.size() - 1uz)
+			{
+				chunk.dataEnd = pt + hasSeparator;
+			}
+			else if (!hasSeparator) [[unlikely]]
+			{
+				// The text end means that the next value is missing.
+				chunk.errorIndex = i + (pt == end);
+				chunk.errorOffset = pt - data.data();
+				chunk.errorCode = std::errc::invalid_argument;
+				return;
+			}
+
+			point = pt + 1;
+		}
+	}
+
+	template<Type::Arithmetic T>
+	const char* DeserializeArrayTextParallelDirect(const std::span<const char> data, const std::span<T> values, const char separator, const std::size_t threadCount)
+	{
+		if (values.empty())
+		{
+			return data.data();
+		}
+
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			const std::size_t chunkCount = GetArrayTextChunkCount(values.size(), ParallelArrayTextChunkLength, threadCount);
+			auto chunks = std::vector<ArrayTextChunk>(chunkCount);
+			RunArrayTextChunks(chunkCount, [&](const std::size_t chunkIndex) noexcept
+			{
+				ArrayTextChunk& chunk = chunks[chunkIndex];
+				const std::size_t end = values.size() * (chunkIndex + 1uz) / chunkCount;
+				for (std::size_t i = values.size() * chunkIndex / chunkCount; i < end; ++i)
+				{
+					if (i >= data.size() || (data[i] != '0' && data[i] != '1')) [[unlikely]]
+					{
+						chunk.errorIndex = i;
+						chunk.errorOffset = i;
+						chunk.errorCode = std::errc::invalid_argument;
+						return;
+					}
+					values[i] = data[i] != '0';
+				}
+			});
+			ThrowArrayTextChunkError(chunks);
+
+			return data.data() + values.size();
+		}
+		else
+		{
+			const std::size_t chunkCount = GetArrayTextChunkCount(data.size(), ParallelArrayTextChunkLength, threadCount);
+			if (chunkCount == 1uz)
+			{
+				// One chunk doesn't need the value indices, so the separators aren't counted.
+				auto chunk = ArrayTextChunk{.end = data.size()};
+				DeserializeArrayTextChunk(data, values, separator, chunk, values.size());
+				ThrowArrayTextChunkError(std::span(&chunk, 1uz));
+
+				return chunk.dataEnd;
+			}
+
+			auto chunks = std::vector<ArrayTextChunk>(chunkCount);
+			for (std::size_t i = 0uz; i < chunkCount; ++i)
+			{
+				// A chunk takes the values that start inside it. A value starts after a separator, so the separators are searched one character earlier.
+				chunks[i].begin = i == 0uz ? 0uz : data.size() * i / chunkCount - 1uz;
+				chunks[i].end = i + 1uz == chunkCount ? data.size() : data.size() * (i + 1uz) / chunkCount - 1uz;
+			}
+
+			RunArrayTextChunks(chunkCount, [&](const std::size_t chunkIndex) noexcept
+			{
+				ArrayTextChunk& chunk = chunks[chunkIndex];
+				chunk.size = CountArrayTextSeparators(data.subspan(chunk.begin, chunk.end - chunk.begin), separator);
+			});
+
+			std::size_t valueCount = 1uz;
+			for (ArrayTextChunk& chunk : chunks)
+			{
+				chunk.firstIndex = &chunk == &chunks.front() ? 0uz : valueCount;
+				valueCount += chunk.size;
+			}
+
+			RunArrayTextChunks(chunkCount, [&](const std::size_t chunkIndex) noexcept
+			{
+				ArrayTextChunk& chunk = chunks[chunkIndex];
+				const std::size_t lastIndex = std::min(chunkIndex + 1uz < chunkCount ? chunks[chunkIndex + 1uz].firstIndex : valueCount, values.size());
+				if (chunk.firstIndex < lastIndex)
+				{
+					DeserializeArrayTextChunk(data, values, separator, chunk, lastIndex);
+				}
+			});
+			ThrowArrayTextChunkError(chunks);
+
+			const auto lastChunk = std::ranges::find_if(chunks, [](const ArrayTextChunk& chunk) noexcept { return chunk.dataEnd; });
+			assert(lastChunk != chunks.cend() && "The last value hasn't been read.");
+
+			return lastChunk->dataEnd;
+		}
+	}
+
+	void ThrowArrayTextChunkError(const std::span<const ArrayTextChunk> chunks)
+	{
+		for (const ArrayTextChunk& chunk : chunks)
+		{
+			if (chunk.errorIndex != std::numeric_limits<std::size_t>::max()) [[unlikely]]
+			{
+				throw std::runtime_error(std::format("Failed to deserialize data: Index = '{}', Offset = '{}', ErrorCode = '0x{:X}'",
+					chunk.errorIndex, chunk.errorOffset, std::to_underlying(chunk.errorCode)));
+			}
+		}
+	}
+
+	template<Type::Arithmetic T>
+	constexpr std::size_t GetSeparatorTextLength(const std::size_t count) noexcept
+	{
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			return 0uz;
+		}
+		else
+		{
+			return std::max(count, 1uz) - 1uz;
+		}
+	}
+
+	template<Type::Arithmetic T>
+	char* SerializeArrayTextDirect(const std::span<const T> values, const std::span<char> data, const char separator)
+	{
+		char* dataPoint = data.data();
+		const char* const end = data.data() + data.size();
+
+		for (std::size_t i = 0uz; i < values.size(); ++i)
+		{
+			dataPoint = SerializeText(values[i], std::span(dataPoint, end));
+
+			if constexpr (!std::is_same_v<T, bool>)
+			{
+				if (i < values.size() - 1uz) [[likely]]
+				{
+					if (dataPoint == end) [[unlikely]]
+					{
+						throw std::runtime_error(std::format("Failed to serialize data: ErrorCode = '0x{:X}'", std::to_underlying(std::errc::value_too_large)));
+					}
+
+					*dataPoint = separator;
+					++dataPoint;
+				}
+			}
+		}
+
+		return dataPoint;
+	}
+
+	template<Type::Arithmetic T>
+	const char* DeserializeArrayTextDirect(const std::span<const char> data, const std::span<T> values, const char separator)
+	{
+		const char* dataPoint = data.data();
+		const char* const end = data.data() + data.size();
+
+		for (T& value : values)
+		{
+			dataPoint = DeserializeText(std::span(dataPoint, end), value);
+
+			if constexpr (!std::is_same_v<T, bool>)
+			{
+				if (dataPoint != end) [[likely]]
+				{
+					dataPoint += *dataPoint == separator;
+				}
+			}
+		}
+
+		return dataPoint;
+	}
+
+	template<Type::Integer T>
+	constexpr std::make_unsigned_t<T> ToUnsignedCode(const T value) noexcept
+	{
+		if constexpr (Type::Signed<T>)
+		{
+			return ZigZagEncode(value);
+		}
+		else
+		{
+			return value;
+		}
+	}
+
+	template<Type::Integer T>
+	constexpr T FromUnsignedCode(const std::make_unsigned_t<T> code) noexcept
+	{
+		if constexpr (Type::Signed<T>)
+		{
+			return ZigZagDecode(code);
+		}
+		else
+		{
+			return code;
+		}
+	}
+
+	template<Type::Integer T> requires (Type::Unsigned<T>)
+	constexpr std::size_t GetVarintSize(const T code) noexcept
+	{
+		return std::max((static_cast<std::size_t>(std::bit_width(code)) + 6uz) / 7uz, 1uz);
+	}
+
+	template<Type::Integer T> requires (Type::Unsigned<T>)
+	std::byte* WriteVarint(T code, std::byte* data) noexcept
+	{
+		while (code >= 0x80u)
+		{
+			*data++ = static_cast<std::byte>(code | 0x80u);
+			code >>= 7;
+		}
+		*data++ = static_cast<std::byte>(code);
+
+		return data;
+	}
+
+	template<Type::Integer T> requires (Type::Unsigned<T>)
+	const std::byte* ReadVarint(const std::byte* data, const std::byte* const end, T& code)
+	{
+		constexpr std::uint32_t bitCount = sizeof(T) * 8u;
+
+		code = 0u;
+		for (std::uint32_t shift = 0u; ; shift += 7u)
+		{
+			if (data == end) [[unlikely]]
+			{
+				throw std::invalid_argument("Data is too small");
+			}
+
+			const std::uint32_t byte = std::to_integer<std::uint32_t>(*data++);
+			const std::uint32_t bits = byte & 0x7Fu;
+			if (shift >= bitCount || (bitCount - shift < 7u && bits >> (bitCount - shift) != 0u)) [[unlikely]]
+			{
+				throw std::invalid_argument("Data is corrupted");
+			}
+			code |= static_cast<T>(static_cast<T>(bits) << shift);
+
+			if (!(byte & 0x80u))
+			{
+				return data;
+			}
+		}
+	}
+
+	template<std::size_t Order, Type::Integer T>
+	constexpr std::make_unsigned_t<T> EncodeDelta(const T value, DeltaState<T>& state) noexcept
+	{
+		using Unsigned = std::make_unsigned_t<T>;
+
+		const auto delta = static_cast<Unsigned>(static_cast<Unsigned>(value) - state.previous);
+		state.previous = static_cast<Unsigned>(value);
+		Unsigned residual = delta;
+		if constexpr (Order == 2uz)
+		{
+			residual = static_cast<Unsigned>(delta - state.previousDelta);
+			state.previousDelta = state.first ? Unsigned{0u} : delta;
+			state.first = false;
+		}
+
+		return ZigZagEncode(static_cast<std::make_signed_t<T>>(residual));
+	}
+
+	template<std::size_t Order, Type::Integer T>
+	constexpr T DecodeDelta(const std::make_unsigned_t<T> code, DeltaState<T>& state) noexcept
+	{
+		using Unsigned = std::make_unsigned_t<T>;
+
+		auto delta = static_cast<Unsigned>(ZigZagDecode(code));
+		if constexpr (Order == 2uz)
+		{
+			delta = static_cast<Unsigned>(delta + state.previousDelta);
+			state.previousDelta = state.first ? Unsigned{0u} : delta;
+			state.first = false;
+		}
+		state.previous = static_cast<Unsigned>(state.previous + delta);
+
+		return static_cast<T>(state.previous);
+	}
+
+	template<std::size_t Order, Type::Integer T>
+	constexpr std::size_t GetSerializedDeltaSize(const std::span<const T> values) noexcept
+	{
+		auto state = DeltaState<T>();
+		std::size_t size = 0uz;
+		for (const T value : values)
+		{
+			size += GetVarintSize(EncodeDelta<Order>(value, state));
+		}
+
+		return size;
+	}
+
+	template<std::size_t Order, Type::Integer T>
+	std::byte* SerializeDelta(const std::span<const T> values, const std::span<std::byte> data)
+	{
+		std::byte* dataPoint = data.data();
+		const std::byte* const end = data.data() + data.size();
+
+		auto state = DeltaState<T>();
+		for (const T value : values)
+		{
+			const std::make_unsigned_t<T> code = EncodeDelta<Order>(value, state);
+			if (static_cast<std::size_t>(end - dataPoint) < MaxVarintSize<T> && GetVarintSize(code) > static_cast<std::size_t>(end - dataPoint)) [[unlikely]]
+			{
+				throw std::invalid_argument("Data is too small");
+			}
+
+			dataPoint = WriteVarint(code, dataPoint);
+		}
+
+		return dataPoint;
+	}
+
+	template<std::size_t Order, Type::Integer T>
+	const std::byte* DeserializeDelta(const std::span<const std::byte> data, const std::span<T> values)
+	{
+		const std::byte* dataPoint = data.data();
+		const std::byte* const end = data.data() + data.size();
+
+		auto state = DeltaState<T>();
+		for (T& value : values)
+		{
+			std::make_unsigned_t<T> code;
+			dataPoint = ReadVarint(dataPoint, end, code);
+			value = DecodeDelta<Order, T>(code, state);
+		}
+
+		return dataPoint;
+	}
+
+	template<Type::Integer T>
+	constexpr std::pair<T, std::uint32_t> GetFrameOfReference(const std::span<const T> values) noexcept
+	{
+		if (values.empty())
+		{
+			return std::pair(T{0}, 0u);
+		}
+
+		const auto [min, max] = std::ranges::minmax(values);
+		const auto difference = static_cast<std::make_unsigned_t<T>>(static_cast<std::make_unsigned_t<T>>(max) - static_cast<std::make_unsigned_t<T>>(min));
+
+		return std::pair(min, static_cast<std::uint32_t>(std::bit_width(difference)));
+	}
+
+	void WriteBits(const std::uint32_t bits, const std::uint32_t width, BitStream& stream, std::byte*& data) noexcept
+	{
+		stream.buffer |= (static_cast<std::uint64_t>(bits) & ((1ull << width) - 1ull)) << stream.bitCount;
+		stream.bitCount += width;
+		for (; stream.bitCount >= 8u; stream.bitCount -= 8u)
+		{
+			*data++ = static_cast<std::byte>(stream.buffer);
+			stream.buffer >>= 8;
+		}
+	}
+
+	void FlushBits(BitStream& stream, std::byte*& data) noexcept
+	{
+		if (stream.bitCount > 0u)
+		{
+			*data++ = static_cast<std::byte>(stream.buffer);
+			stream = BitStream();
+		}
+	}
+
+	std::uint32_t ReadBits(const std::uint32_t width, BitStream& stream, const std::byte*& data) noexcept
+	{
+		for (; stream.bitCount < width; stream.bitCount += 8u)
+		{
+			stream.buffer |= std::to_integer<std::uint64_t>(*data++) << stream.bitCount;
+		}
+
+		const auto bits = static_cast<std::uint32_t>(stream.buffer & ((1ull << width) - 1ull));
+		stream.buffer >>= width;
+		stream.bitCount -= width;
+
+		return bits;
+	}
+
+	constexpr std::uint32_t GetStreamVByteLength(const std::uint32_t code) noexcept
+	{
+		return std::max((static_cast<std::uint32_t>(std::bit_width(code)) + 7u) / 8u, 1u);
+	}
 }
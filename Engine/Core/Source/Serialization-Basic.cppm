@@ -65,6 +65,19 @@ export namespace PonyEngine::Serialization
 
 namespace PonyEngine::Serialization
 {
+	/// @brief Writes the @p value in little-endian.
+	/// @tparam T Value type.
+	/// @param data Target.
+	/// @param value Value.
+	template<std::unsigned_integral T>
+	void WriteLittleEndian(std::byte* data, T value) noexcept;
+	/// @brief Reads a little-endian value.
+	/// @tparam T Value type.
+	/// @param data Source.
+	/// @return Value.
+	template<std::unsigned_integral T> [[nodiscard("Pure function")]]
+	T ReadLittleEndian(const std::byte* data) noexcept;
+
 	template<Type::Arithmetic T>
 	constexpr std::size_t GetSerializedTextLength(const T value) noexcept
 	{
@@ -187,4 +200,20 @@ namespace PonyEngine::Serialization
 			return pt;
 		}
 	}
+
+	template<std::unsigned_integral T>
+	void WriteLittleEndian(std::byte* const data, const T value) noexcept
+	{
+		const T littleValue = std::endian::native == std::endian::little ? value : std::byteswap(value);
+		std::memcpy(data, &littleValue, sizeof(T));
+	}
+
+	template<std::unsigned_integral T>
+	T ReadLittleEndian(const std::byte* const data) noexcept
+	{
+		T value;
+		std::memcpy(&value, data, sizeof(T));
+
+		return std::endian::native == std::endian::little ? value : std::byteswap(value);
+	}
 }
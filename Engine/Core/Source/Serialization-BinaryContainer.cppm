@@ -0,0 +1,508 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Serialization:BinaryContainer;
+
+import std;
+
+import PonyEngine.Meta;
+
+import :Basic;
+
+export namespace PonyEngine::Serialization
+{
+	/// @brief Binary container section ID. It's usually a hash of the section name.
+	using BinarySectionID = std::uint64_t;
+
+	constexpr std::size_t BinaryContainerHeaderSize = 48uz; ///< Binary container header size.
+	constexpr std::size_t BinarySectionEntrySize = 32uz; ///< Size of a table of contents entry.
+	constexpr std::size_t BinarySectionAlignment = 16uz; ///< Min section alignment relative to the container start.
+	constexpr std::size_t MaxBinarySectionAlignment = 4096uz; ///< Max section alignment relative to the container start.
+
+	/// @brief Binary container writer.
+	/// @details The container consists of a header, a table of contents and aligned sections.
+	///          The header carries the container version and the byte order of the section data. The header and the table of contents are always little-endian.
+	///          The section data is written in the native byte order, so writing and reading on the same platform never converts it.
+	/// @note The writer doesn't copy the section data. It must be alive till the container is written.
+	class BinaryContainerWriter final
+	{
+	public:
+		/// @brief Creates a writer.
+		/// @param version Container version. It's up to the user what it means.
+		[[nodiscard("Pure constructor")]]
+		explicit BinaryContainerWriter(const Meta::Version& version) noexcept;
+		[[nodiscard("Pure constructor")]]
+		BinaryContainerWriter(const BinaryContainerWriter& other) = default;
+		[[nodiscard("Pure constructor")]]
+		BinaryContainerWriter(BinaryContainerWriter&& other) noexcept = default;
+
+		~BinaryContainerWriter() noexcept = default;
+
+		/// @brief Adds a section.
+		/// @tparam T Value type.
+		/// @param id Section ID. It must be unique in the container.
+		/// @param values Section values.
+		/// @param alignment Section alignment. It's a power of two. It's raised to @p BinarySectionAlignment if it's less.
+		template<typename T> requires (std::is_trivially_copyable_v<T>)
+		void AddSection(BinarySectionID id, std::span<const T> values, std::size_t alignment = alignof(T));
+		/// @brief Adds a section.
+		/// @param id Section ID. It must be unique in the container.
+		/// @param data Section data.
+		/// @param elementSize Size of one section element. The data size must be a multiple of it.
+		/// @param alignment Section alignment. It's a power of two. It's raised to @p BinarySectionAlignment if it's less.
+		void AddSection(BinarySectionID id, std::span<const std::byte> data, std::size_t elementSize, std::size_t alignment);
+
+		/// @brief Gets the container size.
+		/// @return Container size in bytes.
+		[[nodiscard("Pure function")]]
+		std::size_t Size() const noexcept;
+		/// @brief Writes the container to the @p data.
+		/// @param data Binary data. It must be at least @p Size() bytes. The sections are aligned relative to its start.
+		/// @return Pointer after the last written byte.
+		std::byte* Write(std::span<std::byte> data) const;
+
+		BinaryContainerWriter& operator =(const BinaryContainerWriter& other) = default;
+		BinaryContainerWriter& operator =(BinaryContainerWriter&& other) noexcept = default;
+
+	private:
+		/// @brief Section.
+		struct Section final
+		{
+			BinarySectionID id; ///< Section ID.
+			std::span<const std::byte> data; ///< Section data.
+			std::uint32_t elementSize; ///< Element size.
+			std::uint32_t alignment; ///< Alignment.
+		};
+
+		Meta::Version version; ///< Container version.
+		std::vector<Section> sections; ///< Sections.
+	};
+
+	/// @brief Binary container reader.
+	/// @details It reads the container in place. The construction validates the header and the table of contents, so it takes time proportional to the section count only.
+	///          Section views point directly into the container data: nothing is copied if the section alignment and byte order fit the platform.
+	/// @note The reader doesn't copy the container data. It must be alive while the reader and its views are used.
+	class BinaryContainerReader final
+	{
+	public:
+		/// @brief Creates a reader.
+		/// @param data Container data. It's usually a loaded or mapped file.
+		/// @throws std::invalid_argument If the data isn't a valid container.
+		[[nodiscard("Pure constructor")]]
+		explicit BinaryContainerReader(std::span<const std::byte> data);
+		[[nodiscard("Pure constructor")]]
+		BinaryContainerReader(const BinaryContainerReader& other) noexcept = default;
+		[[nodiscard("Pure constructor")]]
+		BinaryContainerReader(BinaryContainerReader&& other) noexcept = default;
+
+		~BinaryContainerReader() noexcept = default;
+
+		/// @brief Gets the container version.
+		/// @return Container version.
+		[[nodiscard("Pure function")]]
+		Meta::Version Version() const noexcept;
+		/// @brief Gets the byte order of the section data.
+		/// @return Byte order.
+		[[nodiscard("Pure function")]]
+		std::endian Endian() const noexcept;
+		/// @brief Gets the container size.
+		/// @return Container size in bytes.
+		[[nodiscard("Pure function")]]
+		std::size_t Size() const noexcept;
+
+		/// @brief Gets the section count.
+		/// @return Section count.
+		[[nodiscard("Pure function")]]
+		std::size_t SectionCount() const noexcept;
+		/// @brief Gets a section ID.
+		/// @param index Section index.
+		/// @return Section ID.
+		[[nodiscard("Pure function")]]
+		BinarySectionID SectionID(std::size_t index) const noexcept;
+		/// @brief Checks if the container has a section with the @p id.
+		/// @param id Section ID.
+		/// @return @a True if it has; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool HasSection(BinarySectionID id) const noexcept;
+		/// @brief Gets the section data as is.
+		/// @param id Section ID.
+		/// @return Section data.
+		/// @throws std::out_of_range If there's no such section.
+		[[nodiscard("Pure function")]]
+		std::span<const std::byte> SectionData(BinarySectionID id) const;
+
+		/// @brief Checks if the section may be viewed as an array of @p T without a copy.
+		/// @tparam T Value type.
+		/// @param id Section ID.
+		/// @return @a True if the section exists, its element size is the @p T size, its data is aligned for the @p T and its byte order is native; @a false otherwise.
+		template<typename T> requires (std::is_trivially_copyable_v<T>) [[nodiscard("Pure function")]]
+		bool CanView(BinarySectionID id) const noexcept;
+		/// @brief Views the section as an array of @p T.
+		/// @tparam T Value type.
+		/// @param id Section ID.
+		/// @return Section values. They point into the container data.
+		/// @throws std::out_of_range If there's no such section.
+		/// @throws std::invalid_argument If the section can't be viewed as an array of @p T.
+		template<typename T> requires (std::is_trivially_copyable_v<T>) [[nodiscard("Pure function")]]
+		std::span<const T> View(BinarySectionID id) const;
+		/// @brief Reads the section as an array of @p T.
+		/// @details It views the section if it's possible. Otherwise, it copies the section into the @p buffer converting the byte order if needed.
+		/// @tparam T Value type. It must be arithmetic or enum to convert the byte order.
+		/// @param id Section ID.
+		/// @param buffer Buffer that receives the section values if they can't be viewed.
+		/// @return Section values. They point into the container data or into the @p buffer.
+		/// @throws std::out_of_range If there's no such section.
+		/// @throws std::invalid_argument If the section can't be read as an array of @p T.
+		template<typename T> requires (std::is_trivially_copyable_v<T>)
+		std::span<const T> Read(BinarySectionID id, std::vector<T>& buffer) const;
+
+		BinaryContainerReader& operator =(const BinaryContainerReader& other) noexcept = default;
+		BinaryContainerReader& operator =(BinaryContainerReader&& other) noexcept = default;
+
+	private:
+		/// @brief Table of contents entry.
+		struct SectionEntry final
+		{
+			BinarySectionID id; ///< Section ID.
+			std::uint64_t offset; ///< Section offset from the container start.
+			std::uint64_t size; ///< Section size.
+			std::uint32_t elementSize; ///< Element size.
+			std::uint32_t alignment; ///< Alignment.
+		};
+
+		/// @brief Reads a table of contents entry.
+		/// @param index Section index.
+		/// @return Entry.
+		[[nodiscard("Pure function")]]
+		SectionEntry Entry(std::size_t index) const noexcept;
+		/// @brief Finds a table of contents entry.
+		/// @param id Section ID.
+		/// @return Entry; std::nullopt if not found.
+		[[nodiscard("Pure function")]]
+		std::optional<SectionEntry> FindEntry(BinarySectionID id) const noexcept;
+		/// @brief Finds a table of contents entry.
+		/// @param id Section ID.
+		/// @return Entry.
+		/// @throws std::out_of_range If there's no such section.
+		[[nodiscard("Pure function")]]
+		SectionEntry GetEntry(BinarySectionID id) const;
+
+		std::span<const std::byte> data; ///< Container data.
+		Meta::Version version; ///< Container version.
+		std::endian endian; ///< Section data byte order.
+		std::size_t sectionCount; ///< Section count.
+	};
+}
+
+namespace PonyEngine::Serialization
+{
+	constexpr std::array<std::byte, 4> BinaryContainerMagic = { std::byte{'P'}, std::byte{'N'}, std::byte{'B'}, std::byte{'C'} }; ///< Container magic.
+	constexpr std::uint16_t BinaryContainerFormat = 1u; ///< Container format version.
+
+	/// @brief Swaps the byte order of the @p value.
+	/// @tparam T Value type.
+	/// @param value Value.
+	/// @return Swapped value.
+	template<typename T> [[nodiscard("Pure function")]]
+	T SwapBytes(T value) noexcept;
+
+	BinaryContainerWriter::BinaryContainerWriter(const Meta::Version& version) noexcept :
+		version(version)
+	{
+	}
+
+	template<typename T> requires (std::is_trivially_copyable_v<T>)
+	void BinaryContainerWriter::AddSection(const BinarySectionID id, const std::span<const T> values, const std::size_t alignment)
+	{
+		AddSection(id, std::as_bytes(values), sizeof(T), alignment);
+	}
+
+	void BinaryContainerWriter::AddSection(const BinarySectionID id, const std::span<const std::byte> data, const std::size_t elementSize, const std::size_t alignment)
+	{
+		if (!std::has_single_bit(alignment) || alignment > MaxBinarySectionAlignment) [[unlikely]]
+		{
+			throw std::invalid_argument("Invalid alignment");
+		}
+		if (elementSize == 0uz || elementSize > std::numeric_limits<std::uint32_t>::max() || data.size() % elementSize != 0uz) [[unlikely]]
+		{
+			throw std::invalid_argument("Invalid element size");
+		}
+		if (std::ranges::find(sections, id, &Section::id) != sections.cend()) [[unlikely]]
+		{
+			throw std::invalid_argument(std::format("Section '0x{:X}' has already been added", id));
+		}
+
+		sections.push_back(Section
+		{
+			.id = id,
+			.data = data,
+			.elementSize = static_cast<std::uint32_t>(elementSize),
+			.alignment = static_cast<std::uint32_t>(std::max(alignment, BinarySectionAlignment))
+		});
+	}
+
+	std::size_t BinaryContainerWriter::Size() const noexcept
+	{
+		std::size_t size = BinaryContainerHeaderSize + BinarySectionEntrySize * sections.size();
+		for (const Section& section : sections)
+		{
+			size = (size + section.alignment - 1uz) / section.alignment * section.alignment + section.data.size();
+		}
+
+		return size;
+	}
+
+	std::byte* BinaryContainerWriter::Write(const std::span<std::byte> data) const
+	{
+		const std::size_t size = Size();
+		if (size > data.size()) [[unlikely]]
+		{
+			throw std::invalid_argument("Data is too small");
+		}
+
+		std::byte* const header = data.data();
+		std::ranges::fill_n(header, BinaryContainerHeaderSize + BinarySectionEntrySize * sections.size(), std::byte{0});
+		std::ranges::copy(BinaryContainerMagic, header);
+		WriteLittleEndian(header + 4, BinaryContainerFormat);
+		header[6] = std::byte{std::endian::native == std::endian::big};
+		for (std::size_t i = 0uz; i < Meta::Version::VersionNumberCount; ++i)
+		{
+			WriteLittleEndian(header + 8 + i * sizeof(std::uint32_t), version[i]);
+		}
+		WriteLittleEndian(header + 24, static_cast<std::uint32_t>(sections.size()));
+		WriteLittleEndian(header + 32, static_cast<std::uint64_t>(size));
+
+		std::size_t offset = BinaryContainerHeaderSize + BinarySectionEntrySize * sections.size();
+		for (std::size_t i = 0uz; i < sections.size(); ++i)
+		{
+			const Section& section = sections[i];
+			const std::size_t sectionOffset = (offset + section.alignment - 1uz) / section.alignment * section.alignment;
+			std::ranges::fill(data.subspan(offset, sectionOffset - offset), std::byte{0});
+			std::ranges::copy(section.data, data.data() + sectionOffset);
+			offset = sectionOffset + section.data.size();
+
+			std::byte* const entry = header + BinaryContainerHeaderSize + BinarySectionEntrySize * i;
+			WriteLittleEndian(entry, section.id);
+			WriteLittleEndian(entry + 8, static_cast<std::uint64_t>(sectionOffset));
+			WriteLittleEndian(entry + 16, static_cast<std::uint64_t>(section.data.size()));
+			WriteLittleEndian(entry + 24, section.elementSize);
+			WriteLittleEndian(entry + 28, section.alignment);
+		}
+
+		return data.data() + size;
+	}
+
+	BinaryContainerReader::BinaryContainerReader(const std::span<const std::byte> data) :
+		data(data)
+	{
+		if (data.size() < BinaryContainerHeaderSize || !std::ranges::equal(data.first(BinaryContainerMagic.size()), BinaryContainerMagic)) [[unlikely]]
+		{
+			throw std::invalid_argument("Data isn't a binary container");
+		}
+		if (const std::uint16_t format = ReadLittleEndian<std::uint16_t>(data.data() + 4); format != BinaryContainerFormat) [[unlikely]]
+		{
+			throw std::invalid_argument(std::format("Unsupported binary container format '{}'", format));
+		}
+		if (data[6] > std::byte{1}) [[unlikely]]
+		{
+			throw std::invalid_argument("Invalid binary container byte order");
+		}
+
+		endian = data[6] == std::byte{0} ? std::endian::little : std::endian::big;
+		for (std::size_t i = 0uz; i < Meta::Version::VersionNumberCount; ++i)
+		{
+			version[i] = ReadLittleEndian<std::uint32_t>(data.data() + 8 + i * sizeof(std::uint32_t));
+		}
+		sectionCount = ReadLittleEndian<std::uint32_t>(data.data() + 24);
+
+		if (const std::uint64_t size = ReadLittleEndian<std::uint64_t>(data.data() + 32); size > data.size()) [[unlikely]]
+		{
+			throw std::invalid_argument("Binary container is truncated");
+		}
+		else
+		{
+			this->data = data.first(static_cast<std::size_t>(size));
+		}
+
+		const std::size_t tableEnd = BinaryContainerHeaderSize + BinarySectionEntrySize * sectionCount;
+		if (tableEnd > this->data.size()) [[unlikely]]
+		{
+			throw std::invalid_argument("Binary container table of contents is truncated");
+		}
+		for (std::size_t i = 0uz; i < sectionCount; ++i)
+		{
+			const SectionEntry entry = Entry(i);
+			if (entry.offset < tableEnd || entry.offset > this->data.size() || entry.size > this->data.size() - entry.offset) [[unlikely]]
+			{
+				throw std::invalid_argument(std::format("Binary container section '0x{:X}' is out of bounds", entry.id));
+			}
+			if (!std::has_single_bit(entry.alignment) || entry.offset % entry.alignment != 0u || entry.elementSize == 0u || entry.size % entry.elementSize != 0u) [[unlikely]]
+			{
+				throw std::invalid_argument(std::format("Binary container section '0x{:X}' is invalid", entry.id));
+			}
+		}
+	}
+
+	Meta::Version BinaryContainerReader::Version() const noexcept
+	{
+		return version;
+	}
+
+	std::endian BinaryContainerReader::Endian() const noexcept
+	{
+		return endian;
+	}
+
+	std::size_t BinaryContainerReader::Size() const noexcept
+	{
+		return data.size();
+	}
+
+	std::size_t BinaryContainerReader::SectionCount() const noexcept
+	{
+		return sectionCount;
+	}
+
+	BinarySectionID BinaryContainerReader::SectionID(const std::size_t index) const noexcept
+	{
+		return Entry(index).id;
+	}
+
+	bool BinaryContainerReader::HasSection(const BinarySectionID id) const noexcept
+	{
+		return FindEntry(id).has_value();
+	}
+
+	std::span<const std::byte> BinaryContainerReader::SectionData(const BinarySectionID id) const
+	{
+		const SectionEntry entry = GetEntry(id);
+		return data.subspan(static_cast<std::size_t>(entry.offset), static_cast<std::size_t>(entry.size));
+	}
+
+	template<typename T> requires (std::is_trivially_copyable_v<T>)
+	bool BinaryContainerReader::CanView(const BinarySectionID id) const noexcept
+	{
+		const std::optional<SectionEntry> entry = FindEntry(id);
+		if (!entry || entry->elementSize != sizeof(T))
+		{
+			return false;
+		}
+		// Elements of any type, structs included, have foreign byte order inside.
+		if (endian != std::endian::native && sizeof(T) > 1uz)
+		{
+			return false;
+		}
+
+		return reinterpret_cast<std::uintptr_t>(data.data() + entry->offset) % alignof(T) == 0u;
+	}
+
+	template<typename T> requires (std::is_trivially_copyable_v<T>)
+	std::span<const T> BinaryContainerReader::View(const BinarySectionID id) const
+	{
+		const std::span<const std::byte> section = SectionData(id);
+		if (!CanView<T>(id)) [[unlikely]]
+		{
+			throw std::invalid_argument(std::format("Section '0x{:X}' can't be viewed. ElementSize = '{}'", id, sizeof(T)));
+		}
+
+		return std::span(reinterpret_cast<const T*>(section.data()), section.size() / sizeof(T));
+	}
+
+	template<typename T> requires (std::is_trivially_copyable_v<T>)
+	std::span<const T> BinaryContainerReader::Read(const BinarySectionID id, std::vector<T>& buffer) const
+	{
+		if (CanView<T>(id))
+		{
+			return View<T>(id);
+		}
+
+		const SectionEntry entry = GetEntry(id);
+		if (entry.elementSize != sizeof(T)) [[unlikely]]
+		{
+			throw std::invalid_argument(std::format("Section '0x{:X}' element size is '{}' but '{}' is expected", id, entry.elementSize, sizeof(T)));
+		}
+
+		const std::span<const std::byte> section = data.subspan(static_cast<std::size_t>(entry.offset), static_cast<std::size_t>(entry.size));
+		buffer.resize(section.size() / sizeof(T));
+		std::memcpy(buffer.data(), section.data(), section.size());
+		if (endian != std::endian::native && sizeof(T) > 1uz)
+		{
+			if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+			{
+				for (T& value : buffer)
+				{
+					value = SwapBytes(value);
+				}
+			}
+			else
+			{
+				throw std::invalid_argument(std::format("Byte order of section '0x{:X}' can't be converted", id));
+			}
+		}
+
+		return buffer;
+	}
+
+	BinaryContainerReader::SectionEntry BinaryContainerReader::Entry(const std::size_t index) const noexcept
+	{
+		const std::byte* const entry = data.data() + BinaryContainerHeaderSize + BinarySectionEntrySize * index;
+
+		return SectionEntry
+		{
+			.id = ReadLittleEndian<std::uint64_t>(entry),
+			.offset = ReadLittleEndian<std::uint64_t>(entry + 8),
+			.size = ReadLittleEndian<std::uint64_t>(entry + 16),
+			.elementSize = ReadLittleEndian<std::uint32_t>(entry + 24),
+			.alignment = ReadLittleEndian<std::uint32_t>(entry + 28)
+		};
+	}
+
+	std::optional<BinaryContainerReader::SectionEntry> BinaryContainerReader::FindEntry(const BinarySectionID id) const noexcept
+	{
+		for (std::size_t i = 0uz; i < sectionCount; ++i)
+		{
+			if (ReadLittleEndian<std::uint64_t>(data.data() + BinaryContainerHeaderSize + BinarySectionEntrySize * i) == id)
+			{
+				return Entry(i);
+			}
+		}
+
+		return std::nullopt;
+	}
+
+	BinaryContainerReader::SectionEntry BinaryContainerReader::GetEntry(const BinarySectionID id) const
+	{
+		if (const std::optional<SectionEntry> entry = FindEntry(id)) [[likely]]
+		{
+			return *entry;
+		}
+
+		throw std::out_of_range(std::format("Section '0x{:X}' not found", id));
+	}
+
+	template<typename T>
+	T SwapBytes(const T value) noexcept
+	{
+		if constexpr (std::is_enum_v<T>)
+		{
+			return static_cast<T>(SwapBytes(std::to_underlying(value)));
+		}
+		else if constexpr (std::is_integral_v<T>)
+		{
+			return std::byteswap(value);
+		}
+		else
+		{
+			using Bits = std::conditional_t<sizeof(T) == 8uz, std::uint64_t, std::conditional_t<sizeof(T) == 4uz, std::uint32_t, std::uint16_t>>;
+			static_assert(sizeof(Bits) == sizeof(T), "Unsupported floating point size");
+
+			return std::bit_cast<T>(std::byteswap(std::bit_cast<Bits>(value)));
+		}
+	}
+}
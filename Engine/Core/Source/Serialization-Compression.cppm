@@ -0,0 +1,772 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Serialization:Compression;
+
+import std;
+
+import PonyEngine.Hash;
+
+import :Basic;
+
+export namespace PonyEngine::Serialization
+{
+	constexpr std::size_t DefaultCompressionBlockSize = 256uz * 1024uz; ///< Default frame block size.
+	constexpr std::size_t MinCompressionBlockSize = 64uz * 1024uz; ///< Min frame block size.
+	constexpr std::size_t MaxCompressionBlockSize = 4uz * 1024uz * 1024uz; ///< Max frame block size.
+
+	/// @brief Gets a max compressed size of a block.
+	/// @param size Block size.
+	/// @return Max compressed size.
+	[[nodiscard("Pure function")]]
+	constexpr std::size_t GetMaxCompressedBlockSize(std::size_t size) noexcept;
+	/// @brief Compresses the @p source block.
+	/// @details It's an LZ77 compressor with a single-probe hash table. It's tuned for speed rather than ratio.
+	/// @param source Source data.
+	/// @param destination Compressed data. It must be at least @p GetMaxCompressedBlockSize() of the source size.
+	/// @return Pointer after the last element of the written data.
+	std::byte* CompressBlock(std::span<const std::byte> source, std::span<std::byte> destination);
+	/// @brief Decompresses the @p source block.
+	/// @param source Compressed data. It must be exactly one block.
+	/// @param destination Decompressed data.
+	/// @return Pointer after the last element of the written data.
+	/// @throws std::invalid_argument If the @p source is corrupted or the @p destination is too small.
+	std::byte* DecompressBlock(std::span<const std::byte> source, std::span<std::byte> destination);
+
+	/// @brief Gets a max compressed size of a frame.
+	/// @param size Source size.
+	/// @param blockSize Block size.
+	/// @return Max compressed size.
+	[[nodiscard("Pure function")]]
+	constexpr std::size_t GetMaxCompressedFrameSize(std::size_t size, std::size_t blockSize = DefaultCompressionBlockSize) noexcept;
+	/// @brief Compresses the @p source into a frame.
+	/// @details The frame consists of a header, independent blocks and an end mark with a checksum of the whole content.
+	///          Every block has its own checksum. Blocks that don't compress are stored as is. The blocks are compressed by several threads.
+	/// @param source Source data.
+	/// @param destination Frame data. The max required size is @p GetMaxCompressedFrameSize().
+	/// @param blockSize Block size. It's a power of two in range [@p MinCompressionBlockSize, @p MaxCompressionBlockSize].
+	/// @param threadCount Max thread count including the calling one.
+	/// @return Pointer after the last element of the written data.
+	std::byte* CompressFrame(std::span<const std::byte> source, std::span<std::byte> destination, std::size_t blockSize = DefaultCompressionBlockSize,
+		std::size_t threadCount = std::thread::hardware_concurrency());
+	/// @brief Gets a decompressed size of the frame.
+	/// @param source Frame data. Only the header is read.
+	/// @return Decompressed size.
+	/// @throws std::invalid_argument If the @p source isn't a frame.
+	[[nodiscard("Pure function")]]
+	std::size_t GetDecompressedFrameSize(std::span<const std::byte> source);
+	/// @brief Decompresses the frame.
+	/// @details The blocks are verified and decompressed by several threads.
+	/// @param source Frame data.
+	/// @param destination Decompressed data. The required size is @p GetDecompressedFrameSize().
+	/// @param threadCount Max thread count including the calling one.
+	/// @return Pointer after the last element of the written data.
+	/// @throws std::invalid_argument If the @p source is corrupted or the @p destination is too small.
+	std::byte* DecompressFrame(std::span<const std::byte> source, std::span<std::byte> destination, std::size_t threadCount = std::thread::hardware_concurrency());
+
+	/// @brief Frame compressor that receives data in parts.
+	/// @details It writes the same frame as @p CompressFrame() but on the calling thread only. It's handy when the data size isn't known beforehand.
+	class CompressionFrameWriter final
+	{
+	public:
+		/// @brief Creates a writer and writes a frame header.
+		/// @param output Output. The frame is appended to it.
+		/// @param blockSize Block size. It's a power of two in range [@p MinCompressionBlockSize, @p MaxCompressionBlockSize].
+		[[nodiscard("Pure constructor")]]
+		explicit CompressionFrameWriter(std::vector<std::byte>& output, std::size_t blockSize = DefaultCompressionBlockSize);
+		CompressionFrameWriter(const CompressionFrameWriter& other) = delete;
+		CompressionFrameWriter(CompressionFrameWriter&& other) = delete;
+
+		~CompressionFrameWriter() noexcept = default;
+
+		/// @brief Gets the written content size.
+		/// @return Content size.
+		[[nodiscard("Pure function")]]
+		std::size_t ContentSize() const noexcept;
+
+		/// @brief Writes the @p data.
+		/// @param data Data.
+		void Write(std::span<const std::byte> data);
+		/// @brief Writes the buffered data and finishes the frame.
+		/// @note Nothing may be written after it.
+		void Finish();
+
+		CompressionFrameWriter& operator =(const CompressionFrameWriter& other) = delete;
+		CompressionFrameWriter& operator =(CompressionFrameWriter&& other) = delete;
+
+	private:
+		/// @brief Compresses the buffered block and appends it to the output.
+		void WriteBlock();
+
+		std::vector<std::byte>* output; ///< Output.
+		std::size_t headerOffset; ///< Frame header offset in the output.
+		std::size_t blockSize; ///< Block size.
+		std::vector<std::byte> block; ///< Buffered block.
+		std::vector<std::byte> compressedBlock; ///< Compressed block buffer.
+		Hash::WyHash64Hash hash; ///< Content hash.
+		std::size_t contentSize; ///< Content size.
+		bool finished; ///< Is the frame finished?
+	};
+}
+
+namespace PonyEngine::Serialization
+{
+	constexpr std::array<std::byte, 4> CompressionFrameMagic = { std::byte{'P'}, std::byte{'N'}, std::byte{'L'}, std::byte{'Z'} }; ///< Frame magic.
+	constexpr std::uint8_t CompressionFrameFormat = 1u; ///< Frame format version.
+	constexpr std::size_t CompressionFrameHeaderSize = 16uz; ///< Frame header size.
+	constexpr std::size_t CompressionBlockHeaderSize = 8uz; ///< Block header size: stored size and checksum.
+	constexpr std::size_t CompressionFrameEndSize = 12uz; ///< Frame end size: end mark and content checksum.
+	constexpr std::uint32_t UncompressedBlockFlag = 0x80000000u; ///< Flag of a block stored as is.
+
+	constexpr std::size_t MinMatchLength = 4uz; ///< Min match length.
+	constexpr std::size_t LastLiteralCount = 5uz; ///< Count of the last bytes that are always literals.
+	constexpr std::size_t MatchSearchMargin = 12uz; ///< Min distance from a match start to the block end.
+	constexpr std::size_t MaxMatchOffset = 65535uz; ///< Max match offset.
+	constexpr std::uint32_t MatchTableBits = 12u; ///< Match table size log2.
+	constexpr std::size_t WildCopySize = 16uz; ///< Fixed copy size of short literals and matches.
+
+	/// @brief Reads 4 bytes.
+	/// @param data Source.
+	/// @return Read value.
+	[[nodiscard("Pure function")]]
+	std::uint32_t ReadSequence(const std::byte* data) noexcept;
+	/// @brief Gets a match table index of the @p sequence.
+	/// @param sequence 4 bytes.
+	/// @return Match table index.
+	[[nodiscard("Pure function")]]
+	constexpr std::uint32_t GetMatchTableIndex(std::uint32_t sequence) noexcept;
+	/// @brief Counts equal bytes.
+	/// @param data Data.
+	/// @param match Match candidate. It's before the @p data.
+	/// @param end End of the @p data to compare.
+	/// @return Equal byte count.
+	[[nodiscard("Pure function")]]
+	std::size_t CountMatch(const std::byte* data, const std::byte* match, const std::byte* end) noexcept;
+	/// @brief Writes an extended length.
+	/// @param length Length.
+	/// @param data Target.
+	/// @return Pointer after the written length.
+	std::byte* WriteLength(std::size_t length, std::byte* data) noexcept;
+	/// @brief Reads an extended length.
+	/// @param data Source. It's moved after the read length.
+	/// @param end Source end.
+	/// @return Length.
+	[[nodiscard("Pure function")]]
+	std::size_t ReadLength(const std::byte*& data, const std::byte* end);
+	/// @brief Writes a sequence: literals followed by a match.
+	/// @param literals Literals.
+	/// @param offset Match offset.
+	/// @param matchLength Match length. 0 means the last sequence without a match.
+	/// @param data Target.
+	/// @return Pointer after the written sequence.
+	std::byte* WriteSequence(std::span<const std::byte> literals, std::size_t offset, std::size_t matchLength, std::byte* data) noexcept;
+	/// @brief Copies a match.
+	/// @details It may write up to @p WildCopySize bytes past the match if there's room before the @p end. They're overwritten by the next sequences.
+	/// @param data Target.
+	/// @param offset Match offset. The match starts at @p data - @p offset.
+	/// @param length Match length.
+	/// @param end Target end.
+	void CopyMatch(std::byte* data, std::size_t offset, std::size_t length, const std::byte* end) noexcept;
+
+	/// @brief Checks if the @p blockSize is valid.
+	/// @param blockSize Block size.
+	/// @return @a True if it's valid; @a false otherwise.
+	[[nodiscard("Pure function")]]
+	constexpr bool IsValidCompressionBlockSize(std::size_t blockSize) noexcept;
+	/// @brief Gets a block checksum.
+	/// @param data Stored block data.
+	/// @return Checksum.
+	[[nodiscard("Pure function")]]
+	std::uint32_t GetCompressionBlockChecksum(std::span<const std::byte> data) noexcept;
+	/// @brief Writes a frame header.
+	/// @param blockSize Block size.
+	/// @param contentSize Content size.
+	/// @param data Target.
+	void WriteCompressionFrameHeader(std::size_t blockSize, std::uint64_t contentSize, std::byte* data) noexcept;
+	/// @brief Compresses a frame block. If it doesn't compress, it's stored as is.
+	/// @param source Block data.
+	/// @param destination Block buffer. It must be at least @p GetMaxCompressedBlockSize() of the block size.
+	/// @return Block header and stored data.
+	[[nodiscard("Pure function")]]
+	std::pair<std::uint32_t, std::span<const std::byte>> CompressFrameBlock(std::span<const std::byte> source, std::span<std::byte> destination);
+	/// @brief Runs the @p function for every block on several threads. The calling thread is one of them.
+	/// @tparam Function Function type.
+	/// @param blockCount Block count.
+	/// @param threadCount Max thread count.
+	/// @param function Function that receives a block index.
+	/// @remark The first exception thrown by the @p function is rethrown after all the threads finish.
+	template<std::invocable<std::size_t> Function>
+	void RunCompressionBlocks(std::size_t blockCount, std::size_t threadCount, const Function& function);
+
+	constexpr std::size_t GetMaxCompressedBlockSize(const std::size_t size) noexcept
+	{
+		return size + size / 255uz + 16uz;
+	}
+
+	std::byte* CompressBlock(const std::span<const std::byte> source, const std::span<std::byte> destination)
+	{
+		if (destination.size() < GetMaxCompressedBlockSize(source.size())) [[unlikely]]
+		{
+			throw std::invalid_argument("Data is too small");
+		}
+
+		const std::byte* const begin = source.data();
+		const std::byte* const end = begin + source.size();
+		const std::byte* anchor = begin;
+		std::byte* dataPoint = destination.data();
+
+		if (source.size() > MatchSearchMargin)
+		{
+			const std::byte* const searchEnd = end - MatchSearchMargin;
+			const std::byte* const matchEnd = end - LastLiteralCount;
+			auto table = std::array<std::uint32_t, 1uz << MatchTableBits>();
+
+			for (const std::byte* position = begin + 1; position < searchEnd; )
+			{
+				const std::uint32_t sequence = ReadSequence(position);
+				std::uint32_t& entry = table[GetMatchTableIndex(sequence)];
+				const std::byte* match = begin + entry;
+				entry = static_cast<std::uint32_t>(position - begin);
+
+				if (match >= position || static_cast<std::size_t>(position - match) > MaxMatchOffset || ReadSequence(match) != sequence)
+				{
+					position += 1 + ((position - anchor) >> 6);
+					continue;
+				}
+
+				while (position > anchor && match > begin && position[-1] == match[-1])
+				{
+					--position;
+					--match;
+				}
+
+				const std::size_t length = MinMatchLength + CountMatch(position + MinMatchLength, match + MinMatchLength, matchEnd);
+				dataPoint = WriteSequence(std::span(anchor, position), static_cast<std::size_t>(position - match), length, dataPoint);
+				position += length;
+				anchor = position;
+
+				if (position < searchEnd)
+				{
+					table[GetMatchTableIndex(ReadSequence(position - 2))] = static_cast<std::uint32_t>(position - 2 - begin);
+				}
+			}
+		}
+
+		return WriteSequence(std::span(anchor, end), 0uz, 0uz, dataPoint);
+	}
+
+	std::byte* DecompressBlock(const std::span<const std::byte> source, const std::span<std::byte> destination)
+	{
+		const std::byte* sourcePoint = source.data();
+		const std::byte* const sourceEnd = source.data() + source.size();
+		std::byte* dataPoint = destination.data();
+		const std::byte* const end = destination.data() + destination.size();
+
+		while (true)
+		{
+			if (sourcePoint == sourceEnd) [[unlikely]]
+			{
+				throw std::invalid_argument("Data is corrupted");
+			}
+
+			const std::uint32_t token = std::to_integer<std::uint32_t>(*sourcePoint++);
+			std::size_t literalLength = token >> 4;
+			if (literalLength == 15uz)
+			{
+				literalLength += ReadLength(sourcePoint, sourceEnd);
+			}
+			if (literalLength > static_cast<std::size_t>(sourceEnd - sourcePoint)) [[unlikely]]
+			{
+				throw std::invalid_argument("Data is corrupted");
+			}
+			if (literalLength > static_cast<std::size_t>(end - dataPoint)) [[unlikely]]
+			{
+				throw std::invalid_argument("Data is too small");
+			}
+			if (literalLength <= WildCopySize && sourceEnd - sourcePoint >= static_cast<std::ptrdiff_t>(WildCopySize) && end - dataPoint >= static_cast<std::ptrdiff_t>(WildCopySize))
+			{
+				std::memcpy(dataPoint, sourcePoint, WildCopySize);
+			}
+			else if (literalLength > 0uz)
+			{
+				std::memcpy(dataPoint, sourcePoint, literalLength);
+			}
+			sourcePoint += literalLength;
+			dataPoint += literalLength;
+
+			if (sourcePoint == sourceEnd)
+			{
+				return dataPoint;
+			}
+
+			if (sourceEnd - sourcePoint < 2) [[unlikely]]
+			{
+				throw std::invalid_argument("Data is corrupted");
+			}
+			const std::size_t offset = std::to_integer<std::size_t>(sourcePoint[0]) | std::to_integer<std::size_t>(sourcePoint[1]) << 8;
+			sourcePoint += 2;
+			if (offset == 0uz || offset > static_cast<std::size_t>(dataPoint - destination.data())) [[unlikely]]
+			{
+				throw std::invalid_argument("Data is corrupted");
+			}
+
+			std::size_t matchLength = (token & 15u) + MinMatchLength;
+			if (matchLength == 15uz + MinMatchLength)
+			{
+				matchLength += ReadLength(sourcePoint, sourceEnd);
+			}
+			if (matchLength > static_cast<std::size_t>(end - dataPoint)) [[unlikely]]
+			{
+				throw std::invalid_argument("Data is too small");
+			}
+			CopyMatch(dataPoint, offset, matchLength, end);
+			dataPoint += matchLength;
+		}
+	}
+
+	constexpr std::size_t GetMaxCompressedFrameSize(const std::size_t size, const std::size_t blockSize) noexcept
+	{
+		return CompressionFrameHeaderSize + size + (size + blockSize - 1uz) / blockSize * CompressionBlockHeaderSize + CompressionFrameEndSize;
+	}
+
+	std::byte* CompressFrame(const std::span<const std::byte> source, const std::span<std::byte> destination, const std::size_t blockSize, const std::size_t threadCount)
+	{
+		if (!IsValidCompressionBlockSize(blockSize)) [[unlikely]]
+		{
+			throw std::invalid_argument("Invalid block size");
+		}
+		if (destination.size() < CompressionFrameHeaderSize + CompressionFrameEndSize) [[unlikely]]
+		{
+			throw std::invalid_argument("Data is too small");
+		}
+
+		const std::size_t blockCount = (source.size() + blockSize - 1uz) / blockSize;
+		const std::size_t maxBlockSize = GetMaxCompressedBlockSize(blockSize);
+		const std::size_t workerCount = std::clamp(threadCount, 1uz, std::max(blockCount, 1uz));
+		const auto buffer = std::make_unique_for_overwrite<std::byte[]>(maxBlockSize * std::min(blockCount, workerCount * 4uz));
+		auto blocks = std::vector<std::pair<std::uint32_t, std::span<const std::byte>>>(blockCount);
+
+		WriteCompressionFrameHeader(blockSize, source.size(), destination.data());
+		std::byte* dataPoint = destination.data() + CompressionFrameHeaderSize;
+		const std::byte* const end = destination.data() + destination.size();
+
+		// Blocks are compressed in batches to bound the temporary memory.
+		const std::size_t batchSize = std::min(blockCount, workerCount * 4uz);
+		for (std::size_t batchBegin = 0uz; batchBegin < blockCount; batchBegin += batchSize)
+		{
+			const std::size_t batchCount = std::min(batchSize, blockCount - batchBegin);
+			RunCompressionBlocks(batchCount, workerCount, [&](const std::size_t index)
+			{
+				const std::size_t blockIndex = batchBegin + index;
+				const std::span<const std::byte> block = source.subspan(blockIndex * blockSize, std::min(blockSize, source.size() - blockIndex * blockSize));
+				blocks[blockIndex] = CompressFrameBlock(block, std::span(buffer.get() + index * maxBlockSize, maxBlockSize));
+			});
+
+			for (std::size_t i = batchBegin; i < batchBegin + batchCount; ++i)
+			{
+				const auto [header, data] = blocks[i];
+				if (CompressionBlockHeaderSize + data.size() > static_cast<std::size_t>(end - dataPoint)) [[unlikely]]
+				{
+					throw std::invalid_argument("Data is too small");
+				}
+
+				WriteLittleEndian(dataPoint, header);
+				WriteLittleEndian(dataPoint + 4, GetCompressionBlockChecksum(data));
+				std::memcpy(dataPoint + CompressionBlockHeaderSize, data.data(), data.size());
+				dataPoint += CompressionBlockHeaderSize + data.size();
+			}
+		}
+
+		if (CompressionFrameEndSize > static_cast<std::size_t>(end - dataPoint)) [[unlikely]]
+		{
+			throw std::invalid_argument("Data is too small");
+		}
+		WriteLittleEndian(dataPoint, 0u);
+		WriteLittleEndian(dataPoint + 4, Hash::WyHash64(source));
+
+		return dataPoint + CompressionFrameEndSize;
+	}
+
+	std::size_t GetDecompressedFrameSize(const std::span<const std::byte> source)
+	{
+		if (source.size() < CompressionFrameHeaderSize || !std::ranges::equal(source.first(CompressionFrameMagic.size()), CompressionFrameMagic)) [[unlikely]]
+		{
+			throw std::invalid_argument("Data isn't a compression frame");
+		}
+		if (std::to_integer<std::uint8_t>(source[4]) != CompressionFrameFormat) [[unlikely]]
+		{
+			throw std::invalid_argument(std::format("Unsupported compression frame format '{}'", std::to_integer<std::uint32_t>(source[4])));
+		}
+
+		const std::uint64_t contentSize = ReadLittleEndian<std::uint64_t>(source.data() + 8);
+		if (contentSize > std::numeric_limits<std::size_t>::max()) [[unlikely]]
+		{
+			throw std::invalid_argument("Compression frame is too big");
+		}
+
+		return static_cast<std::size_t>(contentSize);
+	}
+
+	std::byte* DecompressFrame(const std::span<const std::byte> source, const std::span<std::byte> destination, const std::size_t threadCount)
+	{
+		const std::size_t contentSize = GetDecompressedFrameSize(source);
+		const std::size_t blockSize = 1uz << std::to_integer<std::size_t>(source[5]);
+		if (std::to_integer<std::size_t>(source[5]) >= sizeof(std::size_t) * 8uz || !IsValidCompressionBlockSize(blockSize)) [[unlikely]]
+		{
+			throw std::invalid_argument("Data is corrupted");
+		}
+		if (contentSize > destination.size()) [[unlikely]]
+		{
+			throw std::invalid_argument("Data is too small");
+		}
+
+		const std::size_t blockCount = (contentSize + blockSize - 1uz) / blockSize;
+		auto blocks = std::vector<const std::byte*>(blockCount);
+		const std::byte* sourcePoint = source.data() + CompressionFrameHeaderSize;
+		const std::byte* const sourceEnd = source.data() + source.size();
+		for (const std::byte*& block : blocks)
+		{
+			if (static_cast<std::size_t>(sourceEnd - sourcePoint) < CompressionBlockHeaderSize) [[unlikely]]
+			{
+				throw std::invalid_argument("Data is corrupted");
+			}
+			const std::size_t storedSize = ReadLittleEndian<std::uint32_t>(sourcePoint) & ~UncompressedBlockFlag;
+			if (storedSize == 0uz || storedSize > static_cast<std::size_t>(sourceEnd - sourcePoint) - CompressionBlockHeaderSize) [[unlikely]]
+			{
+				throw std::invalid_argument("Data is corrupted");
+			}
+			block = sourcePoint;
+			sourcePoint += CompressionBlockHeaderSize + storedSize;
+		}
+		if (static_cast<std::size_t>(sourceEnd - sourcePoint) < CompressionFrameEndSize || ReadLittleEndian<std::uint32_t>(sourcePoint) != 0u) [[unlikely]]
+		{
+			throw std::invalid_argument("Data is corrupted");
+		}
+
+		RunCompressionBlocks(blockCount, threadCount, [&](const std::size_t index)
+		{
+			const std::uint32_t header = ReadLittleEndian<std::uint32_t>(blocks[index]);
+			const auto stored = std::span(blocks[index] + CompressionBlockHeaderSize, header & ~UncompressedBlockFlag);
+			if (GetCompressionBlockChecksum(stored) != ReadLittleEndian<std::uint32_t>(blocks[index] + 4)) [[unlikely]]
+			{
+				throw std::invalid_argument(std::format("Compression block checksum mismatch: Index = '{}'", index));
+			}
+
+			const std::span<std::byte> block = destination.subspan(index * blockSize, std::min(blockSize, contentSize - index * blockSize));
+			if (header & UncompressedBlockFlag)
+			{
+				if (stored.size() != block.size()) [[unlikely]]
+				{
+					throw std::invalid_argument("Data is corrupted");
+				}
+				std::memcpy(block.data(), stored.data(), stored.size());
+			}
+			else if (DecompressBlock(stored, block) != block.data() + block.size()) [[unlikely]]
+			{
+				throw std::invalid_argument("Data is corrupted");
+			}
+		});
+
+		if (Hash::WyHash64(std::span<const std::byte>(destination.data(), contentSize)) != ReadLittleEndian<std::uint64_t>(sourcePoint + 4)) [[unlikely]]
+		{
+			throw std::invalid_argument("Compression frame checksum mismatch");
+		}
+
+		return destination.data() + contentSize;
+	}
+
+	CompressionFrameWriter::CompressionFrameWriter(std::vector<std::byte>& output, const std::size_t blockSize) :
+		output{&output},
+		headerOffset{output.size()},
+		blockSize{blockSize},
+		contentSize{0uz},
+		finished{false}
+	{
+		if (!IsValidCompressionBlockSize(blockSize)) [[unlikely]]
+		{
+			throw std::invalid_argument("Invalid block size");
+		}
+
+		block.reserve(blockSize);
+		compressedBlock.resize(GetMaxCompressedBlockSize(blockSize));
+		output.resize(output.size() + CompressionFrameHeaderSize);
+		WriteCompressionFrameHeader(blockSize, 0ull, output.data() + headerOffset);
+	}
+
+	std::size_t CompressionFrameWriter::ContentSize() const noexcept
+	{
+		return contentSize;
+	}
+
+	void CompressionFrameWriter::Write(std::span<const std::byte> data)
+	{
+		if (finished) [[unlikely]]
+		{
+			throw std::logic_error("Compression frame is finished");
+		}
+
+		hash.Hash(data);
+		contentSize += data.size();
+		while (!data.empty())
+		{
+			const std::size_t count = std::min(data.size(), blockSize - block.size());
+			block.insert(block.end(), data.begin(), data.begin() + count);
+			data = data.subspan(count);
+
+			if (block.size() == blockSize)
+			{
+				WriteBlock();
+			}
+		}
+	}
+
+	void CompressionFrameWriter::Finish()
+	{
+		if (finished) [[unlikely]]
+		{
+			throw std::logic_error("Compression frame is finished");
+		}
+
+		if (!block.empty())
+		{
+			WriteBlock();
+		}
+
+		const std::size_t offset = output->size();
+		output->resize(offset + CompressionFrameEndSize);
+		WriteLittleEndian(output->data() + offset, 0u);
+		WriteLittleEndian(output->data() + offset + 4, hash.Hash());
+		WriteCompressionFrameHeader(blockSize, contentSize, output->data() + headerOffset);
+		finished = true;
+	}
+
+	void CompressionFrameWriter::WriteBlock()
+	{
+		const auto [header, data] = CompressFrameBlock(block, compressedBlock);
+		const std::size_t offset = output->size();
+		output->resize(offset + CompressionBlockHeaderSize + data.size());
+		WriteLittleEndian(output->data() + offset, header);
+		WriteLittleEndian(output->data() + offset + 4, GetCompressionBlockChecksum(data));
+		std::memcpy(output->data() + offset + CompressionBlockHeaderSize, data.data(), data.size());
+		block.clear();
+	}
+
+	std::uint32_t ReadSequence(const std::byte* const data) noexcept
+	{
+		std::uint32_t sequence;
+		std::memcpy(&sequence, data, sizeof(sequence));
+
+		return sequence;
+	}
+
+	constexpr std::uint32_t GetMatchTableIndex(const std::uint32_t sequence) noexcept
+	{
+		return (sequence * 2654435761u) >> (32u - MatchTableBits);
+	}
+
+	std::size_t CountMatch(const std::byte* data, const std::byte* match, const std::byte* const end) noexcept
+	{
+		const std::byte* const begin = data;
+
+		if constexpr (std::endian::native == std::endian::little)
+		{
+			for (; end - data >= 8; data += 8, match += 8)
+			{
+				std::uint64_t dataWord;
+				std::uint64_t matchWord;
+				std::memcpy(&dataWord, data, sizeof(dataWord));
+				std::memcpy(&matchWord, match, sizeof(matchWord));
+				if (const std::uint64_t difference = dataWord ^ matchWord)
+				{
+					return static_cast<std::size_t>(data - begin) + static_cast<std::size_t>(std::countr_zero(difference)) / 8uz;
+				}
+			}
+		}
+
+		for (; data < end && *data == *match; ++data, ++match)
+		{
+		}
+
+		return static_cast<std::size_t>(data - begin);
+	}
+
+	std::byte* WriteLength(std::size_t length, std::byte* data) noexcept
+	{
+		for (; length >= 255uz; length -= 255uz)
+		{
+			*data++ = std::byte{255};
+		}
+		*data++ = static_cast<std::byte>(length);
+
+		return data;
+	}
+
+	std::size_t ReadLength(const std::byte*& data, const std::byte* const end)
+	{
+		std::size_t length = 0uz;
+		std::uint32_t byte;
+		do
+		{
+			if (data == end) [[unlikely]]
+			{
+				throw std::invalid_argument("Data is corrupted");
+			}
+
+			byte = std::to_integer<std::uint32_t>(*data++);
+			length += byte;
+		}
+		while (byte == 255u);
+
+		return length;
+	}
+
+	std::byte* WriteSequence(const std::span<const std::byte> literals, const std::size_t offset, const std::size_t matchLength, std::byte* data) noexcept
+	{
+		std::byte* const token = data++;
+		std::uint32_t tokenValue = static_cast<std::uint32_t>(std::min(literals.size(), 15uz)) << 4;
+		if (literals.size() >= 15uz)
+		{
+			data = WriteLength(literals.size() - 15uz, data);
+		}
+		if (!literals.empty())
+		{
+			std::memcpy(data, literals.data(), literals.size());
+			data += literals.size();
+		}
+
+		if (matchLength > 0uz)
+		{
+			*data++ = static_cast<std::byte>(offset);
+			*data++ = static_cast<std::byte>(offset >> 8);
+
+			const std::size_t length = matchLength - MinMatchLength;
+			tokenValue |= static_cast<std::uint32_t>(std::min(length, 15uz));
+			if (length >= 15uz)
+			{
+				data = WriteLength(length - 15uz, data);
+			}
+		}
+
+		*token = static_cast<std::byte>(tokenValue);
+
+		return data;
+	}
+
+	void CopyMatch(std::byte* data, const std::size_t offset, std::size_t length, const std::byte* const end) noexcept
+	{
+		const std::byte* match = data - offset;
+		if (offset >= WildCopySize && static_cast<std::size_t>(end - data) >= length + WildCopySize)
+		{
+			for (const std::byte* const matchEnd = data + length; data < matchEnd; data += WildCopySize, match += WildCopySize)
+			{
+				std::memcpy(data, match, WildCopySize);
+			}
+		}
+		else if (offset >= length)
+		{
+			std::memcpy(data, match, length);
+		}
+		else if (offset >= 8uz)
+		{
+			for (; length >= 8uz; length -= 8uz, data += 8, match += 8)
+			{
+				std::memcpy(data, match, 8uz);
+			}
+			for (; length > 0uz; --length)
+			{
+				*data++ = *match++;
+			}
+		}
+		else
+		{
+			for (; length > 0uz; --length)
+			{
+				*data++ = *match++;
+			}
+		}
+	}
+
+	constexpr bool IsValidCompressionBlockSize(const std::size_t blockSize) noexcept
+	{
+		return std::has_single_bit(blockSize) && blockSize >= MinCompressionBlockSize && blockSize <= MaxCompressionBlockSize;
+	}
+
+	std::uint32_t GetCompressionBlockChecksum(const std::span<const std::byte> data) noexcept
+	{
+		return static_cast<std::uint32_t>(Hash::WyHash64(data));
+	}
+
+	void WriteCompressionFrameHeader(const std::size_t blockSize, const std::uint64_t contentSize, std::byte* const data) noexcept
+	{
+		std::ranges::copy(CompressionFrameMagic, data);
+		data[4] = static_cast<std::byte>(CompressionFrameFormat);
+		data[5] = static_cast<std::byte>(std::countr_zero(blockSize));
+		data[6] = std::byte{0};
+		data[7] = std::byte{0};
+		WriteLittleEndian(data + 8, contentSize);
+	}
+
+	std::pair<std::uint32_t, std::span<const std::byte>> CompressFrameBlock(const std::span<const std::byte> source, const std::span<std::byte> destination)
+	{
+		const std::byte* const end = CompressBlock(source, destination);
+		const auto size = static_cast<std::size_t>(end - destination.data());
+		if (size >= source.size())
+		{
+			return std::pair(static_cast<std::uint32_t>(source.size()) | UncompressedBlockFlag, source);
+		}
+
+		return std::pair(static_cast<std::uint32_t>(size), std::span<const std::byte>(destination.data(), size));
+	}
+
+	template<std::invocable<std::size_t> Function>
+	void RunCompressionBlocks(const std::size_t blockCount, const std::size_t threadCount, const Function& function)
+	{
+		if (blockCount == 0uz)
+		{
+			return;
+		}
+
+		const std::size_t workerCount = std::clamp(threadCount, 1uz, blockCount);
+		auto nextBlock = std::atomic<std::size_t>(0uz);
+		auto errors = std::vector<std::exception_ptr>(workerCount);
+		const auto work = [&](const std::size_t worker) noexcept
+		{
+			try
+			{
+				for (std::size_t block = nextBlock.fetch_add(1uz, std::memory_order::relaxed); block < blockCount; block = nextBlock.fetch_add(1uz, std::memory_order::relaxed))
+				{
+					function(block);
+				}
+			}
+			catch (...)
+			{
+				errors[worker] = std::current_exception();
+				nextBlock.store(blockCount, std::memory_order::relaxed);
+			}
+		};
+
+		{
+			auto threads = std::vector<std::jthread>();
+			threads.reserve(workerCount - 1uz);
+			for (std::size_t i = 1uz; i < workerCount; ++i)
+			{
+				threads.emplace_back(work, i);
+			}
+			work(0uz);
+		}
+
+		for (const std::exception_ptr& error : errors)
+		{
+			if (error) [[unlikely]]
+			{
+				std::rethrow_exception(error);
+			}
+		}
+	}
+}
@@ -11,3 +11,5 @@ export module PonyEngine.Serialization;
 
 export import :Array;
 export import :Basic;
+export import :BinaryContainer;
+export import :Compression;
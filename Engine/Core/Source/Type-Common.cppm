@@ -16,6 +16,9 @@ export namespace PonyEngine::Type
 	/// @brief The concept is satisfied if @p T is an arithmetic type.
 	template<typename T>
 	concept Arithmetic = std::is_arithmetic_v<T>;
+	/// @brief The concept is satisfied if @p T is an integer type. Bool isn't an integer.
+	template<typename T>
+	concept Integer = std::is_integral_v<T> && !std::is_same_v<std::remove_cv_t<T>, bool>;
 	/// @brief The concept is satisfied if @p T is a signed type.
 	template<typename T>
 	concept Signed = std::is_signed_v<T>;
@@ -0,0 +1,124 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Type:FunctionRef;
+
+import std;
+
+export namespace PonyEngine::Type
+{
+	/// @brief Non-owning reference to a callable.
+	/// @details It's two pointers wide and never allocates. The referenced callable must outlive the reference.
+	/// @tparam Signature Function signature. It may be noexcept.
+	template<typename Signature>
+	class FunctionRef;
+
+	/// @brief Non-owning reference to a callable.
+	/// @details It's two pointers wide and never allocates. The referenced callable must outlive the reference.
+	/// @tparam Return Return type.
+	/// @tparam Args Argument types.
+	/// @tparam Noexcept Is the signature noexcept?
+	template<typename Return, typename... Args, bool Noexcept>
+	class FunctionRef<Return(Args...) noexcept(Noexcept)> final
+	{
+	public:
+		/// @brief Creates a reference to the @p function.
+		/// @param function Function.
+		[[nodiscard("Pure constructor")]]
+		FunctionRef(Return(*function)(Args...) noexcept(Noexcept)) noexcept;
+		/// @brief Creates a reference to the @p function.
+		/// @tparam F Callable type.
+		/// @param function Callable.
+		template<typename F> requires
+			(!std::is_same_v<std::remove_cvref_t<F>, FunctionRef>) && (!std::is_function_v<std::remove_reference_t<F>>) &&
+			(Noexcept ? std::is_nothrow_invocable_r_v<Return, F&, Args...> : std::is_invocable_r_v<Return, F&, Args...>)
+		[[nodiscard("Pure constructor")]]
+		FunctionRef(F&& function) noexcept;
+		[[nodiscard("Pure constructor")]]
+		FunctionRef(const FunctionRef& other) noexcept = default;
+		[[nodiscard("Pure constructor")]]
+		FunctionRef(FunctionRef&& other) noexcept = default;
+
+		~FunctionRef() noexcept = default;
+
+		/// @brief Invokes the referenced callable.
+		/// @param args Arguments.
+		/// @return Callable result.
+		Return operator ()(Args... args) const noexcept(Noexcept);
+
+		FunctionRef& operator =(const FunctionRef& other) noexcept = default;
+		FunctionRef& operator =(FunctionRef&& other) noexcept = default;
+
+	private:
+		/// @brief Referenced callable.
+		union Target
+		{
+			void* object; ///< Callable object.
+			Return(*function)(Args...) noexcept(Noexcept); ///< Function pointer.
+		};
+
+		/// @brief Callable invoker.
+		using Invoker = Return(*)(Target target, Args&&... args) noexcept(Noexcept);
+
+		/// @brief Invokes the callable object.
+		/// @tparam F Callable type.
+		/// @param target Target.
+		/// @param args Arguments.
+		/// @return Callable result.
+		template<typename F>
+		static Return InvokeObject(Target target, Args&&... args) noexcept(Noexcept);
+		/// @brief Invokes the function pointer.
+		/// @param target Target.
+		/// @param args Arguments.
+		/// @return Function result.
+		static Return InvokeFunction(Target target, Args&&... args) noexcept(Noexcept);
+
+		Target target; ///< Referenced callable.
+		Invoker invoker; ///< Callable invoker.
+	};
+}
+
+namespace PonyEngine::Type
+{
+	template<typename Return, typename... Args, bool Noexcept>
+	FunctionRef<Return(Args...) noexcept(Noexcept)>::FunctionRef(Return(* const function)(Args...) noexcept(Noexcept)) noexcept :
+		target{.function = function},
+		invoker{&InvokeFunction}
+	{
+	}
+
+	template<typename Return, typename... Args, bool Noexcept>
+	template<typename F> requires
+		(!std::is_same_v<std::remove_cvref_t<F>, FunctionRef<Return(Args...) noexcept(Noexcept)>>) && (!std::is_function_v<std::remove_reference_t<F>>) &&
+		(Noexcept ? std::is_nothrow_invocable_r_v<Return, F&, Args...> : std::is_invocable_r_v<Return, F&, Args...>)
+	FunctionRef<Return(Args...) noexcept(Noexcept)>::FunctionRef(F&& function) noexcept :
+		target{.object = const_cast<void*>(static_cast<const void*>(std::addressof(function)))},
+		invoker{&InvokeObject<std::remove_reference_t<F>>}
+	{
+	}
+
+	template<typename Return, typename... Args, bool Noexcept>
+	Return FunctionRef<Return(Args...) noexcept(Noexcept)>::operator ()(Args... args) const noexcept(Noexcept)
+	{
+		return invoker(target, std::forward<Args>(args)...);
+	}
+
+	template<typename Return, typename... Args, bool Noexcept>
+	template<typename F>
+	Return FunctionRef<Return(Args...) noexcept(Noexcept)>::InvokeObject(const Target target, Args&&... args) noexcept(Noexcept)
+	{
+		return std::invoke_r<Return>(*static_cast<F*>(target.object), std::forward<Args>(args)...);
+	}
+
+	template<typename Return, typename... Args, bool Noexcept>
+	Return FunctionRef<Return(Args...) noexcept(Noexcept)>::InvokeFunction(const Target target, Args&&... args) noexcept(Noexcept)
+	{
+		return std::invoke_r<Return>(target.function, std::forward<Args>(args)...);
+	}
+}
@@ -0,0 +1,263 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+module;
+
+#include <cassert>
+
+export module PonyEngine.Type:InplaceFunction;
+
+import std;
+
+export namespace PonyEngine::Type
+{
+	/// @brief Default inplace function capacity in bytes.
+	constexpr std::size_t DefaultInplaceFunctionCapacity = 4uz * sizeof(void*);
+
+	/// @brief Move-only function wrapper that stores its target inside itself and never allocates.
+	/// @tparam Signature Function signature. It may be noexcept.
+	/// @tparam Capacity Storage size in bytes. A target bigger than this is a compile-time error.
+	/// @tparam Alignment Storage alignment. A target with a stricter alignment is a compile-time error.
+	template<typename Signature, std::size_t Capacity = DefaultInplaceFunctionCapacity, std::size_t Alignment = alignof(std::max_align_t)>
+	class InplaceFunction;
+
+	/// @brief Move-only function wrapper that stores its target inside itself and never allocates.
+	/// @tparam Return Return type.
+	/// @tparam Args Argument types.
+	/// @tparam Noexcept Is the signature noexcept?
+	/// @tparam Capacity Storage size in bytes. A target bigger than this is a compile-time error.
+	/// @tparam Alignment Storage alignment. A target with a stricter alignment is a compile-time error.
+	template<typename Return, typename... Args, bool Noexcept, std::size_t Capacity, std::size_t Alignment>
+	class InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment> final
+	{
+	public:
+		/// @brief Creates an empty function.
+		[[nodiscard("Pure constructor")]]
+		InplaceFunction() noexcept;
+		/// @brief Creates an empty function.
+		[[nodiscard("Pure constructor")]]
+		InplaceFunction(std::nullptr_t) noexcept;
+		/// @brief Creates a function that holds the @p function.
+		/// @tparam F Function type.
+		/// @param function Function. It's moved or copied into the inner storage.
+		template<typename F> requires
+			(!std::is_same_v<std::remove_cvref_t<F>, InplaceFunction>) &&
+			(Noexcept ? std::is_nothrow_invocable_r_v<Return, std::decay_t<F>&, Args...> : std::is_invocable_r_v<Return, std::decay_t<F>&, Args...>)
+		[[nodiscard("Pure constructor")]]
+		InplaceFunction(F&& function) noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F>);
+		InplaceFunction(const InplaceFunction&) = delete;
+		[[nodiscard("Pure constructor")]]
+		InplaceFunction(InplaceFunction&& other) noexcept;
+
+		~InplaceFunction() noexcept;
+
+		/// @brief Checks if the function has a target.
+		/// @return @a True if it has a target; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool IsEmpty() const noexcept;
+		/// @brief Destroys the target.
+		void Reset() noexcept;
+
+		/// @brief Swaps the functions.
+		/// @param other Other function.
+		void Swap(InplaceFunction& other) noexcept;
+
+		/// @brief Checks if the function has a target.
+		/// @return @a True if it has a target; @a false otherwise.
+		[[nodiscard("Pure operator")]]
+		explicit operator bool() const noexcept;
+
+		/// @brief Invokes the target.
+		/// @param args Arguments.
+		/// @return Target result.
+		/// @note The function must have a target.
+		Return operator ()(Args... args) const noexcept(Noexcept);
+
+		InplaceFunction& operator =(std::nullptr_t) noexcept;
+		InplaceFunction& operator =(const InplaceFunction&) = delete;
+		InplaceFunction& operator =(InplaceFunction&& other) noexcept;
+
+	private:
+		/// @brief Target invoker.
+		using Invoker = Return(*)(void* target, Args&&... args) noexcept(Noexcept);
+		/// @brief Target manager. It move-constructs the @p source into the @p destination and destroys the @p source.
+		/// If the @p destination is nullptr, it only destroys the @p source.
+		using Manager = void(*)(void* destination, void* source) noexcept;
+
+		/// @brief Invokes the target.
+		/// @tparam F Target type.
+		/// @param target Target.
+		/// @param args Arguments.
+		/// @return Target result.
+		template<typename F>
+		static Return Invoke(void* target, Args&&... args) noexcept(Noexcept);
+		/// @brief Moves and/or destroys the target.
+		/// @tparam F Target type.
+		/// @param destination Destination storage or nullptr.
+		/// @param source Source target.
+		template<typename F>
+		static void Manage(void* destination, void* source) noexcept;
+
+		/// @brief Moves the target of the @p other into this. This must be empty.
+		/// @param other Source function.
+		void MoveFrom(InplaceFunction& other) noexcept;
+
+		alignas(Alignment) mutable std::byte storage[Capacity]; ///< Target storage.
+		Invoker invoker; ///< Target invoker. It's nullptr if the function is empty.
+		Manager manager; ///< Target manager. It's nullptr if the function is empty.
+	};
+}
+
+namespace PonyEngine::Type
+{
+	template<typename Return, typename... Args, bool Noexcept, std::size_t Capacity, std::size_t Alignment>
+	InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>::InplaceFunction() noexcept :
+		invoker{nullptr},
+		manager{nullptr}
+	{
+	}
+
+	template<typename Return, typename... Args, bool Noexcept, std::size_t Capacity, std::size_t Alignment>
+	InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>::InplaceFunction(std::nullptr_t) noexcept :
+		InplaceFunction()
+	{
+	}
+
+	template<typename Return, typename... Args, bool Noexcept, std::size_t Capacity, std::size_t Alignment>
+	template<typename F> requires
+		(!std::is_same_v<std::remove_cvref_t<F>, InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>>) &&
+		(Noexcept ? std::is_nothrow_invocable_r_v<Return, std::decay_t<F>&, Args...> : std::is_invocable_r_v<Return, std::decay_t<F>&, Args...>)
+	InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>::InplaceFunction(F&& function) noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F>) :
+		InplaceFunction()
+	{
+		using Target = std::decay_t<F>;
+		static_assert(sizeof(Target) <= Capacity, "The function target is too big for the inplace function capacity");
+		static_assert(alignof(Target) <= Alignment, "The function target alignment is too strict for the inplace function");
+		static_assert(std::is_nothrow_move_constructible_v<Target>, "The function target must be nothrow move constructible");
+
+		if constexpr (std::is_pointer_v<Target> || std::is_member_pointer_v<Target>)
+		{
+			if (!function)
+			{
+				return;
+			}
+		}
+
+		new (storage) Target(std::forward<F>(function));
+		invoker = &Invoke<Target>;
+		manager = &Manage<Target>;
+	}
+
+	template<typename Return, typename... Args, bool Noexcept, std::size_t Capacity, std::size_t Alignment>
+	InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>::InplaceFunction(InplaceFunction&& other) noexcept :
+		InplaceFunction()
+	{
+		MoveFrom(other);
+	}
+
+	template<typename Return, typename... Args, bool Noexcept, std::size_t Capacity, std::size_t Alignment>
+	InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>::~InplaceFunction() noexcept
+	{
+		Reset();
+	}
+
+	template<typename Return, typename... Args, bool Noexcept, std::size_t Capacity, std::size_t Alignment>
+	bool InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>::IsEmpty() const noexcept
+	{
+		return !invoker;
+	}
+
+	template<typename Return, typename... Args, bool Noexcept, std::size_t Capacity, std::size_t Alignment>
+	void InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>::Reset() noexcept
+	{
+		if (manager)
+		{
+			manager(nullptr, storage);
+			invoker = nullptr;
+			manager = nullptr;
+		}
+	}
+
+	template<typename Return, typename... Args, bool Noexcept, std::size_t Capacity, std::size_t Alignment>
+	void InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>::Swap(InplaceFunction& other) noexcept
+	{
+		if (this == &other)
+		{
+			return;
+		}
+
+		InplaceFunction temporary = std::move(other);
+		other.MoveFrom(*this);
+		MoveFrom(temporary);
+	}
+
+	template<typename Return, typename... Args, bool Noexcept, std::size_t Capacity, std::size_t Alignment>
+	InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>::operator bool() const noexcept
+	{
+		return !IsEmpty();
+	}
+
+	template<typename Return, typename... Args, bool Noexcept, std::size_t Capacity, std::size_t Alignment>
+	Return InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>::operator ()(Args... args) const noexcept(Noexcept)
+	{
+		assert(invoker && "The inplace function is empty.");
+
+		return invoker(storage, std::forward<Args>(args)...);
+	}
+
+	template<typename Return, typename... Args, bool Noexcept, std::size_t Capacity, std::size_t Alignment>
+	InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>& InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>::operator =(std::nullptr_t) noexcept
+	{
+		Reset();
+
+		return *this;
+	}
+
+	template<typename Return, typename... Args, bool Noexcept, std::size_t Capacity, std::size_t Alignment>
+	InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>& InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>::operator =(InplaceFunction&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Reset();
+			MoveFrom(other);
+		}
+
+		return *this;
+	}
+
+	template<typename Return, typename... Args, bool Noexcept, std::size_t Capacity, std::size_t Alignment>
+	template<typename F>
+	Return InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>::Invoke(void* const target, Args&&... args) noexcept(Noexcept)
+	{
+		return std::invoke_r<Return>(*std::launder(static_cast<F*>(target)), std::forward<Args>(args)...);
+	}
+
+	template<typename Return, typename... Args, bool Noexcept, std::size_t Capacity, std::size_t Alignment>
+	template<typename F>
+	void InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>::Manage(void* const destination, void* const source) noexcept
+	{
+		F* const sourceTarget = std::launder(static_cast<F*>(source));
+		if (destination)
+		{
+			new (destination) F(std::move(*sourceTarget));
+		}
+		sourceTarget->~F();
+	}
+
+	template<typename Return, typename... Args, bool Noexcept, std::size_t Capacity, std::size_t Alignment>
+	void InplaceFunction<Return(Args...) noexcept(Noexcept), Capacity, Alignment>::MoveFrom(InplaceFunction& other) noexcept
+	{
+		if (other.manager)
+		{
+			other.manager(storage, other.storage);
+			invoker = std::exchange(other.invoker, nullptr);
+			manager = std::exchange(other.manager, nullptr);
+		}
+	}
+}
@@ -10,5 +10,7 @@
 export module PonyEngine.Type;
 
 export import :Common;
+export import :FunctionRef;
+export import :InplaceFunction;
 export import :Limits;
 export import :Variant;
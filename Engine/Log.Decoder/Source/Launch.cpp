@@ -0,0 +1,57 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+import std;
+
+import PonyEngine.Log.Decoder;
+
+int main(const int argc, const char* const* const argv)
+{
+	try
+	{
+		auto args = std::vector<std::string_view>();
+		args.reserve(static_cast<std::size_t>(std::max(argc - 1, 0)));
+		for (int i = 1; i < argc; ++i)
+		{
+			args.push_back(argv[i]);
+		}
+
+		if (args.empty() || args.front() == "--help")
+		{
+			std::cout << PonyEngine::Log::Decoder::Usage;
+			return args.empty() ? 1 : 0;
+		}
+
+		PonyEngine::Log::Decoder::DecoderOptions options;
+		try
+		{
+			options = PonyEngine::Log::Decoder::ParseOptions(args);
+		}
+		catch (const std::invalid_argument& e)
+		{
+			std::cerr << e.what() << ".\n" << PonyEngine::Log::Decoder::Usage;
+			return 1;
+		}
+
+		PonyEngine::Log::Decoder::Decode(options, std::cout);
+
+		return 0;
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << e.what() << ".\n";
+		return 1;
+	}
+	catch (...)
+	{
+		std::cerr << "Unexpected exception.\n";
+		return 1;
+	}
+}
@@ -0,0 +1,173 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+export module PonyEngine.Log.Decoder:Decoder;
+
+import std;
+
+import PonyEngine.Log;
+import PonyEngine.Log.Ext;
+
+import :DecoderOptions;
+import :RecordWriter;
+
+export namespace PonyEngine::Log::Decoder
+{
+	/// @brief Decodes the binary log or the log ring.
+	/// @details Frames and times may slightly decrease between logs because of the asynchronous queue merge and system clock adjustments,
+	///          so the decoder seeks one index entry before the last one preceding the requested range and reads till the end.
+	///          A log ring is decoded from its oldest log; it has no index.
+	/// @param options Decoder options.
+	/// @param output Output stream.
+	/// @return Written log count.
+	/// @throws std::runtime_error If the log can't be read.
+	/// @throws std::invalid_argument If the log is corrupted.
+	std::size_t Decode(const DecoderOptions& options, std::ostream& output);
+}
+
+namespace PonyEngine::Log::Decoder
+{
+	/// @brief Output size after which the output buffer is flushed.
+	constexpr std::size_t OutputFlushSize = 64uz * 1024uz;
+
+	/// @brief Reads the whole file.
+	/// @param path File path.
+	/// @return File data.
+	[[nodiscard("Pure function")]]
+	std::vector<std::byte> ReadFile(const std::filesystem::path& path);
+	/// @brief Finds the index entry to seek to.
+	/// @param index Binary log index.
+	/// @param options Decoder options.
+	/// @return Index entry or nullptr if the reader mustn't seek. It's one entry earlier than the last entry before the range.
+	[[nodiscard("Pure function")]]
+	const BinaryLogIndexEntry* FindSeekEntry(std::span<const BinaryLogIndexEntry> index, const DecoderOptions& options) noexcept;
+	/// @brief Checks if the @p data is a log ring.
+	/// @param data File data.
+	/// @return @a True if it's a log ring; @a false if it must be a binary log.
+	[[nodiscard("Pure function")]]
+	bool IsLogRing(std::span<const std::byte> data) noexcept;
+	/// @brief Writes the record to the @p text if it's in the requested range. The @p text is written to the @p output when it's big enough.
+	/// @param text Output buffer.
+	/// @param record Log record.
+	/// @param options Decoder options.
+	/// @param output Output stream.
+	/// @param count Written log count. It's increased if the record is written.
+	void WriteInRange(std::string& text, const BinaryLogRecord& record, const DecoderOptions& options, std::ostream& output, std::size_t& count);
+
+	std::size_t Decode(const DecoderOptions& options, std::ostream& output)
+	{
+		const std::vector<std::byte> data = ReadFile(options.input);
+
+		std::size_t count = 0uz;
+		auto text = std::string();
+		text.reserve(OutputFlushSize + 1024uz);
+		if (IsLogRing(data))
+		{
+			auto reader = LogRingReader(data);
+			if (reader.LogCount() > reader.SlotCount())
+			{
+				std::cerr << std::format("Log ring keeps the last {} of {} logs.\n", reader.SlotCount(), reader.LogCount());
+			}
+
+			for (auto record = LogRingRecord(); reader.Next(record); )
+			{
+				const auto binaryRecord = BinaryLogRecord
+				{
+					.message = record.message,
+					.timePoint = record.timePoint,
+					.frameCount = record.frameCount,
+					.offset = record.sequence,
+					.logType = record.logType,
+					.hasException = record.hasException
+				};
+				WriteInRange(text, binaryRecord, options, output, count);
+			}
+		}
+		else
+		{
+			auto reader = BinaryLogReader(data);
+			if (!reader.IsFinished())
+			{
+				std::cerr << "Binary log isn't finished. The index is unavailable and the last record may be lost.\n";
+			}
+			if (const BinaryLogIndexEntry* const entry = FindSeekEntry(reader.Index(), options))
+			{
+				reader.Seek(*entry);
+			}
+
+			for (auto record = BinaryLogRecord(); reader.Next(record); )
+			{
+				WriteInRange(text, record, options, output, count);
+			}
+		}
+		output.write(text.data(), static_cast<std::streamsize>(text.size()));
+		output.flush();
+
+		return count;
+	}
+
+	bool IsLogRing(const std::span<const std::byte> data) noexcept
+	{
+		return data.size() >= LogRingMagic.size() && std::ranges::equal(data.first(LogRingMagic.size()), LogRingMagic);
+	}
+
+	void WriteInRange(std::string& text, const BinaryLogRecord& record, const DecoderOptions& options, std::ostream& output, std::size_t& count)
+	{
+		if (record.frameCount < options.minFrameCount || record.frameCount > options.maxFrameCount ||
+			record.timePoint < options.minTimePoint || record.timePoint > options.maxTimePoint || !IsInMask(record.logType, options.logTypes))
+		{
+			return;
+		}
+
+		WriteRecord(text, record, options.format);
+		++count;
+
+		if (text.size() >= OutputFlushSize)
+		{
+			output.write(text.data(), static_cast<std::streamsize>(text.size()));
+			text.clear();
+		}
+	}
+
+	std::vector<std::byte> ReadFile(const std::filesystem::path& path)
+	{
+		auto file = std::ifstream(path, std::ios::binary | std::ios::ate);
+		if (!file.is_open()) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to open log: Path = '{}'", path.string()));
+		}
+
+		auto data = std::vector<std::byte>(static_cast<std::size_t>(file.tellg()));
+		file.seekg(0);
+		if (!file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()))) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to read log: Path = '{}'", path.string()));
+		}
+
+		return data;
+	}
+
+	const BinaryLogIndexEntry* FindSeekEntry(const std::span<const BinaryLogIndexEntry> index, const DecoderOptions& options) noexcept
+	{
+		std::size_t entryCount = 0uz;
+		for (const BinaryLogIndexEntry& entry : index)
+		{
+			if (entry.frameCount > options.minFrameCount || entry.timePoint > options.minTimePoint)
+			{
+				break;
+			}
+
+			++entryCount;
+		}
+
+		// The logs right before an index entry may be later than the entry, so the seek is one entry earlier.
+		return entryCount >= 2uz ? &index[entryCount - 2uz] : nullptr;
+	}
+}
@@ -0,0 +1,201 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+export module PonyEngine.Log.Decoder:DecoderOptions;
+
+import std;
+
+import PonyEngine.Log;
+
+export namespace PonyEngine::Log::Decoder
+{
+	/// @brief Decoder output format.
+	enum class OutputFormat : std::uint8_t
+	{
+		Text, ///< The same text as the text log file.
+		JsonLines ///< One JSON object per log.
+	};
+
+	/// @brief Decoder options.
+	struct DecoderOptions final
+	{
+		std::filesystem::path input; ///< Binary log or log ring path.
+		OutputFormat format = OutputFormat::Text; ///< Output format.
+		LogTypeMask logTypes = LogTypeMask::All; ///< Log types to output.
+		std::uint64_t minFrameCount = 0ull; ///< Min frame to output.
+		std::uint64_t maxFrameCount = std::numeric_limits<std::uint64_t>::max(); ///< Max frame to output.
+		std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> minTimePoint =
+			std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds>::min(); ///< Min time to output.
+		std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> maxTimePoint =
+			std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds>::max(); ///< Max time to output.
+	};
+
+	/// @brief Command line usage.
+	constexpr std::string_view Usage =
+		"Usage: PonyEngine.Log.Decoder <binary log or log ring> [options]\n"
+		"Options:\n"
+		"  --format <text|json>      Output format. JSON is written as one object per line. Default: text.\n"
+		"  --types <type,...>        Log types to output: Verbose, Debug, Info, Warning, Error, Exception. Default: all.\n"
+		"  --min-type <type>         Min log type to output.\n"
+		"  --from-frame <frame>      Min frame to output.\n"
+		"  --to-frame <frame>        Max frame to output.\n"
+		"  --from-time <time>        Min time to output in the UTC format YYYY-MM-DDTHH:MM:SS.\n"
+		"  --to-time <time>          Max time to output in the UTC format YYYY-MM-DDTHH:MM:SS.\n";
+
+	/// @brief Parses the command line arguments.
+	/// @param args Arguments without the executable path.
+	/// @return Decoder options.
+	/// @throws std::invalid_argument If the arguments are incorrect.
+	[[nodiscard("Pure function")]]
+	DecoderOptions ParseOptions(std::span<const std::string_view> args);
+}
+
+namespace PonyEngine::Log::Decoder
+{
+	/// @brief Parses the log type.
+	/// @param name Log type name.
+	/// @return Log type.
+	[[nodiscard("Pure function")]]
+	LogType ParseLogType(std::string_view name);
+	/// @brief Parses the frame.
+	/// @param text Frame text.
+	/// @return Frame.
+	[[nodiscard("Pure function")]]
+	std::uint64_t ParseFrame(std::string_view text);
+	/// @brief Parses the UTC time.
+	/// @param text Time text.
+	/// @return Time point.
+	[[nodiscard("Pure function")]]
+	std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> ParseTime(std::string_view text);
+
+	DecoderOptions ParseOptions(const std::span<const std::string_view> args)
+	{
+		auto options = DecoderOptions();
+		bool hasInput = false;
+		for (std::size_t i = 0uz; i < args.size(); ++i)
+		{
+			const std::string_view arg = args[i];
+			if (!arg.starts_with("--"))
+			{
+				if (hasInput) [[unlikely]]
+				{
+					throw std::invalid_argument(std::format("Unexpected argument: '{}'", arg));
+				}
+
+				options.input = std::filesystem::path(arg);
+				hasInput = true;
+				continue;
+			}
+
+			if (i + 1uz >= args.size()) [[unlikely]]
+			{
+				throw std::invalid_argument(std::format("Option value is missing: '{}'", arg));
+			}
+			const std::string_view value = args[++i];
+
+			if (arg == "--format")
+			{
+				if (value == "text")
+				{
+					options.format = OutputFormat::Text;
+				}
+				else if (value == "json")
+				{
+					options.format = OutputFormat::JsonLines;
+				}
+				else [[unlikely]]
+				{
+					throw std::invalid_argument(std::format("Unknown format: '{}'", value));
+				}
+			}
+			else if (arg == "--types")
+			{
+				options.logTypes = LogTypeMask::None;
+				for (const auto name : value | std::views::split(','))
+				{
+					options.logTypes |= ToMask(ParseLogType(std::string_view(name)));
+				}
+			}
+			else if (arg == "--min-type")
+			{
+				const LogType minLogType = ParseLogType(value);
+				options.logTypes = LogTypeMask::None;
+				for (auto logType = std::to_underlying(minLogType); logType <= std::to_underlying(LogType::Exception); ++logType)
+				{
+					options.logTypes |= ToMask(static_cast<LogType>(logType));
+				}
+			}
+			else if (arg == "--from-frame")
+			{
+				options.minFrameCount = ParseFrame(value);
+			}
+			else if (arg == "--to-frame")
+			{
+				options.maxFrameCount = ParseFrame(value);
+			}
+			else if (arg == "--from-time")
+			{
+				options.minTimePoint = ParseTime(value);
+			}
+			else if (arg == "--to-time")
+			{
+				options.maxTimePoint = ParseTime(value);
+			}
+			else [[unlikely]]
+			{
+				throw std::invalid_argument(std::format("Unknown option: '{}'", arg));
+			}
+		}
+
+		if (!hasInput) [[unlikely]]
+		{
+			throw std::invalid_argument("Log path is missing");
+		}
+
+		return options;
+	}
+
+	LogType ParseLogType(const std::string_view name)
+	{
+		for (auto logType = std::to_underlying(LogType::Verbose); logType <= std::to_underlying(LogType::Exception); ++logType)
+		{
+			if (std::format("{}", static_cast<LogType>(logType)) == name)
+			{
+				return static_cast<LogType>(logType);
+			}
+		}
+
+		throw std::invalid_argument(std::format("Unknown log type: '{}'", name));
+	}
+
+	std::uint64_t ParseFrame(const std::string_view text)
+	{
+		std::uint64_t frame;
+		if (const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), frame); text.empty() || error != std::errc() || end != text.data() + text.size()) [[unlikely]]
+		{
+			throw std::invalid_argument(std::format("Incorrect frame: '{}'", text));
+		}
+
+		return frame;
+	}
+
+	std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> ParseTime(const std::string_view text)
+	{
+		auto stream = std::istringstream(std::string(text));
+		std::chrono::sys_seconds time;
+		stream >> std::chrono::parse("%Y-%m-%dT%H:%M:%S", time);
+		if (stream.fail() || stream.peek() != std::char_traits<char>::eof()) [[unlikely]]
+		{
+			throw std::invalid_argument(std::format("Incorrect time: '{}'", text));
+		}
+
+		return std::chrono::time_point_cast<std::chrono::nanoseconds>(time);
+	}
+}
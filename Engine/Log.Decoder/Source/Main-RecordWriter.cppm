@@ -0,0 +1,81 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+export module PonyEngine.Log.Decoder:RecordWriter;
+
+import std;
+
+import PonyEngine.Log;
+import PonyEngine.Log.Ext;
+
+import :DecoderOptions;
+
+export namespace PonyEngine::Log::Decoder
+{
+	/// @brief Writes the log record as a text line.
+	/// @param target Target string. The line is appended to it.
+	/// @param record Log record.
+	void WriteText(std::string& target, const BinaryLogRecord& record);
+	/// @brief Writes the log record as a JSON object line.
+	/// @param target Target string. The line is appended to it.
+	/// @param record Log record.
+	void WriteJson(std::string& target, const BinaryLogRecord& record);
+	/// @brief Writes the log record in the @p format.
+	/// @param target Target string. The line is appended to it.
+	/// @param record Log record.
+	/// @param format Output format.
+	void WriteRecord(std::string& target, const BinaryLogRecord& record, OutputFormat format);
+}
+
+namespace PonyEngine::Log::Decoder
+{
+	void WriteText(std::string& target, const BinaryLogRecord& record)
+	{
+		std::format_to(std::back_inserter(target), "{}: [{:%F %R:%OS UTC} ({})] {}\n", record.logType, record.timePoint, record.frameCount, record.message);
+		if (!record.stacktrace.empty())
+		{
+			target.append_range(record.stacktrace);
+			if (!record.stacktrace.ends_with('\n'))
+			{
+				target.push_back('\n');
+			}
+		}
+	}
+
+	void WriteJson(std::string& target, const BinaryLogRecord& record)
+	{
+		// The same writer as the JSON lines sub-logger uses, so the decoded logs have the same schema.
+		auto writer = JsonLogWriter(target);
+		writer.Write(JsonLogRecord
+		{
+			.message = record.message,
+			.stacktrace = record.stacktrace,
+			.timePoint = record.timePoint,
+			.frameCount = record.frameCount,
+			.logType = record.logType,
+			.hasException = record.hasException
+		});
+	}
+
+	void WriteRecord(std::string& target, const BinaryLogRecord& record, const OutputFormat format)
+	{
+		switch (format)
+		{
+		case OutputFormat::Text:
+			WriteText(target, record);
+			break;
+		case OutputFormat::JsonLines:
+			WriteJson(target, record);
+			break;
+		default: [[unlikely]]
+			throw std::invalid_argument("Unknown format");
+		}
+	}
+}
@@ -0,0 +1,15 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+export module PonyEngine.Log.Decoder;
+
+export import :Decoder;
+export import :DecoderOptions;
+export import :RecordWriter;
@@ -0,0 +1,723 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+export module PonyEngine.Log.Ext:BinaryLog;
+
+import std;
+
+import PonyEngine.Log;
+import PonyEngine.Memory;
+import PonyEngine.Serialization;
+import PonyEngine.Type;
+
+import :LogEntry;
+import :SymbolCache;
+
+export namespace PonyEngine::Log
+{
+	constexpr std::array<std::byte, 4> BinaryLogMagic = { std::byte{'P'}, std::byte{'N'}, std::byte{'L'}, std::byte{'B'} }; ///< Binary log magic.
+	constexpr std::uint8_t BinaryLogFormat = 1u; ///< Binary log format version.
+	constexpr std::size_t BinaryLogHeaderSize = 8uz; ///< Binary log header size: magic, format version and reserved bytes.
+	constexpr std::size_t BinaryLogFooterSize = 12uz; ///< Binary log footer size: index record offset and index magic.
+
+	/// @brief Binary log record type.
+	enum class BinaryLogRecordType : std::uint8_t
+	{
+		String, ///< Interned string definition.
+		Log, ///< Log entry.
+		Index ///< Sparse index. It's the last record of a finished log.
+	};
+
+	/// @brief Sparse index entry. It points to a log record that doesn't depend on the previous log records.
+	struct BinaryLogIndexEntry final
+	{
+		std::uint64_t offset = 0ull; ///< Log record offset in the binary log.
+		std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> timePoint; ///< Log time.
+		std::uint64_t frameCount = 0ull; ///< Log frame.
+	};
+
+	/// @brief Binary log writer parameters.
+	struct BinaryLogWriterParams final
+	{
+		std::size_t indexInterval = 1024uz; ///< Count of log records between index entries.
+		std::size_t maxInternedStringCount = 4096uz; ///< Max count of interned strings.
+		std::size_t maxInternedStringLength = 256uz; ///< Max length of an interned string. Longer strings are always written inline.
+		std::size_t seenStringCount = 4096uz; ///< Count of remembered string hashes. A string is interned only if its hash is remembered. Must be a power of two.
+	};
+
+	/// @brief Binary log writer.
+	/// @details The binary log is a header and a sequence of records. Every record is a varint payload size and a payload that starts with a record type.
+	///          A log record keeps the log type, the time and frame as ZigZag varint deltas from the previous log record, a message and an optional stacktrace.
+	///          Strings up to the max interned length are written inline on the first use and get an id on the second use:
+	///          they are defined once in a string record and referenced by the id after that. So one-off messages don't fill the interned string table.
+	///          Every @p BinaryLogWriterParams::indexInterval log records, the time and frame are written as absolute values and the record is added to the sparse index.
+	///          The index is written on finishing with a footer that points to it. A log that isn't finished is still readable, but without the index.
+	class BinaryLogWriter final
+	{
+	public:
+		/// @brief Creates a writer and writes a binary log header.
+		/// @param output Output. The records are appended to it. It may be cleared between writes if its content is stored.
+		/// @param params Parameters.
+		[[nodiscard("Pure constructor")]]
+		explicit BinaryLogWriter(std::vector<std::byte>& output, const BinaryLogWriterParams& params = BinaryLogWriterParams());
+		BinaryLogWriter(const BinaryLogWriter& other) = delete;
+		BinaryLogWriter(BinaryLogWriter&& other) = delete;
+
+		~BinaryLogWriter() noexcept = default;
+
+		/// @brief Gets the written binary log size including the data that was cleared from the output.
+		/// @return Binary log size.
+		[[nodiscard("Pure function")]]
+		std::uint64_t Size() const noexcept;
+		/// @brief Gets the written log count.
+		/// @return Log count.
+		[[nodiscard("Pure function")]]
+		std::uint64_t LogCount() const noexcept;
+		/// @brief Gets the sparse index.
+		/// @return Sparse index.
+		[[nodiscard("Pure function")]]
+		std::span<const BinaryLogIndexEntry> Index() const noexcept;
+
+		/// @brief Writes the @p logEntry.
+		/// @param logEntry Log entry.
+		void Write(const LogEntry& logEntry);
+		/// @brief Writes the index and the footer.
+		/// @note Nothing may be written after it.
+		void Finish();
+
+		BinaryLogWriter& operator =(const BinaryLogWriter& other) = delete;
+		BinaryLogWriter& operator =(BinaryLogWriter&& other) = delete;
+
+	private:
+		/// @brief Transparent string hash.
+		struct StringHash final
+		{
+			using is_transparent = void;
+
+			/// @brief Hashes the @p string.
+			/// @param string String.
+			/// @return Hash.
+			[[nodiscard("Pure function")]]
+			std::size_t operator ()(std::string_view string) const noexcept;
+		};
+
+		/// @brief Gets a string reference. If the string is seen the second time and may be interned, a string record is written.
+		/// @param string String.
+		/// @return String id or 0 if the string must be written inline.
+		std::uint64_t Intern(std::string_view string);
+		/// @brief Gets a size of the string reference.
+		/// @param id String id.
+		/// @param string String.
+		/// @return Reference size.
+		[[nodiscard("Pure function")]]
+		static std::size_t StringReferenceSize(std::uint64_t id, std::string_view string) noexcept;
+		/// @brief Appends the string reference.
+		/// @param id String id.
+		/// @param string String.
+		void AppendStringReference(std::uint64_t id, std::string_view string);
+		/// @brief Appends the @p value as a varint.
+		/// @tparam T Value type.
+		/// @param value Value.
+		template<Type::Integer T>
+		void AppendVarint(T value);
+		/// @brief Appends the @p data.
+		/// @param data Data.
+		void Append(std::span<const std::byte> data);
+
+		std::vector<std::byte>* output; ///< Output.
+		BinaryLogWriterParams params; ///< Parameters.
+		Memory::FlatHashMap<std::string, std::uint64_t, StringHash, std::equal_to<>> strings; ///< Interned strings.
+		std::vector<std::size_t> seenStrings; ///< Hashes of the strings seen once. It's direct mapped by the hash.
+		std::vector<BinaryLogIndexEntry> index; ///< Sparse index.
+		std::string stacktraceText; ///< Stacktrace text buffer.
+		std::uint64_t size; ///< Written size.
+		std::uint64_t logCount; ///< Written log count.
+		std::int64_t previousTime; ///< Previous log time in nanoseconds.
+		std::uint64_t previousFrameCount; ///< Previous log frame.
+		bool finished; ///< Is the log finished?
+	};
+
+	/// @brief Decoded binary log record.
+	struct BinaryLogRecord final
+	{
+		std::string_view message; ///< Log message.
+		std::string_view stacktrace; ///< Stacktrace text. It's empty if the log has no stacktrace.
+		std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> timePoint; ///< Log time.
+		std::uint64_t frameCount = 0ull; ///< Log frame.
+		std::uint64_t offset = 0ull; ///< Record offset in the binary log.
+		LogType logType = LogType::Verbose; ///< Log type.
+		bool hasException = false; ///< Was an exception attached to the log?
+	};
+
+	/// @brief Binary log reader.
+	/// @details The returned strings reference the binary log data, so it must outlive them. A truncated last record is ignored.
+	class BinaryLogReader final
+	{
+	public:
+		/// @brief Creates a reader.
+		/// @param data Binary log data.
+		/// @throws std::invalid_argument If the @p data isn't a binary log or its index is corrupted.
+		[[nodiscard("Pure constructor")]]
+		explicit BinaryLogReader(std::span<const std::byte> data);
+		BinaryLogReader(const BinaryLogReader& other) = delete;
+		BinaryLogReader(BinaryLogReader&& other) = delete;
+
+		~BinaryLogReader() noexcept = default;
+
+		/// @brief Checks if the binary log was finished.
+		/// @return @a True if it's finished; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool IsFinished() const noexcept;
+		/// @brief Gets the sparse index.
+		/// @return Sparse index. It's empty if the binary log isn't finished.
+		[[nodiscard("Pure function")]]
+		std::span<const BinaryLogIndexEntry> Index() const noexcept;
+
+		/// @brief Moves the reader to the index entry.
+		/// @details The string records before it are read but the log records are skipped without decoding.
+		/// @param entry Index entry.
+		/// @throws std::invalid_argument If the data is corrupted.
+		void Seek(const BinaryLogIndexEntry& entry);
+		/// @brief Reads the next log record.
+		/// @param record Log record.
+		/// @return @a True if the record is read; @a false if there are no more records.
+		/// @throws std::invalid_argument If the data is corrupted.
+		bool Next(BinaryLogRecord& record);
+
+		BinaryLogReader& operator =(const BinaryLogReader& other) = delete;
+		BinaryLogReader& operator =(BinaryLogReader&& other) = delete;
+
+	private:
+		/// @brief Reads the record at the position.
+		/// @param recordOffset Record offset.
+		/// @return Record payload and the next record offset or an empty payload if there's no complete record.
+		[[nodiscard("Pure function")]]
+		std::pair<std::span<const std::byte>, std::size_t> ReadRecord(std::size_t recordOffset) const;
+		/// @brief Reads a string record.
+		/// @param payload Record payload.
+		/// @param recordOffset Record offset.
+		void ReadString(std::span<const std::byte> payload, std::size_t recordOffset);
+		/// @brief Reads a string reference.
+		/// @param data Data.
+		/// @param end Data end.
+		/// @return String.
+		std::string_view ReadStringReference(const std::byte*& data, const std::byte* end) const;
+		/// @brief Reads the index.
+		void ReadIndex();
+
+		std::span<const std::byte> data; ///< Binary log data.
+		std::vector<std::string_view> strings; ///< Interned strings by id - 1.
+		std::vector<BinaryLogIndexEntry> index; ///< Sparse index.
+		std::size_t end; ///< End of the log records.
+		std::size_t position; ///< Next record offset.
+		std::size_t stringPosition; ///< Offset till which the string records are read.
+		std::int64_t previousTime; ///< Previous log time in nanoseconds.
+		std::uint64_t previousFrameCount; ///< Previous log frame.
+	};
+}
+
+namespace PonyEngine::Log
+{
+	constexpr std::array<std::byte, 4> BinaryLogIndexMagic = { std::byte{'P'}, std::byte{'N'}, std::byte{'L'}, std::byte{'I'} }; ///< Binary log index magic.
+
+	constexpr std::uint8_t LogTypeBits = 0x07u; ///< Log type bits of log record flags.
+	constexpr std::uint8_t AbsoluteFlag = 0x08u; ///< The time and frame are absolute.
+	constexpr std::uint8_t ExceptionFlag = 0x10u; ///< An exception was attached.
+	constexpr std::uint8_t StacktraceFlag = 0x20u; ///< A stacktrace follows the message.
+
+	/// @brief Gets a varint size of the @p value.
+	/// @tparam T Value type.
+	/// @param value Value.
+	/// @return Varint size.
+	template<Type::Integer T> [[nodiscard("Pure function")]]
+	constexpr std::size_t VarintSize(T value) noexcept;
+	/// @brief Reads a varint.
+	/// @tparam T Value type.
+	/// @param data Data. It's moved after the varint.
+	/// @param end Data end.
+	/// @return Value.
+	template<Type::Integer T>
+	T ReadVarint(const std::byte*& data, const std::byte* end);
+
+	/// @brief Converts the time point to nanoseconds since the epoch.
+	/// @param timePoint Time point.
+	/// @return Nanoseconds.
+	[[nodiscard("Pure function")]]
+	std::int64_t ToNanoseconds(std::chrono::time_point<std::chrono::system_clock> timePoint) noexcept;
+	/// @brief Converts the nanoseconds since the epoch to the time point.
+	/// @param time Nanoseconds.
+	/// @return Time point.
+	[[nodiscard("Pure function")]]
+	std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> ToTimePoint(std::int64_t time) noexcept;
+
+	BinaryLogWriter::BinaryLogWriter(std::vector<std::byte>& output, const BinaryLogWriterParams& params) :
+		output{&output},
+		params(params),
+		seenStrings(params.seenStringCount, 0uz),
+		size{0ull},
+		logCount{0ull},
+		previousTime{0ll},
+		previousFrameCount{0ull},
+		finished{false}
+	{
+#ifndef NDEBUG
+		if (params.indexInterval == 0uz) [[unlikely]]
+		{
+			throw std::invalid_argument("Index interval is zero");
+		}
+		if (!std::has_single_bit(params.seenStringCount)) [[unlikely]]
+		{
+			throw std::invalid_argument("Seen string count isn't a power of two");
+		}
+#endif
+
+		auto header = std::array<std::byte, BinaryLogHeaderSize>();
+		std::ranges::copy(BinaryLogMagic, header.begin());
+		header[BinaryLogMagic.size()] = static_cast<std::byte>(BinaryLogFormat);
+		Append(header);
+	}
+
+	std::uint64_t BinaryLogWriter::Size() const noexcept
+	{
+		return size;
+	}
+
+	std::uint64_t BinaryLogWriter::LogCount() const noexcept
+	{
+		return logCount;
+	}
+
+	std::span<const BinaryLogIndexEntry> BinaryLogWriter::Index() const noexcept
+	{
+		return index;
+	}
+
+	void BinaryLogWriter::Write(const LogEntry& logEntry)
+	{
+#ifndef NDEBUG
+		if (finished) [[unlikely]]
+		{
+			throw std::logic_error("Binary log is finished");
+		}
+#endif
+
+		const std::uint64_t messageId = Intern(logEntry.message);
+		std::uint64_t stacktraceId = 0ull;
+		if (logEntry.stacktrace)
+		{
+			stacktraceText.clear();
+			SymbolCache::Shared().Append(stacktraceText, *logEntry.stacktrace);
+			stacktraceId = Intern(stacktraceText);
+		}
+
+		const std::int64_t time = ToNanoseconds(logEntry.timePoint);
+		const bool isAbsolute = logCount % params.indexInterval == 0ull;
+		const std::int64_t timeCode = isAbsolute ? time : static_cast<std::int64_t>(static_cast<std::uint64_t>(time) - static_cast<std::uint64_t>(previousTime));
+		const std::int64_t frameCode = isAbsolute ? static_cast<std::int64_t>(logEntry.frameCount) : static_cast<std::int64_t>(logEntry.frameCount - previousFrameCount);
+		const auto flags = static_cast<std::uint8_t>(static_cast<std::uint8_t>(logEntry.logType) | (isAbsolute ? AbsoluteFlag : 0u) | (logEntry.exception ? ExceptionFlag : 0u) |
+			(logEntry.stacktrace ? StacktraceFlag : 0u));
+
+		std::size_t payloadSize = 2uz + VarintSize(timeCode) + VarintSize(frameCode) + StringReferenceSize(messageId, logEntry.message);
+		if (logEntry.stacktrace)
+		{
+			payloadSize += StringReferenceSize(stacktraceId, stacktraceText);
+		}
+
+		if (isAbsolute)
+		{
+			index.push_back(BinaryLogIndexEntry{.offset = size, .timePoint = ToTimePoint(time), .frameCount = logEntry.frameCount});
+		}
+		AppendVarint(payloadSize);
+		const auto head = std::array{static_cast<std::byte>(BinaryLogRecordType::Log), static_cast<std::byte>(flags)};
+		Append(head);
+		AppendVarint(timeCode);
+		AppendVarint(frameCode);
+		AppendStringReference(messageId, logEntry.message);
+		if (logEntry.stacktrace)
+		{
+			AppendStringReference(stacktraceId, stacktraceText);
+		}
+
+		previousTime = time;
+		previousFrameCount = logEntry.frameCount;
+		++logCount;
+	}
+
+	void BinaryLogWriter::Finish()
+	{
+#ifndef NDEBUG
+		if (finished) [[unlikely]]
+		{
+			throw std::logic_error("Binary log is already finished");
+		}
+#endif
+
+		const std::uint64_t indexOffset = size;
+		std::size_t payloadSize = 1uz + VarintSize(index.size());
+		std::uint64_t previousOffset = 0ull;
+		std::int64_t previousIndexTime = 0ll;
+		std::uint64_t previousIndexFrameCount = 0ull;
+		for (const BinaryLogIndexEntry& entry : index)
+		{
+			const std::int64_t time = entry.timePoint.time_since_epoch().count();
+			payloadSize += VarintSize(entry.offset - previousOffset) + VarintSize(time - previousIndexTime) + VarintSize(entry.frameCount - previousIndexFrameCount);
+			previousOffset = entry.offset;
+			previousIndexTime = time;
+			previousIndexFrameCount = entry.frameCount;
+		}
+
+		AppendVarint(payloadSize);
+		const auto type = std::array{static_cast<std::byte>(BinaryLogRecordType::Index)};
+		Append(type);
+		AppendVarint(index.size());
+		previousOffset = 0ull;
+		previousIndexTime = 0ll;
+		previousIndexFrameCount = 0ull;
+		for (const BinaryLogIndexEntry& entry : index)
+		{
+			const std::int64_t time = entry.timePoint.time_since_epoch().count();
+			AppendVarint(entry.offset - previousOffset);
+			AppendVarint(time - previousIndexTime);
+			AppendVarint(entry.frameCount - previousIndexFrameCount);
+			previousOffset = entry.offset;
+			previousIndexTime = time;
+			previousIndexFrameCount = entry.frameCount;
+		}
+
+		auto footer = std::array<std::byte, BinaryLogFooterSize>();
+		Serialization::SerializeArrayBinary(std::span<const std::uint64_t, 1>(&indexOffset, 1uz), std::span<std::byte, sizeof(std::uint64_t)>(footer.data(), sizeof(std::uint64_t)));
+		std::ranges::copy(BinaryLogIndexMagic, footer.begin() + sizeof(std::uint64_t));
+		Append(footer);
+
+		finished = true;
+	}
+
+	std::size_t BinaryLogWriter::StringHash::operator ()(const std::string_view string) const noexcept
+	{
+		return std::hash<std::string_view>()(string);
+	}
+
+	std::uint64_t BinaryLogWriter::Intern(const std::string_view string)
+	{
+		if (string.size() > params.maxInternedStringLength)
+		{
+			return 0ull;
+		}
+		if (const std::uint64_t* const id = strings.Find(string))
+		{
+			return *id;
+		}
+		if (strings.Size() >= params.maxInternedStringCount)
+		{
+			return 0ull;
+		}
+
+		const std::size_t hash = StringHash()(string);
+		std::size_t& seenHash = seenStrings[hash & (seenStrings.size() - 1uz)];
+		if (const std::size_t marker = hash | 1uz; seenHash != marker)
+		{
+			seenHash = marker;
+			return 0ull;
+		}
+
+		const std::uint64_t id = strings.Size() + 1uz;
+		AppendVarint(1uz + VarintSize(id) + string.size());
+		const auto type = std::array{static_cast<std::byte>(BinaryLogRecordType::String)};
+		Append(type);
+		AppendVarint(id);
+		Append(std::as_bytes(std::span(string)));
+		strings.Emplace(std::string(string), id);
+
+		return id;
+	}
+
+	std::size_t BinaryLogWriter::StringReferenceSize(const std::uint64_t id, const std::string_view string) noexcept
+	{
+		return id > 0ull ? VarintSize(id) : 1uz + VarintSize(string.size()) + string.size();
+	}
+
+	void BinaryLogWriter::AppendStringReference(const std::uint64_t id, const std::string_view string)
+	{
+		AppendVarint(id);
+		if (id == 0ull)
+		{
+			AppendVarint(string.size());
+			Append(std::as_bytes(std::span(string)));
+		}
+	}
+
+	template<Type::Integer T>
+	void BinaryLogWriter::AppendVarint(const T value)
+	{
+		auto varint = std::array<std::byte, Serialization::MaxVarintSize<T>>();
+		const std::byte* const varintEnd = Serialization::SerializeArrayVarint(std::span<const T>(&value, 1uz), std::span<std::byte>(varint));
+		Append(std::span<const std::byte>(varint.data(), varintEnd));
+	}
+
+	void BinaryLogWriter::Append(const std::span<const std::byte> data)
+	{
+		output->append_range(data);
+		size += data.size();
+	}
+
+	BinaryLogReader::BinaryLogReader(const std::span<const std::byte> data) :
+		data(data),
+		end{data.size()},
+		position{BinaryLogHeaderSize},
+		stringPosition{BinaryLogHeaderSize},
+		previousTime{0ll},
+		previousFrameCount{0ull}
+	{
+		if (data.size() < BinaryLogHeaderSize || !std::ranges::equal(data.first(BinaryLogMagic.size()), BinaryLogMagic)) [[unlikely]]
+		{
+			throw std::invalid_argument("Data isn't a binary log");
+		}
+		if (const auto format = static_cast<std::uint8_t>(data[BinaryLogMagic.size()]); format != BinaryLogFormat) [[unlikely]]
+		{
+			throw std::invalid_argument(std::format("Unsupported binary log format: Format = '{}'", format));
+		}
+
+		ReadIndex();
+	}
+
+	bool BinaryLogReader::IsFinished() const noexcept
+	{
+		return end != data.size();
+	}
+
+	std::span<const BinaryLogIndexEntry> BinaryLogReader::Index() const noexcept
+	{
+		return index;
+	}
+
+	void BinaryLogReader::Seek(const BinaryLogIndexEntry& entry)
+	{
+		if (entry.offset < BinaryLogHeaderSize || entry.offset > end) [[unlikely]]
+		{
+			throw std::invalid_argument("Index entry is out of the binary log");
+		}
+
+		while (stringPosition < entry.offset)
+		{
+			const auto [payload, nextOffset] = ReadRecord(stringPosition);
+			if (payload.empty()) [[unlikely]]
+			{
+				throw std::invalid_argument("Index entry doesn't point to a record");
+			}
+			if (static_cast<BinaryLogRecordType>(payload[0]) == BinaryLogRecordType::String)
+			{
+				ReadString(payload, stringPosition);
+			}
+			stringPosition = nextOffset;
+		}
+
+		position = static_cast<std::size_t>(entry.offset);
+		previousTime = entry.timePoint.time_since_epoch().count();
+		previousFrameCount = entry.frameCount;
+	}
+
+	bool BinaryLogReader::Next(BinaryLogRecord& record)
+	{
+		while (true)
+		{
+			const std::size_t recordOffset = position;
+			const auto [payload, nextOffset] = ReadRecord(recordOffset);
+			if (payload.empty())
+			{
+				return false;
+			}
+			position = nextOffset;
+
+			switch (static_cast<BinaryLogRecordType>(payload[0]))
+			{
+			case BinaryLogRecordType::String:
+				ReadString(payload, recordOffset);
+				break;
+			case BinaryLogRecordType::Log:
+			{
+				if (payload.size() < 2uz) [[unlikely]]
+				{
+					throw std::invalid_argument("Log record is corrupted");
+				}
+
+				const auto flags = static_cast<std::uint8_t>(payload[1]);
+				if ((flags & LogTypeBits) > static_cast<std::uint8_t>(LogType::Exception)) [[unlikely]]
+				{
+					throw std::invalid_argument("Log record has an invalid log type");
+				}
+
+				const std::byte* dataPoint = payload.data() + 2;
+				const std::byte* const payloadEnd = payload.data() + payload.size();
+				const auto timeCode = ReadVarint<std::int64_t>(dataPoint, payloadEnd);
+				const auto frameCode = ReadVarint<std::int64_t>(dataPoint, payloadEnd);
+				if (flags & AbsoluteFlag)
+				{
+					previousTime = timeCode;
+					previousFrameCount = static_cast<std::uint64_t>(frameCode);
+				}
+				else
+				{
+					previousTime = static_cast<std::int64_t>(static_cast<std::uint64_t>(previousTime) + static_cast<std::uint64_t>(timeCode));
+					previousFrameCount += static_cast<std::uint64_t>(frameCode);
+				}
+
+				record.message = ReadStringReference(dataPoint, payloadEnd);
+				record.stacktrace = flags & StacktraceFlag ? ReadStringReference(dataPoint, payloadEnd) : std::string_view();
+				record.timePoint = ToTimePoint(previousTime);
+				record.frameCount = previousFrameCount;
+				record.offset = recordOffset;
+				record.logType = static_cast<LogType>(flags & LogTypeBits);
+				record.hasException = flags & ExceptionFlag;
+				stringPosition = std::max(stringPosition, position);
+
+				return true;
+			}
+			default:
+				throw std::invalid_argument(std::format("Unknown binary log record type: Type = '{}'", static_cast<std::uint8_t>(payload[0])));
+			}
+			stringPosition = std::max(stringPosition, position);
+		}
+	}
+
+	std::pair<std::span<const std::byte>, std::size_t> BinaryLogReader::ReadRecord(const std::size_t recordOffset) const
+	{
+		if (recordOffset >= end)
+		{
+			return std::pair(std::span<const std::byte>(), recordOffset);
+		}
+
+		const std::byte* dataPoint = data.data() + recordOffset;
+		const std::byte* const dataEnd = data.data() + end;
+		std::size_t payloadSize;
+		try
+		{
+			payloadSize = ReadVarint<std::size_t>(dataPoint, dataEnd);
+		}
+		catch (const std::invalid_argument&)
+		{
+			return std::pair(std::span<const std::byte>(), recordOffset);
+		}
+		if (payloadSize == 0uz || payloadSize > static_cast<std::size_t>(dataEnd - dataPoint))
+		{
+			return std::pair(std::span<const std::byte>(), recordOffset);
+		}
+
+		return std::pair(std::span<const std::byte>(dataPoint, payloadSize), static_cast<std::size_t>(dataPoint - data.data()) + payloadSize);
+	}
+
+	void BinaryLogReader::ReadString(const std::span<const std::byte> payload, const std::size_t recordOffset)
+	{
+		if (recordOffset < stringPosition)
+		{
+			return;
+		}
+
+		const std::byte* dataPoint = payload.data() + 1;
+		const std::byte* const payloadEnd = payload.data() + payload.size();
+		const auto id = ReadVarint<std::uint64_t>(dataPoint, payloadEnd);
+		if (id != strings.size() + 1uz) [[unlikely]]
+		{
+			throw std::invalid_argument(std::format("Unexpected string id: Id = '{}', Expected = '{}'", id, strings.size() + 1uz));
+		}
+		strings.push_back(std::string_view(reinterpret_cast<const char*>(dataPoint), static_cast<std::size_t>(payloadEnd - dataPoint)));
+	}
+
+	std::string_view BinaryLogReader::ReadStringReference(const std::byte*& data, const std::byte* const end) const
+	{
+		const auto id = ReadVarint<std::uint64_t>(data, end);
+		if (id > 0ull)
+		{
+			if (id > strings.size()) [[unlikely]]
+			{
+				throw std::invalid_argument(std::format("Unknown string id: Id = '{}'", id));
+			}
+
+			return strings[id - 1uz];
+		}
+
+		const auto length = ReadVarint<std::size_t>(data, end);
+		if (length > static_cast<std::size_t>(end - data)) [[unlikely]]
+		{
+			throw std::invalid_argument("String is out of the record");
+		}
+		const auto string = std::string_view(reinterpret_cast<const char*>(data), length);
+		data += length;
+
+		return string;
+	}
+
+	void BinaryLogReader::ReadIndex()
+	{
+		if (data.size() < BinaryLogHeaderSize + BinaryLogFooterSize || !std::ranges::equal(data.last(BinaryLogIndexMagic.size()), BinaryLogIndexMagic))
+		{
+			return;
+		}
+
+		std::uint64_t indexOffset;
+		Serialization::DeserializeArrayBinary(data.subspan(data.size() - BinaryLogFooterSize).first<sizeof(std::uint64_t)>(), std::span<std::uint64_t, 1>(&indexOffset, 1uz));
+		if (indexOffset < BinaryLogHeaderSize || indexOffset >= data.size() - BinaryLogFooterSize) [[unlikely]]
+		{
+			throw std::invalid_argument("Binary log index offset is corrupted");
+		}
+
+		end = static_cast<std::size_t>(indexOffset);
+		const std::byte* dataPoint = data.data() + end;
+		const std::byte* const dataEnd = data.data() + data.size() - BinaryLogFooterSize;
+		const auto payloadSize = ReadVarint<std::size_t>(dataPoint, dataEnd);
+		if (payloadSize == 0uz || payloadSize > static_cast<std::size_t>(dataEnd - dataPoint) || static_cast<BinaryLogRecordType>(*dataPoint) != BinaryLogRecordType::Index) [[unlikely]]
+		{
+			throw std::invalid_argument("Binary log index is corrupted");
+		}
+
+		const std::byte* const payloadEnd = dataPoint + payloadSize;
+		++dataPoint;
+		const auto count = ReadVarint<std::size_t>(dataPoint, payloadEnd);
+		if (count > static_cast<std::size_t>(payloadEnd - dataPoint)) [[unlikely]]
+		{
+			throw std::invalid_argument("Binary log index is corrupted");
+		}
+		index.reserve(count);
+		std::uint64_t offset = 0ull;
+		std::int64_t time = 0ll;
+		std::uint64_t frameCount = 0ull;
+		for (std::size_t i = 0uz; i < count; ++i)
+		{
+			offset += ReadVarint<std::uint64_t>(dataPoint, payloadEnd);
+			time += ReadVarint<std::int64_t>(dataPoint, payloadEnd);
+			frameCount += ReadVarint<std::uint64_t>(dataPoint, payloadEnd);
+			index.push_back(BinaryLogIndexEntry{.offset = offset, .timePoint = ToTimePoint(time), .frameCount = frameCount});
+		}
+	}
+
+	template<Type::Integer T>
+	constexpr std::size_t VarintSize(const T value) noexcept
+	{
+		return Serialization::GetSerializedArrayVarintSize(std::span<const T>(&value, 1uz));
+	}
+
+	template<Type::Integer T>
+	T ReadVarint(const std::byte*& data, const std::byte* const end)
+	{
+		T value;
+		data = Serialization::DeserializeArrayVarint(std::span<const std::byte>(data, end), std::span<T>(&value, 1uz));
+
+		return value;
+	}
+
+	std::int64_t ToNanoseconds(const std::chrono::time_point<std::chrono::system_clock> timePoint) noexcept
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(timePoint.time_since_epoch()).count();
+	}
+
+	std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> ToTimePoint(const std::int64_t time) noexcept
+	{
+		return std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds>(std::chrono::nanoseconds(time));
+	}
+}
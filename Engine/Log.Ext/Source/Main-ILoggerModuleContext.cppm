@@ -15,8 +15,11 @@ export module PonyEngine.Log.Ext:ILoggerModuleContext;
 
 import std;
 
+import PonyEngine.Type;
+
 import :ILoggerContext;
 import :ISubLogger;
+import :LogStatistics;
 import :SubLoggerHandle;
 
 export namespace PonyEngine::Log
@@ -31,10 +34,19 @@ export namespace PonyEngine::Log
 		/// @return Sub-logger handle. Must be used to remove a sub-logger before a destruction of the logger.
 		/// @note The function must be called on a main thread.
 		[[nodiscard("Must be used to remove")]]
-		virtual SubLoggerHandle AddSubLogger(const std::function<std::shared_ptr<ISubLogger>(ILoggerContext&)>& factory) = 0;
+		virtual SubLoggerHandle AddSubLogger(Type::FunctionRef<std::shared_ptr<ISubLogger>(ILoggerContext&)> factory) = 0;
 		/// @brief Removes a sub-logger.
 		/// @param handle Sub-logger handle.
 		/// @note The function must be called on a main thread.
 		virtual void RemoveSubLogger(SubLoggerHandle handle) = 0;
+
+		/// @brief Gets the logger statistics.
+		/// @return Logger statistics.
+		/// @note The function is thread-safe.
+		[[nodiscard("Pure function")]]
+		virtual LogStatistics Statistics() const noexcept = 0;
+		/// @brief Waits till all the logs made before the call are passed to the sub-loggers.
+		/// @note The function is thread-safe. It does nothing if the logger is synchronous or if it's called on the log thread.
+		virtual void Flush() const noexcept = 0;
 	};
 }
@@ -0,0 +1,315 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+module;
+
+#include <cassert>
+
+export module PonyEngine.Log.Ext:JsonLog;
+
+import std;
+
+import PonyEngine.Log;
+import PonyEngine.Type;
+
+import :LogEntry;
+import :SymbolCache;
+
+export namespace PonyEngine::Log
+{
+	/// @brief Log that is written as a JSON line. It's used for logs that are already symbolized, e.g. decoded ones.
+	struct JsonLogRecord final
+	{
+		std::string_view message; ///< Log message.
+		std::string_view stacktrace; ///< Stacktrace text. It's empty if the log has no stacktrace.
+		std::span<const LogField> fields; ///< Structured fields. May be empty.
+		std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> timePoint; ///< Log time.
+		std::uint64_t frameCount = 0ull; ///< Log frame.
+		std::optional<std::uint64_t> thread; ///< Hash of the thread ID. It's not written if it's not set.
+		LogType logType = LogType::Verbose; ///< Log type.
+		bool hasException = false; ///< Was an exception attached to the log?
+	};
+
+	/// @brief JSON lines log writer.
+	/// @details Every log is written as one JSON object on its own line:
+	///          {"time":"2026-01-01T00:00:00.000000000Z","frame":1,"thread":1,"type":"Info","message":"...","exception":true,"fields":{"key":value},"stacktrace":"..."}.
+	///          The thread, exception, fields and stacktrace are written only if the log has them. Non-finite floating point fields are written as null.
+	///          The thread is the hash of the thread ID. The log is encoded directly into the output, so nothing is allocated once the output capacity is enough.
+	class JsonLogWriter final
+	{
+	public:
+		/// @brief Creates a writer.
+		/// @param output Output. The records are appended to it. It may be cleared between writes if its content is stored.
+		[[nodiscard("Pure constructor")]]
+		explicit JsonLogWriter(std::string& output) noexcept;
+		JsonLogWriter(const JsonLogWriter& other) = delete;
+		JsonLogWriter(JsonLogWriter&& other) = delete;
+
+		~JsonLogWriter() noexcept = default;
+
+		/// @brief Gets the written log count.
+		/// @return Log count.
+		[[nodiscard("Pure function")]]
+		std::uint64_t LogCount() const noexcept;
+
+		/// @brief Writes the @p logEntry as a JSON line.
+		/// @param logEntry Log entry.
+		void Write(const LogEntry& logEntry);
+		/// @brief Writes the @p record as a JSON line.
+		/// @param record Log record.
+		void Write(const JsonLogRecord& record);
+
+		JsonLogWriter& operator =(const JsonLogWriter& other) = delete;
+		JsonLogWriter& operator =(JsonLogWriter&& other) = delete;
+
+	private:
+		/// @brief Hex digits.
+		static constexpr std::string_view HexDigits = "0123456789abcdef";
+
+		/// @brief Appends the @p time as an ISO 8601 UTC string with nanoseconds.
+		/// @param time Time.
+		void AppendTime(std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> time);
+		/// @brief Appends the @p field as a JSON member.
+		/// @param field Field.
+		void AppendField(const LogField& field);
+		/// @brief Appends the @p string as a quoted and escaped JSON string.
+		/// @param string String.
+		void AppendString(std::string_view string);
+		/// @brief Appends the @p value as a JSON number.
+		/// @tparam T Value type.
+		/// @param value Value.
+		template<Type::Integer T>
+		void AppendInteger(T value);
+		/// @brief Appends the @p value as a JSON number or null if it's not finite.
+		/// @param value Value.
+		void AppendFloat(double value);
+		/// @brief Appends the @p value as decimal digits padded with zeros to the @p width.
+		/// @param value Value.
+		/// @param width Min digit count.
+		void AppendDigits(std::uint64_t value, std::size_t width);
+
+		std::string* output; ///< Output.
+		std::string stacktraceText; ///< Stacktrace text buffer.
+		std::uint64_t logCount; ///< Written log count.
+	};
+}
+
+namespace PonyEngine::Log
+{
+	JsonLogWriter::JsonLogWriter(std::string& output) noexcept :
+		output{&output},
+		logCount{0ull}
+	{
+	}
+
+	std::uint64_t JsonLogWriter::LogCount() const noexcept
+	{
+		return logCount;
+	}
+
+	void JsonLogWriter::Write(const LogEntry& logEntry)
+	{
+		stacktraceText.clear();
+		if (logEntry.stacktrace)
+		{
+			SymbolCache::Shared().Append(stacktraceText, *logEntry.stacktrace);
+		}
+
+		Write(JsonLogRecord
+		{
+			.message = logEntry.message,
+			.stacktrace = stacktraceText,
+			.fields = logEntry.fields,
+			.timePoint = std::chrono::time_point_cast<std::chrono::nanoseconds>(logEntry.timePoint),
+			.frameCount = logEntry.frameCount,
+			.thread = std::hash<std::thread::id>()(logEntry.threadId),
+			.logType = logEntry.logType,
+			.hasException = static_cast<bool>(logEntry.exception)
+		});
+	}
+
+	void JsonLogWriter::Write(const JsonLogRecord& record)
+	{
+		output->append(R"({"time":)");
+		AppendTime(record.timePoint);
+		output->append(R"(,"frame":)");
+		AppendInteger(record.frameCount);
+		if (record.thread)
+		{
+			output->append(R"(,"thread":)");
+			AppendInteger(*record.thread);
+		}
+		output->append(R"(,"type":")");
+		std::format_to(std::back_inserter(*output), "{}", record.logType);
+		output->append(R"(","message":)");
+		AppendString(record.message);
+
+		if (record.hasException)
+		{
+			output->append(R"(,"exception":true)");
+		}
+
+		if (!record.fields.empty())
+		{
+			output->append(R"(,"fields":{)");
+			for (std::size_t i = 0uz; i < record.fields.size(); ++i)
+			{
+				if (i > 0uz)
+				{
+					output->push_back(',');
+				}
+				AppendField(record.fields[i]);
+			}
+			output->push_back('}');
+		}
+
+		if (!record.stacktrace.empty())
+		{
+			output->append(R"(,"stacktrace":)");
+			AppendString(record.stacktrace);
+		}
+
+		output->append("}\n");
+		++logCount;
+	}
+
+	void JsonLogWriter::AppendTime(const std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> time)
+	{
+		const auto days = std::chrono::floor<std::chrono::days>(time);
+		const auto date = std::chrono::year_month_day(days);
+		const auto dayTime = std::chrono::hh_mm_ss<std::chrono::nanoseconds>(time - days);
+
+		output->push_back('"');
+		AppendDigits(static_cast<std::uint64_t>(static_cast<int>(date.year())), 4uz);
+		output->push_back('-');
+		AppendDigits(static_cast<unsigned int>(date.month()), 2uz);
+		output->push_back('-');
+		AppendDigits(static_cast<unsigned int>(date.day()), 2uz);
+		output->push_back('T');
+		AppendDigits(static_cast<std::uint64_t>(dayTime.hours().count()), 2uz);
+		output->push_back(':');
+		AppendDigits(static_cast<std::uint64_t>(dayTime.minutes().count()), 2uz);
+		output->push_back(':');
+		AppendDigits(static_cast<std::uint64_t>(dayTime.seconds().count()), 2uz);
+		output->push_back('.');
+		AppendDigits(static_cast<std::uint64_t>(dayTime.subseconds().count()), 9uz);
+		output->append("Z\"");
+	}
+
+	void JsonLogWriter::AppendField(const LogField& field)
+	{
+		AppendString(field.Key());
+		output->push_back(':');
+
+		switch (field.Type())
+		{
+		case LogFieldType::Int:
+			AppendInteger(field.Int());
+			break;
+		case LogFieldType::UInt:
+			AppendInteger(field.UInt());
+			break;
+		case LogFieldType::Float:
+			AppendFloat(field.Float());
+			break;
+		case LogFieldType::Bool:
+			output->append(field.Bool() ? "true" : "false");
+			break;
+		case LogFieldType::String:
+			AppendString(field.String());
+			break;
+		default: [[unlikely]]
+			assert(false && "Incorrect log field type.");
+			output->append("null");
+			break;
+		}
+	}
+
+	void JsonLogWriter::AppendString(const std::string_view string)
+	{
+		output->push_back('"');
+
+		std::size_t runStart = 0uz;
+		for (std::size_t i = 0uz; i < string.size(); ++i)
+		{
+			const auto character = static_cast<unsigned char>(string[i]);
+			if (character >= 0x20u && character != '"' && character != '\\') [[likely]]
+			{
+				continue;
+			}
+
+			output->append(string.substr(runStart, i - runStart));
+			runStart = i + 1uz;
+			switch (character)
+			{
+			case '"':
+				output->append("\\\"");
+				break;
+			case '\\':
+				output->append("\\\\");
+				break;
+			case '\n':
+				output->append("\\n");
+				break;
+			case '\r':
+				output->append("\\r");
+				break;
+			case '\t':
+				output->append("\\t");
+				break;
+			default:
+				output->append("\\u00");
+				output->push_back(HexDigits[character >> 4u]);
+				output->push_back(HexDigits[character & 0xFu]);
+				break;
+			}
+		}
+		output->append(string.substr(runStart));
+
+		output->push_back('"');
+	}
+
+	template<Type::Integer T>
+	void JsonLogWriter::AppendInteger(const T value)
+	{
+		std::array<char, 24> buffer;
+		const std::to_chars_result result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+		assert(result.ec == std::errc() && "The buffer is too small.");
+		output->append(buffer.data(), result.ptr);
+	}
+
+	void JsonLogWriter::AppendFloat(const double value)
+	{
+		if (!std::isfinite(value)) [[unlikely]]
+		{
+			output->append("null");
+			return;
+		}
+
+		std::array<char, 32> buffer;
+		const std::to_chars_result result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+		assert(result.ec == std::errc() && "The buffer is too small.");
+		output->append(buffer.data(), result.ptr);
+	}
+
+	void JsonLogWriter::AppendDigits(std::uint64_t value, const std::size_t width)
+	{
+		std::array<char, 20> buffer;
+		std::size_t count = 0uz;
+		do
+		{
+			buffer[buffer.size() - ++count] = static_cast<char>('0' + value % 10ull);
+			value /= 10ull;
+		}
+		while (value > 0ull);
+
+		output->append(width > count ? width - count : 0uz, '0');
+		output->append(buffer.data() + buffer.size() - count, count);
+	}
+}
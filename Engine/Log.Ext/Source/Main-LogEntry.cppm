@@ -25,5 +25,7 @@ export namespace PonyEngine::Log
 		std::chrono::time_point<std::chrono::system_clock> timePoint; ///< Time when the log entry is created.
 		std::uint64_t frameCount = 0ull; ///< Frame when the log entry is created.
 		LogType logType = LogType::Verbose; ///< Log type.
+		std::span<const LogField> fields; ///< Structured fields attached to the log entry. May be empty.
+		std::thread::id threadId; ///< Thread that created the log entry.
 	};
 }
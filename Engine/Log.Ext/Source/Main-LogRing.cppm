@@ -0,0 +1,369 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+module;
+
+#include <cassert>
+
+export module PonyEngine.Log.Ext:LogRing;
+
+import std;
+
+import PonyEngine.Log;
+
+import :BinaryLog;
+import :LogEntry;
+
+export namespace PonyEngine::Log
+{
+	constexpr std::array<std::byte, 4> LogRingMagic = { std::byte{'P'}, std::byte{'N'}, std::byte{'L'}, std::byte{'R'} }; ///< Log ring magic.
+	constexpr std::uint8_t LogRingFormat = 1u; ///< Log ring format version.
+	constexpr std::size_t LogRingHeaderSize = 64uz; ///< Log ring header size: magic, format version, slot size, slot count and reserved bytes.
+	constexpr std::size_t LogRingSlotHeaderSize = 40uz; ///< Slot header size: sequence, time, frame, thread, log type, flags and message size.
+	constexpr std::size_t LogRingMinSlotSize = 64uz; ///< Min slot size.
+	constexpr std::size_t LogRingMaxSlotSize = 65536uz; ///< Max slot size.
+
+	/// @brief Gets the log ring size.
+	/// @param slotCount Slot count.
+	/// @param slotSize Slot size.
+	/// @return Log ring size in bytes.
+	[[nodiscard("Pure function")]]
+	constexpr std::size_t LogRingSize(std::size_t slotCount, std::size_t slotSize) noexcept;
+
+	/// @brief Log ring writer.
+	/// @details The log ring is a header and a fixed count of fixed-size slots. Every log overwrites the oldest slot, so the ring keeps the last logs.
+	///          A slot is a sequence number, the time, frame, thread hash, log type, flags, message size and the message. A message that doesn't fit is truncated.
+	///          The sequence is cleared before the slot is written and set after it, so a slot interrupted by a crash is skipped by the reader.
+	///          The writer only stores to the ring memory. If the memory is a shared file mapping, the kernel keeps the written logs even if the process is killed.
+	///          The values are written in the native byte order.
+	class LogRingWriter final
+	{
+	public:
+		/// @brief Creates a writer and writes a log ring header. The slots left in the @p data are cleared.
+		/// @param data Log ring memory. It must be aligned to 8 bytes. The slot count is the max count that fits into it.
+		/// @param slotSize Slot size. It must be a multiple of 8 in range [@p LogRingMinSlotSize, @p LogRingMaxSlotSize].
+		/// @throws std::invalid_argument If the @p slotSize is incorrect or the @p data can't hold a slot.
+		[[nodiscard("Pure constructor")]]
+		explicit LogRingWriter(std::span<std::byte> data, std::size_t slotSize = 256uz);
+		LogRingWriter(const LogRingWriter& other) = delete;
+		LogRingWriter(LogRingWriter&& other) = delete;
+
+		~LogRingWriter() noexcept = default;
+
+		/// @brief Gets the slot count.
+		/// @return Slot count.
+		[[nodiscard("Pure function")]]
+		std::size_t SlotCount() const noexcept;
+		/// @brief Gets the slot size.
+		/// @return Slot size.
+		[[nodiscard("Pure function")]]
+		std::size_t SlotSize() const noexcept;
+		/// @brief Gets the max message size that fits into a slot.
+		/// @return Max message size.
+		[[nodiscard("Pure function")]]
+		std::size_t MaxMessageSize() const noexcept;
+		/// @brief Gets the written log count including the overwritten logs.
+		/// @return Log count.
+		[[nodiscard("Pure function")]]
+		std::uint64_t LogCount() const noexcept;
+
+		/// @brief Writes the @p logEntry to the next slot.
+		/// @details Only the message is written. The stacktrace and fields are skipped.
+		/// @param logEntry Log entry.
+		void Write(const LogEntry& logEntry) noexcept;
+
+		LogRingWriter& operator =(const LogRingWriter& other) = delete;
+		LogRingWriter& operator =(LogRingWriter&& other) = delete;
+
+	private:
+		/// @brief Gets the slot sequence.
+		/// @param slot Slot.
+		/// @return Slot sequence.
+		[[nodiscard("Pure function")]]
+		static std::atomic_ref<std::uint64_t> Sequence(std::byte* slot) noexcept;
+
+		std::span<std::byte> data; ///< Log ring memory.
+		std::size_t slotSize; ///< Slot size.
+		std::size_t slotCount; ///< Slot count.
+		std::uint64_t logCount; ///< Written log count.
+	};
+
+	/// @brief Decoded log ring record.
+	struct LogRingRecord final
+	{
+		std::string_view message; ///< Log message. It may be truncated.
+		std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> timePoint; ///< Log time.
+		std::uint64_t frameCount = 0ull; ///< Log frame.
+		std::uint64_t thread = 0ull; ///< Hash of the thread ID.
+		std::uint64_t sequence = 0ull; ///< Log sequence number. It starts from 1.
+		LogType logType = LogType::Verbose; ///< Log type.
+		bool hasException = false; ///< Was an exception attached to the log?
+		bool isTruncated = false; ///< Was the message truncated?
+	};
+
+	/// @brief Log ring reader.
+	/// @details The records are read from the oldest to the newest. Empty slots and slots interrupted by a crash are skipped.
+	///          The returned strings reference the log ring data, so it must outlive them.
+	class LogRingReader final
+	{
+	public:
+		/// @brief Creates a reader.
+		/// @param data Log ring data.
+		/// @throws std::invalid_argument If the @p data isn't a log ring or it's truncated.
+		[[nodiscard("Pure constructor")]]
+		explicit LogRingReader(std::span<const std::byte> data);
+		LogRingReader(const LogRingReader& other) = delete;
+		LogRingReader(LogRingReader&& other) = delete;
+
+		~LogRingReader() noexcept = default;
+
+		/// @brief Gets the slot count.
+		/// @return Slot count.
+		[[nodiscard("Pure function")]]
+		std::size_t SlotCount() const noexcept;
+		/// @brief Gets the slot size.
+		/// @return Slot size.
+		[[nodiscard("Pure function")]]
+		std::size_t SlotSize() const noexcept;
+		/// @brief Gets the written log count including the overwritten logs.
+		/// @return Log count.
+		[[nodiscard("Pure function")]]
+		std::uint64_t LogCount() const noexcept;
+
+		/// @brief Reads the next log record.
+		/// @param record Log record.
+		/// @return @a True if the record is read; @a false if there are no more records.
+		/// @throws std::invalid_argument If the slot is corrupted.
+		bool Next(LogRingRecord& record);
+
+		LogRingReader& operator =(const LogRingReader& other) = delete;
+		LogRingReader& operator =(LogRingReader&& other) = delete;
+
+	private:
+		/// @brief Gets the slot sequence.
+		/// @param slotIndex Slot index.
+		/// @return Slot sequence or 0 if the slot is empty or doesn't belong to the ring.
+		[[nodiscard("Pure function")]]
+		std::uint64_t Sequence(std::size_t slotIndex) const noexcept;
+
+		std::span<const std::byte> data; ///< Log ring data.
+		std::size_t slotSize; ///< Slot size.
+		std::size_t slotCount; ///< Slot count.
+		std::uint64_t logCount; ///< Written log count.
+		std::size_t firstSlot; ///< Slot of the oldest log.
+		std::size_t position; ///< Count of the read slots.
+	};
+}
+
+namespace PonyEngine::Log
+{
+	/// @brief Slot header after the sequence.
+	struct LogRingSlotHeader final
+	{
+		std::int64_t time; ///< Log time in nanoseconds.
+		std::uint64_t frameCount; ///< Log frame.
+		std::uint64_t thread; ///< Hash of the thread ID.
+		std::uint8_t logType; ///< Log type.
+		std::uint8_t flags; ///< Log flags.
+		std::uint16_t messageSize; ///< Written message size.
+		std::uint32_t reserved; ///< Reserved.
+	};
+	static_assert(sizeof(std::uint64_t) + sizeof(LogRingSlotHeader) == LogRingSlotHeaderSize);
+
+	constexpr std::uint8_t LogRingExceptionFlag = 0x01u; ///< An exception was attached.
+	constexpr std::uint8_t LogRingTruncatedFlag = 0x02u; ///< The message was truncated.
+
+	constexpr std::size_t LogRingSlotSizeOffset = 8uz; ///< Slot size offset in the log ring header.
+	constexpr std::size_t LogRingSlotCountOffset = 12uz; ///< Slot count offset in the log ring header.
+
+	constexpr std::size_t LogRingSize(const std::size_t slotCount, const std::size_t slotSize) noexcept
+	{
+		return LogRingHeaderSize + slotCount * slotSize;
+	}
+
+	LogRingWriter::LogRingWriter(const std::span<std::byte> data, const std::size_t slotSize) :
+		data(data),
+		slotSize{slotSize},
+		slotCount{data.size() > LogRingHeaderSize ? std::min<std::size_t>((data.size() - LogRingHeaderSize) / slotSize, std::numeric_limits<std::uint32_t>::max()) : 0uz},
+		logCount{0ull}
+	{
+		assert(reinterpret_cast<std::uintptr_t>(data.data()) % alignof(std::uint64_t) == 0uz && "The log ring memory isn't aligned.");
+
+		if (slotSize < LogRingMinSlotSize || slotSize > LogRingMaxSlotSize || slotSize % alignof(std::uint64_t) != 0uz) [[unlikely]]
+		{
+			throw std::invalid_argument(std::format("Incorrect log ring slot size: SlotSize = '{}'", slotSize));
+		}
+		if (slotCount == 0uz) [[unlikely]]
+		{
+			throw std::invalid_argument(std::format("Log ring memory is too small: Size = '{}'", data.size()));
+		}
+
+		for (std::size_t i = 0uz; i < slotCount; ++i)
+		{
+			if (const std::atomic_ref<std::uint64_t> sequence = Sequence(data.data() + LogRingSize(i, slotSize)); sequence.load(std::memory_order_relaxed) != 0ull)
+			{
+				sequence.store(0ull, std::memory_order_relaxed);
+			}
+		}
+
+		const auto slotSize32 = static_cast<std::uint32_t>(slotSize);
+		const auto slotCount32 = static_cast<std::uint32_t>(slotCount);
+		std::ranges::fill(data.first(LogRingHeaderSize), std::byte{0});
+		std::memcpy(data.data() + LogRingSlotSizeOffset, &slotSize32, sizeof(slotSize32));
+		std::memcpy(data.data() + LogRingSlotCountOffset, &slotCount32, sizeof(slotCount32));
+		data[LogRingMagic.size()] = static_cast<std::byte>(LogRingFormat);
+		std::atomic_thread_fence(std::memory_order_release);
+		std::ranges::copy(LogRingMagic, data.begin());
+	}
+
+	std::size_t LogRingWriter::SlotCount() const noexcept
+	{
+		return slotCount;
+	}
+
+	std::size_t LogRingWriter::SlotSize() const noexcept
+	{
+		return slotSize;
+	}
+
+	std::size_t LogRingWriter::MaxMessageSize() const noexcept
+	{
+		return slotSize - LogRingSlotHeaderSize;
+	}
+
+	std::uint64_t LogRingWriter::LogCount() const noexcept
+	{
+		return logCount;
+	}
+
+	void LogRingWriter::Write(const LogEntry& logEntry) noexcept
+	{
+		std::byte* const slot = data.data() + LogRingSize(static_cast<std::size_t>(logCount % slotCount), slotSize);
+		const std::atomic_ref<std::uint64_t> sequence = Sequence(slot);
+		sequence.store(0ull, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		const std::size_t messageSize = std::min(logEntry.message.size(), MaxMessageSize());
+		const auto header = LogRingSlotHeader
+		{
+			.time = ToNanoseconds(logEntry.timePoint),
+			.frameCount = logEntry.frameCount,
+			.thread = static_cast<std::uint64_t>(std::hash<std::thread::id>()(logEntry.threadId)),
+			.logType = static_cast<std::uint8_t>(logEntry.logType),
+			.flags = static_cast<std::uint8_t>((logEntry.exception ? LogRingExceptionFlag : 0u) | (messageSize < logEntry.message.size() ? LogRingTruncatedFlag : 0u)),
+			.messageSize = static_cast<std::uint16_t>(messageSize),
+			.reserved = 0u
+		};
+		std::memcpy(slot + sizeof(std::uint64_t), &header, sizeof(header));
+		std::memcpy(slot + LogRingSlotHeaderSize, logEntry.message.data(), messageSize);
+
+		sequence.store(++logCount, std::memory_order_release);
+	}
+
+	std::atomic_ref<std::uint64_t> LogRingWriter::Sequence(std::byte* const slot) noexcept
+	{
+		return std::atomic_ref<std::uint64_t>(*reinterpret_cast<std::uint64_t*>(slot));
+	}
+
+	LogRingReader::LogRingReader(const std::span<const std::byte> data) :
+		data(data),
+		slotSize{0uz},
+		slotCount{0uz},
+		logCount{0ull},
+		firstSlot{0uz},
+		position{0uz}
+	{
+		if (data.size() < LogRingHeaderSize || !std::ranges::equal(data.first(LogRingMagic.size()), LogRingMagic)) [[unlikely]]
+		{
+			throw std::invalid_argument("Data isn't a log ring");
+		}
+		if (const auto format = static_cast<std::uint8_t>(data[LogRingMagic.size()]); format != LogRingFormat) [[unlikely]]
+		{
+			throw std::invalid_argument(std::format("Unsupported log ring format: Format = '{}'", format));
+		}
+
+		std::uint32_t slotSize32;
+		std::uint32_t slotCount32;
+		std::memcpy(&slotSize32, data.data() + LogRingSlotSizeOffset, sizeof(slotSize32));
+		std::memcpy(&slotCount32, data.data() + LogRingSlotCountOffset, sizeof(slotCount32));
+		slotSize = slotSize32;
+		slotCount = slotCount32;
+		if (slotSize < LogRingMinSlotSize || slotSize > LogRingMaxSlotSize || slotCount == 0uz) [[unlikely]]
+		{
+			throw std::invalid_argument(std::format("Log ring header is corrupted: SlotSize = '{}', SlotCount = '{}'", slotSize, slotCount));
+		}
+		if (data.size() < LogRingSize(slotCount, slotSize)) [[unlikely]]
+		{
+			throw std::invalid_argument(std::format("Log ring is truncated: Size = '{}', ExpectedSize = '{}'", data.size(), LogRingSize(slotCount, slotSize)));
+		}
+
+		for (std::size_t i = 0uz; i < slotCount; ++i)
+		{
+			logCount = std::max(logCount, Sequence(i));
+		}
+		firstSlot = static_cast<std::size_t>(logCount % slotCount);
+	}
+
+	std::size_t LogRingReader::SlotCount() const noexcept
+	{
+		return slotCount;
+	}
+
+	std::size_t LogRingReader::SlotSize() const noexcept
+	{
+		return slotSize;
+	}
+
+	std::uint64_t LogRingReader::LogCount() const noexcept
+	{
+		return logCount;
+	}
+
+	bool LogRingReader::Next(LogRingRecord& record)
+	{
+		while (position < slotCount)
+		{
+			const std::size_t slotIndex = (firstSlot + position++) % slotCount;
+			const std::uint64_t sequence = Sequence(slotIndex);
+			if (sequence == 0ull)
+			{
+				continue;
+			}
+
+			const std::byte* const slot = data.data() + LogRingSize(slotIndex, slotSize);
+			LogRingSlotHeader header;
+			std::memcpy(&header, slot + sizeof(std::uint64_t), sizeof(header));
+			if (header.messageSize > slotSize - LogRingSlotHeaderSize || header.logType > static_cast<std::uint8_t>(LogType::Exception)) [[unlikely]]
+			{
+				throw std::invalid_argument(std::format("Log ring slot is corrupted: Slot = '{}'", slotIndex));
+			}
+
+			record.message = std::string_view(reinterpret_cast<const char*>(slot + LogRingSlotHeaderSize), header.messageSize);
+			record.timePoint = ToTimePoint(header.time);
+			record.frameCount = header.frameCount;
+			record.thread = header.thread;
+			record.sequence = sequence;
+			record.logType = static_cast<LogType>(header.logType);
+			record.hasException = (header.flags & LogRingExceptionFlag) != 0u;
+			record.isTruncated = (header.flags & LogRingTruncatedFlag) != 0u;
+
+			return true;
+		}
+
+		return false;
+	}
+
+	std::uint64_t LogRingReader::Sequence(const std::size_t slotIndex) const noexcept
+	{
+		std::uint64_t sequence;
+		std::memcpy(&sequence, data.data() + LogRingSize(slotIndex, slotSize), sizeof(sequence));
+
+		return sequence > 0ull && (sequence - 1ull) % slotCount == slotIndex ? sequence : 0ull;
+	}
+}
@@ -0,0 +1,41 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Log.Ext:LogStatistics;
+
+import std;
+
+export namespace PonyEngine::Log
+{
+	/// @brief Logger statistics.
+	struct LogStatistics final
+	{
+		std::uint64_t logCount = 0ull; ///< Count of the logs passed to the sub-loggers.
+		std::uint64_t droppedLogCount = 0ull; ///< Count of the logs dropped because the log queue was full.
+		std::uint64_t blockedLogCount = 0ull; ///< Count of the logs that waited for space in the log queue.
+		std::uint64_t repeatedLogCount = 0ull; ///< Count of the repeated logs coalesced into repeat reports. It's always 0 if the logger is synchronous.
+		std::chrono::nanoseconds totalLatency = std::chrono::nanoseconds::zero(); ///< Sum of the times between log creations and their passing to the sub-loggers. It's always 0 if the logger is synchronous.
+		std::chrono::nanoseconds maxLatency = std::chrono::nanoseconds::zero(); ///< Max time between a log creation and its passing to the sub-loggers. It's always 0 if the logger is synchronous.
+		std::size_t queueSize = 0uz; ///< Queued log count. It's always 0 if the logger is synchronous.
+		std::size_t queueCapacity = 0uz; ///< Log queue capacity. It's 0 if the logger is synchronous.
+
+		/// @brief Calculates the average latency.
+		/// @return Average time between a log creation and its passing to the sub-loggers.
+		[[nodiscard("Pure function")]]
+		constexpr std::chrono::nanoseconds AverageLatency() const noexcept;
+	};
+}
+
+namespace PonyEngine::Log
+{
+	constexpr std::chrono::nanoseconds LogStatistics::AverageLatency() const noexcept
+	{
+		return logCount > 0ull ? totalLatency / static_cast<std::chrono::nanoseconds::rep>(logCount) : std::chrono::nanoseconds::zero();
+	}
+}
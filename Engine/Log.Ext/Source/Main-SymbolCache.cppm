@@ -0,0 +1,250 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Log.Ext:SymbolCache;
+
+import std;
+
+export namespace PonyEngine::Log
+{
+	/// @brief Cache of symbolized stacktrace frames.
+	/// @details A stacktrace holds only raw frame addresses; symbolizing them is expensive. The cache keeps the text of each frame by its address,
+	///          so frames that were seen before are resolved with a single lookup.
+	/// @note The class is thread-safe.
+	class SymbolCache final
+	{
+	public:
+		/// @brief Default max cached frame count.
+		static constexpr std::size_t DefaultMaxFrameCount = 4096uz;
+
+		/// @brief Creates a symbol cache.
+		/// @param maxFrameCount Max cached frame count. Frames beyond it are symbolized without caching.
+		[[nodiscard("Pure constructor")]]
+		explicit SymbolCache(std::size_t maxFrameCount = DefaultMaxFrameCount) noexcept;
+		SymbolCache(const SymbolCache&) = delete;
+		SymbolCache(SymbolCache&&) = delete;
+
+		~SymbolCache() noexcept = default;
+
+		/// @brief Gets the cache shared by the loggers of the process.
+		/// @return Shared symbol cache.
+		[[nodiscard("Pure function")]]
+		static SymbolCache& Shared() noexcept;
+
+		/// @brief Appends the symbolized stacktrace to the @p target. The text has the same layout as the platform stacktrace formatter makes.
+		/// @param target Target string.
+		/// @param stacktrace Stacktrace.
+		void Append(std::string& target, const std::stacktrace& stacktrace);
+
+		/// @brief Gets the cached frame count.
+		/// @return Cached frame count.
+		[[nodiscard("Pure function")]]
+		std::size_t FrameCount() const noexcept;
+		/// @brief Gets the count of the frames that were found in the cache.
+		/// @return Hit count.
+		[[nodiscard("Pure function")]]
+		std::uint64_t HitCount() const noexcept;
+		/// @brief Gets the count of the frames that were symbolized.
+		/// @return Miss count.
+		[[nodiscard("Pure function")]]
+		std::uint64_t MissCount() const noexcept;
+
+		SymbolCache& operator =(const SymbolCache&) = delete;
+		SymbolCache& operator =(SymbolCache&&) = delete;
+
+	private:
+		/// @brief Layout of the frames in the platform stacktrace text.
+		struct FrameLayout final
+		{
+			std::string prefix; ///< Text before a frame without its index.
+			std::size_t indexPosition = std::string::npos; ///< Frame index position in the prefix. It's npos if there's no index.
+			std::size_t indexWidth = 0uz; ///< Min frame index width. The index is right-aligned.
+			std::string separator = "\n"; ///< Text between frames.
+			std::string suffix; ///< Text after the last frame.
+		};
+
+		/// @brief Gets the frame layout of the platform stacktrace formatter.
+		/// @return Frame layout.
+		[[nodiscard("Pure function")]]
+		static const FrameLayout& Layout() noexcept;
+		/// @brief Finds the frame layout of the platform stacktrace formatter in its text.
+		/// @param text Stacktrace text.
+		/// @param first First frame text.
+		/// @param second Second frame text.
+		/// @param last Last frame text.
+		/// @return Frame layout. It's the default one if the layout isn't found.
+		[[nodiscard("Pure function")]]
+		static FrameLayout FindLayout(std::string_view text, std::string_view first, std::string_view second, std::string_view last);
+
+		/// @brief Appends the frame prefix to the @p target.
+		/// @param target Target string.
+		/// @param layout Frame layout.
+		/// @param index Frame index.
+		static void AppendPrefix(std::string& target, const FrameLayout& layout, std::size_t index);
+		/// @brief Appends the symbolized frame to the @p target.
+		/// @param target Target string.
+		/// @param entry Frame.
+		void AppendFrame(std::string& target, const std::stacktrace_entry& entry);
+
+		std::size_t maxFrameCount; ///< Max cached frame count.
+		std::unordered_map<std::stacktrace_entry::native_handle_type, std::string> frames; ///< Frame texts by their addresses.
+		mutable std::shared_mutex framesMutex; ///< Frames mutex.
+
+		std::atomic<std::uint64_t> hitCount; ///< Hit count.
+		std::atomic<std::uint64_t> missCount; ///< Miss count.
+	};
+}
+
+namespace PonyEngine::Log
+{
+	SymbolCache::SymbolCache(const std::size_t maxFrameCount) noexcept :
+		maxFrameCount{maxFrameCount},
+		hitCount(0ull),
+		missCount(0ull)
+	{
+	}
+
+	SymbolCache& SymbolCache::Shared() noexcept
+	{
+		static auto cache = SymbolCache();
+		return cache;
+	}
+
+	void SymbolCache::Append(std::string& target, const std::stacktrace& stacktrace)
+	{
+		const FrameLayout& layout = Layout();
+		for (std::size_t i = 0uz; i < stacktrace.size(); ++i)
+		{
+			if (i > 0uz)
+			{
+				target.append(layout.separator);
+			}
+			AppendPrefix(target, layout, i);
+			AppendFrame(target, stacktrace[i]);
+		}
+		if (!stacktrace.empty())
+		{
+			target.append(layout.suffix);
+		}
+	}
+
+	std::size_t SymbolCache::FrameCount() const noexcept
+	{
+		const auto lock = std::shared_lock(framesMutex);
+		return frames.size();
+	}
+
+	std::uint64_t SymbolCache::HitCount() const noexcept
+	{
+		return hitCount.load(std::memory_order::relaxed);
+	}
+
+	std::uint64_t SymbolCache::MissCount() const noexcept
+	{
+		return missCount.load(std::memory_order::relaxed);
+	}
+
+	const SymbolCache::FrameLayout& SymbolCache::Layout() noexcept
+	{
+		static const FrameLayout layout = []() noexcept
+		{
+			try
+			{
+				// The layout is taken from a real stacktrace, so it's the same as the platform formatter makes for any stacktrace.
+				const std::stacktrace stacktrace = std::stacktrace::current();
+				if (stacktrace.size() < 2uz)
+				{
+					return FrameLayout();
+				}
+
+				return FindLayout(std::format("{}", stacktrace), std::format("{}", stacktrace[0]), std::format("{}", stacktrace[1]),
+					std::format("{}", stacktrace[stacktrace.size() - 1uz]));
+			}
+			catch (...)
+			{
+				return FrameLayout();
+			}
+		}();
+
+		return layout;
+	}
+
+	SymbolCache::FrameLayout SymbolCache::FindLayout(const std::string_view text, const std::string_view first, const std::string_view second, const std::string_view last)
+	{
+		const std::size_t firstPosition = text.find(first);
+		if (firstPosition == std::string_view::npos)
+		{
+			return FrameLayout();
+		}
+		const std::size_t firstEnd = firstPosition + first.size();
+		const std::size_t secondPosition = text.find(second, firstEnd);
+		const std::size_t lastPosition = text.rfind(last);
+		if (secondPosition == std::string_view::npos || lastPosition == std::string_view::npos || lastPosition < secondPosition ||
+			secondPosition - firstEnd < firstPosition)
+		{
+			return FrameLayout();
+		}
+
+		// The text between the frames is the separator and the prefix of the second frame. The prefixes differ only by the index.
+		auto layout = FrameLayout();
+		layout.prefix = text.substr(0uz, firstPosition);
+		layout.separator = text.substr(firstEnd, secondPosition - firstEnd - firstPosition);
+		layout.suffix = text.substr(lastPosition + last.size());
+		if (const std::size_t indexPosition = layout.prefix.rfind('0'); indexPosition != std::string::npos)
+		{
+			std::size_t padding = 0uz;
+			while (padding < indexPosition && layout.prefix[indexPosition - padding - 1uz] == ' ')
+			{
+				++padding;
+			}
+			layout.indexPosition = indexPosition - padding;
+			layout.indexWidth = padding + 1uz;
+			layout.prefix.erase(layout.indexPosition, layout.indexWidth);
+		}
+
+		return layout;
+	}
+
+	void SymbolCache::AppendPrefix(std::string& target, const FrameLayout& layout, const std::size_t index)
+	{
+		if (layout.indexPosition == std::string::npos)
+		{
+			target.append(layout.prefix);
+			return;
+		}
+
+		target.append(layout.prefix, 0uz, layout.indexPosition);
+		std::format_to(std::back_inserter(target), "{:>{}}", index, layout.indexWidth);
+		target.append(layout.prefix, layout.indexPosition);
+	}
+
+	void SymbolCache::AppendFrame(std::string& target, const std::stacktrace_entry& entry)
+	{
+		{
+			const auto lock = std::shared_lock(framesMutex);
+			if (const auto position = frames.find(entry.native_handle()); position != frames.cend())
+			{
+				target.append(position->second);
+				hitCount.fetch_add(1ull, std::memory_order::relaxed);
+
+				return;
+			}
+		}
+
+		missCount.fetch_add(1ull, std::memory_order::relaxed);
+		const std::size_t frameStart = target.size();
+		std::format_to(std::back_inserter(target), "{}", entry);
+
+		const auto lock = std::unique_lock(framesMutex);
+		if (frames.size() < maxFrameCount)
+		{
+			frames.try_emplace(entry.native_handle(), std::string_view(target).substr(frameStart));
+		}
+	}
+}
@@ -11,9 +11,14 @@ export module PonyEngine.Log.Ext;
 
 export import PonyEngine.Log;
 
+export import :BinaryLog;
 export import :ILoggerContext;
 export import :ILoggerModuleContext;
 export import :ISubLogger;
+export import :JsonLog;
 export import :LogEntry;
 export import :LogHelper;
+export import :LogRing;
+export import :LogStatistics;
 export import :SubLoggerHandle;
+export import :SymbolCache;
@@ -0,0 +1,129 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+module;
+
+#include "PonyEngine/Log/Console.h"
+
+export module PonyEngine.Log.File.Impl:BinaryFileSubLogger;
+
+import std;
+
+import PonyEngine.Log.Ext;
+
+import :LogFile;
+
+export namespace PonyEngine::Log::File
+{
+	/// @brief Binary file sub-logger parameters.
+	struct BinaryFileSubLoggerParams final
+	{
+		std::filesystem::path path; ///< Binary log file path.
+		std::size_t bufferSize = 256uz * 1024uz; ///< User-space buffer size in bytes.
+		std::chrono::milliseconds flushPeriod = std::chrono::milliseconds(1000); ///< Max time the data stays in the buffer. It's checked on every log.
+		BinaryLogWriterParams writerParams; ///< Binary log writer parameters.
+	};
+
+	/// @brief Sub-logger that writes logs to a file in the binary log format.
+	/// @details The records are collected in a buffer and written when the buffer is full, the flush period passes or an error is logged.
+	///          The index is written on destruction.
+	class BinaryFileSubLogger final : public ISubLogger
+	{
+	public:
+		/// @brief Creates a binary file sub-logger.
+		/// @param logger Logger context.
+		/// @param params Parameters.
+		[[nodiscard("Pure constructor")]]
+		BinaryFileSubLogger(ILoggerContext& logger, const BinaryFileSubLoggerParams& params);
+		BinaryFileSubLogger(const BinaryFileSubLogger&) = delete;
+		BinaryFileSubLogger(BinaryFileSubLogger&&) = delete;
+
+		~BinaryFileSubLogger() noexcept;
+
+		virtual void Log(const LogEntry& logEntry) noexcept override;
+
+		BinaryFileSubLogger& operator =(const BinaryFileSubLogger&) = delete;
+		BinaryFileSubLogger& operator =(BinaryFileSubLogger&&) = delete;
+
+	private:
+		using Clock = std::chrono::steady_clock; ///< Clock of the flush period.
+
+		/// @brief Writes the buffer to the file.
+		/// @param now Current time.
+		void Flush(Clock::time_point now);
+
+		ILoggerContext* logger; ///< Logger context.
+
+		LogFile file; ///< Binary log file.
+		std::vector<std::byte> buffer; ///< User-space buffer.
+		BinaryLogWriter writer; ///< Binary log writer.
+		std::size_t bufferSize; ///< Buffer size that triggers a flush.
+		std::chrono::milliseconds flushPeriod; ///< Flush period.
+		Clock::time_point flushTime; ///< When the buffer was written last time.
+	};
+}
+
+namespace PonyEngine::Log::File
+{
+	BinaryFileSubLogger::BinaryFileSubLogger(ILoggerContext& logger, const BinaryFileSubLoggerParams& params) :
+		logger{&logger},
+		file(params.path),
+		buffer(),
+		writer(buffer, params.writerParams),
+		bufferSize{params.bufferSize},
+		flushPeriod{params.flushPeriod},
+		flushTime{Clock::now()}
+	{
+		buffer.reserve(bufferSize);
+	}
+
+	BinaryFileSubLogger::~BinaryFileSubLogger() noexcept
+	{
+		try
+		{
+			writer.Finish();
+			Flush(Clock::now());
+		}
+		catch (...)
+		{
+			PONY_CONSOLE_X(*logger, std::current_exception(), "On finishing binary log file.");
+		}
+	}
+
+	void BinaryFileSubLogger::Log(const LogEntry& logEntry) noexcept
+	{
+		try
+		{
+			writer.Write(logEntry);
+
+			const Clock::time_point now = Clock::now();
+			if (buffer.size() >= bufferSize || logEntry.logType == LogType::Error || logEntry.logType == LogType::Exception || now - flushTime >= flushPeriod)
+			{
+				Flush(now);
+			}
+		}
+		catch (...)
+		{
+			PONY_CONSOLE_X(*logger, std::current_exception(), "On writing to binary log file.");
+		}
+	}
+
+	void BinaryFileSubLogger::Flush(const Clock::time_point now)
+	{
+		flushTime = now;
+		if (buffer.empty())
+		{
+			return;
+		}
+
+		file.Write(std::array{std::span<const std::byte>(buffer)});
+		buffer.clear();
+	}
+}
@@ -19,7 +19,11 @@ import std;
 import PonyEngine.Application.Ext;
 import PonyEngine.Log.Ext;
 
+import :BinaryFileSubLogger;
 import :FileSubLogger;
+import :JsonFileSubLogger;
+import :RingFileSubLogger;
+import :RotatingFileSubLogger;
 
 export namespace PonyEngine::Log::File
 {
@@ -41,7 +45,22 @@ export namespace PonyEngine::Log::File
 		FileSubLoggerModule& operator =(FileSubLoggerModule&&) = delete;
 
 	private:
+#if PONY_ENGINE_LOG_FILE_ROTATING
+		using SubLogger = RotatingFileSubLogger; ///< File sub-logger type.
+#else
+		using SubLogger = FileSubLogger; ///< File sub-logger type.
+#endif
+
 		SubLoggerHandle fileSubLoggerHandle; ///< File sub-logger handle.
+#if PONY_ENGINE_LOG_FILE_BINARY
+		SubLoggerHandle binarySubLoggerHandle; ///< Binary file sub-logger handle.
+#endif
+#if PONY_ENGINE_LOG_FILE_JSON
+		SubLoggerHandle jsonSubLoggerHandle; ///< JSON lines file sub-logger handle.
+#endif
+#if PONY_ENGINE_LOG_FILE_RING
+		SubLoggerHandle ringSubLoggerHandle; ///< Ring file sub-logger handle.
+#endif
 	};
 }
 
@@ -57,11 +76,30 @@ namespace PonyEngine::Log::File
 		}
 #endif
 
-		PONY_LOG(context.Logger(), LogType::Info, "Constructing '{}'...", typeid(FileSubLogger).name());
+		PONY_LOG(context.Logger(), LogType::Info, "Constructing '{}'...", typeid(SubLogger).name());
 		fileSubLoggerHandle = loggerModuleContext->AddSubLogger([&](ILoggerContext& loggerContext)
 		{
 			PONY_LOG(context.Logger(), LogType::Info, "Preparing log files...");
 			const std::filesystem::path logPath = (loggerContext.Application().LocalDataDirectory() / PONY_STRINGIFY_VALUE(PONY_ENGINE_LOG_FILE_PATH)).lexically_normal();
+#if PONY_ENGINE_LOG_FILE_ROTATING
+			std::filesystem::create_directories(logPath.parent_path());
+			PONY_LOG(context.Logger(), LogType::Info, "Preparing log files done. Log file path: '{}'.", logPath.string());
+			const auto params = RotatingFileSubLoggerParams
+			{
+				.path = logPath,
+				.bufferSize = PONY_ENGINE_LOG_FILE_BUFFER_SIZE,
+				.flushPeriod = std::chrono::milliseconds(PONY_ENGINE_LOG_FILE_FLUSH_PERIOD),
+				.rotationSize = PONY_ENGINE_LOG_FILE_ROTATION_SIZE,
+				.rotationPeriod = std::chrono::seconds(PONY_ENGINE_LOG_FILE_ROTATION_PERIOD),
+				.retentionCount = PONY_ENGINE_LOG_FILE_RETENTION_COUNT,
+				.retentionSize = PONY_ENGINE_LOG_FILE_RETENTION_SIZE,
+				.syncPolicy = LogFileSyncPolicy::PONY_ENGINE_LOG_FILE_SYNC,
+				.syncPeriod = std::chrono::milliseconds(PONY_ENGINE_LOG_FILE_SYNC_PERIOD),
+				.compress = PONY_ENGINE_LOG_FILE_COMPRESSION
+			};
+
+			return std::make_shared<RotatingFileSubLogger>(loggerContext, params);
+#else
 			if (std::filesystem::exists(logPath)) [[likely]]
 			{
 				const std::filesystem::path prevLogPath = logPath.parent_path() / (logPath.stem().string() + "_prev" + logPath.extension().string());
@@ -74,8 +112,119 @@ namespace PonyEngine::Log::File
 				PONY_LOG(context.Logger(), LogType::Info, "Preparing log files done. Log file path: '{}'.", logPath.string());
 			}
 			return std::make_shared<FileSubLogger>(loggerContext, logPath);
+#endif
 		});
-		PONY_LOG(context.Logger(), LogType::Info, "Constructing '{}' done.", typeid(FileSubLogger).name());
+		PONY_LOG(context.Logger(), LogType::Info, "Constructing '{}' done.", typeid(SubLogger).name());
+
+#if PONY_ENGINE_LOG_FILE_BINARY
+		PONY_LOG(context.Logger(), LogType::Info, "Constructing '{}'...", typeid(BinaryFileSubLogger).name());
+		try
+		{
+			binarySubLoggerHandle = loggerModuleContext->AddSubLogger([&](ILoggerContext& loggerContext)
+			{
+				const std::filesystem::path logPath = (loggerContext.Application().LocalDataDirectory() / PONY_STRINGIFY_VALUE(PONY_ENGINE_LOG_FILE_BINARY_PATH)).lexically_normal();
+				if (std::filesystem::exists(logPath))
+				{
+					const std::filesystem::path prevLogPath = logPath.parent_path() / (logPath.stem().string() + "_prev" + logPath.extension().string());
+					std::filesystem::rename(logPath, prevLogPath);
+					PONY_LOG(context.Logger(), LogType::Info, "Binary log file path: '{}'; Old binary log file path: '{}'.", logPath.string(), prevLogPath.string());
+				}
+				else
+				{
+					std::filesystem::create_directories(logPath.parent_path());
+					PONY_LOG(context.Logger(), LogType::Info, "Binary log file path: '{}'.", logPath.string());
+				}
+				const auto params = BinaryFileSubLoggerParams
+				{
+					.path = logPath,
+					.writerParams = BinaryLogWriterParams{.indexInterval = PONY_ENGINE_LOG_FILE_BINARY_INDEX_INTERVAL}
+				};
+
+				return std::make_shared<BinaryFileSubLogger>(loggerContext, params);
+			});
+		}
+		catch (...)
+		{
+			loggerModuleContext->RemoveSubLogger(fileSubLoggerHandle);
+			throw;
+		}
+		PONY_LOG(context.Logger(), LogType::Info, "Constructing '{}' done.", typeid(BinaryFileSubLogger).name());
+#endif
+
+#if PONY_ENGINE_LOG_FILE_JSON
+		PONY_LOG(context.Logger(), LogType::Info, "Constructing '{}'...", typeid(JsonFileSubLogger).name());
+		try
+		{
+			jsonSubLoggerHandle = loggerModuleContext->AddSubLogger([&](ILoggerContext& loggerContext)
+			{
+				const std::filesystem::path logPath = (loggerContext.Application().LocalDataDirectory() / PONY_STRINGIFY_VALUE(PONY_ENGINE_LOG_FILE_JSON_PATH)).lexically_normal();
+				if (std::filesystem::exists(logPath))
+				{
+					const std::filesystem::path prevLogPath = logPath.parent_path() / (logPath.stem().string() + "_prev" + logPath.extension().string());
+					std::filesystem::rename(logPath, prevLogPath);
+					PONY_LOG(context.Logger(), LogType::Info, "JSON lines log file path: '{}'; Old JSON lines log file path: '{}'.", logPath.string(), prevLogPath.string());
+				}
+				else
+				{
+					std::filesystem::create_directories(logPath.parent_path());
+					PONY_LOG(context.Logger(), LogType::Info, "JSON lines log file path: '{}'.", logPath.string());
+				}
+
+				return std::make_shared<JsonFileSubLogger>(loggerContext, JsonFileSubLoggerParams{.path = logPath});
+			});
+		}
+		catch (...)
+		{
+#if PONY_ENGINE_LOG_FILE_BINARY
+			loggerModuleContext->RemoveSubLogger(binarySubLoggerHandle);
+#endif
+			loggerModuleContext->RemoveSubLogger(fileSubLoggerHandle);
+			throw;
+		}
+		PONY_LOG(context.Logger(), LogType::Info, "Constructing '{}' done.", typeid(JsonFileSubLogger).name());
+#endif
+
+#if PONY_ENGINE_LOG_FILE_RING
+		PONY_LOG(context.Logger(), LogType::Info, "Constructing '{}'...", typeid(RingFileSubLogger).name());
+		try
+		{
+			ringSubLoggerHandle = loggerModuleContext->AddSubLogger([&](ILoggerContext& loggerContext)
+			{
+				const std::filesystem::path logPath = (loggerContext.Application().LocalDataDirectory() / PONY_STRINGIFY_VALUE(PONY_ENGINE_LOG_FILE_RING_PATH)).lexically_normal();
+				if (std::filesystem::exists(logPath))
+				{
+					const std::filesystem::path prevLogPath = logPath.parent_path() / (logPath.stem().string() + "_prev" + logPath.extension().string());
+					std::filesystem::rename(logPath, prevLogPath);
+					PONY_LOG(context.Logger(), LogType::Info, "Log ring file path: '{}'; Old log ring file path: '{}'.", logPath.string(), prevLogPath.string());
+				}
+				else
+				{
+					std::filesystem::create_directories(logPath.parent_path());
+					PONY_LOG(context.Logger(), LogType::Info, "Log ring file path: '{}'.", logPath.string());
+				}
+				const auto params = RingFileSubLoggerParams
+				{
+					.path = logPath,
+					.slotCount = PONY_ENGINE_LOG_FILE_RING_SLOT_COUNT,
+					.slotSize = PONY_ENGINE_LOG_FILE_RING_SLOT_SIZE
+				};
+
+				return std::make_shared<RingFileSubLogger>(loggerContext, params);
+			});
+		}
+		catch (...)
+		{
+#if PONY_ENGINE_LOG_FILE_JSON
+			loggerModuleContext->RemoveSubLogger(jsonSubLoggerHandle);
+#endif
+#if PONY_ENGINE_LOG_FILE_BINARY
+			loggerModuleContext->RemoveSubLogger(binarySubLoggerHandle);
+#endif
+			loggerModuleContext->RemoveSubLogger(fileSubLoggerHandle);
+			throw;
+		}
+		PONY_LOG(context.Logger(), LogType::Info, "Constructing '{}' done.", typeid(RingFileSubLogger).name());
+#endif
 	}
 
 	void FileSubLoggerModule::ShutDown(Application::IModuleContext& context)
@@ -88,8 +237,26 @@ namespace PonyEngine::Log::File
 		}
 #endif
 
-		PONY_LOG(context.Logger(), LogType::Info, "Releasing '{}'...", typeid(FileSubLogger).name());
+#if PONY_ENGINE_LOG_FILE_RING
+		PONY_LOG(context.Logger(), LogType::Info, "Releasing '{}'...", typeid(RingFileSubLogger).name());
+		loggerModuleContext->RemoveSubLogger(ringSubLoggerHandle);
+		PONY_LOG(context.Logger(), LogType::Info, "Releasing '{}' done.", typeid(RingFileSubLogger).name());
+#endif
+
+#if PONY_ENGINE_LOG_FILE_JSON
+		PONY_LOG(context.Logger(), LogType::Info, "Releasing '{}'...", typeid(JsonFileSubLogger).name());
+		loggerModuleContext->RemoveSubLogger(jsonSubLoggerHandle);
+		PONY_LOG(context.Logger(), LogType::Info, "Releasing '{}' done.", typeid(JsonFileSubLogger).name());
+#endif
+
+#if PONY_ENGINE_LOG_FILE_BINARY
+		PONY_LOG(context.Logger(), LogType::Info, "Releasing '{}'...", typeid(BinaryFileSubLogger).name());
+		loggerModuleContext->RemoveSubLogger(binarySubLoggerHandle);
+		PONY_LOG(context.Logger(), LogType::Info, "Releasing '{}' done.", typeid(BinaryFileSubLogger).name());
+#endif
+
+		PONY_LOG(context.Logger(), LogType::Info, "Releasing '{}'...", typeid(SubLogger).name());
 		loggerModuleContext->RemoveSubLogger(fileSubLoggerHandle);
-		PONY_LOG(context.Logger(), LogType::Info, "Releasing '{}' done.", typeid(FileSubLogger).name());
+		PONY_LOG(context.Logger(), LogType::Info, "Releasing '{}' done.", typeid(SubLogger).name());
 	}
 }
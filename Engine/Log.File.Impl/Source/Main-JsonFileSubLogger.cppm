@@ -0,0 +1,126 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+module;
+
+#include "PonyEngine/Log/Console.h"
+
+export module PonyEngine.Log.File.Impl:JsonFileSubLogger;
+
+import std;
+
+import PonyEngine.Log.Ext;
+
+import :LogFile;
+
+export namespace PonyEngine::Log::File
+{
+	/// @brief JSON lines file sub-logger parameters.
+	struct JsonFileSubLoggerParams final
+	{
+		std::filesystem::path path; ///< JSON lines log file path.
+		std::size_t bufferSize = 256uz * 1024uz; ///< User-space buffer size in bytes.
+		std::chrono::milliseconds flushPeriod = std::chrono::milliseconds(1000); ///< Max time the data stays in the buffer. It's checked on every log.
+	};
+
+	/// @brief Sub-logger that writes logs to a file as JSON lines.
+	/// @details The records are encoded into a reusable buffer and written when the buffer is full, the flush period passes or an error is logged.
+	class JsonFileSubLogger final : public ISubLogger
+	{
+	public:
+		/// @brief Creates a JSON lines file sub-logger.
+		/// @param logger Logger context.
+		/// @param params Parameters.
+		[[nodiscard("Pure constructor")]]
+		JsonFileSubLogger(ILoggerContext& logger, const JsonFileSubLoggerParams& params);
+		JsonFileSubLogger(const JsonFileSubLogger&) = delete;
+		JsonFileSubLogger(JsonFileSubLogger&&) = delete;
+
+		~JsonFileSubLogger() noexcept;
+
+		virtual void Log(const LogEntry& logEntry) noexcept override;
+
+		JsonFileSubLogger& operator =(const JsonFileSubLogger&) = delete;
+		JsonFileSubLogger& operator =(JsonFileSubLogger&&) = delete;
+
+	private:
+		using Clock = std::chrono::steady_clock; ///< Clock of the flush period.
+
+		/// @brief Writes the buffer to the file.
+		/// @param now Current time.
+		void Flush(Clock::time_point now);
+
+		ILoggerContext* logger; ///< Logger context.
+
+		LogFile file; ///< JSON lines log file.
+		std::string buffer; ///< User-space buffer.
+		JsonLogWriter writer; ///< JSON lines log writer.
+		std::size_t bufferSize; ///< Buffer size that triggers a flush.
+		std::chrono::milliseconds flushPeriod; ///< Flush period.
+		Clock::time_point flushTime; ///< When the buffer was written last time.
+	};
+}
+
+namespace PonyEngine::Log::File
+{
+	JsonFileSubLogger::JsonFileSubLogger(ILoggerContext& logger, const JsonFileSubLoggerParams& params) :
+		logger{&logger},
+		file(params.path),
+		buffer(),
+		writer(buffer),
+		bufferSize{params.bufferSize},
+		flushPeriod{params.flushPeriod},
+		flushTime{Clock::now()}
+	{
+		buffer.reserve(bufferSize);
+	}
+
+	JsonFileSubLogger::~JsonFileSubLogger() noexcept
+	{
+		try
+		{
+			Flush(Clock::now());
+		}
+		catch (...)
+		{
+			PONY_CONSOLE_X(*logger, std::current_exception(), "On flushing JSON lines log file.");
+		}
+	}
+
+	void JsonFileSubLogger::Log(const LogEntry& logEntry) noexcept
+	{
+		try
+		{
+			writer.Write(logEntry);
+
+			const Clock::time_point now = Clock::now();
+			if (buffer.size() >= bufferSize || logEntry.logType == LogType::Error || logEntry.logType == LogType::Exception || now - flushTime >= flushPeriod)
+			{
+				Flush(now);
+			}
+		}
+		catch (...)
+		{
+			PONY_CONSOLE_X(*logger, std::current_exception(), "On writing to JSON lines log file.");
+		}
+	}
+
+	void JsonFileSubLogger::Flush(const Clock::time_point now)
+	{
+		flushTime = now;
+		if (buffer.empty())
+		{
+			return;
+		}
+
+		file.Write(std::array{std::as_bytes(std::span(buffer))});
+		buffer.clear();
+	}
+}
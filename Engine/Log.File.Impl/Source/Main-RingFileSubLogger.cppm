@@ -0,0 +1,88 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+module;
+
+#include "PonyEngine/Log/Console.h"
+
+export module PonyEngine.Log.File.Impl:RingFileSubLogger;
+
+import std;
+
+import PonyEngine.Log.Ext;
+
+import :LogMapping;
+
+export namespace PonyEngine::Log::File
+{
+	/// @brief Ring file sub-logger parameters.
+	struct RingFileSubLoggerParams final
+	{
+		std::filesystem::path path; ///< Log ring file path.
+		std::size_t slotCount = 65536uz; ///< Count of the last logs the ring keeps.
+		std::size_t slotSize = 256uz; ///< Slot size in bytes. Longer messages are truncated.
+	};
+
+	/// @brief Sub-logger that writes logs to a memory mapped log ring file.
+	/// @details Every log is a few stores to the mapped memory: there are no system calls and no allocations.
+	///          The kernel writes the pages to the file, so the last logs survive a crash or a kill of the process.
+	/// @note If the logger is asynchronous, the sub-logger gets the logs on the dispatcher thread, so the logs still queued at a kill aren't in the ring.
+	class RingFileSubLogger final : public ISubLogger
+	{
+	public:
+		/// @brief Creates a ring file sub-logger.
+		/// @param logger Logger context.
+		/// @param params Parameters.
+		[[nodiscard("Pure constructor")]]
+		RingFileSubLogger(ILoggerContext& logger, const RingFileSubLoggerParams& params);
+		RingFileSubLogger(const RingFileSubLogger&) = delete;
+		RingFileSubLogger(RingFileSubLogger&&) = delete;
+
+		~RingFileSubLogger() noexcept;
+
+		virtual void Log(const LogEntry& logEntry) noexcept override;
+
+		RingFileSubLogger& operator =(const RingFileSubLogger&) = delete;
+		RingFileSubLogger& operator =(RingFileSubLogger&&) = delete;
+
+	private:
+		ILoggerContext* logger; ///< Logger context.
+
+		LogMapping file; ///< Log ring file.
+		LogRingWriter writer; ///< Log ring writer.
+	};
+}
+
+namespace PonyEngine::Log::File
+{
+	RingFileSubLogger::RingFileSubLogger(ILoggerContext& logger, const RingFileSubLoggerParams& params) :
+		logger{&logger},
+		file(params.path, LogRingSize(params.slotCount, params.slotSize)),
+		writer(file.Data(), params.slotSize)
+	{
+	}
+
+	RingFileSubLogger::~RingFileSubLogger() noexcept
+	{
+		try
+		{
+			file.Flush();
+		}
+		catch (...)
+		{
+			PONY_CONSOLE_X(*logger, std::current_exception(), "On flushing log ring file.");
+		}
+	}
+
+	void RingFileSubLogger::Log(const LogEntry& logEntry) noexcept
+	{
+		writer.Write(logEntry);
+	}
+}
@@ -0,0 +1,510 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+module;
+
+#include "PonyEngine/Log/Console.h"
+
+export module PonyEngine.Log.File.Impl:RotatingFileSubLogger;
+
+import std;
+
+import PonyEngine.Log.Ext;
+import PonyEngine.Serialization;
+
+import :LogFile;
+
+export namespace PonyEngine::Log::File
+{
+	/// @brief When the log file data is written to the storage device.
+	enum class LogFileSyncPolicy : std::uint8_t
+	{
+		None, ///< The data is never synced explicitly. The OS writes it when it decides to.
+		OnError, ///< The data is synced after every error and exception log.
+		Periodic ///< The data is synced at most once per sync period if something was written.
+	};
+
+	/// @brief Rotating file sub-logger parameters.
+	struct RotatingFileSubLoggerParams final
+	{
+		std::filesystem::path path; ///< Active log file path. Rotated files are placed next to it.
+		std::size_t bufferSize = 1024uz * 1024uz; ///< User-space buffer size in bytes.
+		std::chrono::milliseconds flushPeriod = std::chrono::milliseconds(1000); ///< Max time the data stays in the buffer. It's checked on every log.
+		std::uint64_t rotationSize = 64ull * 1024ull * 1024ull; ///< Active file size that triggers a rotation. Zero disables size rotation.
+		std::chrono::seconds rotationPeriod = std::chrono::seconds(0); ///< Active file age that triggers a rotation. Zero disables time rotation.
+		std::size_t retentionCount = 8uz; ///< Max count of rotated files. Zero means no limit.
+		std::uint64_t retentionSize = 0ull; ///< Max total size of rotated files in bytes. Zero means no limit.
+		LogFileSyncPolicy syncPolicy = LogFileSyncPolicy::OnError; ///< Sync policy.
+		std::chrono::milliseconds syncPeriod = std::chrono::milliseconds(5000); ///< Sync period. It's used only with the periodic sync policy.
+		bool compress = false; ///< If it's @a true, rotated files are compressed into frames.
+	};
+
+	/// @brief Sub-logger that writes logs to a rotating file through a large user-space buffer.
+	/// @details Logs are collected in the buffer and written with a single gathered write when the buffer is full, the flush period passes
+	///          or an error is logged. When the active file becomes too large or too old, it's renamed to <tt><stem>.<index><extension></tt>
+	///          and a new active file is opened. Compression of rotated files and the retention clean-up run on a long-lived archiver thread,
+	///          so the logging thread never waits for them.
+	class RotatingFileSubLogger final : public ISubLogger
+	{
+	public:
+		/// @brief Creates a rotating file sub-logger.
+		/// @details If the active file exists and isn't empty, it's rotated first.
+		/// @param logger Logger context.
+		/// @param params Parameters.
+		[[nodiscard("Pure constructor")]]
+		RotatingFileSubLogger(ILoggerContext& logger, const RotatingFileSubLoggerParams& params);
+		RotatingFileSubLogger(const RotatingFileSubLogger&) = delete;
+		RotatingFileSubLogger(RotatingFileSubLogger&&) = delete;
+
+		~RotatingFileSubLogger() noexcept;
+
+		virtual void Log(const LogEntry& logEntry) noexcept override;
+
+		RotatingFileSubLogger& operator =(const RotatingFileSubLogger&) = delete;
+		RotatingFileSubLogger& operator =(RotatingFileSubLogger&&) = delete;
+
+	private:
+		using Clock = std::chrono::steady_clock; ///< Clock of the flush, sync and rotation periods.
+
+		/// @brief Rotated file.
+		struct RotatedFile final
+		{
+			std::filesystem::path path; ///< File path.
+			std::uint64_t index; ///< Rotation index.
+			std::uint64_t size; ///< File size.
+		};
+
+		/// @brief Appends the @p message to the buffer. If it doesn't fit, the buffer and the message are written to the file.
+		/// @param message Message.
+		void Append(std::span<const std::byte> message);
+		/// @brief Writes the buffer to the file.
+		/// @param now Current time.
+		void Flush(Clock::time_point now);
+		/// @brief Syncs the file.
+		/// @param now Current time.
+		void Sync(Clock::time_point now);
+		/// @brief Checks if the file must be rotated before the message is written.
+		/// @param messageSize Message size.
+		/// @param now Current time.
+		/// @return @a True if it must be rotated; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool ShouldRotate(std::size_t messageSize, Clock::time_point now) const noexcept;
+		/// @brief Rotates the active file and starts archiving the rotated one.
+		/// @param now Current time.
+		void Rotate(Clock::time_point now);
+		/// @brief Rotates the active file. If it fails, the error is logged and the active file stays.
+		/// @param now Current time.
+		void TryRotate(Clock::time_point now) noexcept;
+		/// @brief Opens the active file. The previous one is closed only if the new one is opened.
+		/// @param now Current time.
+		void Open(Clock::time_point now);
+		/// @brief Queues the rotated file to the archiver thread. It doesn't wait for the previous archiving.
+		/// @param rotatedPath Rotated file path.
+		void Archive(const std::filesystem::path& rotatedPath);
+		/// @brief Logs the archiving error if there's one.
+		void ReportArchiveError() noexcept;
+		/// @brief Archiver thread function. It compresses the queued files if it's required and applies the retention limits.
+		/// @details It archives all the queued files before it stops.
+		/// @param stopToken Stop token.
+		void RunArchiver(std::stop_token stopToken) noexcept;
+
+		/// @brief Gets rotated files.
+		/// @return Rotated files sorted by index from the newest.
+		[[nodiscard("Pure function")]]
+		std::vector<RotatedFile> RotatedFiles() const;
+		/// @brief Removes the oldest rotated files that exceed the retention limits.
+		void ApplyRetention() const;
+
+		/// @brief Compresses the file into <tt><path>.lz</tt> and removes the source file.
+		/// @param path File path.
+		static void Compress(const std::filesystem::path& path);
+
+		ILoggerContext* logger; ///< Logger context.
+		RotatingFileSubLoggerParams params; ///< Parameters.
+
+		LogFile file; ///< Active log file.
+		std::unique_ptr<std::byte[]> buffer; ///< User-space buffer.
+		std::size_t bufferedSize; ///< Size of the data in the buffer.
+		std::uint64_t rotationIndex; ///< Index of the last rotated file.
+		Clock::time_point openTime; ///< When the active file was opened.
+		Clock::time_point flushTime; ///< When the buffer was written last time.
+		Clock::time_point syncTime; ///< When the file was synced last time.
+		bool isSynced; ///< Is all the written data synced?
+
+		std::deque<std::filesystem::path> archiveQueue; ///< Rotated files to archive. It's guarded by the archive mutex.
+		std::exception_ptr archiveError; ///< Last archiving error. It's guarded by the archive mutex.
+		std::mutex archiveMutex; ///< Archive mutex.
+		std::condition_variable_any archiveCondition; ///< Archive queue condition.
+		std::jthread archiver; ///< Archiver thread. It must be the last member.
+	};
+}
+
+namespace PonyEngine::Log::File
+{
+	constexpr std::string_view CompressedExtension = ".lz"; ///< Extension added to compressed rotated files.
+	constexpr std::string_view TemporaryExtension = ".tmp"; ///< Extension of a compressed file that is being written.
+	constexpr std::size_t RotationIndexWidth = 6uz; ///< Min count of digits in a rotation index.
+
+	RotatingFileSubLogger::RotatingFileSubLogger(ILoggerContext& logger, const RotatingFileSubLoggerParams& params) :
+		logger{&logger},
+		params(params),
+		buffer(std::make_unique_for_overwrite<std::byte[]>(params.bufferSize)),
+		bufferedSize{0uz},
+		rotationIndex{0ull},
+		isSynced{true},
+		archiver([this](const std::stop_token stopToken) { RunArchiver(stopToken); })
+	{
+#ifndef NDEBUG
+		if (params.bufferSize == 0uz) [[unlikely]]
+		{
+			throw std::invalid_argument("Buffer size is zero");
+		}
+#endif
+
+		if (const std::vector<RotatedFile> rotatedFiles = RotatedFiles(); !rotatedFiles.empty())
+		{
+			rotationIndex = rotatedFiles.front().index;
+		}
+
+		const Clock::time_point now = Clock::now();
+		Open(now);
+		if (file.Size() > 0ull)
+		{
+			TryRotate(now);
+		}
+	}
+
+	RotatingFileSubLogger::~RotatingFileSubLogger() noexcept
+	{
+		try
+		{
+			const Clock::time_point now = Clock::now();
+			Flush(now);
+			if (params.syncPolicy != LogFileSyncPolicy::None && !isSynced)
+			{
+				Sync(now);
+			}
+		}
+		catch (...)
+		{
+			PONY_CONSOLE_X(*logger, std::current_exception(), "On flushing log file.");
+		}
+
+		archiver.request_stop();
+		archiver.join();
+		ReportArchiveError();
+	}
+
+	void RotatingFileSubLogger::Log(const LogEntry& logEntry) noexcept
+	{
+		try
+		{
+			const Clock::time_point now = Clock::now();
+			const std::span<const std::byte> message = std::as_bytes(std::span(logEntry.formattedMessage));
+			if (ShouldRotate(message.size(), now)) [[unlikely]]
+			{
+				TryRotate(now);
+			}
+
+			Append(message);
+
+			const bool isError = logEntry.logType == LogType::Error || logEntry.logType == LogType::Exception;
+			if (isError || now - flushTime >= params.flushPeriod)
+			{
+				Flush(now);
+			}
+			if (!isSynced &&
+				((params.syncPolicy == LogFileSyncPolicy::OnError && isError) || (params.syncPolicy == LogFileSyncPolicy::Periodic && now - syncTime >= params.syncPeriod)))
+			{
+				Sync(now);
+			}
+		}
+		catch (...)
+		{
+			PONY_CONSOLE_X(*logger, std::current_exception(), "On writing to log file.");
+		}
+	}
+
+	void RotatingFileSubLogger::Append(const std::span<const std::byte> message)
+	{
+		if (message.size() <= params.bufferSize - bufferedSize) [[likely]]
+		{
+			std::ranges::copy(message, buffer.get() + bufferedSize);
+			bufferedSize += message.size();
+
+			return;
+		}
+
+		if (message.size() < params.bufferSize)
+		{
+			file.Write(std::array{std::span<const std::byte>(buffer.get(), bufferedSize)});
+			std::ranges::copy(message, buffer.get());
+			bufferedSize = message.size();
+		}
+		else
+		{
+			file.Write(std::array{std::span<const std::byte>(buffer.get(), bufferedSize), message});
+			bufferedSize = 0uz;
+		}
+		isSynced = false;
+	}
+
+	void RotatingFileSubLogger::Flush(const Clock::time_point now)
+	{
+		flushTime = now;
+		if (bufferedSize == 0uz)
+		{
+			return;
+		}
+
+		file.Write(std::array{std::span<const std::byte>(buffer.get(), bufferedSize)});
+		bufferedSize = 0uz;
+		isSynced = false;
+	}
+
+	void RotatingFileSubLogger::Sync(const Clock::time_point now)
+	{
+		file.Sync();
+		syncTime = now;
+		isSynced = true;
+	}
+
+	bool RotatingFileSubLogger::ShouldRotate(const std::size_t messageSize, const Clock::time_point now) const noexcept
+	{
+		const std::uint64_t size = file.Size() + bufferedSize;
+		if (size == 0ull)
+		{
+			return false;
+		}
+
+		return (params.rotationSize > 0ull && size + messageSize > params.rotationSize) ||
+			(params.rotationPeriod > std::chrono::seconds::zero() && now - openTime >= params.rotationPeriod);
+	}
+
+	void RotatingFileSubLogger::Rotate(const Clock::time_point now)
+	{
+		Flush(now);
+		if (params.syncPolicy != LogFileSyncPolicy::None && !isSynced)
+		{
+			Sync(now);
+		}
+
+		// The active file stays open until the new one is opened, so the logs keep going to it if the rotation fails.
+		const std::filesystem::path rotatedPath = params.path.parent_path() /
+			std::format("{}.{:0{}}{}", params.path.stem().string(), rotationIndex + 1ull, RotationIndexWidth, params.path.extension().string());
+		std::filesystem::rename(params.path, rotatedPath);
+		try
+		{
+			Open(now);
+		}
+		catch (...)
+		{
+			std::error_code error;
+			std::filesystem::rename(rotatedPath, params.path, error);
+			throw;
+		}
+		++rotationIndex;
+
+		Archive(rotatedPath);
+	}
+
+	void RotatingFileSubLogger::TryRotate(const Clock::time_point now) noexcept
+	{
+		try
+		{
+			Rotate(now);
+		}
+		catch (...)
+		{
+			PONY_CONSOLE_X(*logger, std::current_exception(), "On rotating log file.");
+		}
+	}
+
+	void RotatingFileSubLogger::Open(const Clock::time_point now)
+	{
+		file = LogFile(params.path);
+		openTime = now;
+		flushTime = now;
+		syncTime = now;
+		isSynced = true;
+	}
+
+	void RotatingFileSubLogger::Archive(const std::filesystem::path& rotatedPath)
+	{
+		ReportArchiveError();
+
+		{
+			const auto lock = std::lock_guard(archiveMutex);
+			archiveQueue.push_back(rotatedPath);
+		}
+		archiveCondition.notify_one();
+	}
+
+	void RotatingFileSubLogger::ReportArchiveError() noexcept
+	{
+		std::exception_ptr error;
+		{
+			const auto lock = std::lock_guard(archiveMutex);
+			error = std::exchange(archiveError, nullptr);
+		}
+
+		if (error) [[unlikely]]
+		{
+			PONY_CONSOLE_X(*logger, error, "On archiving rotated log file.");
+		}
+	}
+
+	void RotatingFileSubLogger::RunArchiver(const std::stop_token stopToken) noexcept
+	{
+		auto lock = std::unique_lock(archiveMutex);
+		while (true)
+		{
+			if (!archiveCondition.wait(lock, stopToken, [&] { return !archiveQueue.empty(); }))
+			{
+				break;
+			}
+
+			const std::filesystem::path rotatedPath = std::move(archiveQueue.front());
+			archiveQueue.pop_front();
+			lock.unlock();
+
+			std::exception_ptr error;
+			try
+			{
+				// The retention of a later rotation may have already removed the file.
+				if (params.compress && std::filesystem::exists(rotatedPath))
+				{
+					Compress(rotatedPath);
+				}
+				ApplyRetention();
+			}
+			catch (...)
+			{
+				error = std::current_exception();
+			}
+
+			lock.lock();
+			if (error) [[unlikely]]
+			{
+				archiveError = error;
+			}
+		}
+	}
+
+	std::vector<RotatingFileSubLogger::RotatedFile> RotatingFileSubLogger::RotatedFiles() const
+	{
+		const std::string prefix = params.path.stem().string() + '.';
+		const std::string extension = params.path.extension().string();
+
+		auto rotatedFiles = std::vector<RotatedFile>();
+		const std::filesystem::path directory = params.path.parent_path();
+		if (!std::filesystem::exists(directory))
+		{
+			return rotatedFiles;
+		}
+
+		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(directory))
+		{
+			if (!entry.is_regular_file())
+			{
+				continue;
+			}
+
+			const std::string fileName = entry.path().filename().string();
+			std::string_view name = fileName;
+			if (!name.starts_with(prefix))
+			{
+				continue;
+			}
+			name.remove_prefix(prefix.size());
+			if (name.ends_with(CompressedExtension))
+			{
+				name.remove_suffix(CompressedExtension.size());
+			}
+			if (!name.ends_with(extension))
+			{
+				continue;
+			}
+			name.remove_suffix(extension.size());
+
+			std::uint64_t index;
+			if (const auto [end, error] = std::from_chars(name.data(), name.data() + name.size(), index); name.empty() || error != std::errc() || end != name.data() + name.size())
+			{
+				continue;
+			}
+
+			rotatedFiles.push_back(RotatedFile{.path = entry.path(), .index = index, .size = entry.file_size()});
+		}
+		std::ranges::sort(rotatedFiles, std::ranges::greater(), &RotatedFile::index);
+
+		return rotatedFiles;
+	}
+
+	void RotatingFileSubLogger::ApplyRetention() const
+	{
+		if (params.retentionCount == 0uz && params.retentionSize == 0ull)
+		{
+			return;
+		}
+
+		std::size_t count = 0uz;
+		std::uint64_t size = 0ull;
+		for (const RotatedFile& rotatedFile : RotatedFiles())
+		{
+			++count;
+			size += rotatedFile.size;
+			if ((params.retentionCount > 0uz && count > params.retentionCount) || (params.retentionSize > 0ull && size > params.retentionSize))
+			{
+				std::filesystem::remove(rotatedFile.path);
+			}
+		}
+	}
+
+	void RotatingFileSubLogger::Compress(const std::filesystem::path& path)
+	{
+		auto compressed = std::vector<std::byte>();
+		{
+			auto input = std::ifstream(path, std::ios::binary);
+			if (!input.is_open()) [[unlikely]]
+			{
+				throw std::runtime_error(std::format("Failed to open rotated log file: Path = '{}'", path.string()));
+			}
+
+			auto writer = Serialization::CompressionFrameWriter(compressed);
+			const auto chunk = std::make_unique_for_overwrite<std::byte[]>(Serialization::DefaultCompressionBlockSize);
+			do
+			{
+				input.read(reinterpret_cast<char*>(chunk.get()), static_cast<std::streamsize>(Serialization::DefaultCompressionBlockSize));
+				writer.Write(std::span<const std::byte>(chunk.get(), static_cast<std::size_t>(input.gcount())));
+			} while (input);
+			if (input.bad()) [[unlikely]]
+			{
+				throw std::runtime_error(std::format("Failed to read rotated log file: Path = '{}'", path.string()));
+			}
+			writer.Finish();
+		}
+
+		std::filesystem::path compressedPath = path;
+		compressedPath += CompressedExtension;
+		std::filesystem::path temporaryPath = compressedPath;
+		temporaryPath += TemporaryExtension;
+		{
+			auto output = std::ofstream(temporaryPath, std::ios::binary | std::ios::trunc);
+			output.write(reinterpret_cast<const char*>(compressed.data()), static_cast<std::streamsize>(compressed.size()));
+			output.close();
+			if (!output) [[unlikely]]
+			{
+				throw std::runtime_error(std::format("Failed to write compressed log file: Path = '{}'", temporaryPath.string()));
+			}
+		}
+		std::filesystem::rename(temporaryPath, compressedPath);
+		std::filesystem::remove(path);
+	}
+}
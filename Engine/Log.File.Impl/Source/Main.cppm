@@ -11,4 +11,11 @@ export module PonyEngine.Log.File.Impl;
 
 export import PonyEngine.Log.Ext;
 
+export import :BinaryFileSubLogger;
+export import :FileSubLogger;
 export import :FileSubLoggerModule;
+export import :JsonFileSubLogger;
+export import :LogFile;
+export import :LogMapping;
+export import :RingFileSubLogger;
+export import :RotatingFileSubLogger;
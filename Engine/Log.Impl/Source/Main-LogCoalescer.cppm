@@ -0,0 +1,181 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+module;
+
+#include <cassert>
+
+export module PonyEngine.Log.Impl:LogCoalescer;
+
+import std;
+
+import PonyEngine.Log.Ext;
+
+import :LogFiller;
+
+export namespace PonyEngine::Log
+{
+	/// @brief Coalesces consecutive repeated logs.
+	/// @details A log repeats the previous one if it has the same type and message and has neither an exception nor structured fields.
+	///          Repeats aren't passed on; they're counted and reported with a single "repeated N times" log
+	///          when a different log comes, when the report period passes or when the logger is destroyed.
+	/// @note It's not thread-safe. The logger uses it under its log mutex.
+	class LogCoalescer final
+	{
+	public:
+		/// @brief Creates a log coalescer.
+		/// @param reportPeriod Max time between the first unreported repeat and its report. Zero disables coalescing.
+		[[nodiscard("Pure constructor")]]
+		explicit LogCoalescer(std::chrono::nanoseconds reportPeriod) noexcept;
+		LogCoalescer(const LogCoalescer&) = delete;
+		LogCoalescer(LogCoalescer&&) = delete;
+
+		~LogCoalescer() noexcept = default;
+
+		/// @brief Checks if the entry repeats the previous one.
+		/// @param entry Log entry.
+		/// @return @a True if it repeats; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool IsRepeat(const LogEntry& entry) const noexcept;
+		/// @brief Counts the repeated entry.
+		/// @param entry Log entry that repeats the previous one.
+		void CountRepeat(const LogEntry& entry) noexcept;
+		/// @brief Remembers the entry as the previous one. The repeat count must be reported before.
+		/// @param entry Log entry.
+		void Remember(const LogEntry& entry) noexcept;
+
+		/// @brief Gets the count of the unreported repeats.
+		/// @return Unreported repeat count.
+		[[nodiscard("Pure function")]]
+		std::uint64_t RepeatCount() const noexcept;
+		/// @brief Gets the total count of the coalesced repeats.
+		/// @return Coalesced repeat count.
+		[[nodiscard("Pure function")]]
+		std::uint64_t CoalescedCount() const noexcept;
+		/// @brief Checks if the unreported repeats must be reported because the report period has passed.
+		/// @param timePoint Current time.
+		/// @return @a True if the report is due; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool IsReportDue(std::chrono::time_point<std::chrono::system_clock> timePoint) const noexcept;
+
+		/// @brief Fills the report of the unreported repeats and resets their count. The repeat count must be greater than 0.
+		/// @param targetEntry Report entry.
+		/// @param targetString Report text target.
+		void FillReport(LogEntry& targetEntry, std::string& targetString) noexcept;
+
+		LogCoalescer& operator =(const LogCoalescer&) = delete;
+		LogCoalescer& operator =(LogCoalescer&&) = delete;
+
+	private:
+		static constexpr std::string_view ReportFormat = "Previous message repeated {} times."; ///< Report format.
+		static constexpr std::string_view ReportAllocationError = "Previous message repeated."; ///< Report message if its formatting failed.
+
+		std::chrono::nanoseconds reportPeriod; ///< Report period.
+
+		std::string previousMessage; ///< Previous log message.
+		LogType previousLogType; ///< Previous log type.
+		bool hasPrevious; ///< Is there a previous log that can be repeated?
+
+		std::uint64_t repeatCount; ///< Unreported repeat count.
+		std::uint64_t coalescedCount; ///< Total coalesced repeat count.
+		std::chrono::time_point<std::chrono::system_clock> firstRepeatTime; ///< Time of the first unreported repeat.
+		std::chrono::time_point<std::chrono::system_clock> lastRepeatTime; ///< Time of the last unreported repeat.
+		std::uint64_t lastRepeatFrame; ///< Frame of the last unreported repeat.
+	};
+}
+
+namespace PonyEngine::Log
+{
+	LogCoalescer::LogCoalescer(const std::chrono::nanoseconds reportPeriod) noexcept :
+		reportPeriod{reportPeriod},
+		previousLogType{LogType::Verbose},
+		hasPrevious{false},
+		repeatCount{0ull},
+		coalescedCount{0ull},
+		lastRepeatFrame{0ull}
+	{
+	}
+
+	bool LogCoalescer::IsRepeat(const LogEntry& entry) const noexcept
+	{
+		return hasPrevious && !entry.exception && entry.fields.empty() && entry.logType == previousLogType && entry.message == previousMessage;
+	}
+
+	void LogCoalescer::CountRepeat(const LogEntry& entry) noexcept
+	{
+		if (repeatCount == 0ull)
+		{
+			firstRepeatTime = entry.timePoint;
+		}
+		++repeatCount;
+		++coalescedCount;
+		lastRepeatTime = entry.timePoint;
+		lastRepeatFrame = entry.frameCount;
+	}
+
+	void LogCoalescer::Remember(const LogEntry& entry) noexcept
+	{
+		assert(repeatCount == 0ull && "The repeats haven't been reported.");
+
+		hasPrevious = false;
+		if (reportPeriod <= std::chrono::nanoseconds::zero() || entry.exception || !entry.fields.empty())
+		{
+			return;
+		}
+
+		try
+		{
+			previousMessage.assign(entry.message);
+			previousLogType = entry.logType;
+			hasPrevious = true;
+		}
+		catch (...)
+		{
+			// Coalescing is skipped for this log.
+		}
+	}
+
+	std::uint64_t LogCoalescer::RepeatCount() const noexcept
+	{
+		return repeatCount;
+	}
+
+	std::uint64_t LogCoalescer::CoalescedCount() const noexcept
+	{
+		return coalescedCount;
+	}
+
+	bool LogCoalescer::IsReportDue(const std::chrono::time_point<std::chrono::system_clock> timePoint) const noexcept
+	{
+		return repeatCount > 0ull && timePoint - firstRepeatTime >= reportPeriod;
+	}
+
+	void LogCoalescer::FillReport(LogEntry& targetEntry, std::string& targetString) noexcept
+	{
+		assert(repeatCount > 0ull && "There's nothing to report.");
+
+		targetEntry.timePoint = lastRepeatTime;
+		targetEntry.frameCount = lastRepeatFrame;
+		targetEntry.logType = previousLogType;
+
+		try
+		{
+			targetString.clear();
+			targetEntry.message = FillText(targetString, previousLogType, lastRepeatTime, lastRepeatFrame, ReportFormat, std::make_format_args(repeatCount));
+			targetEntry.formattedMessage = targetString;
+		}
+		catch (...)
+		{
+			targetEntry.message = ReportAllocationError;
+			targetEntry.formattedMessage = targetEntry.message;
+		}
+
+		repeatCount = 0ull;
+	}
+}
@@ -0,0 +1,585 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+export module PonyEngine.Log.Impl:LogDispatcher;
+
+import std;
+
+import PonyEngine.Memory;
+import PonyEngine.Type;
+
+import :LogRecord;
+
+export namespace PonyEngine::Log
+{
+	/// @brief What a logging thread does if its log queue is full.
+	enum class LogOverflowPolicy : std::uint8_t
+	{
+		Block, ///< Wait till there's space in the queue.
+		Drop ///< Drop the log.
+	};
+
+	/// @brief Log dispatcher parameters.
+	struct LogDispatcherParams final
+	{
+		std::size_t queueSize = 1024uz; ///< Log queue size of each logging thread in records. It's rounded up to a power of two.
+		LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Block; ///< Overflow policy.
+		std::chrono::milliseconds repeatReportPeriod = std::chrono::milliseconds(1000); ///< Max time between the first coalesced repeat of a log and its report. Zero disables coalescing.
+		bool flushErrors = true; ///< If it's @a true, error and exception logs wait till they're passed to the sub-loggers.
+	};
+
+	/// @brief Log dispatcher.
+	/// @details Each logging thread pushes records into its own wait-free queue, so logging threads never contend with each other.
+	///          A background thread merges the queues by the record time and passes the records to the handler in batches.
+	///          Records of the same thread are handled in the order they're pushed in.
+	///          Records of different threads are handled in the time order only if they're in the queues at the same time:
+	///          a record pushed after a delay may be handled after a record of another thread with a later time.
+	class LogDispatcher final
+	{
+	public:
+		/// @brief Record handler. It's called on the dispatcher thread only.
+		using Handler = Type::InplaceFunction<void(std::span<LogRecord> records) noexcept>;
+		/// @brief Idle handler. It's called on the dispatcher thread only.
+		using IdleHandler = Type::InplaceFunction<void() noexcept>;
+
+		/// @brief Creates a log dispatcher and starts its thread.
+		/// @param params Dispatcher parameters.
+		/// @param handler Record handler.
+		/// @param idleHandler Idle handler. It's called when the queues are empty, at least once per sleep period. It may be empty.
+		[[nodiscard("Pure constructor")]]
+		LogDispatcher(const LogDispatcherParams& params, Handler&& handler, IdleHandler&& idleHandler = nullptr);
+		LogDispatcher(const LogDispatcher&) = delete;
+		LogDispatcher(LogDispatcher&&) = delete;
+
+		/// @brief Handles the rest of the records and stops the thread.
+		~LogDispatcher() noexcept;
+
+		/// @brief Gets the total capacity of the thread queues.
+		/// @return Queue capacity.
+		[[nodiscard("Pure function")]]
+		std::size_t QueueCapacity() const noexcept;
+		/// @brief Gets the queued record count.
+		/// @return Queued record count. It's only a snapshot.
+		[[nodiscard("Pure function")]]
+		std::size_t QueueSize() const noexcept;
+		/// @brief Gets the dropped record count.
+		/// @return Dropped record count.
+		[[nodiscard("Pure function")]]
+		std::uint64_t DroppedCount() const noexcept;
+		/// @brief Gets the count of records that waited for space in the queue.
+		/// @return Blocked record count.
+		[[nodiscard("Pure function")]]
+		std::uint64_t BlockedCount() const noexcept;
+
+		/// @brief Pushes the @p record into the queue of the current thread.
+		/// @details The first push of a thread registers its queue. If the queue is full, the overflow policy is applied.
+		///          A record pushed by the dispatcher thread itself is dropped in that case.
+		/// @param record Record.
+		/// @note The function is thread-safe.
+		void Push(LogRecord&& record) noexcept;
+		/// @brief Waits till all the records pushed before the call are handled.
+		/// @note The function is thread-safe. It does nothing if it's called on the dispatcher thread.
+		void Flush() noexcept;
+
+		LogDispatcher& operator =(const LogDispatcher&) = delete;
+		LogDispatcher& operator =(LogDispatcher&&) = delete;
+
+	private:
+		static constexpr std::size_t BatchSize = 64uz; ///< Max record count handled at once.
+		static constexpr std::size_t StageSize = 16uz; ///< Max record count popped from a thread queue at once.
+		static constexpr std::size_t SpinCount = 64uz; ///< How many times the dispatcher thread yields before it sleeps on empty queues.
+		static constexpr std::chrono::milliseconds SleepPeriod = std::chrono::milliseconds(50); ///< Max sleep time of the dispatcher thread.
+
+		/// @brief Log queue of a logging thread.
+		/// @details A queue is never removed while the dispatcher is alive. When its thread exits, the queue is given to the next new thread.
+		struct ThreadQueue final
+		{
+			/// @brief Creates a thread queue.
+			/// @param capacity Queue capacity.
+			[[nodiscard("Pure constructor")]]
+			explicit ThreadQueue(std::size_t capacity);
+			ThreadQueue(const ThreadQueue&) = delete;
+			ThreadQueue(ThreadQueue&&) = delete;
+
+			~ThreadQueue() noexcept = default;
+
+			/// @brief Checks if the queue has staged records.
+			/// @return @a True if it has; @a false otherwise.
+			/// @note Dispatcher function.
+			[[nodiscard("Pure function")]]
+			bool HasStaged() const noexcept;
+			/// @brief Gets the first staged record.
+			/// @return First staged record.
+			/// @note Dispatcher function.
+			[[nodiscard("Pure function")]]
+			LogRecord& Front() noexcept;
+			/// @brief Pops records from the ring to the staging.
+			/// @note Dispatcher function.
+			void Stage() noexcept;
+			/// @brief Marks the @p count records as handled.
+			/// @param count Record count.
+			void Process(std::uint64_t count) noexcept;
+
+			ThreadQueue& operator =(const ThreadQueue&) = delete;
+			ThreadQueue& operator =(ThreadQueue&&) = delete;
+
+			Memory::SPSCRing<LogRecord> ring; ///< Record ring. The owner thread pushes, the dispatcher thread pops.
+			alignas(Memory::CacheLineSize) std::atomic<std::uint64_t> pushedCount; ///< Count of the records pushed into the ring. It's written by the owner thread only.
+			alignas(Memory::CacheLineSize) std::atomic<std::uint64_t> processedCount; ///< Count of the handled records.
+			std::atomic<bool> isOwned; ///< Is the queue owned by a thread?
+			ThreadQueue* next; ///< Next registered queue. It's immutable after the registration.
+
+			alignas(Memory::CacheLineSize) std::vector<LogRecord> staged; ///< Records popped from the ring but not handled yet. It's used by the dispatcher thread only.
+			std::size_t stagedBegin; ///< First staged record index.
+			std::size_t stagedEnd; ///< Staged record end index.
+			std::uint64_t takenCount; ///< Count of the records taken into the current batch.
+		};
+
+		/// @brief Queues of the current thread by dispatcher IDs.
+		class ThreadQueueCache final
+		{
+		public:
+			[[nodiscard("Pure constructor")]]
+			ThreadQueueCache() noexcept = default;
+			ThreadQueueCache(const ThreadQueueCache&) = delete;
+			ThreadQueueCache(ThreadQueueCache&&) = delete;
+
+			/// @brief Releases the queues, so they can be given to other threads.
+			~ThreadQueueCache() noexcept;
+
+			/// @brief Finds a queue.
+			/// @param dispatcherId Dispatcher ID.
+			/// @return Queue or nullptr if it's not found.
+			[[nodiscard("Pure function")]]
+			ThreadQueue* Find(std::uint64_t dispatcherId) const noexcept;
+			/// @brief Adds a queue. The queues of destroyed dispatchers are removed.
+			/// @param dispatcherId Dispatcher ID.
+			/// @param queue Queue.
+			void Add(std::uint64_t dispatcherId, const std::shared_ptr<ThreadQueue>& queue);
+
+			ThreadQueueCache& operator =(const ThreadQueueCache&) = delete;
+			ThreadQueueCache& operator =(ThreadQueueCache&&) = delete;
+
+		private:
+			std::vector<std::pair<std::uint64_t, std::shared_ptr<ThreadQueue>>> queues; ///< Queues by dispatcher IDs.
+		};
+
+		/// @brief Dispatcher thread function.
+		/// @param stopToken Stop token.
+		void Run(std::stop_token stopToken) noexcept;
+		/// @brief Merges the staged records into the batch by their time.
+		/// @details It's a k-way merge over a heap of the thread queues, so a record costs O(log(thread count)).
+		/// @return Batch record count.
+		[[nodiscard("Must use the result")]]
+		std::size_t Merge() noexcept;
+		/// @brief Marks the records taken into the batch as processed.
+		void Process() noexcept;
+		/// @brief Checks if any queue has records.
+		/// @return @a True if there are records; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool HasRecords() const noexcept;
+		/// @brief Wakes the dispatcher thread if it sleeps.
+		void Wake() noexcept;
+
+		/// @brief Gets the queue of the current thread. It's registered if it's the first call on the thread.
+		/// @return Queue or nullptr if it failed to register.
+		[[nodiscard("Must use the result")]]
+		ThreadQueue* GetThreadQueue() noexcept;
+		/// @brief Registers a queue of the current thread.
+		/// @return Queue.
+		ThreadQueue& RegisterThreadQueue();
+
+		inline static std::atomic<std::uint64_t> nextId = 0ull; ///< Next dispatcher ID.
+		inline static thread_local ThreadQueueCache threadQueues; ///< Queues of the current thread.
+
+		std::uint64_t id; ///< Dispatcher ID.
+		std::size_t queueSize; ///< Thread queue size.
+		std::vector<std::shared_ptr<ThreadQueue>> queues; ///< Registered queues. It's guarded by the queue mutex.
+		std::mutex queueMutex; ///< Queue registration mutex.
+		std::atomic<ThreadQueue*> queueHead; ///< Last registered queue. The queues are linked, so they can be iterated without locking.
+		std::atomic<std::size_t> queueCount; ///< Registered queue count.
+
+		std::vector<LogRecord> batch; ///< Record batch. It's used by the dispatcher thread only.
+		std::vector<ThreadQueue*> mergeHeap; ///< Heap of the queues with staged records. It's used by the dispatcher thread only.
+		Handler handler; ///< Record handler.
+		IdleHandler idleHandler; ///< Idle handler.
+		LogOverflowPolicy overflowPolicy; ///< Overflow policy.
+
+		alignas(Memory::CacheLineSize) std::atomic<std::uint64_t> droppedCount; ///< Dropped record count.
+		std::atomic<std::uint64_t> blockedCount; ///< Count of the records that waited for space in the queue.
+		alignas(Memory::CacheLineSize) std::atomic<bool> isSleeping; ///< Is the dispatcher thread sleeping or going to sleep?
+		std::mutex wakeMutex; ///< Wake mutex.
+		std::condition_variable_any wakeCondition; ///< Wake condition.
+
+		std::jthread thread; ///< Dispatcher thread. It must be the last member.
+	};
+}
+
+namespace PonyEngine::Log
+{
+	LogDispatcher::LogDispatcher(const LogDispatcherParams& params, Handler&& handler, IdleHandler&& idleHandler) :
+		id{nextId.fetch_add(1ull, std::memory_order::relaxed)},
+		queueSize{params.queueSize},
+		queueHead(nullptr),
+		queueCount(0uz),
+		batch(BatchSize),
+		handler(std::move(handler)),
+		idleHandler(std::move(idleHandler)),
+		overflowPolicy{params.overflowPolicy},
+		droppedCount(0ull),
+		blockedCount(0ull),
+		isSleeping(false),
+		thread([this](const std::stop_token stopToken) { Run(stopToken); })
+	{
+	}
+
+	LogDispatcher::~LogDispatcher() noexcept
+	{
+		thread.request_stop();
+		thread.join();
+	}
+
+	std::size_t LogDispatcher::QueueCapacity() const noexcept
+	{
+		std::size_t capacity = 0uz;
+		for (const ThreadQueue* queue = queueHead.load(std::memory_order::acquire); queue; queue = queue->next)
+		{
+			capacity += queue->ring.Capacity();
+		}
+
+		return capacity;
+	}
+
+	std::size_t LogDispatcher::QueueSize() const noexcept
+	{
+		std::size_t size = 0uz;
+		for (const ThreadQueue* queue = queueHead.load(std::memory_order::acquire); queue; queue = queue->next)
+		{
+			size += queue->ring.Size();
+		}
+
+		return size;
+	}
+
+	std::uint64_t LogDispatcher::DroppedCount() const noexcept
+	{
+		return droppedCount.load(std::memory_order::relaxed);
+	}
+
+	std::uint64_t LogDispatcher::BlockedCount() const noexcept
+	{
+		return blockedCount.load(std::memory_order::relaxed);
+	}
+
+	void LogDispatcher::Push(LogRecord&& record) noexcept
+	{
+		ThreadQueue* const queue = GetThreadQueue();
+		if (!queue) [[unlikely]]
+		{
+			droppedCount.fetch_add(1ull, std::memory_order::relaxed);
+			return;
+		}
+
+		if (!queue->ring.TryPush(std::move(record))) [[unlikely]]
+		{
+			// A dropped record never enters the ring, so it doesn't touch the queue counts: a flush waits only for the records before it.
+			if (overflowPolicy == LogOverflowPolicy::Drop || std::this_thread::get_id() == thread.get_id())
+			{
+				droppedCount.fetch_add(1ull, std::memory_order::relaxed);
+				return;
+			}
+
+			blockedCount.fetch_add(1ull, std::memory_order::relaxed);
+			do
+			{
+				Wake();
+				std::this_thread::yield();
+			}
+			while (!queue->ring.TryPush(std::move(record)));
+		}
+
+		queue->pushedCount.store(queue->pushedCount.load(std::memory_order::relaxed) + 1ull, std::memory_order::release);
+		Wake();
+	}
+
+	void LogDispatcher::Flush() noexcept
+	{
+		if (std::this_thread::get_id() == thread.get_id())
+		{
+			return;
+		}
+
+		for (ThreadQueue* queue = queueHead.load(std::memory_order::acquire); queue; queue = queue->next)
+		{
+			const std::uint64_t target = queue->pushedCount.load(std::memory_order::acquire);
+			for (std::uint64_t processed = queue->processedCount.load(std::memory_order::acquire); processed < target; processed = queue->processedCount.load(std::memory_order::acquire))
+			{
+				Wake();
+				queue->processedCount.wait(processed, std::memory_order::acquire);
+			}
+		}
+	}
+
+	LogDispatcher::ThreadQueue::ThreadQueue(const std::size_t capacity) :
+		ring(capacity),
+		pushedCount(0ull),
+		processedCount(0ull),
+		isOwned(false),
+		next{nullptr},
+		staged(StageSize),
+		stagedBegin{0uz},
+		stagedEnd{0uz},
+		takenCount{0ull}
+	{
+	}
+
+	bool LogDispatcher::ThreadQueue::HasStaged() const noexcept
+	{
+		return stagedBegin < stagedEnd;
+	}
+
+	LogRecord& LogDispatcher::ThreadQueue::Front() noexcept
+	{
+		return staged[stagedBegin];
+	}
+
+	void LogDispatcher::ThreadQueue::Stage() noexcept
+	{
+		stagedBegin = 0uz;
+		stagedEnd = ring.TryPopBatch(staged);
+	}
+
+	void LogDispatcher::ThreadQueue::Process(const std::uint64_t count) noexcept
+	{
+		processedCount.fetch_add(count, std::memory_order::release);
+		processedCount.notify_all();
+	}
+
+	LogDispatcher::ThreadQueueCache::~ThreadQueueCache() noexcept
+	{
+		for (const auto& [dispatcherId, queue] : queues)
+		{
+			queue->isOwned.store(false, std::memory_order::release);
+		}
+	}
+
+	LogDispatcher::ThreadQueue* LogDispatcher::ThreadQueueCache::Find(const std::uint64_t dispatcherId) const noexcept
+	{
+		for (const auto& [queueDispatcherId, queue] : queues)
+		{
+			if (queueDispatcherId == dispatcherId)
+			{
+				return queue.get();
+			}
+		}
+
+		return nullptr;
+	}
+
+	void LogDispatcher::ThreadQueueCache::Add(const std::uint64_t dispatcherId, const std::shared_ptr<ThreadQueue>& queue)
+	{
+		// If the cache is the only owner, the dispatcher is destroyed.
+		std::erase_if(queues, [](const std::pair<std::uint64_t, std::shared_ptr<ThreadQueue>>& pair) { return pair.second.use_count() == 1l; });
+		queues.emplace_back(dispatcherId, queue);
+	}
+
+	void LogDispatcher::Run(const std::stop_token stopToken) noexcept
+	{
+		std::size_t spin = 0uz;
+		while (true)
+		{
+			if (const std::size_t count = Merge(); count > 0uz)
+			{
+				handler(std::span(batch.data(), count));
+				Process();
+				spin = 0uz;
+				continue;
+			}
+
+			if (stopToken.stop_requested())
+			{
+				break;
+			}
+
+			// Logs usually come in bursts, so a short spin saves producers from waking the thread on every log.
+			if (spin++ < SpinCount)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+			spin = 0uz;
+
+			if (idleHandler)
+			{
+				idleHandler();
+			}
+
+			isSleeping.store(true, std::memory_order::relaxed);
+			// Pairs with the fence in Wake(): either the producer sees the flag or the check below sees its record.
+			std::atomic_thread_fence(std::memory_order::seq_cst);
+			{
+				auto lock = std::unique_lock(wakeMutex);
+				wakeCondition.wait_for(lock, stopToken, SleepPeriod, [&] { return HasRecords(); });
+			}
+			isSleeping.store(false, std::memory_order::relaxed);
+		}
+	}
+
+	std::size_t LogDispatcher::Merge() noexcept
+	{
+		try
+		{
+			mergeHeap.reserve(queueCount.load(std::memory_order::acquire));
+		}
+		catch (...)
+		{
+			// The queues that don't fit are merged on the next passes.
+		}
+
+		mergeHeap.clear();
+		for (ThreadQueue* queue = queueHead.load(std::memory_order::acquire); queue && mergeHeap.size() < mergeHeap.capacity(); queue = queue->next)
+		{
+			if (!queue->HasStaged())
+			{
+				queue->Stage();
+			}
+			if (queue->HasStaged())
+			{
+				mergeHeap.push_back(queue);
+			}
+		}
+
+		// The heap front is the queue with the earliest staged record.
+		constexpr auto isLater = [](const ThreadQueue* const left, const ThreadQueue* const right) noexcept
+		{
+			return left->staged[left->stagedBegin].timePoint > right->staged[right->stagedBegin].timePoint;
+		};
+		std::ranges::make_heap(mergeHeap, isLater);
+
+		std::size_t count = 0uz;
+		while (count < BatchSize && !mergeHeap.empty())
+		{
+			std::ranges::pop_heap(mergeHeap, isLater);
+			ThreadQueue* const earliest = mergeHeap.back();
+
+			batch[count++] = std::move(earliest->Front());
+			++earliest->stagedBegin;
+			++earliest->takenCount;
+			if (!earliest->HasStaged())
+			{
+				earliest->Stage();
+			}
+
+			if (earliest->HasStaged())
+			{
+				std::ranges::push_heap(mergeHeap, isLater);
+			}
+			else
+			{
+				mergeHeap.pop_back();
+			}
+		}
+
+		return count;
+	}
+
+	void LogDispatcher::Process() noexcept
+	{
+		for (ThreadQueue* queue = queueHead.load(std::memory_order::acquire); queue; queue = queue->next)
+		{
+			if (queue->takenCount > 0ull)
+			{
+				queue->Process(queue->takenCount);
+				queue->takenCount = 0ull;
+			}
+		}
+	}
+
+	bool LogDispatcher::HasRecords() const noexcept
+	{
+		for (const ThreadQueue* queue = queueHead.load(std::memory_order::acquire); queue; queue = queue->next)
+		{
+			if (!queue->ring.IsEmpty())
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void LogDispatcher::Wake() noexcept
+	{
+		// The record is pushed with a release store, so the fence keeps the flag load from being reordered before it.
+		std::atomic_thread_fence(std::memory_order::seq_cst);
+		if (isSleeping.load(std::memory_order::relaxed))
+		{
+			{
+				// Taking the mutex guarantees that the dispatcher thread is either before its check or already waiting.
+				const auto lock = std::lock_guard(wakeMutex);
+			}
+			wakeCondition.notify_one();
+		}
+	}
+
+	LogDispatcher::ThreadQueue* LogDispatcher::GetThreadQueue() noexcept
+	{
+		if (ThreadQueue* const queue = threadQueues.Find(id)) [[likely]]
+		{
+			return queue;
+		}
+
+		try
+		{
+			return &RegisterThreadQueue();
+		}
+		catch (...)
+		{
+			return nullptr;
+		}
+	}
+
+	LogDispatcher::ThreadQueue& LogDispatcher::RegisterThreadQueue()
+	{
+		const auto lock = std::lock_guard(queueMutex);
+
+		std::shared_ptr<ThreadQueue> queue;
+		for (const std::shared_ptr<ThreadQueue>& registeredQueue : queues)
+		{
+			if (!registeredQueue->isOwned.load(std::memory_order::acquire))
+			{
+				queue = registeredQueue;
+				break;
+			}
+		}
+
+		if (!queue)
+		{
+			queue = std::make_shared<ThreadQueue>(queueSize);
+			queue->next = queueHead.load(std::memory_order::relaxed);
+			queues.push_back(queue);
+			queueHead.store(queue.get(), std::memory_order::release);
+			queueCount.store(queues.size(), std::memory_order::release);
+		}
+
+		queue->isOwned.store(true, std::memory_order::relaxed);
+		try
+		{
+			threadQueues.Add(id, queue);
+		}
+		catch (...)
+		{
+			queue->isOwned.store(false, std::memory_order::release);
+			throw;
+		}
+
+		return *queue;
+	}
+}
@@ -14,6 +14,7 @@ import std;
 import PonyEngine.Application.Ext;
 import PonyEngine.Log.Ext;
 
+import :LogRecord;
 import :LogTypeSymbol;
 
 using namespace std::literals::string_view_literals;
@@ -25,6 +26,12 @@ export namespace PonyEngine::Log
 	/// @param frameCount Frame count.
 	/// @param context Logger context.
 	void FillTime(std::chrono::time_point<std::chrono::system_clock>& timePoint, std::uint64_t& frameCount, const Application::ILoggerContext& context) noexcept;
+	/// @brief Fills a time data and the current thread.
+	/// @param timePoint Time point.
+	/// @param frameCount Frame count.
+	/// @param threadId Thread ID.
+	/// @param context Logger context.
+	void FillTime(std::chrono::time_point<std::chrono::system_clock>& timePoint, std::uint64_t& frameCount, std::thread::id& threadId, const Application::ILoggerContext& context) noexcept;
 
 	/// @brief Fills a log header.
 	/// @param target Log target.
@@ -44,6 +51,11 @@ export namespace PonyEngine::Log
 	/// @param formatArgs Log message format arguments.
 	/// @return Log message start and end indices in the target.
 	std::pair<std::size_t, std::size_t> FillMessage(std::string& target, std::string_view format, std::format_args formatArgs);
+	/// @brief Fills a log message.
+	/// @param target Log target.
+	/// @param message Deferred message.
+	/// @return Log message start and end indices in the target.
+	std::pair<std::size_t, std::size_t> FillMessage(std::string& target, const DeferredMessage& message);
 
 	/// @brief Fills a log message.
 	/// @param target Log target.
@@ -51,6 +63,16 @@ export namespace PonyEngine::Log
 	/// @return Log message start and end indices in the target.
 	std::pair<std::size_t, std::size_t> FillMessage(std::string& target, const std::optional<const std::exception*>& exception);
 
+	/// @brief Fills a stacktrace on its own lines.
+	/// @details The frames are symbolized via the shared symbol cache.
+	/// @param target Log target.
+	/// @param stacktrace Stacktrace.
+	void FillStacktrace(std::string& target, const std::stacktrace& stacktrace);
+	/// @brief Fills structured fields as " {key=value, ...}".
+	/// @param target Log target.
+	/// @param fields Structured fields. If it's empty, nothing is filled.
+	void FillFields(std::string& target, std::span<const LogField> fields);
+
 	/// @brief Fills a complete log text.
 	/// @param targetString Log target.
 	/// @param logType Log type.
@@ -91,6 +113,35 @@ export namespace PonyEngine::Log
 	/// @return Message view in the target string.
 	std::string_view FillText(std::string& targetString, LogType logType, std::chrono::time_point<std::chrono::system_clock> timePoint, std::uint64_t frameCount,
 		std::string_view format, std::format_args formatArgs, const std::stacktrace& stacktrace);
+	/// @brief Fills a complete log text.
+	/// @param targetString Log target.
+	/// @param logType Log type.
+	/// @param timePoint Time point.
+	/// @param frameCount Frame count.
+	/// @param message Deferred message.
+	/// @return Message view in the target string.
+	std::string_view FillText(std::string& targetString, LogType logType, std::chrono::time_point<std::chrono::system_clock> timePoint, std::uint64_t frameCount,
+		const DeferredMessage& message);
+	/// @brief Fills a complete log text.
+	/// @param targetString Log target.
+	/// @param logType Log type.
+	/// @param timePoint Time point.
+	/// @param frameCount Frame count.
+	/// @param message Deferred message.
+	/// @param stacktrace Stacktrace.
+	/// @return Message view in the target string.
+	std::string_view FillText(std::string& targetString, LogType logType, std::chrono::time_point<std::chrono::system_clock> timePoint, std::uint64_t frameCount,
+		const DeferredMessage& message, const std::stacktrace& stacktrace);
+	/// @brief Fills a complete log text.
+	/// @param targetString Log target.
+	/// @param logType Log type.
+	/// @param timePoint Time point.
+	/// @param frameCount Frame count.
+	/// @param message Log message.
+	/// @param fields Structured fields.
+	/// @return Message view in the target string. It doesn't include the fields.
+	std::string_view FillText(std::string& targetString, LogType logType, std::chrono::time_point<std::chrono::system_clock> timePoint, std::uint64_t frameCount,
+		std::string_view message, std::span<const LogField> fields);
 
 	/// @brief Fills a complete log text.
 	/// @param targetString Log target.
@@ -186,6 +237,32 @@ export namespace PonyEngine::Log
 	/// @param context Logger context.
 	void FillData(LogEntry& targetEntry, std::string& targetString, LogType logType, std::string_view format, std::format_args formatArgs, const std::stacktrace& stacktrace,
 		const Application::ILoggerContext& context) noexcept;
+	/// @brief Fills log data.
+	/// @param targetEntry Log entry.
+	/// @param targetString Log target.
+	/// @param logType Log type.
+	/// @param message Deferred message.
+	/// @param context Logger context.
+	void FillData(LogEntry& targetEntry, std::string& targetString, LogType logType, const DeferredMessage& message, 
+		const Application::ILoggerContext& context) noexcept;
+	/// @brief Fills log data.
+	/// @param targetEntry Log entry.
+	/// @param targetString Log target.
+	/// @param logType Log type.
+	/// @param message Deferred message.
+	/// @param stacktrace Stacktrace.
+	/// @param context Logger context.
+	void FillData(LogEntry& targetEntry, std::string& targetString, LogType logType, const DeferredMessage& message, const std::stacktrace& stacktrace,
+		const Application::ILoggerContext& context) noexcept;
+	/// @brief Fills log data.
+	/// @param targetEntry Log entry.
+	/// @param targetString Log target.
+	/// @param logType Log type.
+	/// @param message Log message.
+	/// @param fields Structured fields. They must outlive the entry.
+	/// @param context Logger context.
+	void FillData(LogEntry& targetEntry, std::string& targetString, LogType logType, std::string_view message, std::span<const LogField> fields,
+		const Application::ILoggerContext& context) noexcept;
 
 	/// @brief Fills log data.
 	/// @param targetEntry Log entry.
@@ -238,6 +315,71 @@ export namespace PonyEngine::Log
 	void FillData(LogEntry& targetEntry, std::string& targetString, const std::exception_ptr& exception, std::string_view format, std::format_args formatArgs,
 		const std::stacktrace& stacktrace, const Application::ILoggerContext& context) noexcept;
 
+	/// @brief Fills log data from the @p record.
+	/// @details The time and the frame are taken from the record. If the record is an exception log with an empty message, the exception is logged alone.
+	/// @param targetEntry Log entry.
+	/// @param targetString Log target.
+	/// @param targetFields Structured field target. It must outlive the entry.
+	/// @param record Log record. It must outlive the entry.
+	void FillData(LogEntry& targetEntry, std::string& targetString, std::vector<LogField>& targetFields, const LogRecord& record) noexcept;
+
+	/// @brief Fills a log record.
+	/// @param targetRecord Log record.
+	/// @param logType Log type.
+	/// @param message Log message.
+	/// @param stacktrace Stacktrace. May be nullptr.
+	/// @param context Logger context.
+	void FillRecord(LogRecord& targetRecord, LogType logType, std::string_view message, const std::stacktrace* stacktrace, 
+		const Application::ILoggerContext& context) noexcept;
+	/// @brief Fills a log record.
+	/// @details The message is formatted on the calling thread because the format arguments reference its data.
+	/// @param targetRecord Log record.
+	/// @param tempString Temporal string for the formatting.
+	/// @param logType Log type.
+	/// @param format Log message format.
+	/// @param formatArgs Log message format arguments.
+	/// @param stacktrace Stacktrace. May be nullptr.
+	/// @param context Logger context.
+	void FillRecord(LogRecord& targetRecord, std::string& tempString, LogType logType, std::string_view format, std::format_args formatArgs, const std::stacktrace* stacktrace, 
+		const Application::ILoggerContext& context) noexcept;
+	/// @brief Fills a log record.
+	/// @details The deferred message arguments are copied to the record, and the message is formatted when the record is logged.
+	/// @param targetRecord Log record.
+	/// @param logType Log type.
+	/// @param message Deferred message.
+	/// @param stacktrace Stacktrace. May be nullptr.
+	/// @param context Logger context.
+	void FillRecord(LogRecord& targetRecord, LogType logType, const DeferredMessage& message, const std::stacktrace* stacktrace, 
+		const Application::ILoggerContext& context) noexcept;
+	/// @brief Fills a log record with structured fields.
+	/// @details The keys and string values of the fields are copied to the record.
+	/// @param targetRecord Log record.
+	/// @param logType Log type.
+	/// @param message Log message.
+	/// @param fields Structured fields.
+	/// @param context Logger context.
+	void FillRecord(LogRecord& targetRecord, LogType logType, std::string_view message, std::span<const LogField> fields, 
+		const Application::ILoggerContext& context) noexcept;
+	/// @brief Fills an exception log record.
+	/// @param targetRecord Log record.
+	/// @param exception Exception.
+	/// @param message Log message. If it's empty, the exception is logged alone.
+	/// @param stacktrace Stacktrace. May be nullptr.
+	/// @param context Logger context.
+	void FillRecord(LogRecord& targetRecord, const std::exception_ptr& exception, std::string_view message, const std::stacktrace* stacktrace, 
+		const Application::ILoggerContext& context) noexcept;
+	/// @brief Fills an exception log record.
+	/// @details The message is formatted on the calling thread because the format arguments reference its data.
+	/// @param targetRecord Log record.
+	/// @param tempString Temporal string for the formatting.
+	/// @param exception Exception.
+	/// @param format Log message format.
+	/// @param formatArgs Log message format arguments.
+	/// @param stacktrace Stacktrace. May be nullptr.
+	/// @param context Logger context.
+	void FillRecord(LogRecord& targetRecord, std::string& tempString, const std::exception_ptr& exception, std::string_view format, std::format_args formatArgs, 
+		const std::stacktrace* stacktrace, const Application::ILoggerContext& context) noexcept;
+
 	/// @brief Fills log data.
 	/// @param targetString Log target.
 	/// @param logType Log type.
@@ -334,12 +476,38 @@ namespace PonyEngine::Log
 	constexpr std::string_view NullptrException = "Nullptr exception."; ///< Nullptr exception message.
 	constexpr std::string_view UnknownException = "Unknown exception"; ///< Unknown exception message.
 
+	/// @brief Fills a complete log text of the exception @p record.
+	/// @param targetString Log target.
+	/// @param record Log record.
+	/// @param exception Exception.
+	/// @return Message view in the target string.
+	std::string_view FillText(std::string& targetString, const LogRecord& record, const std::optional<const std::exception*>& exception);
+
+	/// @brief Fills a record message and stacktrace.
+	/// @param targetRecord Log record.
+	/// @param message Log message.
+	/// @param stacktrace Stacktrace. May be nullptr.
+	void FillRecordMessage(LogRecord& targetRecord, std::string_view message, const std::stacktrace* stacktrace);
+	/// @brief Fills a record message and stacktrace. If it fails, an allocation error message is set.
+	/// @param targetRecord Log record.
+	/// @param tempString Temporal string for the formatting.
+	/// @param format Log message format.
+	/// @param formatArgs Log message format arguments.
+	/// @param stacktrace Stacktrace. May be nullptr.
+	void FillRecordMessage(LogRecord& targetRecord, std::string& tempString, std::string_view format, std::format_args formatArgs, const std::stacktrace* stacktrace) noexcept;
+
 	void FillTime(std::chrono::time_point<std::chrono::system_clock>& timePoint, std::uint64_t& frameCount, const Application::ILoggerContext& context) noexcept
 	{
 		timePoint = std::chrono::system_clock::now();
 		frameCount = context.Application().FrameCount();
 	}
 
+	void FillTime(std::chrono::time_point<std::chrono::system_clock>& timePoint, std::uint64_t& frameCount, std::thread::id& threadId, const Application::ILoggerContext& context) noexcept
+	{
+		FillTime(timePoint, frameCount, context);
+		threadId = std::this_thread::get_id();
+	}
+
 	void FillHeader(std::string& target, const LogType logType, const std::chrono::time_point<std::chrono::system_clock> timePoint, const std::uint64_t frameCount)
 	{
 		std::format_to(std::back_inserter(target), "{}: [{:%F %R:%OS UTC} ({})]", GetLogTypeSymbol(logType), timePoint, frameCount);
@@ -374,6 +542,26 @@ namespace PonyEngine::Log
 		return std::pair(messageStartIndex, messageEndIndex);
 	}
 
+	std::pair<std::size_t, std::size_t> FillMessage(std::string& target, const DeferredMessage& message)
+	{
+		const std::size_t messageStartIndex = target.size();
+
+		try
+		{
+			message.FormatTo(target);
+		}
+		catch (...)
+		{
+			target.erase(target.cbegin() + messageStartIndex, target.cend());
+			target.append_range(FormatError);
+			target.append_range(message.Format());
+		}
+
+		const std::size_t messageEndIndex = target.size();
+
+		return std::pair(messageStartIndex, messageEndIndex);
+	}
+
 	std::pair<std::size_t, std::size_t> FillMessage(std::string& target, const std::optional<const std::exception*>& exception)
 	{
 		const std::size_t messageStartIndex = target.size();
@@ -397,6 +585,25 @@ namespace PonyEngine::Log
 		return std::pair(messageStartIndex, messageEndIndex);
 	}
 
+	void FillStacktrace(std::string& target, const std::stacktrace& stacktrace)
+	{
+		target.push_back('\n');
+		SymbolCache::Shared().Append(target, stacktrace);
+		target.push_back('\n');
+	}
+
+	void FillFields(std::string& target, const std::span<const LogField> fields)
+	{
+		for (std::size_t i = 0uz; i < fields.size(); ++i)
+		{
+			std::format_to(std::back_inserter(target), "{}{}", i == 0uz ? " {"sv : ", "sv, fields[i]);
+		}
+		if (!fields.empty())
+		{
+			target.push_back('}');
+		}
+	}
+
 	std::string_view FillText(std::string& targetString, const LogType logType, const std::chrono::time_point<std::chrono::system_clock> timePoint, const  std::uint64_t frameCount,
 		const std::string_view message)
 	{
@@ -425,7 +632,7 @@ namespace PonyEngine::Log
 		FillHeader(targetString, logType, timePoint, frameCount);
 		targetString.push_back(' ');
 		const auto [messageStartIndex, messageEndIndex] = FillMessage(targetString, message);
-		std::format_to(std::back_inserter(targetString), "\n{}\n", stacktrace);
+		FillStacktrace(targetString, stacktrace);
 
 		return std::string_view(&targetString[messageStartIndex], messageEndIndex - messageStartIndex);
 	}
@@ -436,7 +643,41 @@ namespace PonyEngine::Log
 		FillHeader(targetString, logType, timePoint, frameCount);
 		targetString.push_back(' ');
 		const auto [messageStartIndex, messageEndIndex] = FillMessage(targetString, format, formatArgs);
-		std::format_to(std::back_inserter(targetString), "\n{}\n", stacktrace);
+		FillStacktrace(targetString, stacktrace);
+
+		return std::string_view(&targetString[messageStartIndex], messageEndIndex - messageStartIndex);
+	}
+
+	std::string_view FillText(std::string& targetString, const LogType logType, const std::chrono::time_point<std::chrono::system_clock> timePoint, const std::uint64_t frameCount,
+		const DeferredMessage& message)
+	{
+		FillHeader(targetString, logType, timePoint, frameCount);
+		targetString.push_back(' ');
+		const auto [messageStartIndex, messageEndIndex] = FillMessage(targetString, message);
+		targetString.push_back('\n');
+
+		return std::string_view(&targetString[messageStartIndex], messageEndIndex - messageStartIndex);
+	}
+
+	std::string_view FillText(std::string& targetString, const LogType logType, const std::chrono::time_point<std::chrono::system_clock> timePoint, const std::uint64_t frameCount, 
+		const DeferredMessage& message, const std::stacktrace& stacktrace)
+	{
+		FillHeader(targetString, logType, timePoint, frameCount);
+		targetString.push_back(' ');
+		const auto [messageStartIndex, messageEndIndex] = FillMessage(targetString, message);
+		FillStacktrace(targetString, stacktrace);
+
+		return std::string_view(&targetString[messageStartIndex], messageEndIndex - messageStartIndex);
+	}
+
+	std::string_view FillText(std::string& targetString, const LogType logType, const std::chrono::time_point<std::chrono::system_clock> timePoint, const std::uint64_t frameCount,
+		const std::string_view message, const std::span<const LogField> fields)
+	{
+		FillHeader(targetString, logType, timePoint, frameCount);
+		targetString.push_back(' ');
+		const auto [messageStartIndex, messageEndIndex] = FillMessage(targetString, message);
+		FillFields(targetString, fields);
+		targetString.push_back('\n');
 
 		return std::string_view(&targetString[messageStartIndex], messageEndIndex - messageStartIndex);
 	}
@@ -484,7 +725,7 @@ namespace PonyEngine::Log
 		FillHeader(targetString, LogType::Exception, timePoint, frameCount);
 		targetString.push_back(' ');
 		const auto [exceptionStartIndex, exceptionEndIndex] = FillMessage(targetString, exception);
-		std::format_to(std::back_inserter(targetString), "\n{}\n", stacktrace);
+		FillStacktrace(targetString, stacktrace);
 
 		return std::string_view(&targetString[exceptionStartIndex], exceptionEndIndex - exceptionStartIndex);
 	}
@@ -497,7 +738,7 @@ namespace PonyEngine::Log
 		const auto [exceptionStartIndex, exceptionEndIndex] = FillMessage(targetString, exception);
 		targetString.append_range(" - "sv);
 		const auto [messageStartIndex, messageEndIndex] = FillMessage(targetString, message);
-		std::format_to(std::back_inserter(targetString), "\n{}\n", stacktrace);
+		FillStacktrace(targetString, stacktrace);
 
 		return std::string_view(&targetString[exceptionStartIndex], messageEndIndex - exceptionStartIndex);
 	}
@@ -510,14 +751,14 @@ namespace PonyEngine::Log
 		const auto [exceptionStartIndex, exceptionEndIndex] = FillMessage(targetString, exception);
 		targetString.append_range(" - "sv);
 		const auto [messageStartIndex, messageEndIndex] = FillMessage(targetString, format, formatArgs);
-		std::format_to(std::back_inserter(targetString), "\n{}\n", stacktrace);
+		FillStacktrace(targetString, stacktrace);
 
 		return std::string_view(&targetString[exceptionStartIndex], messageEndIndex - exceptionStartIndex);
 	}
 
 	void FillData(LogEntry& targetEntry, std::string& targetString, const LogType logType, const std::string_view message, const Application::ILoggerContext& context) noexcept
 	{
-		FillTime(targetEntry.timePoint, targetEntry.frameCount, context);
+		FillTime(targetEntry.timePoint, targetEntry.frameCount, targetEntry.threadId, context);
 		targetEntry.logType = logType;
 
 		try
@@ -535,7 +776,7 @@ namespace PonyEngine::Log
 	void FillData(LogEntry& targetEntry, std::string& targetString, const LogType logType, const std::string_view format, const std::format_args formatArgs, 
 		const Application::ILoggerContext& context) noexcept
 	{
-		FillTime(targetEntry.timePoint, targetEntry.frameCount, context);
+		FillTime(targetEntry.timePoint, targetEntry.frameCount, targetEntry.threadId, context);
 		targetEntry.logType = logType;
 
 		try
@@ -553,7 +794,7 @@ namespace PonyEngine::Log
 	void FillData(LogEntry& targetEntry, std::string& targetString, const LogType logType, const std::string_view message, const std::stacktrace& stacktrace, 
 		const Application::ILoggerContext& context) noexcept
 	{
-		FillTime(targetEntry.timePoint, targetEntry.frameCount, context);
+		FillTime(targetEntry.timePoint, targetEntry.frameCount, targetEntry.threadId, context);
 		targetEntry.logType = logType;
 		targetEntry.stacktrace = &stacktrace;
 
@@ -572,7 +813,7 @@ namespace PonyEngine::Log
 	void FillData(LogEntry& targetEntry, std::string& targetString, const LogType logType, const std::string_view format, const std::format_args formatArgs, 
 		const std::stacktrace& stacktrace, const Application::ILoggerContext& context) noexcept
 	{
-		FillTime(targetEntry.timePoint, targetEntry.frameCount, context);
+		FillTime(targetEntry.timePoint, targetEntry.frameCount, targetEntry.threadId, context);
 		targetEntry.logType = logType;
 		targetEntry.stacktrace = &stacktrace;
 
@@ -588,10 +829,66 @@ namespace PonyEngine::Log
 		}
 	}
 
+	void FillData(LogEntry& targetEntry, std::string& targetString, const LogType logType, const DeferredMessage& message, 
+		const Application::ILoggerContext& context) noexcept
+	{
+		FillTime(targetEntry.timePoint, targetEntry.frameCount, targetEntry.threadId, context);
+		targetEntry.logType = logType;
+
+		try
+		{
+			targetEntry.message = FillText(targetString, logType, targetEntry.timePoint, targetEntry.frameCount, message);
+			targetEntry.formattedMessage = targetString;
+		}
+		catch (...)
+		{
+			targetEntry.message = AllocationError;
+			targetEntry.formattedMessage = targetEntry.message;
+		}
+	}
+
+	void FillData(LogEntry& targetEntry, std::string& targetString, const LogType logType, const DeferredMessage& message, const std::stacktrace& stacktrace, 
+		const Application::ILoggerContext& context) noexcept
+	{
+		FillTime(targetEntry.timePoint, targetEntry.frameCount, targetEntry.threadId, context);
+		targetEntry.logType = logType;
+		targetEntry.stacktrace = &stacktrace;
+
+		try
+		{
+			targetEntry.message = FillText(targetString, logType, targetEntry.timePoint, targetEntry.frameCount, message, stacktrace);
+			targetEntry.formattedMessage = targetString;
+		}
+		catch (...)
+		{
+			targetEntry.message = AllocationError;
+			targetEntry.formattedMessage = targetEntry.message;
+		}
+	}
+
+	void FillData(LogEntry& targetEntry, std::string& targetString, const LogType logType, const std::string_view message, const std::span<const LogField> fields,
+		const Application::ILoggerContext& context) noexcept
+	{
+		FillTime(targetEntry.timePoint, targetEntry.frameCount, targetEntry.threadId, context);
+		targetEntry.logType = logType;
+		targetEntry.fields = fields;
+
+		try
+		{
+			targetEntry.message = FillText(targetString, logType, targetEntry.timePoint, targetEntry.frameCount, message, fields);
+			targetEntry.formattedMessage = targetString;
+		}
+		catch (...)
+		{
+			targetEntry.message = AllocationError;
+			targetEntry.formattedMessage = targetEntry.message;
+		}
+	}
+
 	void FillData(LogEntry& targetEntry, std::string& targetString, const std::exception_ptr& exception,
 		const Application::ILoggerContext& context) noexcept
 	{
-		FillTime(targetEntry.timePoint, targetEntry.frameCount, context);
+		FillTime(targetEntry.timePoint, targetEntry.frameCount, targetEntry.threadId, context);
 		targetEntry.logType = LogType::Exception;
 		targetEntry.exception = exception;
 
@@ -628,7 +925,7 @@ namespace PonyEngine::Log
 	void FillData(LogEntry& targetEntry, std::string& targetString, const std::exception_ptr& exception, const std::string_view message, 
 		const Application::ILoggerContext& context) noexcept
 	{
-		FillTime(targetEntry.timePoint, targetEntry.frameCount, context);
+		FillTime(targetEntry.timePoint, targetEntry.frameCount, targetEntry.threadId, context);
 		targetEntry.logType = LogType::Exception;
 		targetEntry.exception = exception;
 
@@ -665,7 +962,7 @@ namespace PonyEngine::Log
 	void FillData(LogEntry& targetEntry, std::string& targetString, const std::exception_ptr& exception, const std::string_view format, const std::format_args formatArgs, 
 		const Application::ILoggerContext& context) noexcept
 	{
-		FillTime(targetEntry.timePoint, targetEntry.frameCount, context);
+		FillTime(targetEntry.timePoint, targetEntry.frameCount, targetEntry.threadId, context);
 		targetEntry.logType = LogType::Exception;
 		targetEntry.exception = exception;
 
@@ -702,7 +999,7 @@ namespace PonyEngine::Log
 	void FillData(LogEntry& targetEntry, std::string& targetString, const std::exception_ptr& exception, const std::stacktrace& stacktrace, 
 		const Application::ILoggerContext& context) noexcept
 	{
-		FillTime(targetEntry.timePoint, targetEntry.frameCount, context);
+		FillTime(targetEntry.timePoint, targetEntry.frameCount, targetEntry.threadId, context);
 		targetEntry.logType = LogType::Exception;
 		targetEntry.exception = exception;
 		targetEntry.stacktrace = &stacktrace;
@@ -740,7 +1037,7 @@ namespace PonyEngine::Log
 	void FillData(LogEntry& targetEntry, std::string& targetString, const std::exception_ptr& exception, const std::string_view message, const std::stacktrace& stacktrace,
 		const Application::ILoggerContext& context) noexcept
 	{
-		FillTime(targetEntry.timePoint, targetEntry.frameCount, context);
+		FillTime(targetEntry.timePoint, targetEntry.frameCount, targetEntry.threadId, context);
 		targetEntry.logType = LogType::Exception;
 		targetEntry.exception = exception;
 
@@ -777,7 +1074,7 @@ namespace PonyEngine::Log
 	void FillData(LogEntry& targetEntry, std::string& targetString, const std::exception_ptr& exception, const std::string_view format, const std::format_args formatArgs, 
 		const std::stacktrace& stacktrace, const Application::ILoggerContext& context) noexcept
 	{
-		FillTime(targetEntry.timePoint, targetEntry.frameCount, context);
+		FillTime(targetEntry.timePoint, targetEntry.frameCount, targetEntry.threadId, context);
 		targetEntry.logType = LogType::Exception;
 		targetEntry.exception = exception;
 
@@ -1107,4 +1404,199 @@ namespace PonyEngine::Log
 			return AllocationError;
 		}
 	}
+
+	std::string_view FillText(std::string& targetString, const LogRecord& record, const std::optional<const std::exception*>& exception)
+	{
+		const std::string_view message = record.Message();
+		const std::stacktrace* const stacktrace = record.Stacktrace();
+		if (!stacktrace)
+		{
+			return message.empty()
+				? FillText(targetString, record.timePoint, record.frameCount, exception)
+				: FillText(targetString, record.timePoint, record.frameCount, exception, message);
+		}
+
+		return message.empty()
+			? FillText(targetString, record.timePoint, record.frameCount, exception, *stacktrace)
+			: FillText(targetString, record.timePoint, record.frameCount, exception, message, *stacktrace);
+	}
+
+	void FillData(LogEntry& targetEntry, std::string& targetString, std::vector<LogField>& targetFields, const LogRecord& record) noexcept
+	{
+		targetEntry.timePoint = record.timePoint;
+		targetEntry.frameCount = record.frameCount;
+		targetEntry.threadId = record.threadId;
+		targetEntry.logType = record.logType;
+		targetEntry.stacktrace = record.Stacktrace();
+		targetEntry.exception = record.Exception();
+
+		try
+		{
+			if (record.formatter)
+			{
+				targetEntry.message = !targetEntry.stacktrace
+					? FillText(targetString, record.logType, record.timePoint, record.frameCount, record.Deferred())
+					: FillText(targetString, record.logType, record.timePoint, record.frameCount, record.Deferred(), *targetEntry.stacktrace);
+			}
+			else if (record.HasFields())
+			{
+				targetEntry.fields = record.Fields(targetFields);
+				targetEntry.message = FillText(targetString, record.logType, record.timePoint, record.frameCount, record.Message(), targetEntry.fields);
+			}
+			else if (!record.isException)
+			{
+				targetEntry.message = !targetEntry.stacktrace
+					? FillText(targetString, record.logType, record.timePoint, record.frameCount, record.Message())
+					: FillText(targetString, record.logType, record.timePoint, record.frameCount, record.Message(), *targetEntry.stacktrace);
+			}
+			else if (targetEntry.exception) [[likely]]
+			{
+				try
+				{
+					std::rethrow_exception(targetEntry.exception);
+				}
+				catch (const std::exception& e)
+				{
+					targetEntry.message = FillText(targetString, record, &e);
+				}
+				catch (...)
+				{
+					targetEntry.message = FillText(targetString, record, nullptr);
+				}
+			}
+			else [[unlikely]]
+			{
+				targetEntry.message = FillText(targetString, record, std::nullopt);
+			}
+			targetEntry.formattedMessage = targetString;
+		}
+		catch (...)
+		{
+			targetEntry.fields = std::span<const LogField>();
+			targetEntry.message = AllocationError;
+			targetEntry.formattedMessage = targetEntry.message;
+		}
+	}
+
+	void FillRecordMessage(LogRecord& targetRecord, const std::string_view message, const std::stacktrace* const stacktrace)
+	{
+		targetRecord.Message(message);
+		if (stacktrace)
+		{
+			targetRecord.Stacktrace(*stacktrace);
+		}
+	}
+
+	void FillRecordMessage(LogRecord& targetRecord, std::string& tempString, const std::string_view format, const std::format_args formatArgs, 
+		const std::stacktrace* const stacktrace) noexcept
+	{
+		try
+		{
+			tempString.clear();
+			FillMessage(tempString, format, formatArgs);
+			FillRecordMessage(targetRecord, tempString, stacktrace);
+		}
+		catch (...)
+		{
+			targetRecord.Message(AllocationError);
+		}
+	}
+
+	void FillRecord(LogRecord& targetRecord, const LogType logType, const std::string_view message, const std::stacktrace* const stacktrace, 
+		const Application::ILoggerContext& context) noexcept
+	{
+		FillTime(targetRecord.timePoint, targetRecord.frameCount, targetRecord.threadId, context);
+		targetRecord.logType = logType;
+
+		try
+		{
+			FillRecordMessage(targetRecord, message, stacktrace);
+		}
+		catch (...)
+		{
+			targetRecord.Message(AllocationError);
+		}
+	}
+
+	void FillRecord(LogRecord& targetRecord, std::string& tempString, const LogType logType, const std::string_view format, const std::format_args formatArgs, 
+		const std::stacktrace* const stacktrace, const Application::ILoggerContext& context) noexcept
+	{
+		FillTime(targetRecord.timePoint, targetRecord.frameCount, targetRecord.threadId, context);
+		targetRecord.logType = logType;
+		FillRecordMessage(targetRecord, tempString, format, formatArgs, stacktrace);
+	}
+
+	void FillRecord(LogRecord& targetRecord, const LogType logType, const DeferredMessage& message, const std::stacktrace* const stacktrace, 
+		const Application::ILoggerContext& context) noexcept
+	{
+		FillTime(targetRecord.timePoint, targetRecord.frameCount, targetRecord.threadId, context);
+		targetRecord.logType = logType;
+
+		try
+		{
+			targetRecord.Deferred(message);
+			if (stacktrace)
+			{
+				targetRecord.Stacktrace(*stacktrace);
+			}
+		}
+		catch (...)
+		{
+			targetRecord.formatter = nullptr;
+			targetRecord.Message(AllocationError);
+		}
+	}
+
+	void FillRecord(LogRecord& targetRecord, const LogType logType, const std::string_view message, const std::span<const LogField> fields, 
+		const Application::ILoggerContext& context) noexcept
+	{
+		FillTime(targetRecord.timePoint, targetRecord.frameCount, targetRecord.threadId, context);
+		targetRecord.logType = logType;
+
+		try
+		{
+			targetRecord.Message(message);
+			targetRecord.Fields(fields);
+		}
+		catch (...)
+		{
+			targetRecord.Reset();
+			targetRecord.Message(AllocationError);
+		}
+	}
+
+	void FillRecord(LogRecord& targetRecord, const std::exception_ptr& exception, const std::string_view message, const std::stacktrace* const stacktrace, 
+		const Application::ILoggerContext& context) noexcept
+	{
+		FillTime(targetRecord.timePoint, targetRecord.frameCount, targetRecord.threadId, context);
+		targetRecord.logType = LogType::Exception;
+		targetRecord.isException = true;
+
+		try
+		{
+			targetRecord.Exception(exception);
+			FillRecordMessage(targetRecord, message, stacktrace);
+		}
+		catch (...)
+		{
+			targetRecord.Message(AllocationError);
+		}
+	}
+
+	void FillRecord(LogRecord& targetRecord, std::string& tempString, const std::exception_ptr& exception, const std::string_view format, const std::format_args formatArgs, 
+		const std::stacktrace* const stacktrace, const Application::ILoggerContext& context) noexcept
+	{
+		FillTime(targetRecord.timePoint, targetRecord.frameCount, targetRecord.threadId, context);
+		targetRecord.logType = LogType::Exception;
+		targetRecord.isException = true;
+		try
+		{
+			targetRecord.Exception(exception);
+		}
+		catch (...)
+		{
+			// The exception log is still passed, without the exception.
+		}
+		FillRecordMessage(targetRecord, tempString, format, formatArgs, stacktrace);
+	}
 }
@@ -0,0 +1,231 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Log.Impl:LogRecord;
+
+import std;
+
+import PonyEngine.Log;
+
+export namespace PonyEngine::Log
+{
+	/// @brief Rare heavy parts of a log record.
+	struct LogRecordExtra final
+	{
+		std::exception_ptr exception; ///< Exception.
+		std::stacktrace stacktrace; ///< Stacktrace. It's empty if there's no stacktrace.
+		std::string heapMessage; ///< Message that doesn't fit into the record.
+		std::vector<LogField> fields; ///< Structured fields. Only their types, values and string sizes are valid: the strings are in the @p fieldText.
+		std::string fieldText; ///< Keys and string values of the fields one after another.
+	};
+
+	/// @brief Compact log that is passed from a logging thread to the log dispatcher.
+	/// @details The message is stored inside the record if it fits. The rare heavy parts (a long message, an exception, a stacktrace and structured fields)
+	///          are stored in a side allocation that is made only if one of them is set, so a common record takes no allocation.
+	struct LogRecord final
+	{
+		static constexpr std::size_t InlineMessageSize = 192uz; ///< Max message size that is stored inside the record.
+
+		/// @brief Gets the message.
+		/// @return Message.
+		[[nodiscard("Pure function")]]
+		std::string_view Message() const noexcept;
+		/// @brief Sets the message.
+		/// @param message Message.
+		void Message(std::string_view message);
+
+		/// @brief Makes a deferred message of the record.
+		/// @return Deferred message. Its arguments reference the record message.
+		/// @note It may be called only if the @p formatter is set.
+		[[nodiscard("Pure function")]]
+		DeferredMessage Deferred() const noexcept;
+		/// @brief Sets the deferred message. Its arguments are copied to the record message.
+		/// @param message Deferred message.
+		void Deferred(const DeferredMessage& message);
+
+		/// @brief Gets the exception.
+		/// @return Exception; nullptr if it's not set.
+		[[nodiscard("Pure function")]]
+		std::exception_ptr Exception() const noexcept;
+		/// @brief Sets the exception.
+		/// @param exception Exception.
+		void Exception(const std::exception_ptr& exception);
+
+		/// @brief Gets the stacktrace.
+		/// @return Stacktrace; nullptr if it's not set.
+		[[nodiscard("Pure function")]]
+		const std::stacktrace* Stacktrace() const noexcept;
+		/// @brief Sets the stacktrace.
+		/// @param stacktrace Stacktrace.
+		void Stacktrace(const std::stacktrace& stacktrace);
+
+		/// @brief Checks if the record has structured fields.
+		/// @return @a True if it has; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool HasFields() const noexcept;
+		/// @brief Gets the structured fields.
+		/// @param target Field storage. The fields reference the record strings.
+		/// @return Fields. They're valid until the @p target or the record is changed.
+		std::span<const LogField> Fields(std::vector<LogField>& target) const;
+		/// @brief Sets the structured fields. Their keys and string values are copied to the record.
+		/// @param fields Fields.
+		void Fields(std::span<const LogField> fields);
+
+		/// @brief Releases the heavy parts.
+		void Reset() noexcept;
+
+		std::chrono::time_point<std::chrono::system_clock> timePoint; ///< Time when the log is created.
+		std::uint64_t frameCount = 0ull; ///< Frame when the log is created.
+		std::thread::id threadId; ///< Thread that created the log.
+		std::unique_ptr<LogRecordExtra> extra; ///< Rare heavy parts. It's nullptr if there are none.
+		std::string_view format; ///< Deferred message format. It's used only if the @p formatter is set.
+		DeferredMessage::FormatFunction formatter = nullptr; ///< Deferred message formatter. If it's set, the message contains the binary format arguments.
+		std::uint32_t messageSize = 0u; ///< Inline message size.
+		LogType logType = LogType::Verbose; ///< Log type.
+		bool isException = false; ///< Is it an exception log?
+		bool isHeapMessage = false; ///< Is the message in the heap message of the @p extra?
+		std::array<char, InlineMessageSize> inlineMessage; ///< Inline message.
+
+	private:
+		/// @brief Gets the heavy parts. They're allocated if they're not yet.
+		/// @return Heavy parts.
+		[[nodiscard("Must use the result")]]
+		LogRecordExtra& Extra();
+	};
+}
+
+namespace PonyEngine::Log
+{
+	std::string_view LogRecord::Message() const noexcept
+	{
+		return isHeapMessage ? std::string_view(extra->heapMessage) : std::string_view(inlineMessage.data(), messageSize);
+	}
+
+	void LogRecord::Message(const std::string_view message)
+	{
+		if (message.size() <= InlineMessageSize) [[likely]]
+		{
+			std::ranges::copy(message, inlineMessage.data());
+			messageSize = static_cast<std::uint32_t>(message.size());
+			isHeapMessage = false;
+		}
+		else [[unlikely]]
+		{
+			Extra().heapMessage.assign(message);
+			isHeapMessage = true;
+		}
+	}
+
+	DeferredMessage LogRecord::Deferred() const noexcept
+	{
+		return DeferredMessage(format, formatter, std::as_bytes(std::span(Message())));
+	}
+
+	void LogRecord::Deferred(const DeferredMessage& message)
+	{
+		const std::span<const std::byte> arguments = message.Arguments();
+		Message(std::string_view(reinterpret_cast<const char*>(arguments.data()), arguments.size()));
+		format = message.Format();
+		formatter = message.Formatter();
+	}
+
+	std::exception_ptr LogRecord::Exception() const noexcept
+	{
+		return extra ? extra->exception : nullptr;
+	}
+
+	void LogRecord::Exception(const std::exception_ptr& exception)
+	{
+		Extra().exception = exception;
+	}
+
+	const std::stacktrace* LogRecord::Stacktrace() const noexcept
+	{
+		return extra && !extra->stacktrace.empty() ? &extra->stacktrace : nullptr;
+	}
+
+	void LogRecord::Stacktrace(const std::stacktrace& stacktrace)
+	{
+		Extra().stacktrace = stacktrace;
+	}
+
+	bool LogRecord::HasFields() const noexcept
+	{
+		return extra && !extra->fields.empty();
+	}
+
+	std::span<const LogField> LogRecord::Fields(std::vector<LogField>& target) const
+	{
+		target.clear();
+		if (!extra)
+		{
+			return target;
+		}
+
+		const std::string_view fieldText = extra->fieldText;
+		std::size_t offset = 0uz;
+		for (const LogField& field : extra->fields)
+		{
+			const std::string_view key = fieldText.substr(offset, field.Key().size());
+			offset += key.size();
+			std::string_view string;
+			if (field.Type() == LogFieldType::String)
+			{
+				string = fieldText.substr(offset, field.String().size());
+				offset += string.size();
+			}
+			target.push_back(field.Rebind(key, string));
+		}
+
+		return target;
+	}
+
+	void LogRecord::Fields(const std::span<const LogField> fields)
+	{
+		if (fields.empty())
+		{
+			if (extra)
+			{
+				extra->fields.clear();
+				extra->fieldText.clear();
+			}
+
+			return;
+		}
+
+		LogRecordExtra& currentExtra = Extra();
+		currentExtra.fields.assign_range(fields);
+		currentExtra.fieldText.clear();
+		for (const LogField& field : fields)
+		{
+			currentExtra.fieldText.append(field.Key());
+			if (field.Type() == LogFieldType::String)
+			{
+				currentExtra.fieldText.append(field.String());
+			}
+		}
+	}
+
+	void LogRecord::Reset() noexcept
+	{
+		extra.reset();
+		isHeapMessage = false;
+		messageSize = 0u;
+	}
+
+	LogRecordExtra& LogRecord::Extra()
+	{
+		if (!extra)
+		{
+			extra = std::make_unique<LogRecordExtra>();
+		}
+
+		return *extra;
+	}
+}
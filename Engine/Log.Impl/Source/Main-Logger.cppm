@@ -17,8 +17,12 @@ import std;
 
 import PonyEngine.Application.Ext;
 import PonyEngine.Log.Ext;
+import PonyEngine.Type;
 
+import :LogCoalescer;
+import :LogDispatcher;
 import :LogFiller;
+import :LogRecord;
 import :SubLoggerContainer;
 
 export namespace PonyEngine::Log
@@ -29,17 +33,27 @@ export namespace PonyEngine::Log
 	public:
 		/// @brief Creates a logger.
 		/// @param loggerContext Logger context.
+		/// @param dispatcherParams Log dispatcher parameters. If it's set, the logger is asynchronous: logs are passed to the sub-loggers on a dedicated thread
+		///                         and consecutive repeated logs are coalesced.
 		[[nodiscard("Pure constuctor")]]
-		explicit Logger(Application::ILoggerContext& loggerContext) noexcept;
+		Logger(Application::ILoggerContext& loggerContext, const std::optional<LogDispatcherParams>& dispatcherParams);
 		Logger(const Logger&) = delete;
 		Logger(Logger&&) = delete;
 
 		~Logger() noexcept;
 
+		[[nodiscard("Pure function")]]
+		virtual LogFilter& Filter() noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual const LogFilter& Filter() const noexcept override;
+
 		virtual void Log(LogType logType, std::string_view message) const noexcept override;
 		virtual void Log(LogType logType, std::string_view format, std::format_args formatArgs) const noexcept override;
 		virtual void Log(LogType logType, std::string_view message, const std::stacktrace& stacktrace) const noexcept override;
 		virtual void Log(LogType logType, std::string_view format, std::format_args formatArgs, const std::stacktrace& stacktrace) const noexcept override;
+		virtual void Log(LogType logType, const DeferredMessage& message) const noexcept override;
+		virtual void Log(LogType logType, const DeferredMessage& message, const std::stacktrace& stacktrace) const noexcept override;
+		virtual void Log(LogType logType, std::string_view message, std::span<const LogField> fields) const noexcept override;
 
 		virtual void Log(const std::exception_ptr& exception) const noexcept override;
 		virtual void Log(const std::exception_ptr& exception, std::string_view message) const noexcept override;
@@ -49,9 +63,13 @@ export namespace PonyEngine::Log
 		virtual void Log(const std::exception_ptr& exception, std::string_view format, std::format_args formatArgs, const std::stacktrace& stacktrace) const noexcept override;
 
 		[[nodiscard("Must be used to remove")]]
-		virtual SubLoggerHandle AddSubLogger(const std::function<std::shared_ptr<ISubLogger>(ILoggerContext&)>& factory) override;
+		virtual SubLoggerHandle AddSubLogger(Type::FunctionRef<std::shared_ptr<ISubLogger>(ILoggerContext&)> factory) override;
 		virtual void RemoveSubLogger(SubLoggerHandle handle) override;
 
+		[[nodiscard("Pure function")]]
+		virtual LogStatistics Statistics() const noexcept override;
+		virtual void Flush() const noexcept override;
+
 		Logger& operator =(const Logger&) = delete;
 		Logger& operator =(Logger&&) = delete;
 
@@ -76,30 +94,69 @@ export namespace PonyEngine::Log
 		/// @brief Logs the entry.
 		/// @param logEntry Log entry to log.
 		void Log(const LogEntry& logEntry) const noexcept;
+		/// @brief Passes the entry to the console and the sub-loggers.
+		/// @param logEntry Log entry to pass.
+		/// @param dispatchTimePoint Time when the entry is dispatched. It's used to measure the latency.
+		/// @note The log mutex must be locked.
+		void Send(const LogEntry& logEntry, std::chrono::time_point<std::chrono::system_clock> dispatchTimePoint) const noexcept;
+
+		/// @brief Pushes the record to the dispatcher.
+		/// @details Error and exception logs are flushed immediately if it's enabled in the dispatcher parameters.
+		/// @param record Log record.
+		void Push(LogRecord&& record) const noexcept;
+		/// @brief Logs the records. It's the dispatcher handler.
+		/// @param records Log records.
+		void Dispatch(std::span<LogRecord> records) const noexcept;
+		/// @brief Passes the report of the coalesced repeats if the report period has passed. It's the dispatcher idle handler.
+		void ReportDueRepeats() const noexcept;
+		/// @brief Passes the report of the coalesced repeats if there are some.
+		/// @param dispatchTimePoint Time when the report is dispatched. It's used to measure the latency.
+		/// @note The log mutex must be locked.
+		void ReportRepeats(std::chrono::time_point<std::chrono::system_clock> dispatchTimePoint) const noexcept;
 
 		Application::ILoggerContext* loggerContext; ///< Logger context.
 
+		LogFilter filter; ///< Runtime log filter.
 		SubLoggerContainer subLoggerContainer; ///< Sub-logger container.
 
 		inline static thread_local std::string logStringTemp; ///< Temporal log string.
 		inline static thread_local std::string consoleStringTemp; ///< Temporal log string that is used in @p LogToString().
 
-		SubLoggerHandle nextSubLoggerHandle; ///< Next sub-logger handle.
+		mutable LogCoalescer coalescer; ///< Repeated log coalescer. It's guarded by the log mutex.
+		mutable std::string repeatStringTemp; ///< Temporal repeat report string. It's guarded by the log mutex.
+		mutable std::vector<LogField> fieldsTemp; ///< Temporal structured fields of a dispatched record. It's guarded by the log mutex.
 
-		mutable std::mutex logMutex; ///< Log mutex.
+		mutable LogStatistics statistics; ///< Log statistics. It's guarded by the log mutex.
+		mutable std::mutex logMutex; ///< Log mutex. If the logger is asynchronous, logging threads never take it: only the dispatcher thread logs under it.
+
+		bool flushErrors; ///< Flush error and exception logs immediately.
+		std::unique_ptr<LogDispatcher> dispatcher; ///< Log dispatcher. It's nullptr if the logger is synchronous. It must be the last member to stop before the others are destroyed.
 	};
 }
 
 namespace PonyEngine::Log
 {
-	Logger::Logger(Application::ILoggerContext& loggerContext) noexcept :
+	Logger::Logger(Application::ILoggerContext& loggerContext, const std::optional<LogDispatcherParams>& dispatcherParams) :
 		loggerContext{&loggerContext},
-		nextSubLoggerHandle{.id = 1u}
+		coalescer(dispatcherParams ? dispatcherParams->repeatReportPeriod : std::chrono::nanoseconds::zero()),
+		flushErrors{dispatcherParams && dispatcherParams->flushErrors}
 	{
+		if (dispatcherParams)
+		{
+			dispatcher = std::make_unique<LogDispatcher>(*dispatcherParams, [this](const std::span<LogRecord> records) noexcept { Dispatch(records); },
+				[this]() noexcept { ReportDueRepeats(); });
+		}
 	}
 
 	Logger::~Logger() noexcept
 	{
+		dispatcher.reset();
+
+		{
+			const auto lock = std::lock_guard(logMutex);
+			ReportRepeats(std::chrono::system_clock::now());
+		}
+
 		if (subLoggerContainer.Size() > 0uz) [[unlikely]]
 		{
 			PONY_CONSOLE(*this, LogType::Error, "Sub-loggers weren't removed:");
@@ -110,8 +167,27 @@ namespace PonyEngine::Log
 		}
 	}
 
+	LogFilter& Logger::Filter() noexcept
+	{
+		return filter;
+	}
+
+	const LogFilter& Logger::Filter() const noexcept
+	{
+		return filter;
+	}
+
 	void Logger::Log(const LogType logType, const std::string_view message) const noexcept
 	{
+		if (dispatcher)
+		{
+			LogRecord record;
+			FillRecord(record, logType, message, nullptr, *loggerContext);
+			Push(std::move(record));
+
+			return;
+		}
+
 		logStringTemp.clear();
 		LogEntry logEntry;
 		FillData(logEntry, logStringTemp, logType, message, *loggerContext);
@@ -120,6 +196,15 @@ namespace PonyEngine::Log
 
 	void Logger::Log(const LogType logType, const std::string_view format, const std::format_args formatArgs) const noexcept
 	{
+		if (dispatcher)
+		{
+			LogRecord record;
+			FillRecord(record, logStringTemp, logType, format, formatArgs, nullptr, *loggerContext);
+			Push(std::move(record));
+
+			return;
+		}
+
 		logStringTemp.clear();
 		LogEntry logEntry;
 		FillData(logEntry, logStringTemp, logType, format, formatArgs, *loggerContext);
@@ -128,6 +213,15 @@ namespace PonyEngine::Log
 
 	void Logger::Log(const LogType logType, const std::string_view message, const std::stacktrace& stacktrace) const noexcept
 	{
+		if (dispatcher)
+		{
+			LogRecord record;
+			FillRecord(record, logType, message, &stacktrace, *loggerContext);
+			Push(std::move(record));
+
+			return;
+		}
+
 		logStringTemp.clear();
 		LogEntry logEntry;
 		FillData(logEntry, logStringTemp, logType, message, stacktrace, *loggerContext);
@@ -136,14 +230,83 @@ namespace PonyEngine::Log
 
 	void Logger::Log(const LogType logType, const std::string_view format, const std::format_args formatArgs, const std::stacktrace& stacktrace) const noexcept
 	{
+		if (dispatcher)
+		{
+			LogRecord record;
+			FillRecord(record, logStringTemp, logType, format, formatArgs, &stacktrace, *loggerContext);
+			Push(std::move(record));
+
+			return;
+		}
+
 		logStringTemp.clear();
 		LogEntry logEntry;
 		FillData(logEntry, logStringTemp, logType, format, formatArgs, stacktrace, *loggerContext);
 		Log(logEntry);
 	}
 
+	void Logger::Log(const LogType logType, const DeferredMessage& message) const noexcept
+	{
+		if (dispatcher)
+		{
+			LogRecord record;
+			FillRecord(record, logType, message, nullptr, *loggerContext);
+			Push(std::move(record));
+
+			return;
+		}
+
+		logStringTemp.clear();
+		LogEntry logEntry;
+		FillData(logEntry, logStringTemp, logType, message, *loggerContext);
+		Log(logEntry);
+	}
+
+	void Logger::Log(const LogType logType, const DeferredMessage& message, const std::stacktrace& stacktrace) const noexcept
+	{
+		if (dispatcher)
+		{
+			LogRecord record;
+			FillRecord(record, logType, message, &stacktrace, *loggerContext);
+			Push(std::move(record));
+
+			return;
+		}
+
+		logStringTemp.clear();
+		LogEntry logEntry;
+		FillData(logEntry, logStringTemp, logType, message, stacktrace, *loggerContext);
+		Log(logEntry);
+	}
+
+	void Logger::Log(const LogType logType, const std::string_view message, const std::span<const LogField> fields) const noexcept
+	{
+		if (dispatcher)
+		{
+			LogRecord record;
+			FillRecord(record, logType, message, fields, *loggerContext);
+			Push(std::move(record));
+
+			return;
+		}
+
+		logStringTemp.clear();
+		LogEntry logEntry;
+		FillData(logEntry, logStringTemp, logType, message, fields, *loggerContext);
+		Log(logEntry);
+	}
+
 	void Logger::Log(const std::exception_ptr& exception) const noexcept
 	{
+		if (dispatcher)
+		{
+			LogRecord record;
+			FillRecord(record, exception, std::string_view(), nullptr, *loggerContext);
+			Push(std::move(record));
+
+			return;
+		}
+
 		logStringTemp.clear();
 		LogEntry logEntry;
 		FillData(logEntry, logStringTemp, exception, *loggerContext);
@@ -152,6 +315,15 @@ namespace PonyEngine::Log
 
 	void Logger::Log(const std::exception_ptr& exception, const std::string_view message) const noexcept
 	{
+		if (dispatcher)
+		{
+			LogRecord record;
+			FillRecord(record, exception, message, nullptr, *loggerContext);
+			Push(std::move(record));
+
+			return;
+		}
+
 		logStringTemp.clear();
 		LogEntry logEntry;
 		FillData(logEntry, logStringTemp, exception, message, *loggerContext);
@@ -160,6 +332,15 @@ namespace PonyEngine::Log
 
 	void Logger::Log(const std::exception_ptr& exception, const std::string_view format, const std::format_args formatArgs) const noexcept
 	{
+		if (dispatcher)
+		{
+			LogRecord record;
+			FillRecord(record, logStringTemp, exception, format, formatArgs, nullptr, *loggerContext);
+			Push(std::move(record));
+
+			return;
+		}
+
 		logStringTemp.clear();
 		LogEntry logEntry;
 		FillData(logEntry, logStringTemp, exception, format, formatArgs, *loggerContext);
@@ -168,6 +349,15 @@ namespace PonyEngine::Log
 
 	void Logger::Log(const std::exception_ptr& exception, const std::stacktrace& stacktrace) const noexcept
 	{
+		if (dispatcher)
+		{
+			LogRecord record;
+			FillRecord(record, exception, std::string_view(), &stacktrace, *loggerContext);
+			Push(std::move(record));
+
+			return;
+		}
+
 		logStringTemp.clear();
 		LogEntry logEntry;
 		FillData(logEntry, logStringTemp, exception, stacktrace, *loggerContext);
@@ -176,6 +366,15 @@ namespace PonyEngine::Log
 
 	void Logger::Log(const std::exception_ptr& exception, const std::string_view message, const std::stacktrace& stacktrace) const noexcept
 	{
+		if (dispatcher)
+		{
+			LogRecord record;
+			FillRecord(record, exception, message, &stacktrace, *loggerContext);
+			Push(std::move(record));
+
+			return;
+		}
+
 		logStringTemp.clear();
 		LogEntry logEntry;
 		FillData(logEntry, logStringTemp, exception, message, stacktrace, *loggerContext);
@@ -184,13 +383,22 @@ namespace PonyEngine::Log
 
 	void Logger::Log(const std::exception_ptr& exception, const std::string_view format, const std::format_args formatArgs, const std::stacktrace& stacktrace) const noexcept
 	{
+		if (dispatcher)
+		{
+			LogRecord record;
+			FillRecord(record, logStringTemp, exception, format, formatArgs, &stacktrace, *loggerContext);
+			Push(std::move(record));
+
+			return;
+		}
+
 		logStringTemp.clear();
 		LogEntry logEntry;
 		FillData(logEntry, logStringTemp, exception, format, formatArgs, stacktrace, *loggerContext);
 		Log(logEntry);
 	}
 
-	SubLoggerHandle Logger::AddSubLogger(const std::function<std::shared_ptr<ISubLogger>(ILoggerContext&)>& factory)
+	SubLoggerHandle Logger::AddSubLogger(Type::FunctionRef<std::shared_ptr<ISubLogger>(ILoggerContext&)> factory)
 	{
 #ifndef NDEBUG
 		if (std::this_thread::get_id() != loggerContext->Application().MainThreadID()) [[unlikely]]
@@ -198,10 +406,6 @@ namespace PonyEngine::Log
 			throw std::logic_error("Must be called on main thread");
 		}
 
-		if (!nextSubLoggerHandle.IsValid()) [[unlikely]]
-		{
-			throw std::overflow_error("No more sub-logger handles available");
-		}
 		if (loggerContext->Application().FlowState() != Application::FlowState::StartingUp) [[unlikely]]
 		{
 			throw std::logic_error("Sub-logger can be added only on start-up");
@@ -220,9 +424,11 @@ namespace PonyEngine::Log
 		}
 #endif
 
-		const SubLoggerHandle currentHandle = nextSubLoggerHandle;
-		subLoggerContainer.Add(currentHandle, subLogger);
-		++nextSubLoggerHandle.id;
+		SubLoggerHandle currentHandle;
+		{
+			const auto lock = std::lock_guard(logMutex);
+			currentHandle = subLoggerContainer.Add(subLogger);
+		}
 
 		PONY_LOG(*this, LogType::Info, "'{}' sub-logger added. Handle: '0x{:X}'.", typeid(*subLogger).name(), currentHandle.id);
 
@@ -243,10 +449,16 @@ namespace PonyEngine::Log
 		}
 #endif
 
+		Flush();
+
 		if (const std::size_t index = subLoggerContainer.IndexOf(handle); index < subLoggerContainer.Size()) [[likely]]
 		{
 			const char* const subLoggerName = typeid(subLoggerContainer.SubLogger(index)).name();
-			subLoggerContainer.Remove(index);
+			{
+				const auto lock = std::lock_guard(logMutex);
+				ReportRepeats(std::chrono::system_clock::now());
+				subLoggerContainer.Remove(index);
+			}
 			PONY_LOG(*this, LogType::Info, "'{}' sub-logger removed. Handle: '0x{:X}'.", subLoggerName, handle.id);
 		}
 		else [[unlikely]]
@@ -255,6 +467,34 @@ namespace PonyEngine::Log
 		}
 	}
 
+	LogStatistics Logger::Statistics() const noexcept
+	{
+		LogStatistics currentStatistics;
+		{
+			const auto lock = std::lock_guard(logMutex);
+			currentStatistics = statistics;
+			currentStatistics.repeatedLogCount = coalescer.CoalescedCount();
+		}
+
+		if (dispatcher)
+		{
+			currentStatistics.droppedLogCount = dispatcher->DroppedCount();
+			currentStatistics.blockedLogCount = dispatcher->BlockedCount();
+			currentStatistics.queueSize = dispatcher->QueueSize();
+			currentStatistics.queueCapacity = dispatcher->QueueCapacity();
+		}
+
+		return currentStatistics;
+	}
+
+	void Logger::Flush() const noexcept
+	{
+		if (dispatcher)
+		{
+			dispatcher->Flush();
+		}
+	}
+
 	Application::IApplicationContext& Logger::Application() noexcept
 	{
 		return loggerContext->Application();
@@ -338,12 +578,81 @@ namespace PonyEngine::Log
 	void Logger::Log(const LogEntry& logEntry) const noexcept
 	{
 		const auto lock = std::lock_guard(logMutex);
+		// A synchronous log is passed right away, so its latency isn't measured: it'd cost a clock read per log.
+		Send(logEntry, logEntry.timePoint);
+	}
 
+	void Logger::Send(const LogEntry& logEntry, const std::chrono::time_point<std::chrono::system_clock> dispatchTimePoint) const noexcept
+	{
 		loggerContext->LogToConsole(logEntry.logType, logEntry.formattedMessage);
 
 		for (std::size_t i = 0uz; i < subLoggerContainer.Size(); ++i)
 		{
 			subLoggerContainer.SubLogger(i).Log(logEntry);
 		}
+
+		const auto latency = std::max(std::chrono::duration_cast<std::chrono::nanoseconds>(dispatchTimePoint - logEntry.timePoint), std::chrono::nanoseconds::zero());
+		++statistics.logCount;
+		statistics.totalLatency += latency;
+		statistics.maxLatency = std::max(statistics.maxLatency, latency);
+	}
+
+	void Logger::Push(LogRecord&& record) const noexcept
+	{
+		const LogType logType = record.logType;
+		dispatcher->Push(std::move(record));
+
+		if (flushErrors && (logType == LogType::Error || logType == LogType::Exception)) [[unlikely]]
+		{
+			dispatcher->Flush();
+		}
+	}
+
+	void Logger::Dispatch(const std::span<LogRecord> records) const noexcept
+	{
+		const auto lock = std::lock_guard(logMutex);
+		// The time is taken once per batch: the records of a batch are passed together.
+		const std::chrono::time_point<std::chrono::system_clock> now = std::chrono::system_clock::now();
+
+		for (LogRecord& record : records)
+		{
+			logStringTemp.clear();
+			LogEntry logEntry;
+			FillData(logEntry, logStringTemp, fieldsTemp, record);
+			if (coalescer.IsRepeat(logEntry))
+			{
+				coalescer.CountRepeat(logEntry);
+				if (coalescer.IsReportDue(logEntry.timePoint))
+				{
+					ReportRepeats(now);
+				}
+			}
+			else
+			{
+				ReportRepeats(now);
+				Send(logEntry, now);
+				coalescer.Remember(logEntry);
+			}
+			record.Reset();
+		}
+	}
+
+	void Logger::ReportDueRepeats() const noexcept
+	{
+		const auto lock = std::lock_guard(logMutex);
+		if (const std::chrono::time_point<std::chrono::system_clock> now = std::chrono::system_clock::now(); coalescer.IsReportDue(now))
+		{
+			ReportRepeats(now);
+		}
+	}
+
+	void Logger::ReportRepeats(const std::chrono::time_point<std::chrono::system_clock> dispatchTimePoint) const noexcept
+	{
+		if (coalescer.RepeatCount() > 0ull)
+		{
+			LogEntry logEntry;
+			coalescer.FillReport(logEntry, repeatStringTemp);
+			Send(logEntry, dispatchTimePoint);
+		}
 	}
 }
@@ -18,6 +18,7 @@ import std;
 import PonyEngine.Application.Ext;
 import PonyEngine.Log;
 
+import :LogDispatcher;
 import :Logger;
 
 export namespace PonyEngine::Log
@@ -42,6 +43,11 @@ export namespace PonyEngine::Log
 	private:
 		Application::ModuleDataHandle loggerModuleHandle; ///< Logger module handle.
 		Application::LoggerHandle loggerHandle; ///< Logger handle.
+
+#if PONY_ENGINE_LOG_ASYNC
+		static constexpr LogDispatcherParams DispatcherParams = LogDispatcherParams{.queueSize = PONY_ENGINE_LOG_ASYNC_QUEUE_SIZE, .overflowPolicy = LogOverflowPolicy::PONY_ENGINE_LOG_ASYNC_OVERFLOW,
+			.repeatReportPeriod = std::chrono::milliseconds(PONY_ENGINE_LOG_ASYNC_REPEAT_PERIOD), .flushErrors = PONY_ENGINE_LOG_ASYNC_ERROR_FLUSH}; ///< Log dispatcher parameters.
+#endif
 	};
 }
 
@@ -54,7 +60,11 @@ namespace PonyEngine::Log
 		{
 			loggerHandle = context.LoggerModuleContext().SetLogger([&](Application::ILoggerContext& loggerContext)
 			{
-				const auto logger = std::make_shared<Logger>(loggerContext);
+#if PONY_ENGINE_LOG_ASYNC
+				const auto logger = std::make_shared<Logger>(loggerContext, DispatcherParams);
+#else
+				const auto logger = std::make_shared<Logger>(loggerContext, std::nullopt);
+#endif
 				loggerModuleHandle = context.AddData(std::shared_ptr<ILoggerModuleContext>(logger, logger.get()));
 
 				return logger;
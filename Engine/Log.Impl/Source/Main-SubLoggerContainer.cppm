@@ -16,10 +16,12 @@ export module PonyEngine.Log.Impl:SubLoggerContainer;
 import std;
 
 import PonyEngine.Log.Ext;
+import PonyEngine.Memory;
 
 export namespace PonyEngine::Log
 {
 	/// @brief Sub-logger container.
+	/// @details It issues sub-logger handles itself. Finding a sub-logger by its handle takes constant time.
 	class SubLoggerContainer final
 	{
 	public:
@@ -60,11 +62,12 @@ export namespace PonyEngine::Log
 		ISubLogger& SubLogger(std::size_t index) const noexcept;
 
 		/// @brief Adds a sub-logger.
-		/// @param handle Handle.
 		/// @param subLogger Sub-logger.
-		void Add(SubLoggerHandle handle, const std::shared_ptr<ISubLogger>& subLogger);
+		/// @return Handle.
+		SubLoggerHandle Add(const std::shared_ptr<ISubLogger>& subLogger);
 		/// @brief Removes a sub-logger at the @p index.
 		/// @param index Index.
+		/// @note It keeps the order of the rest sub-loggers.
 		void Remove(std::size_t index) noexcept;
 		/// @brief Clears the container.
 		void Clear() noexcept;
@@ -73,8 +76,7 @@ export namespace PonyEngine::Log
 		SubLoggerContainer& operator =(SubLoggerContainer&& other) noexcept = default;
 
 	private:
-		std::vector<SubLoggerHandle> subLoggerHandles; ///< Sub-logger handles.
-		std::vector<std::shared_ptr<ISubLogger>> subLoggers; ///< Sub-loggers.
+		Memory::SlotMap<std::shared_ptr<ISubLogger>> subLoggers; ///< Sub-loggers.
 	};
 }
 
@@ -82,22 +84,22 @@ namespace PonyEngine::Log
 {
 	std::size_t SubLoggerContainer::Size() const noexcept
 	{
-		return subLoggerHandles.size();
+		return subLoggers.Size();
 	}
 
 	std::size_t SubLoggerContainer::IndexOf(const SubLoggerHandle handle) const noexcept
 	{
-		return std::ranges::find(subLoggerHandles, handle) - subLoggerHandles.cbegin();
+		return subLoggers.IndexOf(Memory::SlotKey{.id = handle.id});
 	}
 
 	std::size_t SubLoggerContainer::IndexOf(const ISubLogger& subLogger) const noexcept
 	{
-		return std::ranges::find_if(subLoggers, [&](const std::shared_ptr<ISubLogger>& s) { return s.get() == &subLogger; }) - subLoggers.cbegin();
+		return std::ranges::find_if(subLoggers, [&](const std::shared_ptr<ISubLogger>& s) { return s.get() == &subLogger; }) - subLoggers.begin();
 	}
 
 	SubLoggerHandle SubLoggerContainer::Handle(const std::size_t index) const noexcept
 	{
-		return subLoggerHandles[index];
+		return SubLoggerHandle{.id = subLoggers.Key(index).id};
 	}
 
 	ISubLogger& SubLoggerContainer::SubLogger(const std::size_t index) const noexcept
@@ -105,31 +107,20 @@ namespace PonyEngine::Log
 		return *subLoggers[index];
 	}
 
-	void SubLoggerContainer::Add(const SubLoggerHandle handle, const std::shared_ptr<ISubLogger>& subLogger)
+	SubLoggerHandle SubLoggerContainer::Add(const std::shared_ptr<ISubLogger>& subLogger)
 	{
 		assert(subLogger && "The sub-logger is nullptr.");
 
-		subLoggerHandles.push_back(handle);
-		try
-		{
-			subLoggers.push_back(subLogger);
-		}
-		catch (...)
-		{
-			subLoggerHandles.pop_back();
-			throw;
-		}
+		return SubLoggerHandle{.id = subLoggers.Add(subLogger).id};
 	}
 
 	void SubLoggerContainer::Remove(const std::size_t index) noexcept
 	{
-		subLoggers.erase(subLoggers.cbegin() + index);
-		subLoggerHandles.erase(subLoggerHandles.cbegin() + index);
+		subLoggers.RemoveOrdered(index);
 	}
 
 	void SubLoggerContainer::Clear() noexcept
 	{
-		subLoggerHandles.clear();
-		subLoggers.clear();
+		subLoggers.Clear();
 	}
 }
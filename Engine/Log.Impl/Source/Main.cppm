@@ -11,4 +11,8 @@ export module PonyEngine.Log.Impl;
 
 export import PonyEngine.Log.Ext;
 
+export import :LogCoalescer;
+export import :LogDispatcher;
+export import :Logger;
 export import :LoggerModule;
+export import :LogRecord;
@@ -145,7 +145,8 @@
 		PonyEngine::Log::LogToLogger(logger, exception __VA_OPT__(,) __VA_ARGS__); \
 	} \
 
-/// @brief Log macro that calls the log function if it's enabled with the preprocessors; otherwise it's empty.
+/// @brief Log macro that calls the log function if it's enabled with the preprocessors and the logger filter; otherwise it's empty.
+/// @details The logger filter is checked before the arguments are evaluated.
 /// @param logger PonyEngine::Log::ILogger reference.
 /// @param type PonyEngine::Log::LogType value.
 /// @param message std::string_view as a message or format string.
@@ -154,10 +155,14 @@
 #define PONY_LOG(logger, type, message, ...) \
 	if constexpr (PonyEngine::Log::IsInMask(type, PONY_LOG_MASK)) \
 	{ \
-		PONY_LOG_PUSH(logger, type, message __VA_OPT__(,) __VA_ARGS__) \
+		if (const auto& ponyLogLogger = (logger); ponyLogLogger.Filter().IsEnabled(type)) \
+		{ \
+			PONY_LOG_PUSH(ponyLogLogger, type, message __VA_OPT__(,) __VA_ARGS__) \
+		} \
 	} \
 
-/// @brief Log macro that conditionally calls the log function if it's enabled with the preprocessors; otherwise it's empty.
+/// @brief Log macro that conditionally calls the log function if it's enabled with the preprocessors and the logger filter; otherwise it's empty.
+/// @details The logger filter is checked before the condition and the arguments are evaluated.
 /// @param condition Log condition.
 /// @param logger PonyEngine::Log::ILogger reference.
 /// @param type PonyEngine::Log::LogType value.
@@ -167,13 +172,108 @@
 #define PONY_LOG_IF(condition, logger, type, message, ...) \
 	if constexpr (PonyEngine::Log::IsInMask(type, PONY_LOG_MASK)) \
 	{ \
-		if (condition) \
+		if (const auto& ponyLogLogger = (logger); ponyLogLogger.Filter().IsEnabled(type) && (condition)) \
+		{ \
+			PONY_LOG_PUSH(ponyLogLogger, type, message __VA_OPT__(,) __VA_ARGS__) \
+		} \
+	} \
+
+/// @brief Log macro with a category that calls the log function if it's enabled with the preprocessors and the logger filter; otherwise it's empty.
+/// @details The logger filter is checked before the arguments are evaluated.
+/// @param logger PonyEngine::Log::ILogger reference.
+/// @param category PonyEngine::Log::LogCategory registered in the logger filter.
+/// @param type PonyEngine::Log::LogType value.
+/// @param message std::string_view as a message or format string.
+/// @param ... Format arguments.
+/// @note The function is thread-safe.
+#define PONY_LOG_C(logger, category, type, message, ...) \
+	if constexpr (PonyEngine::Log::IsInMask(type, PONY_LOG_MASK)) \
+	{ \
+		if (const auto& ponyLogLogger = (logger); ponyLogLogger.Filter().IsEnabled(type, category)) \
+		{ \
+			PONY_LOG_PUSH(ponyLogLogger, type, message __VA_OPT__(,) __VA_ARGS__) \
+		} \
+	} \
+
+/// @brief Log macro with a category that conditionally calls the log function if it's enabled with the preprocessors and the logger filter; otherwise it's empty.
+/// @details The logger filter is checked before the condition and the arguments are evaluated.
+/// @param condition Log condition.
+/// @param logger PonyEngine::Log::ILogger reference.
+/// @param category PonyEngine::Log::LogCategory registered in the logger filter.
+/// @param type PonyEngine::Log::LogType value.
+/// @param message std::string_view as a message or format string.
+/// @param ... Format arguments.
+/// @note The function is thread-safe.
+#define PONY_LOG_C_IF(condition, logger, category, type, message, ...) \
+	if constexpr (PonyEngine::Log::IsInMask(type, PONY_LOG_MASK)) \
+	{ \
+		if (const auto& ponyLogLogger = (logger); ponyLogLogger.Filter().IsEnabled(type, category) && (condition)) \
+		{ \
+			PONY_LOG_PUSH(ponyLogLogger, type, message __VA_OPT__(,) __VA_ARGS__) \
+		} \
+	} \
+
+/// @brief Log macro that calls the log function on the first call and then on every @p n-th call of the call site if it's enabled with the preprocessors and the logger filter; otherwise it's empty.
+/// @details The call site counter is a static atomic. Calls rejected by the logger filter aren't counted. The arguments are evaluated only if the log passes.
+/// @param logger PonyEngine::Log::ILogger reference.
+/// @param n Period in calls.
+/// @param type PonyEngine::Log::LogType value.
+/// @param message std::string_view as a message or format string.
+/// @param ... Format arguments.
+/// @note The function is thread-safe.
+#define PONY_LOG_EVERY_N(logger, n, type, message, ...) \
+	if constexpr (PonyEngine::Log::IsInMask(type, PONY_LOG_MASK)) \
+	{ \
+		if (const auto& ponyLogLogger = (logger); ponyLogLogger.Filter().IsEnabled(type)) \
 		{ \
-			PONY_LOG_PUSH(logger, type, message __VA_OPT__(,) __VA_ARGS__) \
+			static constinit PonyEngine::Log::LogEveryN ponyLogEveryN; \
+			if (ponyLogEveryN.Next(n)) \
+			{ \
+				PONY_LOG_PUSH(ponyLogLogger, type, message __VA_OPT__(,) __VA_ARGS__) \
+			} \
 		} \
 	} \
 
-/// @brief Log exception macro that calls the log exception function if it's enabled with the preprocessors; otherwise it's empty.
+/// @brief Log macro that calls the log function at most once per @p interval for the call site if it's enabled with the preprocessors and the logger filter; otherwise it's empty.
+/// @details The call site limiter is a static atomic. The arguments are evaluated only if the log passes.
+/// @param logger PonyEngine::Log::ILogger reference.
+/// @param interval std::chrono::duration as a min interval between logs.
+/// @param type PonyEngine::Log::LogType value.
+/// @param message std::string_view as a message or format string.
+/// @param ... Format arguments.
+/// @note The function is thread-safe.
+#define PONY_LOG_RATE_LIMITED(logger, interval, type, message, ...) \
+	if constexpr (PonyEngine::Log::IsInMask(type, PONY_LOG_MASK)) \
+	{ \
+		if (const auto& ponyLogLogger = (logger); ponyLogLogger.Filter().IsEnabled(type)) \
+		{ \
+			static constinit PonyEngine::Log::LogRateLimiter ponyLogRateLimiter; \
+			if (ponyLogRateLimiter.TryPass(interval)) \
+			{ \
+				PONY_LOG_PUSH(ponyLogLogger, type, message __VA_OPT__(,) __VA_ARGS__) \
+			} \
+		} \
+	} \
+
+/// @brief Structured log macro that calls the log function with fields if it's enabled with the preprocessors and the logger filter; otherwise it's empty.
+/// @details The logger filter is checked before the fields are evaluated. No stacktrace is attached.
+/// @param logger PonyEngine::Log::ILogger reference.
+/// @param type PonyEngine::Log::LogType value.
+/// @param message std::string_view as a message. It isn't formatted.
+/// @param ... PonyEngine::Log::LogField initializers like {"key", value}. At least one is required.
+/// @note The function is thread-safe.
+#define PONY_LOG_FIELDS(logger, type, message, ...) \
+	if constexpr (PonyEngine::Log::IsInMask(type, PONY_LOG_MASK)) \
+	{ \
+		if (const auto& ponyLogLogger = (logger); ponyLogLogger.Filter().IsEnabled(type)) \
+		{ \
+			const PonyEngine::Log::LogField ponyLogFields[] = { __VA_ARGS__ }; \
+			ponyLogLogger.Log(type, message, std::span<const PonyEngine::Log::LogField>(ponyLogFields)); \
+		} \
+	} \
+
+/// @brief Log exception macro that calls the log exception function if it's enabled with the preprocessors and the logger filter; otherwise it's empty.
+/// @details The logger filter is checked before the arguments are evaluated.
 /// @param logger PonyEngine::Log::ILogger reference.
 /// @param exception std::exception reference.
 /// @param ... Message or format and format arguments.
@@ -181,10 +281,14 @@
 #define PONY_LOG_X(logger, exception, ...) \
 	if constexpr (PONY_LOG_EXCEPTION_MASK != PonyEngine::Log::LogTypeMask::None) \
 	{ \
-		PONY_LOG_PUSH_X(logger, exception __VA_OPT__(,) __VA_ARGS__); \
+		if (const auto& ponyLogLogger = (logger); ponyLogLogger.Filter().IsEnabled(PonyEngine::Log::LogType::Exception)) \
+		{ \
+			PONY_LOG_PUSH_X(ponyLogLogger, exception __VA_OPT__(,) __VA_ARGS__); \
+		} \
 	} \
 
-/// @brief Log exception macro that conditionally calls the log exception function if it's enabled with the preprocessors; otherwise it's empty.
+/// @brief Log exception macro that conditionally calls the log exception function if it's enabled with the preprocessors and the logger filter; otherwise it's empty.
+/// @details The logger filter is checked before the condition and the arguments are evaluated.
 /// @param condition Log condition.
 /// @param logger PonyEngine::Log::ILogger reference.
 /// @param exception std::exception reference.
@@ -193,8 +297,8 @@
 #define PONY_LOG_X_IF(condition, logger, exception, ...) \
 	if constexpr (PONY_LOG_EXCEPTION_MASK != PonyEngine::Log::LogTypeMask::None) \
 	{ \
-		if (condition) \
+		if (const auto& ponyLogLogger = (logger); ponyLogLogger.Filter().IsEnabled(PonyEngine::Log::LogType::Exception) && (condition)) \
 		{ \
-			PONY_LOG_PUSH_X(logger, exception __VA_OPT__(,) __VA_ARGS__); \
+			PONY_LOG_PUSH_X(ponyLogLogger, exception __VA_OPT__(,) __VA_ARGS__); \
 		} \
 	} \
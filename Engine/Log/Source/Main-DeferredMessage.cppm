@@ -0,0 +1,246 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Log:DeferredMessage;
+
+import std;
+
+import PonyEngine.Math;
+import PonyEngine.Type;
+
+export namespace PonyEngine::Log
+{
+	/// @brief Max size of the binary format arguments of a deferred message.
+	constexpr std::size_t MaxDeferredArgumentsSize = 256uz;
+
+	/// @brief Checks if the argument is captured by a deferred message as a string.
+	/// @tparam T Argument type.
+	template<typename T>
+	concept DeferredString = std::is_convertible_v<const T&, std::string_view>;
+	/// @brief Is the argument captured by a deferred message by its bytes?
+	/// @details It's @a true for arithmetic types, enums, raw pointers formatted as addresses and math vectors, matrices, quaternions and colors.
+	///          Specialize it with @a true for a trivially copyable type that doesn't reference other data and has a formatter.
+	///          Other types are passed to the logger as format arguments and formatted on the logging thread.
+	/// @tparam T Argument type.
+	template<typename T>
+	constexpr bool IsDeferredByBytes = std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_same_v<T, void*> || std::is_same_v<T, const void*>;
+	template<Type::Arithmetic T, std::size_t Size> requires (Size >= 1uz)
+	constexpr bool IsDeferredByBytes<Math::Vector<T, Size>> = true;
+	template<Type::Arithmetic T, std::size_t RowSize, std::size_t ColumnSize> requires (RowSize >= 1uz && ColumnSize >= 1uz)
+	constexpr bool IsDeferredByBytes<Math::Matrix<T, RowSize, ColumnSize>> = true;
+	template<std::floating_point T>
+	constexpr bool IsDeferredByBytes<Math::Quaternion<T>> = true;
+	template<Math::ColorChannelType T, Math::ColorChannel FirstChannel, Math::ColorChannel SecondChannel, Math::ColorChannel ThirdChannel, Math::ColorChannel FourthChannel>
+	constexpr bool IsDeferredByBytes<Math::Color<T, FirstChannel, SecondChannel, ThirdChannel, FourthChannel>> = true;
+
+	/// @brief Checks if the argument can be captured by a deferred message.
+	/// @details Strings are copied by their characters. Other arguments are copied by their bytes, so they must be opted in with @p IsDeferredByBytes
+	///          because they may be formatted later on another thread.
+	/// @tparam T Argument type.
+	template<typename T>
+	concept DeferredArgument = DeferredString<T> || (IsDeferredByBytes<T> && std::is_trivially_copyable_v<T>);
+
+	/// @brief Log message which formatting is deferred.
+	/// @details It consists of a format string and a binary copy of the format arguments. It's formatted only when it's needed and may be formatted on another thread.
+	///          The format string must be static. The arguments are only referenced, so a logger must copy them if it formats the message later.
+	class DeferredMessage final
+	{
+	public:
+		/// @brief Format function. It decodes the @p arguments and appends the formatted message to the @p target.
+		using FormatFunction = void(*)(std::string& target, std::string_view format, std::span<const std::byte> arguments);
+
+		/// @brief Creates a deferred message.
+		/// @param format Format string.
+		/// @param formatter Format function.
+		/// @param arguments Binary format arguments.
+		[[nodiscard("Pure constructor")]]
+		constexpr DeferredMessage(std::string_view format, FormatFunction formatter, std::span<const std::byte> arguments) noexcept;
+		[[nodiscard("Pure constructor")]]
+		constexpr DeferredMessage(const DeferredMessage& other) noexcept = default;
+		[[nodiscard("Pure constructor")]]
+		constexpr DeferredMessage(DeferredMessage&& other) noexcept = default;
+
+		constexpr ~DeferredMessage() noexcept = default;
+
+		/// @brief Gets the format string.
+		/// @return Format string.
+		[[nodiscard("Pure function")]]
+		constexpr std::string_view Format() const noexcept;
+		/// @brief Gets the format function.
+		/// @return Format function.
+		[[nodiscard("Pure function")]]
+		constexpr FormatFunction Formatter() const noexcept;
+		/// @brief Gets the binary format arguments.
+		/// @return Binary format arguments.
+		[[nodiscard("Pure function")]]
+		constexpr std::span<const std::byte> Arguments() const noexcept;
+
+		/// @brief Formats the message and appends it to the @p target.
+		/// @param target Target string.
+		void FormatTo(std::string& target) const;
+
+		constexpr DeferredMessage& operator =(const DeferredMessage& other) noexcept = default;
+		constexpr DeferredMessage& operator =(DeferredMessage&& other) noexcept = default;
+
+	private:
+		std::string_view format; ///< Format string.
+		FormatFunction formatter; ///< Format function.
+		std::span<const std::byte> arguments; ///< Binary format arguments.
+	};
+
+	/// @brief Calculates the binary size of the deferred arguments.
+	/// @tparam Args Argument types.
+	/// @param args Arguments.
+	/// @return Binary size.
+	template<DeferredArgument... Args> [[nodiscard("Pure function")]]
+	constexpr std::size_t DeferredArgumentsSize(const Args&... args) noexcept;
+	/// @brief Writes the binary copy of the deferred arguments.
+	/// @tparam Args Argument types.
+	/// @param target Target. Its size must be at least @p DeferredArgumentsSize().
+	/// @param args Arguments.
+	template<DeferredArgument... Args>
+	void WriteDeferredArguments(std::span<std::byte> target, const Args&... args) noexcept;
+	/// @brief Decodes the binary deferred arguments and formats them.
+	/// @details It's the format function of the deferred messages made of the @p Args.
+	/// @tparam Args Argument types.
+	/// @param target Target string. The formatted message is appended to it.
+	/// @param format Format string.
+	/// @param arguments Binary arguments written by the @p WriteDeferredArguments().
+	template<DeferredArgument... Args>
+	void FormatDeferredArguments(std::string& target, std::string_view format, std::span<const std::byte> arguments);
+}
+
+namespace PonyEngine::Log
+{
+	/// @brief Type that is formatted in place of the deferred argument.
+	/// @tparam T Argument type.
+	template<typename T>
+	using DeferredValue = std::conditional_t<DeferredString<T>, std::string_view, T>;
+
+	/// @brief Calculates the binary size of the deferred argument.
+	/// @tparam T Argument type.
+	/// @param arg Argument.
+	/// @return Binary size.
+	template<DeferredArgument T> [[nodiscard("Pure function")]]
+	constexpr std::size_t DeferredArgumentSize(const T& arg) noexcept;
+	/// @brief Writes the binary copy of the deferred argument.
+	/// @tparam T Argument type.
+	/// @param target Target. It's advanced by the written size.
+	/// @param arg Argument.
+	template<DeferredArgument T>
+	void WriteDeferredArgument(std::byte*& target, const T& arg) noexcept;
+	/// @brief Reads the deferred argument.
+	/// @tparam T Argument type.
+	/// @param source Source. It's advanced by the read size.
+	/// @return Argument value. A string view references the @p source.
+	template<DeferredArgument T> [[nodiscard("Must use the result")]]
+	DeferredValue<T> ReadDeferredArgument(const std::byte*& source) noexcept;
+
+	constexpr DeferredMessage::DeferredMessage(const std::string_view format, const FormatFunction formatter, const std::span<const std::byte> arguments) noexcept :
+		format(format),
+		formatter{formatter},
+		arguments(arguments)
+	{
+	}
+
+	constexpr std::string_view DeferredMessage::Format() const noexcept
+	{
+		return format;
+	}
+
+	constexpr DeferredMessage::FormatFunction DeferredMessage::Formatter() const noexcept
+	{
+		return formatter;
+	}
+
+	constexpr std::span<const std::byte> DeferredMessage::Arguments() const noexcept
+	{
+		return arguments;
+	}
+
+	void DeferredMessage::FormatTo(std::string& target) const
+	{
+		formatter(target, format, arguments);
+	}
+
+	template<DeferredArgument... Args>
+	constexpr std::size_t DeferredArgumentsSize(const Args&... args) noexcept
+	{
+		return (0uz + ... + DeferredArgumentSize(args));
+	}
+
+	template<DeferredArgument... Args>
+	void WriteDeferredArguments(const std::span<std::byte> target, const Args&... args) noexcept
+	{
+		std::byte* position = target.data();
+		(WriteDeferredArgument(position, args), ...);
+	}
+
+	template<DeferredArgument... Args>
+	void FormatDeferredArguments(std::string& target, const std::string_view format, const std::span<const std::byte> arguments)
+	{
+		const std::byte* source = arguments.data();
+		// Braced initialization guarantees the left-to-right read order.
+		auto values = std::tuple<DeferredValue<Args>...>{ReadDeferredArgument<Args>(source)...};
+		std::apply([&](auto&... args) { std::vformat_to(std::back_inserter(target), format, std::make_format_args(args...)); }, values);
+	}
+
+	template<DeferredArgument T>
+	constexpr std::size_t DeferredArgumentSize(const T& arg) noexcept
+	{
+		if constexpr (DeferredString<T>)
+		{
+			return sizeof(std::uint32_t) + std::string_view(arg).size();
+		}
+		else
+		{
+			return sizeof(T);
+		}
+	}
+
+	template<DeferredArgument T>
+	void WriteDeferredArgument(std::byte*& target, const T& arg) noexcept
+	{
+		if constexpr (DeferredString<T>)
+		{
+			const auto string = std::string_view(arg);
+			const auto size = static_cast<std::uint32_t>(string.size());
+			std::memcpy(target, &size, sizeof(size));
+			target = std::ranges::copy(std::as_bytes(std::span(string)), target + sizeof(size)).out;
+		}
+		else
+		{
+			std::memcpy(target, std::addressof(arg), sizeof(T));
+			target += sizeof(T);
+		}
+	}
+
+	template<DeferredArgument T>
+	DeferredValue<T> ReadDeferredArgument(const std::byte*& source) noexcept
+	{
+		if constexpr (DeferredString<T>)
+		{
+			std::uint32_t size;
+			std::memcpy(&size, source, sizeof(size));
+			source += sizeof(size);
+			const auto string = std::string_view(reinterpret_cast<const char*>(source), size);
+			source += size;
+
+			return string;
+		}
+		else
+		{
+			alignas(T) std::byte storage[sizeof(T)];
+			std::memcpy(storage, source, sizeof(T));
+			source += sizeof(T);
+
+			return *std::launder(reinterpret_cast<T*>(storage));
+		}
+	}
+}
@@ -15,6 +15,9 @@ export module PonyEngine.Log:ILogger;
 
 import std;
 
+import :DeferredMessage;
+import :LogField;
+import :LogFilter;
 import :LogType;
 
 export namespace PonyEngine::Log
@@ -24,6 +27,19 @@ export namespace PonyEngine::Log
 	{
 		PONY_INTERFACE_BODY(ILogger)
 
+		/// @brief Gets the runtime log filter.
+		/// @details The log macros check it before evaluating the log arguments. Use it to change the enabled log types and categories while running.
+		/// @return Log filter.
+		/// @note The function is thread-safe.
+		[[nodiscard("Pure function")]]
+		virtual LogFilter& Filter() noexcept = 0;
+		/// @brief Gets the runtime log filter.
+		/// @details The log macros check it before evaluating the log arguments.
+		/// @return Log filter.
+		/// @note The function is thread-safe.
+		[[nodiscard("Pure function")]]
+		virtual const LogFilter& Filter() const noexcept = 0;
+
 		/// @brief Logs a message.
 		/// @param logType Log type.
 		/// @param message Log message.
@@ -48,6 +64,23 @@ export namespace PonyEngine::Log
 		/// @param stacktrace Stacktrace.
 		/// @note The function is thread-safe.
 		virtual void Log(LogType logType, std::string_view format, std::format_args formatArgs, const std::stacktrace& stacktrace) const noexcept = 0;
+		/// @brief Logs a deferred message.
+		/// @param logType Log type.
+		/// @param message Deferred message. Its arguments are valid only during the call.
+		/// @note The function is thread-safe.
+		virtual void Log(LogType logType, const DeferredMessage& message) const noexcept = 0;
+		/// @brief Logs a deferred message with the stacktrace.
+		/// @param logType Log type.
+		/// @param message Deferred message. Its arguments are valid only during the call.
+		/// @param stacktrace Stacktrace.
+		/// @note The function is thread-safe.
+		virtual void Log(LogType logType, const DeferredMessage& message, const std::stacktrace& stacktrace) const noexcept = 0;
+		/// @brief Logs a message with structured fields.
+		/// @param logType Log type.
+		/// @param message Log message.
+		/// @param fields Structured fields. They're valid only during the call.
+		/// @note The function is thread-safe.
+		virtual void Log(LogType logType, std::string_view message, std::span<const LogField> fields) const noexcept = 0;
 
 		/// @brief Logs the exception.
 		/// @param exception Exception.
@@ -0,0 +1,269 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+module;
+
+#include <cassert>
+
+export module PonyEngine.Log:LogField;
+
+import std;
+
+export namespace PonyEngine::Log
+{
+	/// @brief Log field value type.
+	enum class LogFieldType : std::uint8_t
+	{
+		Int, ///< Signed integer.
+		UInt, ///< Unsigned integer.
+		Float, ///< Floating point number.
+		Bool, ///< Boolean.
+		String ///< String.
+	};
+
+	/// @brief Typed key/value pair attached to a structured log.
+	/// @details It only references the key and the string value; they must be valid during the log call.
+	class LogField final
+	{
+	public:
+		/// @brief Creates a signed integer field.
+		/// @tparam T Value type.
+		/// @param key Key.
+		/// @param value Value.
+		template<std::signed_integral T> [[nodiscard("Pure constructor")]]
+		constexpr LogField(std::string_view key, T value) noexcept;
+		/// @brief Creates an unsigned integer field.
+		/// @tparam T Value type.
+		/// @param key Key.
+		/// @param value Value.
+		template<std::unsigned_integral T> [[nodiscard("Pure constructor")]]
+		constexpr LogField(std::string_view key, T value) noexcept;
+		/// @brief Creates a floating point field.
+		/// @tparam T Value type.
+		/// @param key Key.
+		/// @param value Value.
+		template<std::floating_point T> [[nodiscard("Pure constructor")]]
+		constexpr LogField(std::string_view key, T value) noexcept;
+		/// @brief Creates a boolean field.
+		/// @param key Key.
+		/// @param value Value.
+		[[nodiscard("Pure constructor")]]
+		constexpr LogField(std::string_view key, bool value) noexcept;
+		/// @brief Creates a string field.
+		/// @param key Key.
+		/// @param value Value.
+		[[nodiscard("Pure constructor")]]
+		constexpr LogField(std::string_view key, std::string_view value) noexcept;
+		/// @brief Creates a string field.
+		/// @note This overload keeps string literals from being converted to a boolean.
+		/// @param key Key.
+		/// @param value Null-terminated value.
+		[[nodiscard("Pure constructor")]]
+		constexpr LogField(std::string_view key, const char* value) noexcept;
+		[[nodiscard("Pure constructor")]]
+		constexpr LogField(const LogField& other) noexcept = default;
+		[[nodiscard("Pure constructor")]]
+		constexpr LogField(LogField&& other) noexcept = default;
+
+		constexpr ~LogField() noexcept = default;
+
+		/// @brief Gets the key.
+		/// @return Key.
+		[[nodiscard("Pure function")]]
+		constexpr std::string_view Key() const noexcept;
+		/// @brief Gets the value type.
+		/// @return Value type.
+		[[nodiscard("Pure function")]]
+		constexpr LogFieldType Type() const noexcept;
+
+		/// @brief Gets the signed integer value.
+		/// @return Value.
+		/// @note It may be called only if the type is @p LogFieldType::Int.
+		[[nodiscard("Pure function")]]
+		constexpr std::int64_t Int() const noexcept;
+		/// @brief Gets the unsigned integer value.
+		/// @return Value.
+		/// @note It may be called only if the type is @p LogFieldType::UInt.
+		[[nodiscard("Pure function")]]
+		constexpr std::uint64_t UInt() const noexcept;
+		/// @brief Gets the floating point value.
+		/// @return Value.
+		/// @note It may be called only if the type is @p LogFieldType::Float.
+		[[nodiscard("Pure function")]]
+		constexpr double Float() const noexcept;
+		/// @brief Gets the boolean value.
+		/// @return Value.
+		/// @note It may be called only if the type is @p LogFieldType::Bool.
+		[[nodiscard("Pure function")]]
+		constexpr bool Bool() const noexcept;
+		/// @brief Gets the string value.
+		/// @return Value.
+		/// @note It may be called only if the type is @p LogFieldType::String.
+		[[nodiscard("Pure function")]]
+		constexpr std::string_view String() const noexcept;
+
+		/// @brief Makes a copy of the field that references another key and string value.
+		/// @details It's used to move the field strings into another storage.
+		/// @param key Key.
+		/// @param string String value. It's ignored if the type isn't @p LogFieldType::String.
+		/// @return Field copy.
+		[[nodiscard("Pure function")]]
+		constexpr LogField Rebind(std::string_view key, std::string_view string) const noexcept;
+
+		constexpr LogField& operator =(const LogField& other) noexcept = default;
+		constexpr LogField& operator =(LogField&& other) noexcept = default;
+
+	private:
+		std::string_view key; ///< Key.
+		union
+		{
+			std::int64_t intValue; ///< Signed integer value.
+			std::uint64_t uintValue; ///< Unsigned integer value.
+			double floatValue; ///< Floating point value.
+			bool boolValue; ///< Boolean value.
+			std::string_view stringValue; ///< String value.
+		};
+		LogFieldType type; ///< Value type.
+	};
+}
+
+/// @brief Log field formatter.
+/// @details The format is "{}". A field is formatted as "key=value".
+export template<>
+struct std::formatter<PonyEngine::Log::LogField, char>
+{
+	constexpr std::format_parse_context::iterator parse(std::format_parse_context& context)
+	{
+		auto it = context.begin();
+		if (it != context.end() && *it != '}') [[unlikely]]
+		{
+			throw std::format_error("Unexpected log field format specifier");
+		}
+
+		return it;
+	}
+
+	std::format_context::iterator format(const PonyEngine::Log::LogField& field, std::format_context& context) const
+	{
+		switch (field.Type())
+		{
+		case PonyEngine::Log::LogFieldType::Int:
+			return std::format_to(context.out(), "{}={}", field.Key(), field.Int());
+		case PonyEngine::Log::LogFieldType::UInt:
+			return std::format_to(context.out(), "{}={}", field.Key(), field.UInt());
+		case PonyEngine::Log::LogFieldType::Float:
+			return std::format_to(context.out(), "{}={}", field.Key(), field.Float());
+		case PonyEngine::Log::LogFieldType::Bool:
+			return std::format_to(context.out(), "{}={}", field.Key(), field.Bool());
+		case PonyEngine::Log::LogFieldType::String:
+			return std::format_to(context.out(), "{}={}", field.Key(), field.String());
+		default: [[unlikely]]
+			assert(false && "Incorrect log field type.");
+			return context.out();
+		}
+	}
+};
+
+namespace PonyEngine::Log
+{
+	template<std::signed_integral T>
+	constexpr LogField::LogField(const std::string_view key, const T value) noexcept :
+		key(key),
+		intValue{static_cast<std::int64_t>(value)},
+		type{LogFieldType::Int}
+	{
+	}
+
+	template<std::unsigned_integral T>
+	constexpr LogField::LogField(const std::string_view key, const T value) noexcept :
+		key(key),
+		uintValue{static_cast<std::uint64_t>(value)},
+		type{LogFieldType::UInt}
+	{
+	}
+
+	template<std::floating_point T>
+	constexpr LogField::LogField(const std::string_view key, const T value) noexcept :
+		key(key),
+		floatValue{static_cast<double>(value)},
+		type{LogFieldType::Float}
+	{
+	}
+
+	constexpr LogField::LogField(const std::string_view key, const bool value) noexcept :
+		key(key),
+		boolValue{value},
+		type{LogFieldType::Bool}
+	{
+	}
+
+	constexpr LogField::LogField(const std::string_view key, const std::string_view value) noexcept :
+		key(key),
+		stringValue(value),
+		type{LogFieldType::String}
+	{
+	}
+
+	constexpr LogField::LogField(const std::string_view key, const char* const value) noexcept :
+		LogField(key, std::string_view(value))
+	{
+	}
+
+	constexpr std::string_view LogField::Key() const noexcept
+	{
+		return key;
+	}
+
+	constexpr LogFieldType LogField::Type() const noexcept
+	{
+		return type;
+	}
+
+	constexpr std::int64_t LogField::Int() const noexcept
+	{
+		assert(type == LogFieldType::Int && "The field isn't a signed integer.");
+		return intValue;
+	}
+
+	constexpr std::uint64_t LogField::UInt() const noexcept
+	{
+		assert(type == LogFieldType::UInt && "The field isn't an unsigned integer.");
+		return uintValue;
+	}
+
+	constexpr double LogField::Float() const noexcept
+	{
+		assert(type == LogFieldType::Float && "The field isn't a floating point number.");
+		return floatValue;
+	}
+
+	constexpr bool LogField::Bool() const noexcept
+	{
+		assert(type == LogFieldType::Bool && "The field isn't a boolean.");
+		return boolValue;
+	}
+
+	constexpr std::string_view LogField::String() const noexcept
+	{
+		assert(type == LogFieldType::String && "The field isn't a string.");
+		return stringValue;
+	}
+
+	constexpr LogField LogField::Rebind(const std::string_view key, const std::string_view string) const noexcept
+	{
+		LogField field = *this;
+		field.key = key;
+		if (type == LogFieldType::String)
+		{
+			field.stringValue = string;
+		}
+
+		return field;
+	}
+}
@@ -0,0 +1,240 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+module;
+
+#include <cassert>
+
+export module PonyEngine.Log:LogFilter;
+
+import std;
+
+import :LogType;
+
+export namespace PonyEngine::Log
+{
+	/// @brief Log category. It's registered in a log filter and is valid only for that filter.
+	struct LogCategory final
+	{
+		std::uint8_t id = 0u; ///< Category index.
+
+		[[nodiscard("Pure operator")]]
+		constexpr bool operator ==(const LogCategory& other) const noexcept = default;
+	};
+
+	/// @brief Default log category. It's always registered.
+	constexpr LogCategory DefaultLogCategory = LogCategory{};
+
+	/// @brief Runtime log filter.
+	/// @details The log type mask and the category mask are packed into one atomic word,
+	///          so a check is a single relaxed load. A log passes if both its type and its category are enabled.
+	class LogFilter final
+	{
+	public:
+		/// @brief Max category count including the default one.
+		static constexpr std::size_t MaxCategoryCount = 56uz;
+		/// @brief Default category name.
+		static constexpr std::string_view DefaultCategoryName = "Default";
+
+		/// @brief Creates a log filter with all the types enabled and only the default category registered.
+		[[nodiscard("Pure constructor")]]
+		LogFilter() noexcept;
+		LogFilter(const LogFilter&) = delete;
+		LogFilter(LogFilter&&) = delete;
+
+		~LogFilter() noexcept = default;
+
+		/// @brief Checks if the log passes the filter.
+		/// @param logType Log type.
+		/// @param category Log category.
+		/// @return @a True if it passes; @a false otherwise.
+		/// @note The function is thread-safe.
+		[[nodiscard("Pure function")]]
+		bool IsEnabled(LogType logType, LogCategory category = DefaultLogCategory) const noexcept;
+
+		/// @brief Gets the enabled log types.
+		/// @return Log type mask.
+		/// @note The function is thread-safe.
+		[[nodiscard("Pure function")]]
+		LogTypeMask TypeMask() const noexcept;
+		/// @brief Sets the enabled log types.
+		/// @param mask Log type mask.
+		/// @note The function is thread-safe.
+		void TypeMask(LogTypeMask mask) noexcept;
+		/// @brief Enables the log types with the same or higher severity than the @p logType and disables the others.
+		/// @param logType Min log type.
+		/// @note The function is thread-safe.
+		void MinType(LogType logType) noexcept;
+
+		/// @brief Checks if the category is enabled.
+		/// @param category Category.
+		/// @return @a True if it's enabled; @a false otherwise.
+		/// @note The function is thread-safe.
+		[[nodiscard("Pure function")]]
+		bool IsCategoryEnabled(LogCategory category) const noexcept;
+		/// @brief Enables or disables the category.
+		/// @param category Category.
+		/// @param enable @a True to enable; @a false to disable.
+		/// @note The function is thread-safe.
+		void EnableCategory(LogCategory category, bool enable) noexcept;
+
+		/// @brief Registers a category. If a category with the same name is already registered, it's returned.
+		/// @param name Category name.
+		/// @return Category. A new category is enabled.
+		/// @throws std::length_error If the max category count is reached.
+		/// @note The function is thread-safe.
+		LogCategory RegisterCategory(std::string_view name);
+		/// @brief Finds a category by its name.
+		/// @param name Category name.
+		/// @return Category if it's found; @a std::nullopt otherwise.
+		/// @note The function is thread-safe.
+		[[nodiscard("Pure function")]]
+		std::optional<LogCategory> FindCategory(std::string_view name) const noexcept;
+		/// @brief Gets the registered category count.
+		/// @return Category count.
+		/// @note The function is thread-safe.
+		[[nodiscard("Pure function")]]
+		std::size_t CategoryCount() const noexcept;
+		/// @brief Gets the category name.
+		/// @param category Registered category.
+		/// @return Category name.
+		/// @note The function is thread-safe.
+		[[nodiscard("Pure function")]]
+		std::string_view CategoryName(LogCategory category) const noexcept;
+
+		LogFilter& operator =(const LogFilter&) = delete;
+		LogFilter& operator =(LogFilter&&) = delete;
+
+	private:
+		/// @brief Category bit offset in the filter word.
+		static constexpr std::size_t CategoryOffset = 8uz;
+		/// @brief Type bits in the filter word.
+		static constexpr std::uint64_t TypeBits = (std::uint64_t{1} << CategoryOffset) - 1ull;
+
+		/// @brief Gets the category bit.
+		/// @param category Category.
+		/// @return Category bit.
+		[[nodiscard("Pure function")]]
+		static constexpr std::uint64_t CategoryBit(LogCategory category) noexcept;
+
+		std::atomic<std::uint64_t> word; ///< Type mask in the low byte and category mask in the rest.
+
+		std::array<std::string, MaxCategoryCount> categoryNames; ///< Category names. The default category name isn't stored here. An entry is immutable once it's published by the count.
+		std::atomic<std::size_t> categoryCount; ///< Registered category count.
+		std::mutex categoryMutex; ///< Category registration mutex.
+	};
+}
+
+namespace PonyEngine::Log
+{
+	LogFilter::LogFilter() noexcept :
+		word{static_cast<std::uint64_t>(LogTypeMask::All) | CategoryBit(DefaultLogCategory)},
+		categoryCount{1uz}
+	{
+	}
+
+	bool LogFilter::IsEnabled(const LogType logType, const LogCategory category) const noexcept
+	{
+		const std::uint64_t required = static_cast<std::uint64_t>(ToMask(logType)) | CategoryBit(category);
+
+		return (word.load(std::memory_order::relaxed) & required) == required;
+	}
+
+	LogTypeMask LogFilter::TypeMask() const noexcept
+	{
+		return static_cast<LogTypeMask>(word.load(std::memory_order::relaxed) & TypeBits);
+	}
+
+	void LogFilter::TypeMask(const LogTypeMask mask) noexcept
+	{
+		std::uint64_t current = word.load(std::memory_order::relaxed);
+		while (!word.compare_exchange_weak(current, (current & ~TypeBits) | static_cast<std::uint64_t>(mask), std::memory_order::relaxed))
+		{
+		}
+	}
+
+	void LogFilter::MinType(const LogType logType) noexcept
+	{
+		const auto minBit = static_cast<std::uint64_t>(ToMask(logType));
+		TypeMask(static_cast<LogTypeMask>(static_cast<std::uint64_t>(LogTypeMask::All) & ~(minBit - 1ull)));
+	}
+
+	bool LogFilter::IsCategoryEnabled(const LogCategory category) const noexcept
+	{
+		return word.load(std::memory_order::relaxed) & CategoryBit(category);
+	}
+
+	void LogFilter::EnableCategory(const LogCategory category, const bool enable) noexcept
+	{
+		if (enable)
+		{
+			word.fetch_or(CategoryBit(category), std::memory_order::relaxed);
+		}
+		else
+		{
+			word.fetch_and(~CategoryBit(category), std::memory_order::relaxed);
+		}
+	}
+
+	LogCategory LogFilter::RegisterCategory(const std::string_view name)
+	{
+		const auto lock = std::lock_guard(categoryMutex);
+
+		const std::size_t count = categoryCount.load(std::memory_order::relaxed);
+		for (std::size_t i = 0uz; i < count; ++i)
+		{
+			if (CategoryName(LogCategory{.id = static_cast<std::uint8_t>(i)}) == name)
+			{
+				return LogCategory{.id = static_cast<std::uint8_t>(i)};
+			}
+		}
+
+		if (count >= MaxCategoryCount) [[unlikely]]
+		{
+			throw std::length_error("Too many log categories");
+		}
+
+		categoryNames[count] = name;
+		const auto category = LogCategory{.id = static_cast<std::uint8_t>(count)};
+		word.fetch_or(CategoryBit(category), std::memory_order::relaxed);
+		categoryCount.store(count + 1uz, std::memory_order::release);
+
+		return category;
+	}
+
+	std::optional<LogCategory> LogFilter::FindCategory(const std::string_view name) const noexcept
+	{
+		const std::size_t count = categoryCount.load(std::memory_order::acquire);
+		for (std::size_t i = 0uz; i < count; ++i)
+		{
+			if (CategoryName(LogCategory{.id = static_cast<std::uint8_t>(i)}) == name)
+			{
+				return LogCategory{.id = static_cast<std::uint8_t>(i)};
+			}
+		}
+
+		return std::nullopt;
+	}
+
+	std::size_t LogFilter::CategoryCount() const noexcept
+	{
+		return categoryCount.load(std::memory_order::acquire);
+	}
+
+	std::string_view LogFilter::CategoryName(const LogCategory category) const noexcept
+	{
+		assert(category.id < categoryCount.load(std::memory_order::acquire) && "The category isn't registered.");
+		return category == DefaultLogCategory ? DefaultCategoryName : std::string_view(categoryNames[category.id]);
+	}
+
+	constexpr std::uint64_t LogFilter::CategoryBit(const LogCategory category) noexcept
+	{
+		return std::uint64_t{1} << (CategoryOffset + category.id);
+	}
+}
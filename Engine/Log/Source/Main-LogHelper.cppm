@@ -11,6 +11,7 @@ export module PonyEngine.Log:LogHelper;
 
 import std;
 
+import :DeferredMessage;
 import :ILogger;
 import :LogType;
 
@@ -23,6 +24,7 @@ export namespace PonyEngine::Log
 	/// @note The function is thread-safe.
 	void LogToLogger(const ILogger& logger, LogType logType, std::string_view message) noexcept;
 	/// @brief Logs to the logger.
+	/// @details If all the arguments are @p DeferredArgument and fit into @p MaxDeferredArgumentsSize, the message is passed as a @p DeferredMessage.
 	/// @tparam Args Format argument types.
 	/// @param logger Logger.
 	/// @param logType Log type.
@@ -39,6 +41,7 @@ export namespace PonyEngine::Log
 	/// @note The function is thread-safe.
 	void LogToLogger(const ILogger& logger, LogType logType, const std::stacktrace& stacktrace, std::string_view message) noexcept;
 	/// @brief Logs to the logger.
+	/// @details If all the arguments are @p DeferredArgument and fit into @p MaxDeferredArgumentsSize, the message is passed as a @p DeferredMessage.
 	/// @tparam Args Format argument types.
 	/// @param logger Logger.
 	/// @param logType Log type.
@@ -104,6 +107,18 @@ namespace PonyEngine::Log
 	template<typename... Args>
 	void LogToLogger(const ILogger& logger, const LogType logType, const std::format_string<Args...> format, Args&&... args) noexcept
 	{
+		if constexpr ((DeferredArgument<std::remove_cvref_t<Args>> && ...))
+		{
+			if (const std::size_t size = DeferredArgumentsSize(args...); size <= MaxDeferredArgumentsSize) [[likely]]
+			{
+				std::array<std::byte, MaxDeferredArgumentsSize> arguments;
+				WriteDeferredArguments(arguments, args...);
+				logger.Log(logType, DeferredMessage(format.get(), &FormatDeferredArguments<std::remove_cvref_t<Args>...>, std::span(arguments.data(), size)));
+
+				return;
+			}
+		}
+
 		logger.Log(logType, format.get(), std::make_format_args(args...));
 	}
 
@@ -120,6 +135,18 @@ namespace PonyEngine::Log
 	template<typename... Args>
 	void LogToLogger(const ILogger& logger, const LogType logType, const std::stacktrace& stacktrace, const std::format_string<Args...> format, Args&&... args) noexcept
 	{
+		if constexpr ((DeferredArgument<std::remove_cvref_t<Args>> && ...))
+		{
+			if (const std::size_t size = DeferredArgumentsSize(args...); size <= MaxDeferredArgumentsSize) [[likely]]
+			{
+				std::array<std::byte, MaxDeferredArgumentsSize> arguments;
+				WriteDeferredArguments(arguments, args...);
+				logger.Log(logType, DeferredMessage(format.get(), &FormatDeferredArguments<std::remove_cvref_t<Args>...>, std::span(arguments.data(), size)), stacktrace);
+
+				return;
+			}
+		}
+
 		logger.Log(logType, format.get(), std::make_format_args(args...), stacktrace);
 	}
 
@@ -0,0 +1,112 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Log:LogThrottle;
+
+import std;
+
+export namespace PonyEngine::Log
+{
+	/// @brief Call site counter that passes every n-th log.
+	/// @details It's meant to be a constinit static of a log call site. It's a single relaxed atomic increment per call.
+	class LogEveryN final
+	{
+	public:
+		[[nodiscard("Pure constructor")]]
+		constexpr LogEveryN() noexcept = default;
+		LogEveryN(const LogEveryN&) = delete;
+		LogEveryN(LogEveryN&&) = delete;
+
+		constexpr ~LogEveryN() noexcept = default;
+
+		/// @brief Counts the call and checks if it passes.
+		/// @param n Period in calls. The first call and then every n-th call pass. 0 is treated as 1.
+		/// @return @a True if the call passes; @a false otherwise.
+		/// @note The function is thread-safe.
+		bool Next(std::uint64_t n) noexcept;
+
+		LogEveryN& operator =(const LogEveryN&) = delete;
+		LogEveryN& operator =(LogEveryN&&) = delete;
+
+	private:
+		std::atomic<std::uint64_t> count; ///< Call count.
+	};
+
+	/// @brief Call site limiter that passes at most one log per interval.
+	/// @details It's meant to be a constinit static of a log call site. A rejected call is a single relaxed load; a passed call is a compare-exchange.
+	class LogRateLimiter final
+	{
+	public:
+		[[nodiscard("Pure constructor")]]
+		constexpr LogRateLimiter() noexcept = default;
+		LogRateLimiter(const LogRateLimiter&) = delete;
+		LogRateLimiter(LogRateLimiter&&) = delete;
+
+		constexpr ~LogRateLimiter() noexcept = default;
+
+		/// @brief Checks if the call passes and starts a new interval if it does.
+		/// @tparam Rep Interval representation.
+		/// @tparam Period Interval period.
+		/// @param interval Min interval between passed calls.
+		/// @return @a True if the call passes; @a false otherwise.
+		/// @note The function is thread-safe.
+		template<typename Rep, typename Period>
+		bool TryPass(std::chrono::duration<Rep, Period> interval) noexcept;
+
+		/// @brief Gets the count of the rejected calls.
+		/// @return Rejected call count.
+		/// @note The function is thread-safe.
+		[[nodiscard("Pure function")]]
+		std::uint64_t RejectedCount() const noexcept;
+
+		LogRateLimiter& operator =(const LogRateLimiter&) = delete;
+		LogRateLimiter& operator =(LogRateLimiter&&) = delete;
+
+	private:
+		/// @brief Checks if the call passes and starts a new interval if it does.
+		/// @param interval Min interval between passed calls.
+		/// @return @a True if the call passes; @a false otherwise.
+		bool TryPassSteady(std::chrono::steady_clock::duration interval) noexcept;
+
+		std::atomic<std::chrono::steady_clock::rep> nextTime; ///< Steady clock time since which the next call passes.
+		std::atomic<std::uint64_t> rejectedCount; ///< Rejected call count.
+	};
+}
+
+namespace PonyEngine::Log
+{
+	bool LogEveryN::Next(const std::uint64_t n) noexcept
+	{
+		return count.fetch_add(1ull, std::memory_order::relaxed) % std::max(n, std::uint64_t{1}) == 0ull;
+	}
+
+	template<typename Rep, typename Period>
+	bool LogRateLimiter::TryPass(const std::chrono::duration<Rep, Period> interval) noexcept
+	{
+		return TryPassSteady(std::chrono::duration_cast<std::chrono::steady_clock::duration>(interval));
+	}
+
+	std::uint64_t LogRateLimiter::RejectedCount() const noexcept
+	{
+		return rejectedCount.load(std::memory_order::relaxed);
+	}
+
+	bool LogRateLimiter::TryPassSteady(const std::chrono::steady_clock::duration interval) noexcept
+	{
+		const std::chrono::steady_clock::rep now = std::chrono::steady_clock::now().time_since_epoch().count();
+		std::chrono::steady_clock::rep next = nextTime.load(std::memory_order::relaxed);
+		if (now < next || !nextTime.compare_exchange_strong(next, now + interval.count(), std::memory_order::relaxed))
+		{
+			rejectedCount.fetch_add(1ull, std::memory_order::relaxed);
+			return false;
+		}
+
+		return true;
+	}
+}
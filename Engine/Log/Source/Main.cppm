@@ -9,6 +9,10 @@
 
 export module PonyEngine.Log;
 
+export import :DeferredMessage;
 export import :ILogger;
+export import :LogField;
+export import :LogFilter;
 export import :LogHelper;
+export import :LogThrottle;
 export import :LogType;
@@ -15,6 +15,8 @@ export module PonyEngine.RawInput.Ext:IRawInputModuleContext;
 
 import std;
 
+import PonyEngine.Type;
+
 import :IInputProvider;
 import :InputProviderHandle;
 import :IRawInputContext;
@@ -31,7 +33,7 @@ export namespace PonyEngine::RawInput
 		/// @return Input provider handle. Must be used to remove a provider before a destruction of the raw input service.
 		/// @note The function must be called on a main thread.
 		[[nodiscard("Must be used to remove")]]
-		virtual InputProviderHandle AddProvider(const std::function<std::shared_ptr<IInputProvider>(IRawInputContext&)>& factory) = 0;
+		virtual InputProviderHandle AddProvider(Type::FunctionRef<std::shared_ptr<IInputProvider>(IRawInputContext&)> factory) = 0;
 		/// @brief Removes an input provider.
 		/// @param providerHandle Input provider handle.
 		/// @note The function must be called on a main thread.
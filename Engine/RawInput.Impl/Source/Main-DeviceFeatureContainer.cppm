@@ -11,6 +11,8 @@ export module PonyEngine.RawInput.Impl:DeviceFeatureContainer;
 
 import std;
 
+import PonyEngine.Memory;
+
 export namespace PonyEngine::RawInput
 {
 	/// @brief Device feature container.
@@ -67,8 +69,10 @@ export namespace PonyEngine::RawInput
 		DeviceFeatureContainer& operator =(DeviceFeatureContainer&& other) noexcept = default;
 
 	private:
-		std::vector<std::type_index> featureTypes; ///< Feature types.
-		std::vector<void*> features; ///< Features.
+		static constexpr std::size_t InlineFeatureCount = 4uz; ///< Feature count that a container keeps without a heap allocation.
+
+		Memory::SmallVector<std::type_index, InlineFeatureCount> featureTypes; ///< Feature types.
+		Memory::SmallVector<void*, InlineFeatureCount> features; ///< Features.
 	};
 }
 
@@ -76,12 +80,12 @@ namespace PonyEngine::RawInput
 {
 	std::size_t DeviceFeatureContainer::Size() const noexcept
 	{
-		return featureTypes.size();
+		return featureTypes.Size();
 	}
 
 	std::size_t DeviceFeatureContainer::IndexOf(const std::type_index type) const noexcept
 	{
-		return std::ranges::find(featureTypes, type) - featureTypes.cbegin();
+		return std::ranges::find(featureTypes, type) - featureTypes.begin();
 	}
 
 	std::type_index DeviceFeatureContainer::Type(const std::size_t index) const noexcept
@@ -101,27 +105,27 @@ namespace PonyEngine::RawInput
 
 	void DeviceFeatureContainer::Add(const std::type_index type, void* const feature)
 	{
-		featureTypes.push_back(type);
+		featureTypes.Add(type);
 		try
 		{
-			features.push_back(feature);
+			features.Add(feature);
 		}
 		catch (...)
 		{
-			featureTypes.pop_back();
+			featureTypes.RemoveLast();
 			throw;
 		}
 	}
 
 	void DeviceFeatureContainer::Remove(const std::size_t index) noexcept
 	{
-		features.erase(features.cbegin() + index);
-		featureTypes.erase(featureTypes.cbegin() + index);
+		features.Remove(index);
+		featureTypes.Remove(index);
 	}
 
 	void DeviceFeatureContainer::Clear() noexcept
 	{
-		featureTypes.clear();
-		features.clear();
+		featureTypes.Clear();
+		features.Clear();
 	}
 }
@@ -15,6 +15,7 @@ export module PonyEngine.RawInput.Impl:InputDeviceContainer;
 
 import std;
 
+import PonyEngine.Memory;
 import PonyEngine.RawInput.Ext;
 
 import :DeviceFeatureContainer;
@@ -22,6 +23,7 @@ import :DeviceFeatureContainer;
 export namespace PonyEngine::RawInput
 {
 	/// @brief Input device container.
+	/// @details It issues device handles itself. Finding, adding and removing a device take constant time.
 	class InputDeviceContainer final
 	{
 	public:
@@ -97,15 +99,15 @@ export namespace PonyEngine::RawInput
 		void ClearDeltas() noexcept;
 
 		/// @brief Adds a new device.
-		/// @param handle Device handle.
 		/// @param deviceType Device type.
 		/// @param deviceName Device name.
 		/// @param isConnected Is the device connected?
 		/// @param features Device features.
-		void Add(DeviceHandle handle, DeviceTypeID deviceType, std::string_view deviceName, bool isConnected,
-			std::span<const FeatureEntry> features);
+		/// @return Device handle.
+		DeviceHandle Add(DeviceTypeID deviceType, std::string_view deviceName, bool isConnected, std::span<const FeatureEntry> features);
 		/// @brief Removes a device.
 		/// @param index Device index.
+		/// @note It changes the index of the last device.
 		void Remove(std::size_t index) noexcept;
 		/// @brief Clears all the data.
 		void Clear() noexcept;
@@ -114,42 +116,43 @@ export namespace PonyEngine::RawInput
 		InputDeviceContainer& operator =(InputDeviceContainer&& other) noexcept = default;
 
 	private:
+		static constexpr std::size_t InlineAxisCount = 8uz; ///< Axis count that a device keeps without a heap allocation.
+
+		/// @brief Input device.
+		struct Device final
+		{
+			std::string name; ///< Device name.
+			DeviceTypeID type; ///< Device type.
+			DeviceFeatureContainer features; ///< Device features.
+			bool isConnected; ///< Device connection status.
+
+			// These 3 vectors are synced by index.
+			Memory::SmallVector<AxisID, InlineAxisCount> axes; ///< Device axes.
+			Memory::SmallVector<float, InlineAxisCount> states; ///< State values.
+			Memory::SmallVector<float, InlineAxisCount> deltas; ///< Delta values.
+		};
+
 		/// @brief Finds an index of the device axis.
-		/// @param handle Device handle.
-		/// @param axis Axis.
-		/// @return Axis index or axes size if not found.
-		[[nodiscard("Pure function")]]
-		std::size_t IndexOf(DeviceHandle handle, AxisID axis) const noexcept;
-		/// @brief Finds an index of the axis among the axis indices.
-		/// @param axisIndices Axis indices.
+		/// @param device Device.
 		/// @param axis Axis.
-		/// @return Axis index or axes size if not found.
+		/// @return Axis index or device axes size if not found.
 		[[nodiscard("Pure function")]]
-		std::size_t IndexOf(std::span<const std::size_t> axisIndices, AxisID axis) const noexcept;
+		static std::size_t IndexOf(const Device& device, AxisID axis) noexcept;
 
 		/// @brief Gets an axis value.
+		/// @param device Device.
 		/// @param axisIndex Axis index.
 		/// @return Axis value.
 		[[nodiscard("Pure function")]]
-		float Value(std::size_t axisIndex) const noexcept;
+		static float Value(const Device& device, std::size_t axisIndex) noexcept;
 
 		/// @brief Adds a new axis.
-		/// @param deviceIndex Device index.
+		/// @param device Device.
 		/// @param axis Axis.
 		/// @return Axis index.
-		std::size_t AddAxis(std::size_t deviceIndex, AxisID axis);
-
-		std::vector<DeviceHandle> handles; ///< Device handles.
-		std::vector<std::string> deviceNames; ///< Device names.
-		std::vector<DeviceTypeID> deviceTypes; ///< Device types.
-		std::vector<DeviceFeatureContainer> deviceFeatures; ///< Device features.
-		std::vector<bool> connections; ///< Device connection statuses
-		std::vector<std::vector<std::size_t>> axisIndices; ///< Device axes indices. These indices point to the @p axes, @p states and @p deltas.
-
-		// These 3 vectors are synced by index.
-		std::vector<AxisID> axes; ///< Axes.
-		std::vector<float> states; ///< State values.
-		std::vector<float> deltas; ///< Delta values.
+		static std::size_t AddAxis(Device& device, AxisID axis);
+
+		Memory::SlotMap<Device> devices; ///< Devices.
 	};
 }
 
@@ -157,54 +160,57 @@ namespace PonyEngine::RawInput
 {
 	std::size_t InputDeviceContainer::Size() const noexcept
 	{
-		return handles.size();
+		return devices.Size();
 	}
 
 	std::size_t InputDeviceContainer::IndexOf(const DeviceHandle handle) const noexcept
 	{
-		return std::ranges::find(handles, handle) - handles.cbegin();
+		return devices.IndexOf(Memory::SlotKey{.id = handle.id});
 	}
 
 	DeviceHandle InputDeviceContainer::Handle(const std::size_t index) const noexcept
 	{
-		return handles[index];
+		return DeviceHandle{.id = devices.Key(index).id};
 	}
 
 	std::string_view InputDeviceContainer::DeviceName(const std::size_t index) const noexcept
 	{
-		return deviceNames[index];
+		return devices[index].name;
 	}
 
 	DeviceTypeID InputDeviceContainer::DeviceType(const std::size_t index) const noexcept
 	{
-		return deviceTypes[index];
+		return devices[index].type;
 	}
 
 	const DeviceFeatureContainer& InputDeviceContainer::DeviceFeatures(const std::size_t index) const noexcept
 	{
-		return deviceFeatures[index];
+		return devices[index].features;
 	}
 
 	bool InputDeviceContainer::IsConnected(const std::size_t index) const noexcept
 	{
-		return connections[index];
+		return devices[index].isConnected;
 	}
 
 	void InputDeviceContainer::IsConnected(const std::size_t index, const bool value) noexcept
 	{
-		assert(index < connections.size() && "The device index is incorrect.");
+		assert(index < devices.Size() && "The device index is incorrect.");
 
-		connections[index] = value;
+		devices[index].isConnected = value;
 	}
 
 	float InputDeviceContainer::Value(const AxisID axis) const noexcept
 	{
 		float value = 0.f;
-		for (std::size_t i = 0uz; i < axes.size(); ++i)
+		for (const Device& device : devices)
 		{
-			if (axes[i] == axis)
+			for (std::size_t i = 0uz; i < device.axes.Size(); ++i)
 			{
-				value += Value(i);
+				if (device.axes[i] == axis)
+				{
+					value += Value(device, i);
+				}
 			}
 		}
 
@@ -213,27 +219,34 @@ namespace PonyEngine::RawInput
 
 	float InputDeviceContainer::Value(const AxisID axis, const DeviceHandle device) const noexcept
 	{
-		const std::size_t axisIndex = IndexOf(device, axis);
-		return axisIndex < axes.size() ? Value(axisIndex) : 0.f;
+		const Device* const found = devices.Find(Memory::SlotKey{.id = device.id});
+		if (!found) [[unlikely]]
+		{
+			return 0.f;
+		}
+
+		const std::size_t axisIndex = IndexOf(*found, axis);
+		return axisIndex < found->axes.Size() ? Value(*found, axisIndex) : 0.f;
 	}
 
 	void InputDeviceContainer::Value(const std::size_t deviceIndex, const AxisID axis, const float value, const InputEventType type)
 	{
 		assert(deviceIndex < Size() && "Incorrect device.");
 
-		std::size_t axisIndex = IndexOf(axisIndices[deviceIndex], axis);
-		if (axisIndex >= axes.size()) [[unlikely]]
+		Device& device = devices[deviceIndex];
+		std::size_t axisIndex = IndexOf(device, axis);
+		if (axisIndex >= device.axes.Size()) [[unlikely]]
 		{
-			axisIndex = AddAxis(deviceIndex, axis);
+			axisIndex = AddAxis(device, axis);
 		}
 
 		switch (type)
 		{
 		case InputEventType::State:
-			states[axisIndex] = value;
+			device.states[axisIndex] = value;
 			break;
 		case InputEventType::Delta:
-			deltas[axisIndex] += value;
+			device.deltas[axisIndex] += value;
 			break;
 		default: [[unlikely]]
 			assert(false && "Incorrect input event type.");
@@ -243,179 +256,83 @@ namespace PonyEngine::RawInput
 
 	void InputDeviceContainer::ClearDeltas() noexcept
 	{
-		std::ranges::fill(deltas, 0.f);
-	}
-
-	void InputDeviceContainer::Add(const DeviceHandle handle, const DeviceTypeID deviceType, const std::string_view deviceName, const bool isConnected,
-		const std::span<const FeatureEntry> features)
-	{
-		handles.push_back(handle);
-		try
+		for (Device& device : devices)
 		{
-			deviceNames.emplace_back(deviceName);
-			try
-			{
-				deviceTypes.push_back(deviceType);
-				try
-				{
-					auto featureContainer = DeviceFeatureContainer();
-					for (const FeatureEntry& featureEntry : features)
-					{
-#ifndef NDEBUG
-						if (featureContainer.IndexOf(featureEntry.featureType) < featureContainer.Size())
-						{
-							throw std::invalid_argument(std::format("Feature of type '{}' is added twice", featureEntry.featureType.name()));
-						}
-						if (!featureEntry.feature) [[unlikely]]
-						{
-							throw std::invalid_argument("Feature is nullptr");
-						}
-#endif
-						featureContainer.Add(featureEntry.featureType, featureEntry.feature);
-					}
-					deviceFeatures.push_back(std::move(featureContainer));
-					try
-					{
-						connections.push_back(isConnected);
-						try
-						{
-							axisIndices.push_back(std::vector<std::size_t>());
-						}
-						catch (...)
-						{
-							connections.pop_back();
-							throw;
-						}
-					}
-					catch (...)
-					{
-						deviceFeatures.pop_back();
-						throw;
-					}
-				}
-				catch (...)
-				{
-					deviceTypes.pop_back();
-					throw;
-				}
-			}
-			catch (...)
-			{
-				deviceNames.pop_back();
-				throw;
-			}
-		}
-		catch (...)
-		{
-			handles.pop_back();
-			throw;
+			std::ranges::fill(device.deltas, 0.f);
 		}
 	}
 
-	void InputDeviceContainer::Remove(const std::size_t index) noexcept
+	DeviceHandle InputDeviceContainer::Add(const DeviceTypeID deviceType, const std::string_view deviceName, const bool isConnected,
+		const std::span<const FeatureEntry> features)
 	{
-		for (std::size_t i = 0uz; i < axisIndices.size(); ++i)
+		auto featureContainer = DeviceFeatureContainer();
+		for (const FeatureEntry& featureEntry : features)
 		{
-			if (i == index) [[unlikely]]
+#ifndef NDEBUG
+			if (featureContainer.IndexOf(featureEntry.featureType) < featureContainer.Size())
 			{
-				continue;
+				throw std::invalid_argument(std::format("Feature of type '{}' is added twice", featureEntry.featureType.name()));
 			}
-
-			for (std::size_t& axisIndex : axisIndices[i])
+			if (!featureEntry.feature) [[unlikely]]
 			{
-				std::size_t shift = 0uz;
-				for (const std::size_t removedAxisIndex : axisIndices[index])
-				{
-					shift += removedAxisIndex < axisIndex;
-				}
-				axisIndex -= shift;
+				throw std::invalid_argument("Feature is nullptr");
 			}
+#endif
+			featureContainer.Add(featureEntry.featureType, featureEntry.feature);
 		}
 
-		const std::span<const std::size_t> indices = axisIndices[index];
-		for (std::size_t i = indices.size(); i-- > 0uz; )
+		const Memory::SlotKey key = devices.Add(Device
 		{
-			const std::size_t axisIndex = indices[i];
-			deltas.erase(deltas.cbegin() + axisIndex);
-			states.erase(states.cbegin() + axisIndex);
-			axes.erase(axes.cbegin() + axisIndex);
-		}
+			.name = std::string(deviceName),
+			.type = deviceType,
+			.features = std::move(featureContainer),
+			.isConnected = isConnected
+		});
 
-		axisIndices.erase(axisIndices.cbegin() + index);
-		connections.erase(connections.cbegin() + index);
-		deviceFeatures.erase(deviceFeatures.cbegin() + index);
-		deviceTypes.erase(deviceTypes.cbegin() + index);
-		deviceNames.erase(deviceNames.cbegin() + index);
-		handles.erase(handles.cbegin() + index);
+		return DeviceHandle{.id = key.id};
 	}
 
-	void InputDeviceContainer::Clear() noexcept
+	void InputDeviceContainer::Remove(const std::size_t index) noexcept
 	{
-		handles.clear();
-		deviceNames.clear();
-		deviceTypes.clear();
-		deviceFeatures.clear();
-		connections.clear();
-		axisIndices.clear();
-
-		axes.clear();
-		states.clear();
-		deltas.clear();
+		devices.Remove(index);
 	}
 
-	std::size_t InputDeviceContainer::IndexOf(const DeviceHandle handle, const AxisID axis) const noexcept
+	void InputDeviceContainer::Clear() noexcept
 	{
-		const std::size_t deviceIndex = IndexOf(handle);
-		if (deviceIndex >= Size()) [[unlikely]]
-		{
-			return axes.size();
-		}
-
-		return IndexOf(axisIndices[deviceIndex], axis);
+		devices.Clear();
 	}
 
-	std::size_t InputDeviceContainer::IndexOf(const std::span<const std::size_t> axisIndices, const AxisID axis) const noexcept
+	std::size_t InputDeviceContainer::IndexOf(const Device& device, const AxisID axis) noexcept
 	{
-		const std::size_t axisIndex = std::ranges::find_if(axisIndices, [&](const std::size_t index) { return axes[index] == axis; }) - axisIndices.cbegin();
-		return axisIndex < axisIndices.size() ? axisIndices[axisIndex] : axes.size();
+		return std::ranges::find(device.axes, axis) - device.axes.begin();
 	}
 
-	float InputDeviceContainer::Value(const std::size_t axisIndex) const noexcept
+	float InputDeviceContainer::Value(const Device& device, const std::size_t axisIndex) noexcept
 	{
-		return states[axisIndex] + deltas[axisIndex];
+		return device.states[axisIndex] + device.deltas[axisIndex];
 	}
 
-	std::size_t InputDeviceContainer::AddAxis(const std::size_t deviceIndex, const AxisID axis)
+	std::size_t InputDeviceContainer::AddAxis(Device& device, const AxisID axis)
 	{
-		const std::size_t axisIndex = axes.size();
+		const std::size_t axisIndex = device.axes.Size();
 
-		std::vector<std::size_t>& deviceAxes = axisIndices[deviceIndex];
-		deviceAxes.push_back(axisIndex);
+		device.axes.Add(axis);
 		try
 		{
-			axes.push_back(axis);
+			device.states.Add(0.f);
 			try
 			{
-				states.push_back(0.f);
-				try
-				{
-					deltas.push_back(0.f);
-				}
-				catch (...)
-				{
-					states.pop_back();
-					throw;
-				}
+				device.deltas.Add(0.f);
 			}
 			catch (...)
 			{
-				axes.pop_back();
+				device.states.RemoveLast();
 				throw;
 			}
 		}
 		catch (...)
 		{
-			deviceAxes.pop_back();
+			device.axes.RemoveLast();
 			throw;
 		}
 
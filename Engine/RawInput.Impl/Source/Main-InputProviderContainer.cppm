@@ -15,11 +15,13 @@ export module PonyEngine.RawInput.Impl:InputProviderContainer;
 
 import std;
 
+import PonyEngine.Memory;
 import PonyEngine.RawInput.Ext;
 
 export namespace PonyEngine::RawInput
 {
 	/// @brief Input provider container.
+	/// @details It issues provider handles itself. Finding a provider by its handle takes constant time.
 	class InputProviderContainer final
 	{
 	public:
@@ -60,11 +62,12 @@ export namespace PonyEngine::RawInput
 		IInputProvider& Provider(std::size_t index) const noexcept;
 
 		/// @brief Adds the provider.
-		/// @param handle Provider handle.
 		/// @param provider Provider.
-		void Add(InputProviderHandle handle, const std::shared_ptr<IInputProvider>& provider);
+		/// @return Provider handle.
+		InputProviderHandle Add(const std::shared_ptr<IInputProvider>& provider);
 		/// @brief Removes a provider.
 		/// @param index Provider index.
+		/// @note It keeps the order of the rest providers.
 		void Remove(std::size_t index) noexcept;
 		/// @brief Clears the data.
 		void Clear() noexcept;
@@ -73,8 +76,7 @@ export namespace PonyEngine::RawInput
 		InputProviderContainer& operator =(InputProviderContainer&& other) noexcept = default;
 
 	private:
-		std::vector<InputProviderHandle> handles; ///< Input provider handles.
-		std::vector<std::shared_ptr<IInputProvider>> providers; ///< Input providers.
+		Memory::SlotMap<std::shared_ptr<IInputProvider>> providers; ///< Input providers.
 	};
 }
 
@@ -82,22 +84,22 @@ namespace PonyEngine::RawInput
 {
 	std::size_t InputProviderContainer::Size() const noexcept
 	{
-		return handles.size();
+		return providers.Size();
 	}
 
 	std::size_t InputProviderContainer::IndexOf(const InputProviderHandle handle) const noexcept
 	{
-		return std::ranges::find(handles, handle) - handles.cbegin();
+		return providers.IndexOf(Memory::SlotKey{.id = handle.id});
 	}
 
 	std::size_t InputProviderContainer::IndexOf(const IInputProvider& provider) const noexcept
 	{
-		return std::ranges::find_if(providers, [&](const std::shared_ptr<IInputProvider>& p) { return p.get() == &provider; }) - providers.cbegin();
+		return std::ranges::find_if(providers, [&](const std::shared_ptr<IInputProvider>& p) { return p.get() == &provider; }) - providers.begin();
 	}
 
 	InputProviderHandle InputProviderContainer::Handle(const std::size_t index) const noexcept
 	{
-		return handles[index];
+		return InputProviderHandle{.id = providers.Key(index).id};
 	}
 
 	IInputProvider& InputProviderContainer::Provider(const std::size_t index) const noexcept
@@ -105,31 +107,20 @@ namespace PonyEngine::RawInput
 		return *providers[index];
 	}
 
-	void InputProviderContainer::Add(const InputProviderHandle handle, const std::shared_ptr<IInputProvider>& provider)
+	InputProviderHandle InputProviderContainer::Add(const std::shared_ptr<IInputProvider>& provider)
 	{
 		assert(provider && "The provider is nullptr.");
 
-		handles.push_back(handle);
-		try
-		{
-			providers.push_back(provider);
-		}
-		catch (...)
-		{
-			handles.pop_back();
-			throw;
-		}
+		return InputProviderHandle{.id = providers.Add(provider).id};
 	}
 
 	void InputProviderContainer::Remove(const std::size_t index) noexcept
 	{
-		providers.erase(providers.cbegin() + index);
-		handles.erase(handles.cbegin() + index);
+		providers.RemoveOrdered(index);
 	}
 
 	void InputProviderContainer::Clear() noexcept
 	{
-		handles.clear();
-		providers.clear();
+		providers.Clear();
 	}
 }
@@ -16,7 +16,6 @@ export module PonyEngine.RawInput.Impl:RawInputService;
 import std;
 
 import PonyEngine.Application.Ext;
-import PonyEngine.Hash;
 import PonyEngine.Log;
 import PonyEngine.RawInput.Ext;
 import PonyEngine.Type;
@@ -34,7 +33,7 @@ export namespace PonyEngine::RawInput
 		/// @brief Creates an input service.
 		/// @param application Application context.
 		[[nodiscard("Pure constructor")]]
-		explicit RawInputService(Application::IApplicationContext& application) noexcept;
+		explicit RawInputService(Application::IApplicationContext& application);
 		RawInputService(const RawInputService&) = delete;
 		RawInputService(RawInputService&&) = delete;
 
@@ -47,7 +46,7 @@ export namespace PonyEngine::RawInput
 		virtual void AddInterfaces(Application::IServiceInterfaceAdder& adder) override;
 
 		[[nodiscard("Must be used to remove")]]
-		virtual InputProviderHandle AddProvider(const std::function<std::shared_ptr<IInputProvider>(IRawInputContext&)>& factory) override;
+		virtual InputProviderHandle AddProvider(Type::FunctionRef<std::shared_ptr<IInputProvider>(IRawInputContext&)> factory) override;
 		virtual void RemoveProvider(InputProviderHandle providerHandle) override;
 
 		RawInputService& operator =(const RawInputService&) = delete;
@@ -120,6 +119,9 @@ export namespace PonyEngine::RawInput
 		virtual void AddObserver(IRawInputObserver& observer) override;
 		virtual void RemoveObserver(IRawInputObserver& observer) noexcept override;
 
+		/// @brief Registers the preset axes and device types and checks them for collisions.
+		void RegisterPresets();
+
 		/// @brief Begins the providers.
 		/// @param count How many providers are begun.
 		void Begin(std::size_t& count);
@@ -156,22 +158,18 @@ export namespace PonyEngine::RawInput
 		RawInputQueue inputQueue; ///< Input queue.
 		DeviceHandle lastInputDevice; ///< Last device that sent input.
 
-		std::unordered_map<std::uint32_t, std::vector<Axis>> axisHashMap; ///< Input axis hash map. It has a hash and a vector that is synced by index.
-		std::unordered_map<DeviceTypeID, class DeviceType> deviceTypeHashMap; ///< Device type hash map.
+		std::vector<std::pair<AxisID, Axis>> axes; ///< Input axes sorted by ID.
+		std::vector<std::pair<DeviceTypeID, class DeviceType>> deviceTypes; ///< Device types sorted by ID.
 
 		std::vector<IDeviceObserver*> deviceObservers; ///< Device observers.
 		std::vector<IRawInputObserver*> inputObservers; ///< Input observers.
-
-		InputProviderHandle nextProviderHandle; ///< Next input provider handle.
-		DeviceHandle nextDeviceHandle; ///< Next device handle.
 	};
 
-	RawInputService::RawInputService(Application::IApplicationContext& application) noexcept :
+	RawInputService::RawInputService(Application::IApplicationContext& application) :
 		application{&application},
-		lastInputDevice{.id = 0u},
-		nextProviderHandle{.id = 1u},
-		nextDeviceHandle{.id = 1u}
+		lastInputDevice{.id = 0u}
 	{
+		RegisterPresets();
 	}
 
 	RawInputService::~RawInputService() noexcept
@@ -224,7 +222,7 @@ export namespace PonyEngine::RawInput
 		adder.AddInterface<IRawInputService>(*this);
 	}
 
-	InputProviderHandle RawInputService::AddProvider(const std::function<std::shared_ptr<IInputProvider>(IRawInputContext&)>& factory)
+	InputProviderHandle RawInputService::AddProvider(Type::FunctionRef<std::shared_ptr<IInputProvider>(IRawInputContext&)> factory)
 	{
 #ifndef NDEBUG
 		if (std::this_thread::get_id() != application->MainThreadID()) [[unlikely]]
@@ -232,10 +230,6 @@ export namespace PonyEngine::RawInput
 			throw std::logic_error("Must be called on main thread");
 		}
 
-		if (!nextProviderHandle.IsValid()) [[unlikely]]
-		{
-			throw std::overflow_error("No more input provider handles available");
-		}
 		if (application->FlowState() != Application::FlowState::StartingUp) [[unlikely]]
 		{
 			throw std::logic_error("Input providers can be added only on start-up");
@@ -254,9 +248,7 @@ export namespace PonyEngine::RawInput
 		}
 #endif
 
-		const InputProviderHandle currentHandle = nextProviderHandle;
-		providers.Add(currentHandle, provider);
-		++nextProviderHandle.id;
+		const InputProviderHandle currentHandle = providers.Add(provider);
 
 		PONY_LOG(application->Logger(), Log::LogType::Info, "'{}' provider added. Handle: '0x{:X}'.", typeid(*provider).name(), currentHandle.id);
 
@@ -334,20 +326,13 @@ export namespace PonyEngine::RawInput
 			throw std::logic_error("Must be called on main thread");
 		}
 
-		if (!deviceTypeHashMap.contains(deviceType))
+		if (!IsValid(deviceType)) [[unlikely]]
 		{
 			throw std::invalid_argument("Device type is invalid");
 		}
 #endif
 
-		if (!nextDeviceHandle.IsValid()) [[unlikely]]
-		{
-			throw std::overflow_error("No more device handles available");
-		}
-
-		const DeviceHandle currentHandle = nextDeviceHandle;
-		devices.Add(currentHandle, deviceType, deviceName, isConnected, features);
-		++nextDeviceHandle.id;
+		const DeviceHandle currentHandle = devices.Add(deviceType, deviceName, isConnected, features);
 
 		PONY_LOG(application->Logger(), Log::LogType::Info, "Device registered. Handle: '0x{:X}'; Name: '{}'.", currentHandle.id, deviceName);
 
@@ -542,60 +527,53 @@ export namespace PonyEngine::RawInput
 
 	AxisID RawInputService::Hash(const Axis& axis)
 	{
-		const std::uint32_t hash = Hash::FNV1a32(axis.Path());
-		auto axisId = AxisID{.hash = hash};
-
-		if (const auto position = axisHashMap.find(hash); position != axisHashMap.cend())
+		const AxisID hashId = MakeAxisID(axis.Path());
+		auto position = std::ranges::lower_bound(axes, hashId, std::less(), &std::pair<AxisID, Axis>::first);
+		for (; position != axes.cend() && position->first.hash == hashId.hash; ++position)
 		{
-			std::vector<Axis>& axes = position->second;
-			const auto axisPosition = std::ranges::find(axes, axis);
-			axisId.index = static_cast<std::uint32_t>(axisPosition - axes.cbegin());
-
-			if (axisPosition == axes.cend()) [[unlikely]]
+			if (position->second == axis)
 			{
-				PONY_LOG(application->Logger(), Log::LogType::Info, "Adding new input axis. Axis: '{}'; AxisHash: '{}'; AxisIndex: '{}'.", axis.Path(), axisId.hash, axisId.index);
-				if (axes.size() >= std::numeric_limits<std::uint32_t>::max()) [[unlikely]]
-				{
-					throw std::bad_alloc();
-				}
-
-				axes.push_back(axis);
+				return position->first;
 			}
 		}
-		else
+
+		const std::uint32_t index = position == axes.cbegin() || std::prev(position)->first.hash != hashId.hash ? 0u : std::prev(position)->first.index + 1u;
+		if (index == std::numeric_limits<std::uint32_t>::max()) [[unlikely]]
 		{
-			axisId.index = 0u;
-			PONY_LOG(application->Logger(), Log::LogType::Info, "Adding new input axis. Axis: '{}'; AxisHash: '{}'; AxisIndex: '{}'.", axis.Path(), axisId.hash, axisId.index);
-			axisHashMap[hash] = std::vector<Axis>{ axis };
+			throw std::bad_alloc();
 		}
 
+		const auto axisId = AxisID{.hash = hashId.hash, .index = index};
+		PONY_LOG(application->Logger(), Log::LogType::Info, "Adding new input axis. Axis: '{}'; AxisHash: '{}'; AxisIndex: '{}'.", axis.Path(), axisId.hash, axisId.index);
+		axes.emplace(position, axisId, axis);
+
 		return axisId;
 	}
 
 	const Axis& RawInputService::Unhash(const AxisID axisId) const
 	{
-		const auto position = axisHashMap.find(axisId.hash);
+		const auto position = std::ranges::lower_bound(axes, axisId, std::less(), &std::pair<AxisID, Axis>::first);
 #ifndef NDEBUG
-		if (position == axisHashMap.cend() || axisId.index >= position->second.size()) [[unlikely]]
+		if (position == axes.cend() || position->first != axisId) [[unlikely]]
 		{
 			throw std::invalid_argument("Invalid axis ID");
 		}
 #endif
 
-		return position->second[axisId.index];
+		return position->second;
 	}
 
 	bool RawInputService::IsValid(const AxisID axisId) const noexcept
 	{
-		const auto position = axisHashMap.find(axisId.hash);
-		return position != axisHashMap.cend() && axisId.index < position->second.size();
+		const auto position = std::ranges::lower_bound(axes, axisId, std::less(), &std::pair<AxisID, Axis>::first);
+		return position != axes.cend() && position->first == axisId;
 	}
 
 	DeviceTypeID RawInputService::Hash(const class DeviceType& deviceType)
 	{
-		const auto deviceTypeId = DeviceTypeID{.hash = Hash::FNV1a64(deviceType.Type())};
-
-		if (const auto position = deviceTypeHashMap.find(deviceTypeId); position != deviceTypeHashMap.cend())
+		const DeviceTypeID deviceTypeId = MakeDeviceTypeID(deviceType.Type());
+		const auto position = std::ranges::lower_bound(deviceTypes, deviceTypeId, std::less(), &std::pair<DeviceTypeID, class DeviceType>::first);
+		if (position != deviceTypes.cend() && position->first == deviceTypeId)
 		{
 			if (position->second != deviceType) [[unlikely]]
 			{
@@ -605,7 +583,7 @@ export namespace PonyEngine::RawInput
 		else
 		{
 			PONY_LOG(application->Logger(), Log::LogType::Info, "Adding new input device type. DeviceType: '{}'; DeviceTypeHash: '{}'.", deviceType.Type(), deviceTypeId.hash);
-			deviceTypeHashMap[deviceTypeId] = deviceType;
+			deviceTypes.emplace(position, deviceTypeId, deviceType);
 		}
 
 		return deviceTypeId;
@@ -613,9 +591,9 @@ export namespace PonyEngine::RawInput
 
 	const DeviceType& RawInputService::Unhash(const DeviceTypeID deviceTypeId)
 	{
-		const auto position = deviceTypeHashMap.find(deviceTypeId);
+		const auto position = std::ranges::lower_bound(deviceTypes, deviceTypeId, std::less(), &std::pair<DeviceTypeID, class DeviceType>::first);
 #ifndef NDEBUG
-		if (position == deviceTypeHashMap.cend()) [[unlikely]]
+		if (position == deviceTypes.cend() || position->first != deviceTypeId) [[unlikely]]
 		{
 			throw std::invalid_argument("Invalid device type ID");
 		}
@@ -626,7 +604,8 @@ export namespace PonyEngine::RawInput
 
 	bool RawInputService::IsValid(const DeviceTypeID deviceTypeId) const noexcept
 	{
-		return deviceTypeHashMap.contains(deviceTypeId);
+		const auto position = std::ranges::lower_bound(deviceTypes, deviceTypeId, std::less(), &std::pair<DeviceTypeID, class DeviceType>::first);
+		return position != deviceTypes.cend() && position->first == deviceTypeId;
 	}
 
 	void RawInputService::AddObserver(IDeviceObserver& observer)
@@ -663,6 +642,43 @@ export namespace PonyEngine::RawInput
 		}
 	}
 
+	void RawInputService::RegisterPresets()
+	{
+		axes.reserve(PresetAxisPaths.size());
+		for (const std::string_view path : PresetAxisPaths)
+		{
+			const auto axis = Axis(path);
+			if (axis.Path() != path) [[unlikely]]
+			{
+				throw std::logic_error(std::format("Preset axis path isn't normalized. Path: '{}'.", path));
+			}
+			axes.emplace_back(MakeAxisID(path), axis);
+		}
+		std::ranges::sort(axes, std::less(), &std::pair<AxisID, Axis>::first);
+		if (std::ranges::adjacent_find(axes, std::equal_to(), &std::pair<AxisID, Axis>::first) != axes.cend()) [[unlikely]]
+		{
+			throw std::logic_error("Preset axis hash collision");
+		}
+
+		deviceTypes.reserve(PresetDeviceTypes.size());
+		for (const std::string_view type : PresetDeviceTypes)
+		{
+			const auto deviceType = RawInput::DeviceType(type);
+			if (deviceType.Type() != type) [[unlikely]]
+			{
+				throw std::logic_error(std::format("Preset device type isn't normalized. Type: '{}'.", type));
+			}
+			deviceTypes.emplace_back(MakeDeviceTypeID(type), deviceType);
+		}
+		std::ranges::sort(deviceTypes, std::less(), &std::pair<DeviceTypeID, class DeviceType>::first);
+		if (std::ranges::adjacent_find(deviceTypes, std::equal_to(), &std::pair<DeviceTypeID, class DeviceType>::first) != deviceTypes.cend()) [[unlikely]]
+		{
+			throw std::logic_error("Preset device type hash collision");
+		}
+
+		PONY_LOG(application->Logger(), Log::LogType::Info, "Preset input axes and device types registered. AxisCount: '{}'; DeviceTypeCount: '{}'.", axes.size(), deviceTypes.size());
+	}
+
 	void RawInputService::Begin(std::size_t& count)
 	{
 		PONY_LOG(application->Logger(), Log::LogType::Info, "Beginning input providers...");
@@ -747,7 +763,7 @@ export namespace PonyEngine::RawInput
 				[&](const ConnectionEvent& connectionEvent)
 				{
 					PONY_LOG(application->Logger(), Log::LogType::Debug, "Connection status of device '0x{:X}' changed to '{}'.", device.id, connectionEvent.isConnected);
-					devices.IsConnected(devices.IndexOf(device), connectionEvent.isConnected);
+					devices.IsConnected(deviceIndex, connectionEvent.isConnected);
 					ObserveConnection(device, connectionEvent);
 				}
 			}, event);
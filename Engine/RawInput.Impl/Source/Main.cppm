@@ -11,4 +11,5 @@ export module PonyEngine.RawInput.Impl;
 
 export import PonyEngine.RawInput.Ext;
 
+export import :RawInputService;
 export import :RawInputServiceModule;
@@ -7,15 +7,21 @@
  * Repo: https://github.com/ZorPastaman/PonyEngine *
  ***************************************************/
 
+module;
+
+#include <cassert>
+
 export module PonyEngine.RawInput.Keyboard.Impl:KeyboardContainer;
 
 import std;
 
+import PonyEngine.Memory;
 import PonyEngine.RawInput;
 
 export namespace PonyEngine::RawInput::Keyboard
 {
 	/// @brief Keyboard container.
+	/// @details Finding a keyboard by its native handle or its device handle takes constant time.
 	/// @tparam NativeHandleType Native keyboard handle type.
 	/// @tparam NativeKeyType Native keyboard key type.
 	template<typename NativeHandleType, typename NativeKeyType>
@@ -50,26 +56,20 @@ export namespace PonyEngine::RawInput::Keyboard
 		[[nodiscard("Pure function")]]
 		std::size_t IndexOf(std::string_view deviceName) const noexcept;
 
-		/// @brief Gets a native handle.
-		/// @param index Keyboard index.
-		/// @return Native handle.
-		[[nodiscard("Pure function")]]
-		NativeHandleType& NativeHandle(std::size_t index) noexcept;
 		/// @brief Gets a native handle.
 		/// @param index Keyboard index.
 		/// @return Native handle.
 		[[nodiscard("Pure function")]]
 		const NativeHandleType& NativeHandle(std::size_t index) const noexcept;
-		/// @brief Gets a device handle.
+		/// @brief Sets a native handle.
 		/// @param index Keyboard index.
-		/// @return Device handle.
-		[[nodiscard("Pure function")]]
-		struct DeviceHandle& DeviceHandle(std::size_t index) noexcept;
+		/// @param nativeHandle Native handle.
+		void NativeHandle(std::size_t index, const NativeHandleType& nativeHandle);
 		/// @brief Gets a device handle.
 		/// @param index Keyboard index.
 		/// @return Device handle.
 		[[nodiscard("Pure function")]]
-		const struct DeviceHandle& DeviceHandle(std::size_t index) const noexcept;
+		struct DeviceHandle DeviceHandle(std::size_t index) const noexcept;
 
 		/// @brief Gets a device name.
 		/// @param index Keyboard index.
@@ -112,9 +112,11 @@ export namespace PonyEngine::RawInput::Keyboard
 		/// @param deviceHandle Device handle.
 		/// @param name Keyboard name.
 		/// @param isConnected Is the device connected?
-		void Add(const NativeHandleType& nativeHandle, struct DeviceHandle deviceHandle, std::string_view name, bool isConnected);
+		/// @return Keyboard index.
+		std::size_t Add(const NativeHandleType& nativeHandle, struct DeviceHandle deviceHandle, std::string_view name, bool isConnected);
 		/// @brief Removed a keyboard.
 		/// @param index Keyboard index.
+		/// @note It changes the index of the last keyboard.
 		void Remove(std::size_t index) noexcept;
 		/// @brief Clears all the data.
 		void Clear() noexcept;
@@ -123,11 +125,26 @@ export namespace PonyEngine::RawInput::Keyboard
 		KeyboardContainer& operator =(KeyboardContainer&&) = delete;
 
 	private:
-		std::vector<NativeHandleType> nativeHandles; ///< Native keyboard handles.
-		std::vector<struct DeviceHandle> deviceHandles; ///< Device handles.
-		std::vector<std::string> deviceNames; ///< Device names.
-		std::vector<bool> connections; ///< Keyboard connection statuses.
-		std::vector<std::vector<NativeKeyType>> pressedKeys; ///< Keyboard pressed keys.
+		static constexpr std::size_t InlinePressedKeyCount = 8uz; ///< Pressed key count that a keyboard keeps without a heap allocation.
+
+		/// @brief Keyboard data.
+		struct KeyboardData final
+		{
+			NativeHandleType nativeHandle; ///< Native keyboard handle.
+			struct DeviceHandle deviceHandle; ///< Device handle.
+			std::string deviceName; ///< Device name.
+			bool isConnected; ///< Keyboard connection status.
+			Memory::SmallVector<NativeKeyType, InlinePressedKeyCount> pressedKeys; ///< Keyboard pressed keys.
+		};
+
+		/// @brief Removes a native handle lookup entry if it points to the @p key.
+		/// @param nativeHandle Native handle.
+		/// @param key Keyboard key.
+		void RemoveNativeHandleKey(const NativeHandleType& nativeHandle, Memory::SlotKey key) noexcept;
+
+		Memory::SlotMap<KeyboardData> keyboards; ///< Keyboards.
+		Memory::FlatHashMap<NativeHandleType, Memory::SlotKey> nativeHandleKeys; ///< Native handle to keyboard key map.
+		Memory::FlatHashMap<struct DeviceHandle, Memory::SlotKey> deviceHandleKeys; ///< Device handle to keyboard key map.
 	};
 }
 
@@ -136,100 +153,103 @@ namespace PonyEngine::RawInput::Keyboard
 	template<typename NativeHandleType, typename NativeKeyType>
 	std::size_t KeyboardContainer<NativeHandleType, NativeKeyType>::Size() const noexcept
 	{
-		return nativeHandles.size();
+		return keyboards.Size();
 	}
 
 	template<typename NativeHandleType, typename NativeKeyType>
 	std::size_t KeyboardContainer<NativeHandleType, NativeKeyType>::IndexOf(const NativeHandleType& nativeHandle) const noexcept
 	{
-		return std::ranges::find(nativeHandles, nativeHandle) - nativeHandles.cbegin();
+		const Memory::SlotKey* const key = nativeHandleKeys.Find(nativeHandle);
+		return key ? keyboards.IndexOf(*key) : keyboards.Size();
 	}
 
 	template<typename NativeHandleType, typename NativeKeyType>
 	std::size_t KeyboardContainer<NativeHandleType, NativeKeyType>::IndexOf(const struct DeviceHandle deviceHandle) const noexcept
 	{
-		return std::ranges::find(deviceHandles, deviceHandle) - deviceHandles.cbegin();
+		const Memory::SlotKey* const key = deviceHandleKeys.Find(deviceHandle);
+		return key ? keyboards.IndexOf(*key) : keyboards.Size();
 	}
 
 	template<typename NativeHandleType, typename NativeKeyType>
 	std::size_t KeyboardContainer<NativeHandleType, NativeKeyType>::IndexOf(const std::string_view deviceName) const noexcept
 	{
-		return std::ranges::find(deviceNames, deviceName) - deviceNames.cbegin();
+		return std::ranges::find(keyboards, deviceName, &KeyboardData::deviceName) - keyboards.begin();
 	}
 
-	template<typename NativeHandleTypeType, typename NativeKeyType>
-	NativeHandleTypeType& KeyboardContainer<NativeHandleTypeType, NativeKeyType>::NativeHandle(const std::size_t index) noexcept
-	{
-		return nativeHandles[index];
-	}
-
-	template<typename NativeHandleTypeType, typename NativeKeyType>
-	const NativeHandleTypeType& KeyboardContainer<NativeHandleTypeType, NativeKeyType>::NativeHandle(const std::size_t index) const noexcept
+	template<typename NativeHandleType, typename NativeKeyType>
+	const NativeHandleType& KeyboardContainer<NativeHandleType, NativeKeyType>::NativeHandle(const std::size_t index) const noexcept
 	{
-		return nativeHandles[index];
+		return keyboards[index].nativeHandle;
 	}
 
 	template<typename NativeHandleType, typename NativeKeyType>
-	struct DeviceHandle& KeyboardContainer<NativeHandleType, NativeKeyType>::DeviceHandle(const std::size_t index) noexcept
+	void KeyboardContainer<NativeHandleType, NativeKeyType>::NativeHandle(const std::size_t index, const NativeHandleType& nativeHandle)
 	{
-		return deviceHandles[index];
+		KeyboardData& keyboard = keyboards[index];
+		const Memory::SlotKey key = keyboards.Key(index);
+		nativeHandleKeys.InsertOrAssign(nativeHandle, key);
+		if (keyboard.nativeHandle != nativeHandle)
+		{
+			RemoveNativeHandleKey(keyboard.nativeHandle, key);
+			keyboard.nativeHandle = nativeHandle;
+		}
 	}
 
 	template<typename NativeHandleType, typename NativeKeyType>
-	const struct DeviceHandle& KeyboardContainer<NativeHandleType, NativeKeyType>::DeviceHandle(const std::size_t index) const noexcept
+	struct DeviceHandle KeyboardContainer<NativeHandleType, NativeKeyType>::DeviceHandle(const std::size_t index) const noexcept
 	{
-		return deviceHandles[index];
+		return keyboards[index].deviceHandle;
 	}
 
 	template<typename NativeHandleType, typename NativeKeyType>
 	std::string_view KeyboardContainer<NativeHandleType, NativeKeyType>::DeviceName(const std::size_t index) const noexcept
 	{
-		return deviceNames[index];
+		return keyboards[index].deviceName;
 	}
 
 	template<typename NativeHandleType, typename NativeKeyType>
 	bool KeyboardContainer<NativeHandleType, NativeKeyType>::IsConnected(const std::size_t index) const noexcept
 	{
-		return connections[index];
+		return keyboards[index].isConnected;
 	}
 
 	template<typename NativeHandleType, typename NativeKeyType>
 	void KeyboardContainer<NativeHandleType, NativeKeyType>::Connect(const std::size_t index, const bool isConnected) noexcept
 	{
-		connections[index] = isConnected;
+		keyboards[index].isConnected = isConnected;
 	}
 
 	template<typename NativeHandleType, typename NativeKeyType>
 	bool KeyboardContainer<NativeHandleType, NativeKeyType>::IsPressed(const std::size_t index, const NativeKeyType key) const noexcept
 	{
 		const std::span<const NativeKeyType> pressed = PressedKeys(index);
-		return std::ranges::find(pressed, key) != pressed.cend();
+		return std::ranges::find(pressed, key) != pressed.end();
 	}
 
 	template<typename NativeHandleType, typename NativeKeyType>
 	std::span<const NativeKeyType> KeyboardContainer<NativeHandleType, NativeKeyType>::PressedKeys(const std::size_t index) const noexcept
 	{
-		return pressedKeys[index];
+		return keyboards[index].pressedKeys;
 	}
 
 	template<typename NativeHandleType, typename NativeKeyType>
 	void KeyboardContainer<NativeHandleType, NativeKeyType>::Press(const std::size_t index, const NativeKeyType key, const bool value)
 	{
-		std::vector<NativeKeyType>& pressed = pressedKeys[index];
+		Memory::SmallVector<NativeKeyType, InlinePressedKeyCount>& pressed = keyboards[index].pressedKeys;
 		const auto position = std::ranges::find(pressed, key);
 
 		if (value)
 		{
-			if (position == pressed.cend()) [[likely]]
+			if (position == pressed.end()) [[likely]]
 			{
-				pressed.push_back(key);
+				pressed.Add(key);
 			}
 		}
 		else
 		{
-			if (position != pressed.cend()) [[likely]]
+			if (position != pressed.end()) [[likely]]
 			{
-				pressed.erase(position);
+				pressed.Remove(position - pressed.begin());
 			}
 		}
 	}
@@ -237,69 +257,67 @@ namespace PonyEngine::RawInput::Keyboard
 	template<typename NativeHandleType, typename NativeKeyType>
 	void KeyboardContainer<NativeHandleType, NativeKeyType>::ResetKeys(const std::size_t index) noexcept
 	{
-		pressedKeys[index].clear();
+		keyboards[index].pressedKeys.Clear();
 	}
 
 	template<typename NativeHandleType, typename NativeKeyType>
-	void KeyboardContainer<NativeHandleType, NativeKeyType>::Add(const NativeHandleType& nativeHandle, const struct DeviceHandle deviceHandle, 
+	std::size_t KeyboardContainer<NativeHandleType, NativeKeyType>::Add(const NativeHandleType& nativeHandle, const struct DeviceHandle deviceHandle, 
 		const std::string_view name, const bool isConnected)
 	{
-		nativeHandles.push_back(nativeHandle);
+		assert(!deviceHandleKeys.Contains(deviceHandle) && "The device handle has already been added.");
+
+		const Memory::SlotKey key = keyboards.Add(KeyboardData
+		{
+			.nativeHandle = nativeHandle,
+			.deviceHandle = deviceHandle,
+			.deviceName = std::string(name),
+			.isConnected = isConnected
+		});
 		try
 		{
-			deviceHandles.push_back(deviceHandle);
+			deviceHandleKeys.Emplace(deviceHandle, key);
 			try
 			{
-				deviceNames.emplace_back(name);
-				try
-				{
-					connections.push_back(isConnected);
-					try
-					{
-						pressedKeys.push_back(std::vector<NativeKeyType>());
-					}
-					catch (...)
-					{
-						connections.pop_back();
-						throw;
-					}
-				}
-				catch (...)
-				{
-					deviceNames.pop_back();
-					throw;
-				}
+				nativeHandleKeys.InsertOrAssign(nativeHandle, key);
 			}
 			catch (...)
 			{
-				deviceHandles.pop_back();
+				deviceHandleKeys.Remove(deviceHandle);
 				throw;
 			}
 		}
 		catch (...)
 		{
-			nativeHandles.pop_back();
+			keyboards.Remove(keyboards.Size() - 1uz);
 			throw;
 		}
+
+		return keyboards.Size() - 1uz;
 	}
 
 	template<typename NativeHandleType, typename NativeKeyType>
 	void KeyboardContainer<NativeHandleType, NativeKeyType>::Remove(const std::size_t index) noexcept
 	{
-		pressedKeys.erase(pressedKeys.cbegin() + index);
-		connections.erase(connections.cbegin() + index);
-		deviceNames.erase(deviceNames.cbegin() + index);
-		deviceHandles.erase(deviceHandles.cbegin() + index);
-		nativeHandles.erase(nativeHandles.cbegin() + index);
+		const KeyboardData& keyboard = keyboards[index];
+		RemoveNativeHandleKey(keyboard.nativeHandle, keyboards.Key(index));
+		deviceHandleKeys.Remove(keyboard.deviceHandle);
+		keyboards.Remove(index);
 	}
 
 	template<typename NativeHandleType, typename NativeKeyType>
 	void KeyboardContainer<NativeHandleType, NativeKeyType>::Clear() noexcept
 	{
-		nativeHandles.clear();
-		deviceHandles.clear();
-		deviceNames.clear();
-		connections.clear();
-		pressedKeys.clear();
+		keyboards.Clear();
+		nativeHandleKeys.Clear();
+		deviceHandleKeys.Clear();
+	}
+
+	template<typename NativeHandleType, typename NativeKeyType>
+	void KeyboardContainer<NativeHandleType, NativeKeyType>::RemoveNativeHandleKey(const NativeHandleType& nativeHandle, const Memory::SlotKey key) noexcept
+	{
+		if (const Memory::SlotKey* const nativeKey = nativeHandleKeys.Find(nativeHandle); nativeKey && *nativeKey == key)
+		{
+			nativeHandleKeys.Remove(nativeHandle);
+		}
 	}
 }
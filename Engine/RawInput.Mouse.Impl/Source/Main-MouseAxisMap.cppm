@@ -71,18 +71,29 @@ export namespace PonyEngine::RawInput::Mouse
 
 namespace PonyEngine::RawInput::Mouse
 {
-	MouseAxisMap::MouseAxisMap(IRawInputContext& input)
+	MouseAxisMap::MouseAxisMap([[maybe_unused]] IRawInputContext& input) :
+		buttonAxes{MakeAxisID(MouseLayout::Button1Path), MakeAxisID(MouseLayout::Button2Path), MakeAxisID(MouseLayout::Button3Path),
+			MakeAxisID(MouseLayout::Button4Path), MakeAxisID(MouseLayout::Button5Path)}
 	{
-		for (std::size_t i = 0uz; i < buttonAxes.size(); ++i)
-		{
-			buttonAxes[i] = input.Hash(RawInput::Axis(std::format("{}/{}", MouseLayout::ButtonPath, i + 1)));
-		}
+		// The mouse axes are presets, so their IDs are known at compile time.
+		wheelAxes[static_cast<std::size_t>(MouseWheel::Horizontal)] = MakeAxisID(MouseLayout::WheelHorizontalPath);
+		wheelAxes[static_cast<std::size_t>(MouseWheel::Vertical)] = MakeAxisID(MouseLayout::WheelVerticalPath);
 
-		wheelAxes[static_cast<std::size_t>(MouseWheel::Horizontal)] = input.Hash(RawInput::Axis(MouseLayout::WheelHorizontalPath));
-		wheelAxes[static_cast<std::size_t>(MouseWheel::Vertical)] = input.Hash(RawInput::Axis(MouseLayout::WheelVerticalPath));
+		pointerAxes[static_cast<std::size_t>(MousePointer::X)] = MakeAxisID(MouseLayout::AxisXPath);
+		pointerAxes[static_cast<std::size_t>(MousePointer::Y)] = MakeAxisID(MouseLayout::AxisYPath);
 
-		pointerAxes[static_cast<std::size_t>(MousePointer::X)] = input.Hash(RawInput::Axis(MouseLayout::AxisXPath));
-		pointerAxes[static_cast<std::size_t>(MousePointer::Y)] = input.Hash(RawInput::Axis(MouseLayout::AxisYPath));
+#ifndef NDEBUG
+		for (const std::span<const AxisID> axes : {std::span<const AxisID>(buttonAxes), std::span<const AxisID>(wheelAxes), std::span<const AxisID>(pointerAxes)})
+		{
+			for (const AxisID axis : axes)
+			{
+				if (!input.IsValid(axis)) [[unlikely]]
+				{
+					throw std::logic_error("Mouse axis isn't registered");
+				}
+			}
+		}
+#endif
 	}
 
 	AxisID MouseAxisMap::Axis(const MouseButton button) const noexcept
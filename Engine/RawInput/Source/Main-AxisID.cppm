@@ -11,6 +11,8 @@ export module PonyEngine.RawInput:AxisID;
 
 import std;
 
+import PonyEngine.Hash;
+
 export namespace PonyEngine::RawInput
 {
 	/// @brief Axis ID.
@@ -20,8 +22,15 @@ export namespace PonyEngine::RawInput
 		std::uint32_t index = 0u; ///< Axis hash index. It's used when different axes have the same hash.
 
 		[[nodiscard("Pure operator")]]
-		constexpr bool operator ==(const AxisID& other) const noexcept = default;
+		constexpr auto operator <=>(const AxisID& other) const noexcept = default;
 	};
+
+	/// @brief Makes an axis ID at compile time.
+	/// @param path Axis path. It must be in the normalized form, the same as @p Axis makes.
+	/// @return Axis ID. It's the same as the raw input service returns for the axis if the axis hash doesn't collide with another one registered before it.
+	///         The preset axes are checked for collisions at compile time and registered first, so their IDs are always valid.
+	[[nodiscard("Pure function")]]
+	constexpr AxisID MakeAxisID(std::string_view path) noexcept;
 }
 
 export template<>
@@ -33,3 +42,11 @@ struct std::hash<PonyEngine::RawInput::AxisID> final
 		return std::hash<std::uint64_t>()(*reinterpret_cast<const std::uint64_t*>(&axisId));
 	}
 };
+
+namespace PonyEngine::RawInput
+{
+	constexpr AxisID MakeAxisID(const std::string_view path) noexcept
+	{
+		return AxisID{.hash = Hash::FNV1a32(path), .index = 0u};
+	}
+}
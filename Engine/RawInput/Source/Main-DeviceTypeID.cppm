@@ -11,6 +11,8 @@ export module PonyEngine.RawInput:DeviceTypeID;
 
 import std;
 
+import PonyEngine.Hash;
+
 export namespace PonyEngine::RawInput
 {
 	/// @brief Device type ID.
@@ -19,8 +21,14 @@ export namespace PonyEngine::RawInput
 		std::uint64_t hash = 0u; ///< Device type hash.
 
 		[[nodiscard("Pure operator")]]
-		constexpr bool operator ==(const DeviceTypeID& other) const noexcept = default;
+		constexpr auto operator <=>(const DeviceTypeID& other) const noexcept = default;
 	};
+
+	/// @brief Makes a device type ID at compile time.
+	/// @param type Device type. It must be in the normalized form, the same as @p DeviceType makes.
+	/// @return Device type ID. It's the same as the raw input service returns for the device type.
+	[[nodiscard("Pure function")]]
+	constexpr DeviceTypeID MakeDeviceTypeID(std::string_view type) noexcept;
 }
 
 export template<>
@@ -32,3 +40,11 @@ struct std::hash<PonyEngine::RawInput::DeviceTypeID> final
 		return std::hash<std::uint64_t>()(deviceTypeId.hash);
 	}
 };
+
+namespace PonyEngine::RawInput
+{
+	constexpr DeviceTypeID MakeDeviceTypeID(const std::string_view type) noexcept
+	{
+		return DeviceTypeID{.hash = Hash::FNV1a64(type)};
+	}
+}
@@ -0,0 +1,218 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.RawInput:Preset;
+
+import std;
+
+import :AxisID;
+import :DeviceTypeID;
+import :Gamepad;
+import :Keyboard;
+import :Mouse;
+
+export namespace PonyEngine::RawInput
+{
+	/// @brief Paths of the preset axes. The raw input service registers them first, so @p MakeAxisID() always gives their actual IDs.
+	constexpr std::array<std::string_view, 151> PresetAxisPaths
+	{
+		KeyboardLayout::MainAPath,
+		KeyboardLayout::MainBPath,
+		KeyboardLayout::MainCPath,
+		KeyboardLayout::MainDPath,
+		KeyboardLayout::MainEPath,
+		KeyboardLayout::MainFPath,
+		KeyboardLayout::MainGPath,
+		KeyboardLayout::MainHPath,
+		KeyboardLayout::MainIPath,
+		KeyboardLayout::MainJPath,
+		KeyboardLayout::MainKPath,
+		KeyboardLayout::MainLPath,
+		KeyboardLayout::MainMPath,
+		KeyboardLayout::MainNPath,
+		KeyboardLayout::MainOPath,
+		KeyboardLayout::MainPPath,
+		KeyboardLayout::MainQPath,
+		KeyboardLayout::MainRPath,
+		KeyboardLayout::MainSPath,
+		KeyboardLayout::MainTPath,
+		KeyboardLayout::MainUPath,
+		KeyboardLayout::MainVPath,
+		KeyboardLayout::MainWPath,
+		KeyboardLayout::MainXPath,
+		KeyboardLayout::MainYPath,
+		KeyboardLayout::MainZPath,
+		KeyboardLayout::Main1Path,
+		KeyboardLayout::Main2Path,
+		KeyboardLayout::Main3Path,
+		KeyboardLayout::Main4Path,
+		KeyboardLayout::Main5Path,
+		KeyboardLayout::Main6Path,
+		KeyboardLayout::Main7Path,
+		KeyboardLayout::Main8Path,
+		KeyboardLayout::Main9Path,
+		KeyboardLayout::Main0Path,
+		KeyboardLayout::MainEnterPath,
+		KeyboardLayout::MainEscapePath,
+		KeyboardLayout::MainBackspacePath,
+		KeyboardLayout::MainTabPath,
+		KeyboardLayout::MainSpacePath,
+		KeyboardLayout::MainDashPath,
+		KeyboardLayout::MainEqualsPath,
+		KeyboardLayout::MainLeftBracePath,
+		KeyboardLayout::MainRightBracePath,
+		KeyboardLayout::MainBackslashPath,
+		KeyboardLayout::MainColonPath,
+		KeyboardLayout::MainApostrophePath,
+		KeyboardLayout::MainTildePath,
+		KeyboardLayout::MainCommaPath,
+		KeyboardLayout::MainPeriodPath,
+		KeyboardLayout::MainSlashPath,
+		KeyboardLayout::MainPipePath,
+		KeyboardLayout::MainF1Path,
+		KeyboardLayout::MainF2Path,
+		KeyboardLayout::MainF3Path,
+		KeyboardLayout::MainF4Path,
+		KeyboardLayout::MainF5Path,
+		KeyboardLayout::MainF6Path,
+		KeyboardLayout::MainF7Path,
+		KeyboardLayout::MainF8Path,
+		KeyboardLayout::MainF9Path,
+		KeyboardLayout::MainF10Path,
+		KeyboardLayout::MainF11Path,
+		KeyboardLayout::MainF12Path,
+		KeyboardLayout::MainF13Path,
+		KeyboardLayout::MainF14Path,
+		KeyboardLayout::MainF15Path,
+		KeyboardLayout::MainF16Path,
+		KeyboardLayout::MainF17Path,
+		KeyboardLayout::MainF18Path,
+		KeyboardLayout::MainF19Path,
+		KeyboardLayout::MainF20Path,
+		KeyboardLayout::MainF21Path,
+		KeyboardLayout::MainF22Path,
+		KeyboardLayout::MainF23Path,
+		KeyboardLayout::MainF24Path,
+		KeyboardLayout::MainInsertPath,
+		KeyboardLayout::MainDeletePath,
+		KeyboardLayout::MainHomePath,
+		KeyboardLayout::MainEndPath,
+		KeyboardLayout::MainPageUpPath,
+		KeyboardLayout::MainPageDownPath,
+		KeyboardLayout::MainLeftCtrlPath,
+		KeyboardLayout::MainRightCtrlPath,
+		KeyboardLayout::MainLeftAltPath,
+		KeyboardLayout::MainRightAltPath,
+		KeyboardLayout::MainLeftShiftPath,
+		KeyboardLayout::MainRightShiftPath,
+		KeyboardLayout::LockCapsPath,
+		KeyboardLayout::LockScrollPath,
+		KeyboardLayout::LockNumPath,
+		KeyboardLayout::ArrowLeftPath,
+		KeyboardLayout::ArrowRightPath,
+		KeyboardLayout::ArrowDownPath,
+		KeyboardLayout::ArrowUpPath,
+		KeyboardLayout::NumpadSlashPath,
+		KeyboardLayout::NumpadStarPath,
+		KeyboardLayout::NumpadDashPath,
+		KeyboardLayout::NumpadPlusPath,
+		KeyboardLayout::NumpadEnterPath,
+		KeyboardLayout::Numpad1Path,
+		KeyboardLayout::Numpad2Path,
+		KeyboardLayout::Numpad3Path,
+		KeyboardLayout::Numpad4Path,
+		KeyboardLayout::Numpad5Path,
+		KeyboardLayout::Numpad6Path,
+		KeyboardLayout::Numpad7Path,
+		KeyboardLayout::Numpad8Path,
+		KeyboardLayout::Numpad9Path,
+		KeyboardLayout::Numpad0Path,
+		KeyboardLayout::NumpadPeriodPath,
+		KeyboardLayout::NumpadEqualsPath,
+		KeyboardLayout::NumpadCommaPath,
+		KeyboardLayout::SystemMenuPath,
+		KeyboardLayout::SystemLeftGuidePath,
+		KeyboardLayout::SystemRightGuidePath,
+		KeyboardLayout::SystemPrintScreenPath,
+		KeyboardLayout::SystemRequestPath,
+		KeyboardLayout::SystemPausePath,
+		KeyboardLayout::SystemBreakPath,
+		MouseLayout::Button1Path,
+		MouseLayout::Button2Path,
+		MouseLayout::Button3Path,
+		MouseLayout::Button4Path,
+		MouseLayout::Button5Path,
+		MouseLayout::WheelHorizontalPath,
+		MouseLayout::WheelVerticalPath,
+		MouseLayout::AxisXPath,
+		MouseLayout::AxisYPath,
+		GamepadLayout::DPadLeftPath,
+		GamepadLayout::DPadRightPath,
+		GamepadLayout::DPadDownPath,
+		GamepadLayout::DPadUpPath,
+		GamepadLayout::FaceButtonLeftPath,
+		GamepadLayout::FaceButtonRightPath,
+		GamepadLayout::FaceButtonDownPath,
+		GamepadLayout::FaceButtonUpPath,
+		GamepadLayout::BackButtonLeftPath,
+		GamepadLayout::BackButtonRightPath,
+		GamepadLayout::TriggerLeftPath,
+		GamepadLayout::TriggerRightPath,
+		GamepadLayout::LeftStickHorizontalPath,
+		GamepadLayout::LeftStickVerticalPath,
+		GamepadLayout::LeftStickButtonPath,
+		GamepadLayout::RightStickHorizontalPath,
+		GamepadLayout::RightStickVerticalPath,
+		GamepadLayout::RightStickButtonPath,
+		GamepadLayout::SystemMenuPath,
+		GamepadLayout::SystemSelectPath,
+		GamepadLayout::SystemGuidePath
+	};
+
+	/// @brief Preset device types. The raw input service registers them first.
+	constexpr std::array<std::string_view, 5> PresetDeviceTypes
+	{
+		KeyboardDevice::GenericType,
+		MouseDevice::GenericType,
+		GamepadDevice::GenericType,
+		GamepadDevice::XboxType,
+		GamepadDevice::PlayStationType
+	};
+}
+
+namespace PonyEngine::RawInput
+{
+	/// @brief Checks if the @p ids are unique.
+	/// @tparam ID ID type.
+	/// @tparam Size ID count.
+	/// @param ids IDs.
+	/// @return @a True if they're unique; @a false otherwise.
+	template<typename ID, std::size_t Size>
+	consteval bool AreUnique(std::array<ID, Size> ids) noexcept
+	{
+		std::ranges::sort(ids);
+
+		return std::ranges::adjacent_find(ids) == ids.cend();
+	}
+
+	static_assert(AreUnique([]
+	{
+		auto ids = std::array<AxisID, PresetAxisPaths.size()>();
+		std::ranges::transform(PresetAxisPaths, ids.begin(), &MakeAxisID);
+
+		return ids;
+	}()), "Preset axis hash collision. Rename the axis.");
+	static_assert(AreUnique([]
+	{
+		auto ids = std::array<DeviceTypeID, PresetDeviceTypes.size()>();
+		std::ranges::transform(PresetDeviceTypes, ids.begin(), &MakeDeviceTypeID);
+
+		return ids;
+	}()), "Preset device type hash collision. Rename the device type.");
+}
@@ -24,4 +24,5 @@ export import :IVibrating;
 export import :Keyboard;
 export import :Layout;
 export import :Mouse;
+export import :Preset;
 export import :RawInputEvent;
@@ -15,6 +15,8 @@ export module PonyEngine.RenderDevice.Ext:IRenderDeviceModuleContext;
 
 import std;
 
+import PonyEngine.Type;
+
 import :BackendHandle;
 import :IBackend;
 import :IRenderDeviceContext;
@@ -31,7 +33,7 @@ export namespace PonyEngine::RenderDevice
 		/// @return Backend handle. Must be used to remove a backend before a destruction of the render device.
 		/// @note The function must be called on a main thread.
 		[[nodiscard("Must be used to remove")]]
-		virtual BackendHandle AddBackend(const std::function<std::shared_ptr<IBackend>(IRenderDeviceContext&)>& factory) = 0;
+		virtual BackendHandle AddBackend(Type::FunctionRef<std::shared_ptr<IBackend>(IRenderDeviceContext&)> factory) = 0;
 		/// @brief Removes a backend.
 		/// @param backendHandle Backend handle.
 		/// @note The function must be called on a main thread.
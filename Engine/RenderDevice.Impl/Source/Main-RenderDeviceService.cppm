@@ -20,6 +20,7 @@ import PonyEngine.Hash;
 import PonyEngine.Log;
 import PonyEngine.Meta;
 import PonyEngine.RenderDevice.Ext;
+import PonyEngine.Type;
 
 import :BackendContainer;
 
@@ -44,7 +45,7 @@ export namespace PonyEngine::RenderDevice
 		virtual void AddInterfaces(Application::IServiceInterfaceAdder& adder) override;
 
 		[[nodiscard("Must be used to remove")]]
-		virtual BackendHandle AddBackend(const std::function<std::shared_ptr<IBackend>(IRenderDeviceContext&)>& factory) override;
+		virtual BackendHandle AddBackend(Type::FunctionRef<std::shared_ptr<IBackend>(IRenderDeviceContext&)> factory) override;
 		virtual void RemoveBackend(BackendHandle backendHandle) override;
 
 		RenderDeviceService& operator =(const RenderDeviceService&) = delete;
@@ -240,7 +241,7 @@ namespace PonyEngine::RenderDevice
 		adder.AddInterface<IRenderDeviceService>(*this);
 	}
 
-	BackendHandle RenderDeviceService::AddBackend(const std::function<std::shared_ptr<IBackend>(IRenderDeviceContext&)>& factory)
+	BackendHandle RenderDeviceService::AddBackend(Type::FunctionRef<std::shared_ptr<IBackend>(IRenderDeviceContext&)> factory)
 	{
 #ifndef NDEBUG
 		if (!nextBackendHandle.IsValid()) [[unlikely]]
@@ -0,0 +1,23 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.RenderDevice:HeapAllocation;
+
+import std;
+
+export namespace PonyEngine::RenderDevice
+{
+	/// @brief Heap allocation. It's a range inside a heap managed by a heap allocator.
+	struct HeapAllocation final
+	{
+		std::uint64_t offset = 0ull; ///< Offset in the heap in bytes.
+		std::uint64_t size = 0ull; ///< Allocated size in bytes. It may be bigger than a requested size.
+		std::uint32_t block = 0u; ///< Allocator inner block index. It's used only by the allocator.
+	};
+}
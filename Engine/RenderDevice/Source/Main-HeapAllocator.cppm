@@ -0,0 +1,524 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+module;
+
+#include <cassert>
+
+export module PonyEngine.RenderDevice:HeapAllocator;
+
+import std;
+
+import :HeapAllocation;
+import :HeapAllocatorStatistics;
+
+export namespace PonyEngine::RenderDevice
+{
+	/// @brief Heap allocator. It manages offsets inside a big heap so that many resources can be placed into it.
+	/// @details It's a two-level segregated fit (TLSF) allocator. It only does a bookkeeping and never touches the heap memory,
+	///          so it works with any render backend. Allocating and freeing take constant time.
+	class HeapAllocator final
+	{
+	public:
+		static constexpr std::uint64_t SmallResourceAlignment = 4ull * 1024ull; ///< Alignment class of small textures.
+		static constexpr std::uint64_t DefaultResourceAlignment = 64ull * 1024ull; ///< Alignment class of buffers and textures.
+		static constexpr std::uint64_t MultisampleResourceAlignment = 4ull * 1024ull * 1024ull; ///< Alignment class of multisample textures.
+
+		/// @brief Creates a heap allocator.
+		/// @param heapSize Heap size in bytes. It's rounded down to the @p granularity.
+		/// @param granularity Min allocation size and alignment in bytes. Must be a power of two.
+		[[nodiscard("Pure constructor")]]
+		explicit HeapAllocator(std::uint64_t heapSize, std::uint64_t granularity = SmallResourceAlignment);
+		[[nodiscard("Pure constructor")]]
+		HeapAllocator(const HeapAllocator& other) = default;
+		[[nodiscard("Pure constructor")]]
+		HeapAllocator(HeapAllocator&& other) noexcept = default;
+
+		~HeapAllocator() noexcept = default;
+
+		/// @brief Gets the heap size.
+		/// @return Heap size in bytes.
+		[[nodiscard("Pure function")]]
+		std::uint64_t HeapSize() const noexcept;
+		/// @brief Gets the granularity.
+		/// @return Granularity in bytes.
+		[[nodiscard("Pure function")]]
+		std::uint64_t Granularity() const noexcept;
+
+		/// @brief Allocates a heap range.
+		/// @param size Size in bytes. It's rounded up to the granularity.
+		/// @param alignment Offset alignment in bytes. Must be a power of two. The granularity is used if it's smaller.
+		/// @return Allocation; std::nullopt if there's no free block big enough.
+		[[nodiscard("Must be freed")]]
+		std::optional<HeapAllocation> Allocate(std::uint64_t size, std::uint64_t alignment = DefaultResourceAlignment);
+		/// @brief Frees the allocation.
+		/// @param allocation Allocation. Must be allocated by this allocator and not freed yet.
+		void Free(const HeapAllocation& allocation);
+		/// @brief Frees all the allocations.
+		void Clear();
+
+		/// @brief Gets the allocator statistics.
+		/// @return Statistics.
+		[[nodiscard("Pure function")]]
+		HeapAllocatorStatistics Statistics() const noexcept;
+
+		HeapAllocator& operator =(const HeapAllocator& other) = default;
+		HeapAllocator& operator =(HeapAllocator&& other) noexcept = default;
+
+	private:
+		static constexpr std::uint32_t SecondLevelBitCount = 4u; ///< Bit count of a second level index.
+		static constexpr std::uint32_t SecondLevelCount = 1u << SecondLevelBitCount; ///< Second level count.
+		static constexpr std::uint32_t FirstLevelCount = 64u; ///< First level count.
+		static constexpr std::uint32_t NullBlock = std::numeric_limits<std::uint32_t>::max(); ///< Null block index.
+
+		/// @brief Block state.
+		enum class BlockState : std::uint8_t
+		{
+			Unused, ///< The block isn't a part of the heap and can be reused.
+			Free, ///< The block is free.
+			Used ///< The block is allocated.
+		};
+
+		/// @brief Heap block.
+		struct Block final
+		{
+			std::uint64_t offset; ///< Block offset in bytes.
+			std::uint64_t size; ///< Block size in bytes.
+			std::uint32_t previousPhysical; ///< Previous block in the heap.
+			std::uint32_t nextPhysical; ///< Next block in the heap.
+			std::uint32_t previousFree; ///< Previous block in the free list.
+			std::uint32_t nextFree; ///< Next block in the free list. For unused blocks, it's a next unused block.
+			BlockState state; ///< Block state.
+		};
+
+		/// @brief Free list index.
+		struct ListIndex final
+		{
+			std::uint32_t firstLevel; ///< First level index.
+			std::uint32_t secondLevel; ///< Second level index.
+		};
+
+		/// @brief Gets a free list index that contains blocks of the @p size.
+		/// @param size Block size in bytes.
+		/// @return Free list index.
+		[[nodiscard("Pure function")]]
+		ListIndex Mapping(std::uint64_t size) const noexcept;
+		/// @brief Gets a first free list index where every block is at least the @p size.
+		/// @param size Required size in bytes.
+		/// @return Free list index.
+		[[nodiscard("Pure function")]]
+		ListIndex SearchMapping(std::uint64_t size) const noexcept;
+		/// @brief Finds a free block that is at least the @p size.
+		/// @param size Required size in bytes.
+		/// @return Free block index or @p NullBlock if not found.
+		[[nodiscard("Pure function")]]
+		std::uint32_t FindFreeBlock(std::uint64_t size) const noexcept;
+
+		/// @brief Inserts the block into the free lists.
+		/// @param blockIndex Block index.
+		void InsertFreeBlock(std::uint32_t blockIndex) noexcept;
+		/// @brief Removes the block from the free lists.
+		/// @param blockIndex Block index.
+		void RemoveFreeBlock(std::uint32_t blockIndex) noexcept;
+
+		/// @brief Marks the free block as used. Its tail is split into a new free block if the block is bigger than the @p size.
+		/// @param blockIndex Block index. It must be removed from the free lists.
+		/// @param size Allocation size in bytes.
+		/// @return Allocation.
+		[[nodiscard("Must be freed")]]
+		HeapAllocation UseBlock(std::uint32_t blockIndex, std::uint64_t size) noexcept;
+
+		/// @brief Splits the block. The new block is placed after the existing one and is free.
+		/// @param blockIndex Block index.
+		/// @param size Size of the first part in bytes.
+		void SplitBlock(std::uint32_t blockIndex, std::uint64_t size) noexcept;
+		/// @brief Merges the block with the next physical block. The next block becomes unused.
+		/// @param blockIndex Block index.
+		void MergeWithNext(std::uint32_t blockIndex) noexcept;
+
+		/// @brief Makes sure that the @p count blocks can be acquired without an allocation.
+		/// @param count Block count.
+		void ReserveBlocks(std::uint32_t count);
+		/// @brief Acquires an unused block.
+		/// @return Block index.
+		[[nodiscard("Weird call")]]
+		std::uint32_t AcquireBlock() noexcept;
+		/// @brief Releases the block.
+		/// @param blockIndex Block index.
+		void ReleaseBlock(std::uint32_t blockIndex) noexcept;
+
+		std::uint64_t heapSize; ///< Heap size.
+		std::uint64_t granularity; ///< Granularity.
+		std::uint32_t granularityShift; ///< Log2 of the granularity.
+
+		std::vector<Block> blocks; ///< Blocks.
+		std::uint32_t unusedBlock; ///< First unused block.
+		std::uint32_t unusedBlockCount; ///< Unused block count.
+
+		std::uint64_t firstLevelBitmap; ///< Bit is set if the first level has a non-empty list.
+		std::array<std::uint32_t, FirstLevelCount> secondLevelBitmaps; ///< Bit is set if the second level list is non-empty.
+		std::array<std::array<std::uint32_t, SecondLevelCount>, FirstLevelCount> freeLists; ///< Free list heads.
+
+		std::uint64_t usedSize; ///< Allocated size.
+		std::uint32_t allocationCount; ///< Allocation count.
+		std::uint32_t freeBlockCount; ///< Free block count.
+	};
+}
+
+namespace PonyEngine::RenderDevice
+{
+	HeapAllocator::HeapAllocator(const std::uint64_t heapSize, const std::uint64_t granularity) :
+		heapSize{heapSize & ~(granularity - 1ull)},
+		granularity{granularity},
+		granularityShift{static_cast<std::uint32_t>(std::countr_zero(granularity))}
+	{
+		if (!std::has_single_bit(granularity)) [[unlikely]]
+		{
+			throw std::invalid_argument("Granularity must be a power of two");
+		}
+		if (this->heapSize == 0ull) [[unlikely]]
+		{
+			throw std::invalid_argument("Heap size must be at least the granularity");
+		}
+
+		Clear();
+	}
+
+	std::uint64_t HeapAllocator::HeapSize() const noexcept
+	{
+		return heapSize;
+	}
+
+	std::uint64_t HeapAllocator::Granularity() const noexcept
+	{
+		return granularity;
+	}
+
+	std::optional<HeapAllocation> HeapAllocator::Allocate(const std::uint64_t size, std::uint64_t alignment)
+	{
+#ifndef NDEBUG
+		if (size == 0ull) [[unlikely]]
+		{
+			throw std::invalid_argument("Size must be greater than zero");
+		}
+		if (!std::has_single_bit(alignment)) [[unlikely]]
+		{
+			throw std::invalid_argument("Alignment must be a power of two");
+		}
+#endif
+
+		alignment = std::max(alignment, granularity);
+		const std::uint64_t alignedSize = (size + granularity - 1ull) & ~(granularity - 1ull);
+		if (alignedSize > heapSize || alignment - granularity > heapSize - alignedSize) [[unlikely]]
+		{
+			return std::nullopt;
+		}
+
+		const std::uint32_t blockIndex = FindFreeBlock(alignedSize + alignment - granularity);
+		if (blockIndex == NullBlock) [[unlikely]]
+		{
+			return std::nullopt;
+		}
+
+		ReserveBlocks(2u);
+		RemoveFreeBlock(blockIndex);
+
+		if (const std::uint64_t padding = ((blocks[blockIndex].offset + alignment - 1ull) & ~(alignment - 1ull)) - blocks[blockIndex].offset; padding > 0ull)
+		{
+			// The padding stays free, the block goes after it.
+			SplitBlock(blockIndex, padding);
+			const std::uint32_t alignedBlockIndex = blocks[blockIndex].nextPhysical;
+			InsertFreeBlock(blockIndex);
+
+			return UseBlock(alignedBlockIndex, alignedSize);
+		}
+
+		return UseBlock(blockIndex, alignedSize);
+	}
+
+	void HeapAllocator::Free(const HeapAllocation& allocation)
+	{
+#ifndef NDEBUG
+		if (allocation.block >= blocks.size() || blocks[allocation.block].state != BlockState::Used || blocks[allocation.block].offset != allocation.offset) [[unlikely]]
+		{
+			throw std::invalid_argument("Allocation doesn't belong to this allocator");
+		}
+#endif
+
+		std::uint32_t blockIndex = allocation.block;
+		usedSize -= blocks[blockIndex].size;
+		--allocationCount;
+		blocks[blockIndex].state = BlockState::Free;
+
+		if (const std::uint32_t next = blocks[blockIndex].nextPhysical; next != NullBlock && blocks[next].state == BlockState::Free)
+		{
+			RemoveFreeBlock(next);
+			MergeWithNext(blockIndex);
+		}
+		if (const std::uint32_t previous = blocks[blockIndex].previousPhysical; previous != NullBlock && blocks[previous].state == BlockState::Free)
+		{
+			RemoveFreeBlock(previous);
+			MergeWithNext(previous);
+			blockIndex = previous;
+		}
+
+		InsertFreeBlock(blockIndex);
+	}
+
+	void HeapAllocator::Clear()
+	{
+		blocks.clear();
+		unusedBlock = NullBlock;
+		unusedBlockCount = 0u;
+		firstLevelBitmap = 0ull;
+		secondLevelBitmaps.fill(0u);
+		for (std::array<std::uint32_t, SecondLevelCount>& secondLevel : freeLists)
+		{
+			secondLevel.fill(NullBlock);
+		}
+		usedSize = 0ull;
+		allocationCount = 0u;
+		freeBlockCount = 0u;
+
+		blocks.push_back(Block
+		{
+			.offset = 0ull,
+			.size = heapSize,
+			.previousPhysical = NullBlock,
+			.nextPhysical = NullBlock,
+			.previousFree = NullBlock,
+			.nextFree = NullBlock,
+			.state = BlockState::Free
+		});
+		InsertFreeBlock(0u);
+	}
+
+	HeapAllocatorStatistics HeapAllocator::Statistics() const noexcept
+	{
+		std::uint64_t largestFreeBlockSize = 0ull;
+		if (firstLevelBitmap)
+		{
+			const auto firstLevel = static_cast<std::uint32_t>(std::bit_width(firstLevelBitmap) - 1);
+			const auto secondLevel = static_cast<std::uint32_t>(std::bit_width(secondLevelBitmaps[firstLevel]) - 1);
+			for (std::uint32_t blockIndex = freeLists[firstLevel][secondLevel]; blockIndex != NullBlock; blockIndex = blocks[blockIndex].nextFree)
+			{
+				largestFreeBlockSize = std::max(largestFreeBlockSize, blocks[blockIndex].size);
+			}
+		}
+
+		return HeapAllocatorStatistics
+		{
+			.heapSize = heapSize,
+			.usedSize = usedSize,
+			.freeSize = heapSize - usedSize,
+			.largestFreeBlockSize = largestFreeBlockSize,
+			.allocationCount = allocationCount,
+			.freeBlockCount = freeBlockCount
+		};
+	}
+
+	HeapAllocator::ListIndex HeapAllocator::Mapping(const std::uint64_t size) const noexcept
+	{
+		const std::uint64_t units = size >> granularityShift;
+		if (units < SecondLevelCount)
+		{
+			return ListIndex{.firstLevel = 0u, .secondLevel = static_cast<std::uint32_t>(units)};
+		}
+
+		const auto highBit = static_cast<std::uint32_t>(std::bit_width(units) - 1);
+		return ListIndex
+		{
+			.firstLevel = highBit - SecondLevelBitCount + 1u,
+			.secondLevel = static_cast<std::uint32_t>(units >> (highBit - SecondLevelBitCount)) - SecondLevelCount
+		};
+	}
+
+	HeapAllocator::ListIndex HeapAllocator::SearchMapping(const std::uint64_t size) const noexcept
+	{
+		std::uint64_t units = (size + granularity - 1ull) >> granularityShift;
+		if (units >= SecondLevelCount)
+		{
+			const auto highBit = static_cast<std::uint32_t>(std::bit_width(units) - 1);
+			units += (1ull << (highBit - SecondLevelBitCount)) - 1ull;
+		}
+
+		return Mapping(units << granularityShift);
+	}
+
+	std::uint32_t HeapAllocator::FindFreeBlock(const std::uint64_t size) const noexcept
+	{
+		ListIndex index = SearchMapping(size);
+		if (index.firstLevel >= FirstLevelCount) [[unlikely]]
+		{
+			return NullBlock;
+		}
+
+		std::uint32_t secondLevelBitmap = secondLevelBitmaps[index.firstLevel] & (~0u << index.secondLevel);
+		if (!secondLevelBitmap)
+		{
+			const std::uint64_t firstLevelBitmap = index.firstLevel + 1u < FirstLevelCount ? this->firstLevelBitmap & (~0ull << (index.firstLevel + 1u)) : 0ull;
+			if (!firstLevelBitmap)
+			{
+				return NullBlock;
+			}
+
+			index.firstLevel = static_cast<std::uint32_t>(std::countr_zero(firstLevelBitmap));
+			secondLevelBitmap = secondLevelBitmaps[index.firstLevel];
+		}
+		index.secondLevel = static_cast<std::uint32_t>(std::countr_zero(secondLevelBitmap));
+
+		return freeLists[index.firstLevel][index.secondLevel];
+	}
+
+	void HeapAllocator::InsertFreeBlock(const std::uint32_t blockIndex) noexcept
+	{
+		Block& block = blocks[blockIndex];
+		const ListIndex index = Mapping(block.size);
+		std::uint32_t& head = freeLists[index.firstLevel][index.secondLevel];
+
+		block.state = BlockState::Free;
+		block.previousFree = NullBlock;
+		block.nextFree = head;
+		if (head != NullBlock)
+		{
+			blocks[head].previousFree = blockIndex;
+		}
+		head = blockIndex;
+
+		firstLevelBitmap |= 1ull << index.firstLevel;
+		secondLevelBitmaps[index.firstLevel] |= 1u << index.secondLevel;
+		++freeBlockCount;
+	}
+
+	void HeapAllocator::RemoveFreeBlock(const std::uint32_t blockIndex) noexcept
+	{
+		assert(blocks[blockIndex].state == BlockState::Free && "The block isn't free.");
+
+		const Block& block = blocks[blockIndex];
+		if (block.previousFree != NullBlock)
+		{
+			blocks[block.previousFree].nextFree = block.nextFree;
+		}
+		else
+		{
+			const ListIndex index = Mapping(block.size);
+			std::uint32_t& head = freeLists[index.firstLevel][index.secondLevel];
+			head = block.nextFree;
+			if (head == NullBlock)
+			{
+				secondLevelBitmaps[index.firstLevel] &= ~(1u << index.secondLevel);
+				if (!secondLevelBitmaps[index.firstLevel])
+				{
+					firstLevelBitmap &= ~(1ull << index.firstLevel);
+				}
+			}
+		}
+		if (block.nextFree != NullBlock)
+		{
+			blocks[block.nextFree].previousFree = block.previousFree;
+		}
+
+		--freeBlockCount;
+	}
+
+	HeapAllocation HeapAllocator::UseBlock(const std::uint32_t blockIndex, const std::uint64_t size) noexcept
+	{
+		assert(blocks[blockIndex].size >= size && "The block is too small.");
+
+		if (blocks[blockIndex].size > size)
+		{
+			SplitBlock(blockIndex, size);
+			InsertFreeBlock(blocks[blockIndex].nextPhysical);
+		}
+
+		Block& block = blocks[blockIndex];
+		block.state = BlockState::Used;
+		usedSize += block.size;
+		++allocationCount;
+
+		return HeapAllocation{.offset = block.offset, .size = block.size, .block = blockIndex};
+	}
+
+	void HeapAllocator::SplitBlock(const std::uint32_t blockIndex, const std::uint64_t size) noexcept
+	{
+		const std::uint32_t tailIndex = AcquireBlock();
+		Block& block = blocks[blockIndex];
+		Block& tail = blocks[tailIndex];
+
+		tail.offset = block.offset + size;
+		tail.size = block.size - size;
+		tail.previousPhysical = blockIndex;
+		tail.nextPhysical = block.nextPhysical;
+		tail.state = BlockState::Free;
+		if (block.nextPhysical != NullBlock)
+		{
+			blocks[block.nextPhysical].previousPhysical = tailIndex;
+		}
+
+		block.size = size;
+		block.nextPhysical = tailIndex;
+	}
+
+	void HeapAllocator::MergeWithNext(const std::uint32_t blockIndex) noexcept
+	{
+		Block& block = blocks[blockIndex];
+		const std::uint32_t nextIndex = block.nextPhysical;
+		const Block& next = blocks[nextIndex];
+
+		block.size += next.size;
+		block.nextPhysical = next.nextPhysical;
+		if (next.nextPhysical != NullBlock)
+		{
+			blocks[next.nextPhysical].previousPhysical = blockIndex;
+		}
+
+		ReleaseBlock(nextIndex);
+	}
+
+	void HeapAllocator::ReserveBlocks(const std::uint32_t count)
+	{
+		if (unusedBlockCount >= count)
+		{
+			return;
+		}
+
+		const std::size_t required = blocks.size() + (count - unusedBlockCount);
+		if (required > blocks.capacity())
+		{
+			blocks.reserve(std::max(blocks.capacity() * 2uz, required));
+		}
+	}
+
+	std::uint32_t HeapAllocator::AcquireBlock() noexcept
+	{
+		if (unusedBlock != NullBlock)
+		{
+			const std::uint32_t blockIndex = unusedBlock;
+			unusedBlock = blocks[blockIndex].nextFree;
+			--unusedBlockCount;
+
+			return blockIndex;
+		}
+
+		assert(blocks.size() < blocks.capacity() && "Blocks weren't reserved.");
+		blocks.push_back(Block{.offset = 0ull, .size = 0ull, .previousPhysical = NullBlock, .nextPhysical = NullBlock,
+			.previousFree = NullBlock, .nextFree = NullBlock, .state = BlockState::Unused});
+
+		return static_cast<std::uint32_t>(blocks.size() - 1uz);
+	}
+
+	void HeapAllocator::ReleaseBlock(const std::uint32_t blockIndex) noexcept
+	{
+		Block& block = blocks[blockIndex];
+		block.state = BlockState::Unused;
+		block.nextFree = unusedBlock;
+		unusedBlock = blockIndex;
+		++unusedBlockCount;
+	}
+}
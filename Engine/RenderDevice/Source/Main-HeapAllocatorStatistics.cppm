@@ -0,0 +1,39 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.RenderDevice:HeapAllocatorStatistics;
+
+import std;
+
+export namespace PonyEngine::RenderDevice
+{
+	/// @brief Heap allocator statistics.
+	struct HeapAllocatorStatistics final
+	{
+		std::uint64_t heapSize = 0ull; ///< Heap size in bytes.
+		std::uint64_t usedSize = 0ull; ///< Allocated size in bytes.
+		std::uint64_t freeSize = 0ull; ///< Free size in bytes.
+		std::uint64_t largestFreeBlockSize = 0ull; ///< Largest free block size in bytes.
+		std::uint32_t allocationCount = 0u; ///< Allocation count.
+		std::uint32_t freeBlockCount = 0u; ///< Free block count.
+
+		/// @brief Calculates the fragmentation.
+		/// @return Fragmentation in range [0, 1]. 0 means that all the free space is in one block.
+		[[nodiscard("Pure function")]]
+		constexpr float Fragmentation() const noexcept;
+	};
+}
+
+namespace PonyEngine::RenderDevice
+{
+	constexpr float HeapAllocatorStatistics::Fragmentation() const noexcept
+	{
+		return freeSize > 0ull ? 1.f - static_cast<float>(static_cast<double>(largestFreeBlockSize) / static_cast<double>(freeSize)) : 0.f;
+	}
+}
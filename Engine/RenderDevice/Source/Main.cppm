@@ -48,6 +48,9 @@ export import :DeviceSupport;
 export import :FillMode;
 export import :Filter;
 export import :GraphicsPipelineStateParams;
+export import :HeapAllocation;
+export import :HeapAllocator;
+export import :HeapAllocatorStatistics;
 export import :HeapType;
 export import :IBuffer;
 export import :ICommandList;
@@ -11,4 +11,5 @@ export module PonyEngine.Time.Impl;
 
 export import PonyEngine.Time;
 
+export import :TimeService;
 export import :TimeServiceModule;
@@ -0,0 +1,469 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+module;
+
+#include <cassert>
+#include <cerrno>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+export module PonyEngine.Platform.Linux:MappedFile;
+
+import std;
+
+export namespace PonyEngine::Platform::Linux
+{
+	/// @brief Mapped file access.
+	enum class FileAccess : std::uint8_t
+	{
+		Read, ///< The file is mapped for reading only.
+		ReadWrite ///< The file is mapped for reading and writing. Writes go to the file. The file is created if it doesn't exist.
+	};
+
+	/// @brief Expected access pattern. It's a hint for the kernel page cache.
+	enum class AccessPattern : std::uint8_t
+	{
+		Normal, ///< No special treatment.
+		Sequential, ///< Pages are accessed in order. The kernel reads ahead aggressively and frees pages after they're used.
+		Random ///< Pages are accessed in random order. The kernel doesn't read ahead.
+	};
+
+	/// @brief Huge page mode of the mapping.
+	enum class HugePageMode : std::uint8_t
+	{
+		None, ///< Regular pages.
+		Transparent, ///< Transparent huge pages are requested. It's a best-effort hint: the kernel may ignore it.
+		HugeTLB ///< Explicit huge pages. The file must be on a hugetlbfs.
+	};
+
+	/// @brief Mapped file parameters.
+	struct MappedFileParams final
+	{
+		FileAccess access = FileAccess::Read; ///< File access.
+		AccessPattern pattern = AccessPattern::Normal; ///< Expected access pattern.
+		HugePageMode hugePages = HugePageMode::None; ///< Huge page mode.
+		std::size_t size = 0uz; ///< Min file size. If the file is smaller, it's grown sparsely. It's used only with the read-write access.
+		bool prefetch = false; ///< If it's @a true, the whole file is prefetched into the page cache asynchronously.
+	};
+
+	/// @brief Memory mapped file.
+	/// @details The file data is accessed directly in the page cache without copying it into user buffers.
+	class MappedFile final
+	{
+	public:
+		/// @brief Creates an empty mapped file.
+		[[nodiscard("Pure constructor")]]
+		MappedFile() noexcept;
+		/// @brief Maps the file.
+		/// @param path File path.
+		/// @param params Mapping parameters.
+		/// @throws std::runtime_error If the mapping fails.
+		[[nodiscard("Pure constructor")]]
+		MappedFile(const std::filesystem::path& path, const MappedFileParams& params);
+		MappedFile(const MappedFile& other) = delete;
+		[[nodiscard("Pure constructor")]]
+		MappedFile(MappedFile&& other) noexcept;
+
+		~MappedFile() noexcept;
+
+		/// @brief Checks if a file is mapped.
+		/// @return @a True if it's mapped; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool IsMapped() const noexcept;
+		/// @brief Checks if the mapping is writable.
+		/// @return @a True if it's writable; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool IsWritable() const noexcept;
+		/// @brief Gets the mapped size.
+		/// @return Mapped size in bytes.
+		[[nodiscard("Pure function")]]
+		std::size_t Size() const noexcept;
+
+		/// @brief Gets the mapped data.
+		/// @return Mapped data.
+		[[nodiscard("Pure function")]]
+		std::span<const std::byte> Data() const noexcept;
+		/// @brief Gets the mapped data for writing.
+		/// @return Mapped data.
+		/// @note The mapping must be writable.
+		[[nodiscard("Pure function")]]
+		std::span<std::byte> WritableData() noexcept;
+
+		/// @brief Sets the expected access pattern of the range.
+		/// @param pattern Access pattern.
+		/// @param offset Range offset. It's aligned down to the page size.
+		/// @param size Range size. It's clamped to the mapping.
+		void Advise(AccessPattern pattern, std::size_t offset = 0uz, std::size_t size = std::numeric_limits<std::size_t>::max()) const;
+		/// @brief Starts an asynchronous read of the range into the page cache.
+		/// @details The function doesn't wait for the read. It only queues it.
+		/// @param offset Range offset. It's aligned down to the page size.
+		/// @param size Range size. It's clamped to the mapping.
+		void Prefetch(std::size_t offset = 0uz, std::size_t size = std::numeric_limits<std::size_t>::max()) const;
+		/// @brief Tells the kernel that the range isn't needed soon. Its clean pages may be dropped from the page cache.
+		/// @param offset Range offset. It's aligned down to the page size.
+		/// @param size Range size. It's clamped to the mapping.
+		void Evict(std::size_t offset = 0uz, std::size_t size = std::numeric_limits<std::size_t>::max()) const;
+
+		/// @brief Resizes the file and the mapping.
+		/// @details Growing the file doesn't allocate disk space: the new range is a hole that reads as zeros till it's written.
+		/// @param size New size.
+		/// @note The mapping must be writable. The previously got data spans are invalidated.
+		void Resize(std::size_t size);
+		/// @brief Writes the changed pages to the file.
+		/// @param wait If it's @a true, the function waits till the pages are written; otherwise, it only schedules the write.
+		void Flush(bool wait = true) const;
+
+		/// @brief Unmaps and closes the file.
+		void Close() noexcept;
+
+		/// @brief Gets the page size.
+		/// @return Page size in bytes.
+		[[nodiscard("Pure function")]]
+		static std::size_t PageSize() noexcept;
+
+		MappedFile& operator =(const MappedFile& other) = delete;
+		MappedFile& operator =(MappedFile&& other) noexcept;
+
+	private:
+		/// @brief Maps the file.
+		/// @param size Mapping size.
+		void Map(std::size_t size);
+		/// @brief Sets the huge page mode of the mapping.
+		void AdviseHugePages() const noexcept;
+
+		/// @brief Converts the range into a page aligned range inside the mapping.
+		/// @param offset Range offset.
+		/// @param size Range size.
+		/// @return Page aligned offset and size.
+		[[nodiscard("Pure function")]]
+		std::pair<std::size_t, std::size_t> PageRange(std::size_t offset, std::size_t size) const noexcept;
+
+		std::byte* data; ///< Mapped data.
+		std::size_t size; ///< Mapped size.
+		int file; ///< File descriptor.
+		FileAccess access; ///< File access.
+		HugePageMode hugePages; ///< Huge page mode.
+	};
+}
+
+namespace PonyEngine::Platform::Linux
+{
+	/// @brief Converts the access pattern into a madvise advice.
+	/// @param pattern Access pattern.
+	/// @return Advice.
+	[[nodiscard("Pure function")]]
+	int ToMemoryAdvice(AccessPattern pattern) noexcept;
+	/// @brief Converts the access pattern into a posix_fadvise advice.
+	/// @param pattern Access pattern.
+	/// @return Advice.
+	[[nodiscard("Pure function")]]
+	int ToFileAdvice(AccessPattern pattern) noexcept;
+
+	MappedFile::MappedFile() noexcept :
+		data{nullptr},
+		size{0uz},
+		file{-1},
+		access{FileAccess::Read},
+		hugePages{HugePageMode::None}
+	{
+	}
+
+	MappedFile::MappedFile(const std::filesystem::path& path, const MappedFileParams& params) :
+		data{nullptr},
+		size{0uz},
+		file{-1},
+		access{params.access},
+		hugePages{params.hugePages}
+	{
+		const int flags = access == FileAccess::Read ? O_RDONLY | O_CLOEXEC : O_RDWR | O_CREAT | O_CLOEXEC;
+		file = open(path.c_str(), flags, 0644);
+		if (file < 0) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to open file: Path = '{}', ErrorCode = '{}'", path.string(), errno));
+		}
+
+		try
+		{
+			struct stat status;
+			if (fstat(file, &status) != 0) [[unlikely]]
+			{
+				throw std::runtime_error(std::format("Failed to get file size: Path = '{}', ErrorCode = '{}'", path.string(), errno));
+			}
+
+			std::size_t fileSize = static_cast<std::size_t>(status.st_size);
+			if (access == FileAccess::ReadWrite && params.size > fileSize)
+			{
+				if (ftruncate(file, static_cast<off_t>(params.size)) != 0) [[unlikely]]
+				{
+					throw std::runtime_error(std::format("Failed to grow file: Path = '{}', Size = '{}', ErrorCode = '{}'", path.string(), params.size, errno));
+				}
+				fileSize = params.size;
+			}
+
+			Map(fileSize);
+			if (params.pattern != AccessPattern::Normal)
+			{
+				Advise(params.pattern);
+			}
+			if (params.prefetch)
+			{
+				Prefetch();
+			}
+		}
+		catch (...)
+		{
+			Close();
+			throw;
+		}
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept :
+		data{std::exchange(other.data, nullptr)},
+		size{std::exchange(other.size, 0uz)},
+		file{std::exchange(other.file, -1)},
+		access{other.access},
+		hugePages{other.hugePages}
+	{
+	}
+
+	MappedFile::~MappedFile() noexcept
+	{
+		Close();
+	}
+
+	bool MappedFile::IsMapped() const noexcept
+	{
+		return file >= 0;
+	}
+
+	bool MappedFile::IsWritable() const noexcept
+	{
+		return IsMapped() && access == FileAccess::ReadWrite;
+	}
+
+	std::size_t MappedFile::Size() const noexcept
+	{
+		return size;
+	}
+
+	std::span<const std::byte> MappedFile::Data() const noexcept
+	{
+		return std::span<const std::byte>(data, size);
+	}
+
+	std::span<std::byte> MappedFile::WritableData() noexcept
+	{
+		assert(IsWritable() && "The mapped file isn't writable.");
+		return std::span<std::byte>(data, size);
+	}
+
+	void MappedFile::Advise(const AccessPattern pattern, const std::size_t offset, const std::size_t size) const
+	{
+		const auto [pageOffset, pageSize] = PageRange(offset, size);
+		if (pageSize == 0uz)
+		{
+			return;
+		}
+
+		if (madvise(data + pageOffset, pageSize, ToMemoryAdvice(pattern)) != 0) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to advise mapping: ErrorCode = '{}'", errno));
+		}
+		if (const int result = posix_fadvise(file, static_cast<off_t>(pageOffset), static_cast<off_t>(pageSize), ToFileAdvice(pattern)); result != 0) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to advise file: ErrorCode = '{}'", result));
+		}
+	}
+
+	void MappedFile::Prefetch(const std::size_t offset, const std::size_t size) const
+	{
+		const auto [pageOffset, pageSize] = PageRange(offset, size);
+		if (pageSize == 0uz)
+		{
+			return;
+		}
+
+		if (const int result = posix_fadvise(file, static_cast<off_t>(pageOffset), static_cast<off_t>(pageSize), POSIX_FADV_WILLNEED); result != 0) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to prefetch file: ErrorCode = '{}'", result));
+		}
+		if (madvise(data + pageOffset, pageSize, MADV_WILLNEED) != 0) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to prefetch mapping: ErrorCode = '{}'", errno));
+		}
+	}
+
+	void MappedFile::Evict(const std::size_t offset, const std::size_t size) const
+	{
+		const auto [pageOffset, pageSize] = PageRange(offset, size);
+		if (pageSize == 0uz)
+		{
+			return;
+		}
+
+		if (const int result = posix_fadvise(file, static_cast<off_t>(pageOffset), static_cast<off_t>(pageSize), POSIX_FADV_DONTNEED); result != 0) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to evict file: ErrorCode = '{}'", result));
+		}
+	}
+
+	void MappedFile::Resize(const std::size_t size)
+	{
+		assert(IsWritable() && "The mapped file isn't writable.");
+
+		if (ftruncate(file, static_cast<off_t>(size)) != 0) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to resize file: Size = '{}', ErrorCode = '{}'", size, errno));
+		}
+
+		if (!data || size == 0uz || hugePages == HugePageMode::HugeTLB)
+		{
+			if (data)
+			{
+				munmap(data, this->size);
+				data = nullptr;
+				this->size = 0uz;
+			}
+			Map(size);
+
+			return;
+		}
+
+		void* const newData = mremap(data, this->size, size, MREMAP_MAYMOVE);
+		if (newData == MAP_FAILED) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to remap file: Size = '{}', ErrorCode = '{}'", size, errno));
+		}
+		data = static_cast<std::byte*>(newData);
+		this->size = size;
+		AdviseHugePages();
+	}
+
+	void MappedFile::Flush(const bool wait) const
+	{
+		if (size == 0uz)
+		{
+			return;
+		}
+
+		if (msync(data, size, wait ? MS_SYNC : MS_ASYNC) != 0) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to flush mapping: ErrorCode = '{}'", errno));
+		}
+	}
+
+	void MappedFile::Close() noexcept
+	{
+		if (data)
+		{
+			munmap(data, size);
+			data = nullptr;
+			size = 0uz;
+		}
+		if (file >= 0)
+		{
+			close(file);
+			file = -1;
+		}
+	}
+
+	std::size_t MappedFile::PageSize() noexcept
+	{
+		static const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+		return pageSize;
+	}
+
+	MappedFile& MappedFile::operator =(MappedFile&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Close();
+			data = std::exchange(other.data, nullptr);
+			size = std::exchange(other.size, 0uz);
+			file = std::exchange(other.file, -1);
+			access = other.access;
+			hugePages = other.hugePages;
+		}
+
+		return *this;
+	}
+
+	void MappedFile::Map(const std::size_t size)
+	{
+		if (size == 0uz)
+		{
+			return;
+		}
+
+		const int protection = access == FileAccess::Read ? PROT_READ : PROT_READ | PROT_WRITE;
+		const int flags = MAP_SHARED | (hugePages == HugePageMode::HugeTLB ? MAP_HUGETLB : 0);
+		void* const newData = mmap(nullptr, size, protection, flags, file, 0);
+		if (newData == MAP_FAILED) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to map file: Size = '{}', ErrorCode = '{}'", size, errno));
+		}
+		data = static_cast<std::byte*>(newData);
+		this->size = size;
+		AdviseHugePages();
+	}
+
+	void MappedFile::AdviseHugePages() const noexcept
+	{
+#ifdef MADV_HUGEPAGE
+		if (hugePages == HugePageMode::Transparent)
+		{
+			// It's only a hint. The kernel may not support transparent huge pages for files.
+			[[maybe_unused]] const int result = madvise(data, size, MADV_HUGEPAGE);
+		}
+#endif
+	}
+
+	std::pair<std::size_t, std::size_t> MappedFile::PageRange(const std::size_t offset, const std::size_t size) const noexcept
+	{
+		if (offset >= this->size)
+		{
+			return std::pair(0uz, 0uz);
+		}
+
+		const std::size_t pageOffset = offset / PageSize() * PageSize();
+		const std::size_t end = offset + std::min(size, this->size - offset);
+
+		return std::pair(pageOffset, end - pageOffset);
+	}
+
+	int ToMemoryAdvice(const AccessPattern pattern) noexcept
+	{
+		switch (pattern)
+		{
+		case AccessPattern::Sequential:
+			return MADV_SEQUENTIAL;
+		case AccessPattern::Random:
+			return MADV_RANDOM;
+		default:
+			return MADV_NORMAL;
+		}
+	}
+
+	int ToFileAdvice(const AccessPattern pattern) noexcept
+	{
+		switch (pattern)
+		{
+		case AccessPattern::Sequential:
+			return POSIX_FADV_SEQUENTIAL;
+		case AccessPattern::Random:
+			return POSIX_FADV_RANDOM;
+		default:
+			return POSIX_FADV_NORMAL;
+		}
+	}
+}
@@ -0,0 +1,202 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+module;
+
+#include <cerrno>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+export module PonyEngine.Log.File.Impl:LogFile;
+
+import std;
+
+export namespace PonyEngine::Log::File
+{
+	/// @brief Append-only log file.
+	/// @details It writes directly to the file descriptor without any user-space buffering. The caller is expected to batch the data.
+	class LogFile final
+	{
+	public:
+		static constexpr std::size_t MaxWritePartCount = 8uz; ///< Max count of parts in one gathered write.
+
+		/// @brief Creates a closed log file.
+		[[nodiscard("Pure constructor")]]
+		LogFile() noexcept;
+		/// @brief Opens the log file for appending. The file is created if it doesn't exist.
+		/// @param path File path.
+		/// @throws std::runtime_error If the file can't be opened.
+		[[nodiscard("Pure constructor")]]
+		explicit LogFile(const std::filesystem::path& path);
+		LogFile(const LogFile& other) = delete;
+		[[nodiscard("Pure constructor")]]
+		LogFile(LogFile&& other) noexcept;
+
+		~LogFile() noexcept;
+
+		/// @brief Checks if the file is open.
+		/// @return @a True if it's open; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool IsOpen() const noexcept;
+		/// @brief Gets the file size.
+		/// @return File size in bytes.
+		[[nodiscard("Pure function")]]
+		std::uint64_t Size() const noexcept;
+
+		/// @brief Writes the @p parts to the end of the file with a single gathered write.
+		/// @param parts Data parts. Their count must be at most @p MaxWritePartCount.
+		/// @throws std::runtime_error If the write fails.
+		void Write(std::span<const std::span<const std::byte>> parts);
+		/// @brief Writes the file data to the storage device.
+		/// @details The file metadata is written only if it's required to read the data back.
+		/// @throws std::runtime_error If the sync fails.
+		void Sync() const;
+
+		/// @brief Closes the file.
+		void Close() noexcept;
+
+		LogFile& operator =(const LogFile& other) = delete;
+		LogFile& operator =(LogFile&& other) noexcept;
+
+	private:
+		std::uint64_t size; ///< File size.
+		int file; ///< File descriptor.
+	};
+}
+
+namespace PonyEngine::Log::File
+{
+	LogFile::LogFile() noexcept :
+		size{0ull},
+		file{-1}
+	{
+	}
+
+	LogFile::LogFile(const std::filesystem::path& path) :
+		size{0ull},
+		file{open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644)}
+	{
+		if (file < 0) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to open log file: Path = '{}', ErrorCode = '{}'", path.string(), errno));
+		}
+
+		struct stat status;
+		if (fstat(file, &status) != 0) [[unlikely]]
+		{
+			const int error = errno;
+			Close();
+			throw std::runtime_error(std::format("Failed to get log file size: Path = '{}', ErrorCode = '{}'", path.string(), error));
+		}
+		size = static_cast<std::uint64_t>(status.st_size);
+	}
+
+	LogFile::LogFile(LogFile&& other) noexcept :
+		size{std::exchange(other.size, 0ull)},
+		file{std::exchange(other.file, -1)}
+	{
+	}
+
+	LogFile::~LogFile() noexcept
+	{
+		Close();
+	}
+
+	bool LogFile::IsOpen() const noexcept
+	{
+		return file >= 0;
+	}
+
+	std::uint64_t LogFile::Size() const noexcept
+	{
+		return size;
+	}
+
+	void LogFile::Write(const std::span<const std::span<const std::byte>> parts)
+	{
+#ifndef NDEBUG
+		if (parts.size() > MaxWritePartCount) [[unlikely]]
+		{
+			throw std::logic_error("Too many write parts");
+		}
+#endif
+
+		auto vectors = std::array<iovec, MaxWritePartCount>();
+		std::size_t vectorCount = 0uz;
+		for (const std::span<const std::byte> part : parts)
+		{
+			if (!part.empty())
+			{
+				vectors[vectorCount++] = iovec{.iov_base = const_cast<std::byte*>(part.data()), .iov_len = part.size()};
+			}
+		}
+
+		for (std::size_t vectorIndex = 0uz; vectorIndex < vectorCount; )
+		{
+			const ssize_t written = writev(file, vectors.data() + vectorIndex, static_cast<int>(vectorCount - vectorIndex));
+			if (written < 0) [[unlikely]]
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				throw std::runtime_error(std::format("Failed to write log file: ErrorCode = '{}'", errno));
+			}
+
+			size += static_cast<std::uint64_t>(written);
+			for (std::size_t left = static_cast<std::size_t>(written); left > 0uz; )
+			{
+				iovec& vector = vectors[vectorIndex];
+				const std::size_t consumed = std::min(left, vector.iov_len);
+				vector.iov_base = static_cast<std::byte*>(vector.iov_base) + consumed;
+				vector.iov_len -= consumed;
+				left -= consumed;
+				if (vector.iov_len == 0uz)
+				{
+					++vectorIndex;
+				}
+			}
+		}
+	}
+
+	void LogFile::Sync() const
+	{
+		if (fdatasync(file) != 0) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to sync log file: ErrorCode = '{}'", errno));
+		}
+	}
+
+	void LogFile::Close() noexcept
+	{
+		if (file >= 0)
+		{
+			close(file);
+			file = -1;
+			size = 0ull;
+		}
+	}
+
+	LogFile& LogFile::operator =(LogFile&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Close();
+			size = std::exchange(other.size, 0ull);
+			file = std::exchange(other.file, -1);
+		}
+
+		return *this;
+	}
+}
@@ -0,0 +1,93 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+export module PonyEngine.Log.File.Impl:LogMapping;
+
+import std;
+
+import PonyEngine.Platform.Linux;
+
+export namespace PonyEngine::Log::File
+{
+	/// @brief Fixed-size log file mapped for writing.
+	/// @details The mapping is shared, so the written data is in the page cache and the kernel writes it to the file even if the process is killed.
+	class LogMapping final
+	{
+	public:
+		/// @brief Creates an empty log mapping.
+		[[nodiscard("Pure constructor")]]
+		LogMapping() noexcept = default;
+		/// @brief Opens the log file, resizes it to the @p size and maps it. The file is created if it doesn't exist.
+		/// @param path File path.
+		/// @param size File size.
+		/// @throws std::runtime_error If the file can't be mapped.
+		[[nodiscard("Pure constructor")]]
+		LogMapping(const std::filesystem::path& path, std::size_t size);
+		LogMapping(const LogMapping& other) = delete;
+		[[nodiscard("Pure constructor")]]
+		LogMapping(LogMapping&& other) noexcept = default;
+
+		~LogMapping() noexcept = default;
+
+		/// @brief Checks if the file is mapped.
+		/// @return @a True if it's mapped; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool IsMapped() const noexcept;
+		/// @brief Gets the mapped data.
+		/// @return Mapped data. It's page aligned.
+		[[nodiscard("Pure function")]]
+		std::span<std::byte> Data() noexcept;
+
+		/// @brief Schedules a write of the changed pages to the file. It doesn't wait for the write.
+		/// @throws std::runtime_error If the flush fails.
+		void Flush() const;
+
+		/// @brief Unmaps and closes the file.
+		void Close() noexcept;
+
+		LogMapping& operator =(const LogMapping& other) = delete;
+		LogMapping& operator =(LogMapping&& other) noexcept = default;
+
+	private:
+		Platform::Linux::MappedFile file; ///< Mapped file.
+	};
+}
+
+namespace PonyEngine::Log::File
+{
+	LogMapping::LogMapping(const std::filesystem::path& path, const std::size_t size) :
+		file(path, Platform::Linux::MappedFileParams{.access = Platform::Linux::FileAccess::ReadWrite, .size = size})
+	{
+		if (file.Size() != size)
+		{
+			file.Resize(size);
+		}
+	}
+
+	bool LogMapping::IsMapped() const noexcept
+	{
+		return file.IsMapped();
+	}
+
+	std::span<std::byte> LogMapping::Data() noexcept
+	{
+		return file.WritableData();
+	}
+
+	void LogMapping::Flush() const
+	{
+		file.Flush(false);
+	}
+
+	void LogMapping::Close() noexcept
+	{
+		file.Close();
+	}
+}
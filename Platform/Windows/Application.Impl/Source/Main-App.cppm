@@ -18,6 +18,7 @@ import std;
 import PonyEngine.Application.Ext.Windows;
 import PonyEngine.Application.Impl;
 import PonyEngine.Log;
+import PonyEngine.Memory;
 import PonyEngine.Meta;
 
 import :AppDataManager;
@@ -109,6 +110,9 @@ export namespace PonyEngine::Application::Windows
 		[[nodiscard("Pure function")]]
 		virtual std::uint64_t FrameCount() const noexcept override;
 
+		[[nodiscard("Pure function")]]
+		virtual Memory::AllocationStatistics AllocationStatistics(Memory::AllocationTag tag) const noexcept override;
+
 		[[nodiscard("Pure function")]]
 		virtual HINSTANCE Instance() const noexcept override;
 		[[nodiscard("Pure function")]]
@@ -278,6 +282,11 @@ namespace PonyEngine::Application::Windows
 		return flowManager.FrameCount();
 	}
 
+	Memory::AllocationStatistics App::AllocationStatistics(const Memory::AllocationTag tag) const noexcept
+	{
+		return Memory::GetAllocationStatistics(tag);
+	}
+
 	HINSTANCE App::Instance() const noexcept
 	{
 		return appDataManager.Instance();
@@ -0,0 +1,175 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+module;
+
+#include "PonyEngine/Platform/Windows/Framework.h"
+
+export module PonyEngine.Log.File.Impl:LogFile;
+
+import std;
+
+export namespace PonyEngine::Log::File
+{
+	/// @brief Append-only log file.
+	/// @details It writes directly to the file handle without any user-space buffering. The caller is expected to batch the data.
+	class LogFile final
+	{
+	public:
+		static constexpr std::size_t MaxWritePartCount = 8uz; ///< Max count of parts in one gathered write.
+
+		/// @brief Creates a closed log file.
+		[[nodiscard("Pure constructor")]]
+		LogFile() noexcept;
+		/// @brief Opens the log file for appending. The file is created if it doesn't exist.
+		/// @param path File path.
+		/// @throws std::runtime_error If the file can't be opened.
+		[[nodiscard("Pure constructor")]]
+		explicit LogFile(const std::filesystem::path& path);
+		LogFile(const LogFile& other) = delete;
+		[[nodiscard("Pure constructor")]]
+		LogFile(LogFile&& other) noexcept;
+
+		~LogFile() noexcept;
+
+		/// @brief Checks if the file is open.
+		/// @return @a True if it's open; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool IsOpen() const noexcept;
+		/// @brief Gets the file size.
+		/// @return File size in bytes.
+		[[nodiscard("Pure function")]]
+		std::uint64_t Size() const noexcept;
+
+		/// @brief Writes the @p parts to the end of the file.
+		/// @details Windows has no gathered write for buffered files, so the parts are written one by one.
+		/// @param parts Data parts. Their count must be at most @p MaxWritePartCount.
+		/// @throws std::runtime_error If the write fails.
+		void Write(std::span<const std::span<const std::byte>> parts);
+		/// @brief Writes the file data and metadata to the storage device.
+		/// @throws std::runtime_error If the sync fails.
+		void Sync() const;
+
+		/// @brief Closes the file.
+		void Close() noexcept;
+
+		LogFile& operator =(const LogFile& other) = delete;
+		LogFile& operator =(LogFile&& other) noexcept;
+
+	private:
+		std::uint64_t size; ///< File size.
+		HANDLE file; ///< File handle.
+	};
+}
+
+namespace PonyEngine::Log::File
+{
+	LogFile::LogFile() noexcept :
+		size{0ull},
+		file{INVALID_HANDLE_VALUE}
+	{
+	}
+
+	LogFile::LogFile(const std::filesystem::path& path) :
+		size{0ull},
+		file{CreateFileW(path.c_str(), FILE_APPEND_DATA, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr)}
+	{
+		if (file == INVALID_HANDLE_VALUE) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to open log file: Path = '{}', ErrorCode = '0x{:X}'", path.string(), GetLastError()));
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize)) [[unlikely]]
+		{
+			const DWORD error = GetLastError();
+			Close();
+			throw std::runtime_error(std::format("Failed to get log file size: Path = '{}', ErrorCode = '0x{:X}'", path.string(), error));
+		}
+		size = static_cast<std::uint64_t>(fileSize.QuadPart);
+	}
+
+	LogFile::LogFile(LogFile&& other) noexcept :
+		size{std::exchange(other.size, 0ull)},
+		file{std::exchange(other.file, INVALID_HANDLE_VALUE)}
+	{
+	}
+
+	LogFile::~LogFile() noexcept
+	{
+		Close();
+	}
+
+	bool LogFile::IsOpen() const noexcept
+	{
+		return file != INVALID_HANDLE_VALUE;
+	}
+
+	std::uint64_t LogFile::Size() const noexcept
+	{
+		return size;
+	}
+
+	void LogFile::Write(const std::span<const std::span<const std::byte>> parts)
+	{
+#ifndef NDEBUG
+		if (parts.size() > MaxWritePartCount) [[unlikely]]
+		{
+			throw std::logic_error("Too many write parts");
+		}
+#endif
+
+		for (std::span<const std::byte> part : parts)
+		{
+			while (!part.empty())
+			{
+				const DWORD toWrite = static_cast<DWORD>(std::min(part.size(), static_cast<std::size_t>(std::numeric_limits<DWORD>::max())));
+				DWORD written;
+				if (!WriteFile(file, part.data(), toWrite, &written, nullptr)) [[unlikely]]
+				{
+					throw std::runtime_error(std::format("Failed to write log file: ErrorCode = '0x{:X}'", GetLastError()));
+				}
+
+				size += written;
+				part = part.subspan(written);
+			}
+		}
+	}
+
+	void LogFile::Sync() const
+	{
+		if (!FlushFileBuffers(file)) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to sync log file: ErrorCode = '0x{:X}'", GetLastError()));
+		}
+	}
+
+	void LogFile::Close() noexcept
+	{
+		if (file != INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(file);
+			file = INVALID_HANDLE_VALUE;
+			size = 0ull;
+		}
+	}
+
+	LogFile& LogFile::operator =(LogFile&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Close();
+			size = std::exchange(other.size, 0ull);
+			file = std::exchange(other.file, INVALID_HANDLE_VALUE);
+		}
+
+		return *this;
+	}
+}
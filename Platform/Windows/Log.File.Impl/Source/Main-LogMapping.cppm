@@ -0,0 +1,186 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+module;
+
+#include "PonyEngine/Platform/Windows/Framework.h"
+
+export module PonyEngine.Log.File.Impl:LogMapping;
+
+import std;
+
+export namespace PonyEngine::Log::File
+{
+	/// @brief Fixed-size log file mapped for writing.
+	/// @details The view is backed by the system file cache, so the written data is written to the file even if the process is terminated.
+	class LogMapping final
+	{
+	public:
+		/// @brief Creates an empty log mapping.
+		[[nodiscard("Pure constructor")]]
+		LogMapping() noexcept;
+		/// @brief Opens the log file, resizes it to the @p size and maps it. The file is created if it doesn't exist.
+		/// @param path File path.
+		/// @param size File size.
+		/// @throws std::runtime_error If the file can't be mapped.
+		[[nodiscard("Pure constructor")]]
+		LogMapping(const std::filesystem::path& path, std::size_t size);
+		LogMapping(const LogMapping& other) = delete;
+		[[nodiscard("Pure constructor")]]
+		LogMapping(LogMapping&& other) noexcept;
+
+		~LogMapping() noexcept;
+
+		/// @brief Checks if the file is mapped.
+		/// @return @a True if it's mapped; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool IsMapped() const noexcept;
+		/// @brief Gets the mapped data.
+		/// @return Mapped data. It's page aligned.
+		[[nodiscard("Pure function")]]
+		std::span<std::byte> Data() noexcept;
+
+		/// @brief Starts a write of the changed pages to the file. It doesn't wait for the storage device.
+		/// @throws std::runtime_error If the flush fails.
+		void Flush() const;
+
+		/// @brief Unmaps and closes the file.
+		void Close() noexcept;
+
+		LogMapping& operator =(const LogMapping& other) = delete;
+		LogMapping& operator =(LogMapping&& other) noexcept;
+
+	private:
+		std::byte* data; ///< Mapped data.
+		std::size_t size; ///< Mapped size.
+		HANDLE file; ///< File handle.
+		HANDLE mapping; ///< File mapping handle.
+	};
+}
+
+namespace PonyEngine::Log::File
+{
+	LogMapping::LogMapping() noexcept :
+		data{nullptr},
+		size{0uz},
+		file{INVALID_HANDLE_VALUE},
+		mapping{nullptr}
+	{
+	}
+
+	LogMapping::LogMapping(const std::filesystem::path& path, const std::size_t size) :
+		data{nullptr},
+		size{0uz},
+		file{CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr)},
+		mapping{nullptr}
+	{
+		if (file == INVALID_HANDLE_VALUE) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to open log file: Path = '{}', ErrorCode = '0x{:X}'", path.string(), GetLastError()));
+		}
+
+		try
+		{
+			const auto fileSize = LARGE_INTEGER{.QuadPart = static_cast<LONGLONG>(size)};
+			if (!SetFilePointerEx(file, fileSize, nullptr, FILE_BEGIN) || !SetEndOfFile(file)) [[unlikely]]
+			{
+				throw std::runtime_error(std::format("Failed to resize log file: Path = '{}', Size = '{}', ErrorCode = '0x{:X}'", path.string(), size, GetLastError()));
+			}
+
+			mapping = CreateFileMappingW(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(fileSize.HighPart), fileSize.LowPart, nullptr);
+			if (!mapping) [[unlikely]]
+			{
+				throw std::runtime_error(std::format("Failed to create log file mapping: Path = '{}', ErrorCode = '0x{:X}'", path.string(), GetLastError()));
+			}
+
+			data = static_cast<std::byte*>(MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, size));
+			if (!data) [[unlikely]]
+			{
+				throw std::runtime_error(std::format("Failed to map log file: Path = '{}', ErrorCode = '0x{:X}'", path.string(), GetLastError()));
+			}
+			this->size = size;
+		}
+		catch (...)
+		{
+			Close();
+			throw;
+		}
+	}
+
+	LogMapping::LogMapping(LogMapping&& other) noexcept :
+		data{std::exchange(other.data, nullptr)},
+		size{std::exchange(other.size, 0uz)},
+		file{std::exchange(other.file, INVALID_HANDLE_VALUE)},
+		mapping{std::exchange(other.mapping, nullptr)}
+	{
+	}
+
+	LogMapping::~LogMapping() noexcept
+	{
+		Close();
+	}
+
+	bool LogMapping::IsMapped() const noexcept
+	{
+		return data;
+	}
+
+	std::span<std::byte> LogMapping::Data() noexcept
+	{
+		return std::span<std::byte>(data, size);
+	}
+
+	void LogMapping::Flush() const
+	{
+		if (!data)
+		{
+			return;
+		}
+
+		if (!FlushViewOfFile(data, 0)) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to flush log file mapping: ErrorCode = '0x{:X}'", GetLastError()));
+		}
+	}
+
+	void LogMapping::Close() noexcept
+	{
+		if (data)
+		{
+			UnmapViewOfFile(data);
+			data = nullptr;
+			size = 0uz;
+		}
+		if (mapping)
+		{
+			CloseHandle(mapping);
+			mapping = nullptr;
+		}
+		if (file != INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(file);
+			file = INVALID_HANDLE_VALUE;
+		}
+	}
+
+	LogMapping& LogMapping::operator =(LogMapping&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Close();
+			data = std::exchange(other.data, nullptr);
+			size = std::exchange(other.size, 0uz);
+			file = std::exchange(other.file, INVALID_HANDLE_VALUE);
+			mapping = std::exchange(other.mapping, nullptr);
+		}
+
+		return *this;
+	}
+}
@@ -61,140 +61,156 @@ export namespace PonyEngine::RawInput::Keyboard::Windows
 
 namespace PonyEngine::RawInput::Keyboard::Windows
 {
+	/// @brief Axes of the known scan codes. They're presets, so their IDs are made at compile time.
+	constexpr auto PresetAxes = std::to_array(
+	{
+		std::pair<WORD, AxisID>(0x001E, MakeAxisID(KeyboardLayout::MainAPath)),
+		std::pair<WORD, AxisID>(0x0030, MakeAxisID(KeyboardLayout::MainBPath)),
+		std::pair<WORD, AxisID>(0x002E, MakeAxisID(KeyboardLayout::MainCPath)),
+		std::pair<WORD, AxisID>(0x0020, MakeAxisID(KeyboardLayout::MainDPath)),
+		std::pair<WORD, AxisID>(0x0012, MakeAxisID(KeyboardLayout::MainEPath)),
+		std::pair<WORD, AxisID>(0x0021, MakeAxisID(KeyboardLayout::MainFPath)),
+		std::pair<WORD, AxisID>(0x0022, MakeAxisID(KeyboardLayout::MainGPath)),
+		std::pair<WORD, AxisID>(0x0023, MakeAxisID(KeyboardLayout::MainHPath)),
+		std::pair<WORD, AxisID>(0x0017, MakeAxisID(KeyboardLayout::MainIPath)),
+		std::pair<WORD, AxisID>(0x0024, MakeAxisID(KeyboardLayout::MainJPath)),
+		std::pair<WORD, AxisID>(0x0025, MakeAxisID(KeyboardLayout::MainKPath)),
+		std::pair<WORD, AxisID>(0x0026, MakeAxisID(KeyboardLayout::MainLPath)),
+		std::pair<WORD, AxisID>(0x0032, MakeAxisID(KeyboardLayout::MainMPath)),
+		std::pair<WORD, AxisID>(0x0031, MakeAxisID(KeyboardLayout::MainNPath)),
+		std::pair<WORD, AxisID>(0x0018, MakeAxisID(KeyboardLayout::MainOPath)),
+		std::pair<WORD, AxisID>(0x0019, MakeAxisID(KeyboardLayout::MainPPath)),
+		std::pair<WORD, AxisID>(0x0010, MakeAxisID(KeyboardLayout::MainQPath)),
+		std::pair<WORD, AxisID>(0x0013, MakeAxisID(KeyboardLayout::MainRPath)),
+		std::pair<WORD, AxisID>(0x001F, MakeAxisID(KeyboardLayout::MainSPath)),
+		std::pair<WORD, AxisID>(0x0014, MakeAxisID(KeyboardLayout::MainTPath)),
+		std::pair<WORD, AxisID>(0x0016, MakeAxisID(KeyboardLayout::MainUPath)),
+		std::pair<WORD, AxisID>(0x002F, MakeAxisID(KeyboardLayout::MainVPath)),
+		std::pair<WORD, AxisID>(0x0011, MakeAxisID(KeyboardLayout::MainWPath)),
+		std::pair<WORD, AxisID>(0x002D, MakeAxisID(KeyboardLayout::MainXPath)),
+		std::pair<WORD, AxisID>(0x0015, MakeAxisID(KeyboardLayout::MainYPath)),
+		std::pair<WORD, AxisID>(0x002C, MakeAxisID(KeyboardLayout::MainZPath)),
+
+		std::pair<WORD, AxisID>(0x0002, MakeAxisID(KeyboardLayout::Main1Path)),
+		std::pair<WORD, AxisID>(0x0003, MakeAxisID(KeyboardLayout::Main2Path)),
+		std::pair<WORD, AxisID>(0x0004, MakeAxisID(KeyboardLayout::Main3Path)),
+		std::pair<WORD, AxisID>(0x0005, MakeAxisID(KeyboardLayout::Main4Path)),
+		std::pair<WORD, AxisID>(0x0006, MakeAxisID(KeyboardLayout::Main5Path)),
+		std::pair<WORD, AxisID>(0x0007, MakeAxisID(KeyboardLayout::Main6Path)),
+		std::pair<WORD, AxisID>(0x0008, MakeAxisID(KeyboardLayout::Main7Path)),
+		std::pair<WORD, AxisID>(0x0009, MakeAxisID(KeyboardLayout::Main8Path)),
+		std::pair<WORD, AxisID>(0x000A, MakeAxisID(KeyboardLayout::Main9Path)),
+		std::pair<WORD, AxisID>(0x000B, MakeAxisID(KeyboardLayout::Main0Path)),
+
+		std::pair<WORD, AxisID>(0x001C, MakeAxisID(KeyboardLayout::MainEnterPath)),
+		std::pair<WORD, AxisID>(0x0001, MakeAxisID(KeyboardLayout::MainEscapePath)),
+		std::pair<WORD, AxisID>(0x000E, MakeAxisID(KeyboardLayout::MainBackspacePath)),
+		std::pair<WORD, AxisID>(0x000F, MakeAxisID(KeyboardLayout::MainTabPath)),
+		std::pair<WORD, AxisID>(0x0039, MakeAxisID(KeyboardLayout::MainSpacePath)),
+
+		std::pair<WORD, AxisID>(0x000C, MakeAxisID(KeyboardLayout::MainDashPath)),
+		std::pair<WORD, AxisID>(0x000D, MakeAxisID(KeyboardLayout::MainEqualsPath)),
+		std::pair<WORD, AxisID>(0x001A, MakeAxisID(KeyboardLayout::MainLeftBracePath)),
+		std::pair<WORD, AxisID>(0x001B, MakeAxisID(KeyboardLayout::MainRightBracePath)),
+		std::pair<WORD, AxisID>(0x002B, MakeAxisID(KeyboardLayout::MainBackslashPath)),
+		std::pair<WORD, AxisID>(0x0027, MakeAxisID(KeyboardLayout::MainColonPath)),
+		std::pair<WORD, AxisID>(0x0028, MakeAxisID(KeyboardLayout::MainApostrophePath)),
+		std::pair<WORD, AxisID>(0x0029, MakeAxisID(KeyboardLayout::MainTildePath)),
+		std::pair<WORD, AxisID>(0x0033, MakeAxisID(KeyboardLayout::MainCommaPath)),
+		std::pair<WORD, AxisID>(0x0034, MakeAxisID(KeyboardLayout::MainPeriodPath)),
+		std::pair<WORD, AxisID>(0x0035, MakeAxisID(KeyboardLayout::MainSlashPath)),
+		std::pair<WORD, AxisID>(0x0056, MakeAxisID(KeyboardLayout::MainPipePath)),
+
+		std::pair<WORD, AxisID>(0x003B, MakeAxisID(KeyboardLayout::MainF1Path)),
+		std::pair<WORD, AxisID>(0x003C, MakeAxisID(KeyboardLayout::MainF2Path)),
+		std::pair<WORD, AxisID>(0x003D, MakeAxisID(KeyboardLayout::MainF3Path)),
+		std::pair<WORD, AxisID>(0x003E, MakeAxisID(KeyboardLayout::MainF4Path)),
+		std::pair<WORD, AxisID>(0x003F, MakeAxisID(KeyboardLayout::MainF5Path)),
+		std::pair<WORD, AxisID>(0x0040, MakeAxisID(KeyboardLayout::MainF6Path)),
+		std::pair<WORD, AxisID>(0x0041, MakeAxisID(KeyboardLayout::MainF7Path)),
+		std::pair<WORD, AxisID>(0x0042, MakeAxisID(KeyboardLayout::MainF8Path)),
+		std::pair<WORD, AxisID>(0x0043, MakeAxisID(KeyboardLayout::MainF9Path)),
+		std::pair<WORD, AxisID>(0x0044, MakeAxisID(KeyboardLayout::MainF10Path)),
+		std::pair<WORD, AxisID>(0x0057, MakeAxisID(KeyboardLayout::MainF11Path)),
+		std::pair<WORD, AxisID>(0x0058, MakeAxisID(KeyboardLayout::MainF12Path)),
+		std::pair<WORD, AxisID>(0x0064, MakeAxisID(KeyboardLayout::MainF13Path)),
+		std::pair<WORD, AxisID>(0x0065, MakeAxisID(KeyboardLayout::MainF14Path)),
+		std::pair<WORD, AxisID>(0x0066, MakeAxisID(KeyboardLayout::MainF15Path)),
+		std::pair<WORD, AxisID>(0x0067, MakeAxisID(KeyboardLayout::MainF16Path)),
+		std::pair<WORD, AxisID>(0x0068, MakeAxisID(KeyboardLayout::MainF17Path)),
+		std::pair<WORD, AxisID>(0x0069, MakeAxisID(KeyboardLayout::MainF18Path)),
+		std::pair<WORD, AxisID>(0x006A, MakeAxisID(KeyboardLayout::MainF19Path)),
+		std::pair<WORD, AxisID>(0x006B, MakeAxisID(KeyboardLayout::MainF20Path)),
+		std::pair<WORD, AxisID>(0x006C, MakeAxisID(KeyboardLayout::MainF21Path)),
+		std::pair<WORD, AxisID>(0x006D, MakeAxisID(KeyboardLayout::MainF22Path)),
+		std::pair<WORD, AxisID>(0x006E, MakeAxisID(KeyboardLayout::MainF23Path)),
+		std::pair<WORD, AxisID>(0x0076, MakeAxisID(KeyboardLayout::MainF24Path)),
+
+		std::pair<WORD, AxisID>(0xE052, MakeAxisID(KeyboardLayout::MainInsertPath)),
+		std::pair<WORD, AxisID>(0xE053, MakeAxisID(KeyboardLayout::MainDeletePath)),
+		std::pair<WORD, AxisID>(0xE047, MakeAxisID(KeyboardLayout::MainHomePath)),
+		std::pair<WORD, AxisID>(0xE04F, MakeAxisID(KeyboardLayout::MainEndPath)),
+		std::pair<WORD, AxisID>(0xE049, MakeAxisID(KeyboardLayout::MainPageUpPath)),
+		std::pair<WORD, AxisID>(0xE051, MakeAxisID(KeyboardLayout::MainPageDownPath)),
+
+		std::pair<WORD, AxisID>(0x001D, MakeAxisID(KeyboardLayout::MainLeftCtrlPath)),
+		std::pair<WORD, AxisID>(0xE01D, MakeAxisID(KeyboardLayout::MainRightCtrlPath)),
+		std::pair<WORD, AxisID>(0x0038, MakeAxisID(KeyboardLayout::MainLeftAltPath)),
+		std::pair<WORD, AxisID>(0xE038, MakeAxisID(KeyboardLayout::MainRightAltPath)),
+		std::pair<WORD, AxisID>(0x002A, MakeAxisID(KeyboardLayout::MainLeftShiftPath)),
+		std::pair<WORD, AxisID>(0x0036, MakeAxisID(KeyboardLayout::MainRightShiftPath)),
+
+		std::pair<WORD, AxisID>(0x003A, MakeAxisID(KeyboardLayout::LockCapsPath)),
+		std::pair<WORD, AxisID>(0x0046, MakeAxisID(KeyboardLayout::LockScrollPath)),
+		std::pair<WORD, AxisID>(0x0045, MakeAxisID(KeyboardLayout::LockNumPath)),
+
+		std::pair<WORD, AxisID>(0xE04B, MakeAxisID(KeyboardLayout::ArrowLeftPath)),
+		std::pair<WORD, AxisID>(0xE04D, MakeAxisID(KeyboardLayout::ArrowRightPath)),
+		std::pair<WORD, AxisID>(0xE050, MakeAxisID(KeyboardLayout::ArrowDownPath)),
+		std::pair<WORD, AxisID>(0xE048, MakeAxisID(KeyboardLayout::ArrowUpPath)),
+
+		std::pair<WORD, AxisID>(0xE035, MakeAxisID(KeyboardLayout::NumpadSlashPath)),
+		std::pair<WORD, AxisID>(0x0037, MakeAxisID(KeyboardLayout::NumpadStarPath)),
+		std::pair<WORD, AxisID>(0x004A, MakeAxisID(KeyboardLayout::NumpadDashPath)),
+		std::pair<WORD, AxisID>(0x004E, MakeAxisID(KeyboardLayout::NumpadPlusPath)),
+		std::pair<WORD, AxisID>(0xE01C, MakeAxisID(KeyboardLayout::NumpadEnterPath)),
+		std::pair<WORD, AxisID>(0x004F, MakeAxisID(KeyboardLayout::Numpad1Path)),
+		std::pair<WORD, AxisID>(0x0050, MakeAxisID(KeyboardLayout::Numpad2Path)),
+		std::pair<WORD, AxisID>(0x0051, MakeAxisID(KeyboardLayout::Numpad3Path)),
+		std::pair<WORD, AxisID>(0x004B, MakeAxisID(KeyboardLayout::Numpad4Path)),
+		std::pair<WORD, AxisID>(0x004C, MakeAxisID(KeyboardLayout::Numpad5Path)),
+		std::pair<WORD, AxisID>(0x004D, MakeAxisID(KeyboardLayout::Numpad6Path)),
+		std::pair<WORD, AxisID>(0x0047, MakeAxisID(KeyboardLayout::Numpad7Path)),
+		std::pair<WORD, AxisID>(0x0048, MakeAxisID(KeyboardLayout::Numpad8Path)),
+		std::pair<WORD, AxisID>(0x0049, MakeAxisID(KeyboardLayout::Numpad9Path)),
+		std::pair<WORD, AxisID>(0x0052, MakeAxisID(KeyboardLayout::Numpad0Path)),
+		std::pair<WORD, AxisID>(0x0053, MakeAxisID(KeyboardLayout::NumpadPeriodPath)),
+		std::pair<WORD, AxisID>(0x0059, MakeAxisID(KeyboardLayout::NumpadEqualsPath)),
+		std::pair<WORD, AxisID>(0x007E, MakeAxisID(KeyboardLayout::NumpadCommaPath)),
+
+		std::pair<WORD, AxisID>(0xE05D, MakeAxisID(KeyboardLayout::SystemMenuPath)),
+		std::pair<WORD, AxisID>(0xE05B, MakeAxisID(KeyboardLayout::SystemLeftGuidePath)),
+		std::pair<WORD, AxisID>(0xE05C, MakeAxisID(KeyboardLayout::SystemRightGuidePath)),
+		std::pair<WORD, AxisID>(0xE037, MakeAxisID(KeyboardLayout::SystemPrintScreenPath)),
+		std::pair<WORD, AxisID>(0x0054, MakeAxisID(KeyboardLayout::SystemRequestPath)),
+		std::pair<WORD, AxisID>(0xE11D, MakeAxisID(KeyboardLayout::SystemPausePath)),
+		std::pair<WORD, AxisID>(0xE046, MakeAxisID(KeyboardLayout::SystemBreakPath))
+	});
+
 	KeyboardAxisMap::KeyboardAxisMap(IRawInputContext& input) :
 		input{&input}
 	{
-		Bind(0x001E, KeyboardLayout::MainAPath);
-		Bind(0x0030, KeyboardLayout::MainBPath);
-		Bind(0x002E, KeyboardLayout::MainCPath);
-		Bind(0x0020, KeyboardLayout::MainDPath);
-		Bind(0x0012, KeyboardLayout::MainEPath);
-		Bind(0x0021, KeyboardLayout::MainFPath);
-		Bind(0x0022, KeyboardLayout::MainGPath);
-		Bind(0x0023, KeyboardLayout::MainHPath);
-		Bind(0x0017, KeyboardLayout::MainIPath);
-		Bind(0x0024, KeyboardLayout::MainJPath);
-		Bind(0x0025, KeyboardLayout::MainKPath);
-		Bind(0x0026, KeyboardLayout::MainLPath);
-		Bind(0x0032, KeyboardLayout::MainMPath);
-		Bind(0x0031, KeyboardLayout::MainNPath);
-		Bind(0x0018, KeyboardLayout::MainOPath);
-		Bind(0x0019, KeyboardLayout::MainPPath);
-		Bind(0x0010, KeyboardLayout::MainQPath);
-		Bind(0x0013, KeyboardLayout::MainRPath);
-		Bind(0x001F, KeyboardLayout::MainSPath);
-		Bind(0x0014, KeyboardLayout::MainTPath);
-		Bind(0x0016, KeyboardLayout::MainUPath);
-		Bind(0x002F, KeyboardLayout::MainVPath);
-		Bind(0x0011, KeyboardLayout::MainWPath);
-		Bind(0x002D, KeyboardLayout::MainXPath);
-		Bind(0x0015, KeyboardLayout::MainYPath);
-		Bind(0x002C, KeyboardLayout::MainZPath);
-
-		Bind(0x0002, KeyboardLayout::Main1Path);
-		Bind(0x0003, KeyboardLayout::Main2Path);
-		Bind(0x0004, KeyboardLayout::Main3Path);
-		Bind(0x0005, KeyboardLayout::Main4Path);
-		Bind(0x0006, KeyboardLayout::Main5Path);
-		Bind(0x0007, KeyboardLayout::Main6Path);
-		Bind(0x0008, KeyboardLayout::Main7Path);
-		Bind(0x0009, KeyboardLayout::Main8Path);
-		Bind(0x000A, KeyboardLayout::Main9Path);
-		Bind(0x000B, KeyboardLayout::Main0Path);
-
-		Bind(0x001C, KeyboardLayout::MainEnterPath);
-		Bind(0x0001, KeyboardLayout::MainEscapePath);
-		Bind(0x000E, KeyboardLayout::MainBackspacePath);
-		Bind(0x000F, KeyboardLayout::MainTabPath);
-		Bind(0x0039, KeyboardLayout::MainSpacePath);
-
-		Bind(0x000C, KeyboardLayout::MainDashPath);
-		Bind(0x000D, KeyboardLayout::MainEqualsPath);
-		Bind(0x001A, KeyboardLayout::MainLeftBracePath);
-		Bind(0x001B, KeyboardLayout::MainRightBracePath);
-		Bind(0x002B, KeyboardLayout::MainBackslashPath);
-		Bind(0x0027, KeyboardLayout::MainColonPath);
-		Bind(0x0028, KeyboardLayout::MainApostrophePath);
-		Bind(0x0029, KeyboardLayout::MainTildePath);
-		Bind(0x0033, KeyboardLayout::MainCommaPath);
-		Bind(0x0034, KeyboardLayout::MainPeriodPath);
-		Bind(0x0035, KeyboardLayout::MainSlashPath);
-		Bind(0x0056, KeyboardLayout::MainPipePath);
-
-		Bind(0x003B, KeyboardLayout::MainF1Path);
-		Bind(0x003C, KeyboardLayout::MainF2Path);
-		Bind(0x003D, KeyboardLayout::MainF3Path);
-		Bind(0x003E, KeyboardLayout::MainF4Path);
-		Bind(0x003F, KeyboardLayout::MainF5Path);
-		Bind(0x0040, KeyboardLayout::MainF6Path);
-		Bind(0x0041, KeyboardLayout::MainF7Path);
-		Bind(0x0042, KeyboardLayout::MainF8Path);
-		Bind(0x0043, KeyboardLayout::MainF9Path);
-		Bind(0x0044, KeyboardLayout::MainF10Path);
-		Bind(0x0057, KeyboardLayout::MainF11Path);
-		Bind(0x0058, KeyboardLayout::MainF12Path);
-		Bind(0x0064, KeyboardLayout::MainF13Path);
-		Bind(0x0065, KeyboardLayout::MainF14Path);
-		Bind(0x0066, KeyboardLayout::MainF15Path);
-		Bind(0x0067, KeyboardLayout::MainF16Path);
-		Bind(0x0068, KeyboardLayout::MainF17Path);
-		Bind(0x0069, KeyboardLayout::MainF18Path);
-		Bind(0x006A, KeyboardLayout::MainF19Path);
-		Bind(0x006B, KeyboardLayout::MainF20Path);
-		Bind(0x006C, KeyboardLayout::MainF21Path);
-		Bind(0x006D, KeyboardLayout::MainF22Path);
-		Bind(0x006E, KeyboardLayout::MainF23Path);
-		Bind(0x0076, KeyboardLayout::MainF24Path);
-
-		Bind(0xE052, KeyboardLayout::MainInsertPath);
-		Bind(0xE053, KeyboardLayout::MainDeletePath);
-		Bind(0xE047, KeyboardLayout::MainHomePath);
-		Bind(0xE04F, KeyboardLayout::MainEndPath);
-		Bind(0xE049, KeyboardLayout::MainPageUpPath);
-		Bind(0xE051, KeyboardLayout::MainPageDownPath);
-
-		Bind(0x001D, KeyboardLayout::MainLeftCtrlPath);
-		Bind(0xE01D, KeyboardLayout::MainRightCtrlPath);
-		Bind(0x0038, KeyboardLayout::MainLeftAltPath);
-		Bind(0xE038, KeyboardLayout::MainRightAltPath);
-		Bind(0x002A, KeyboardLayout::MainLeftShiftPath);
-		Bind(0x0036, KeyboardLayout::MainRightShiftPath);
-
-		Bind(0x003A, KeyboardLayout::LockCapsPath);
-		Bind(0x0046, KeyboardLayout::LockScrollPath);
-		Bind(0x0045, KeyboardLayout::LockNumPath);
-
-		Bind(0xE04B, KeyboardLayout::ArrowLeftPath);
-		Bind(0xE04D, KeyboardLayout::ArrowRightPath);
-		Bind(0xE050, KeyboardLayout::ArrowDownPath);
-		Bind(0xE048, KeyboardLayout::ArrowUpPath);
-
-		Bind(0xE035, KeyboardLayout::NumpadSlashPath);
-		Bind(0x0037, KeyboardLayout::NumpadStarPath);
-		Bind(0x004A, KeyboardLayout::NumpadDashPath);
-		Bind(0x004E, KeyboardLayout::NumpadPlusPath);
-		Bind(0xE01C, KeyboardLayout::NumpadEnterPath);
-		Bind(0x004F, KeyboardLayout::Numpad1Path);
-		Bind(0x0050, KeyboardLayout::Numpad2Path);
-		Bind(0x0051, KeyboardLayout::Numpad3Path);
-		Bind(0x004B, KeyboardLayout::Numpad4Path);
-		Bind(0x004C, KeyboardLayout::Numpad5Path);
-		Bind(0x004D, KeyboardLayout::Numpad6Path);
-		Bind(0x0047, KeyboardLayout::Numpad7Path);
-		Bind(0x0048, KeyboardLayout::Numpad8Path);
-		Bind(0x0049, KeyboardLayout::Numpad9Path);
-		Bind(0x0052, KeyboardLayout::Numpad0Path);
-		Bind(0x0053, KeyboardLayout::NumpadPeriodPath);
-		Bind(0x0059, KeyboardLayout::NumpadEqualsPath);
-		Bind(0x007E, KeyboardLayout::NumpadCommaPath);
-
-		Bind(0xE05D, KeyboardLayout::SystemMenuPath);
-		Bind(0xE05B, KeyboardLayout::SystemLeftGuidePath);
-		Bind(0xE05C, KeyboardLayout::SystemRightGuidePath);
-		Bind(0xE037, KeyboardLayout::SystemPrintScreenPath);
-		Bind(0x0054, KeyboardLayout::SystemRequestPath);
-		Bind(0xE11D, KeyboardLayout::SystemPausePath);
-		Bind(0xE046, KeyboardLayout::SystemBreakPath);
+		axisMap.reserve(PresetAxes.size());
+		for (const auto& [scanCode, axis] : PresetAxes)
+		{
+#ifndef NDEBUG
+			if (!input.IsValid(axis)) [[unlikely]]
+			{
+				throw std::logic_error("Keyboard axis isn't registered");
+			}
+#endif
+			axisMap.emplace(scanCode, axis);
+		}
 	}
 
 	WORD KeyboardAxisMap::ScanCode(const RAWKEYBOARD& key) noexcept
@@ -220,7 +220,7 @@ namespace PonyEngine::RawInput::Keyboard::Windows
 			const std::size_t index = keyboardContainer.IndexOf(name);
 			if (index < keyboardContainer.Size())
 			{
-				keyboardContainer.NativeHandle(index) = device;
+				keyboardContainer.NativeHandle(index, device);
 				addConnectionEvent(index);
 			}
 		}
@@ -230,7 +230,7 @@ namespace PonyEngine::RawInput::Keyboard::Windows
 			if (index < keyboardContainer.Size())
 			{
 				ResetInput(index, surface->LastMessageTime(), surface->LastMessageCursorPosition());
-				keyboardContainer.NativeHandle(index) = INVALID_HANDLE_VALUE;
+				keyboardContainer.NativeHandle(index, INVALID_HANDLE_VALUE);
 				addConnectionEvent(index);
 			}
 		}
@@ -320,9 +320,10 @@ namespace PonyEngine::RawInput::Keyboard::Windows
 		PONY_LOG(input->Logger(), Log::LogType::Info, "Creating new keyboard device... Native handle: '0x{:X}'.", reinterpret_cast<std::uintptr_t>(keyboardHandle));
 		const std::string_view name = GetKeyboardName(keyboardHandle);
 		const DeviceHandle deviceHandle = input->RegisterDevice(deviceType, name, true);
+		std::size_t index;
 		try
 		{
-			keyboardContainer.Add(keyboardHandle, deviceHandle, name, true);
+			index = keyboardContainer.Add(keyboardHandle, deviceHandle, name, true);
 		}
 		catch (...)
 		{
@@ -332,7 +333,7 @@ namespace PonyEngine::RawInput::Keyboard::Windows
 		PONY_LOG(input->Logger(), Log::LogType::Info, "Creating new keyboard device done. Native handle: '0x{:X}'; Device handle: '0x{:X}'; Device name: '{}'.", 
 			reinterpret_cast<std::uintptr_t>(keyboardHandle), deviceHandle.id, name);
 
-		return keyboardContainer.Size() - 1uz;
+		return index;
 	}
 
 	std::string_view KeyboardProvider::GetKeyboardName(const HANDLE keyboardHandle) const
@@ -87,19 +87,16 @@ export namespace PonyEngine::RawInput::XInput::Windows
 		/// @param index Button index.
 		/// @param nativeAxis Button native axis.
 		/// @param axis Button axis.
-		/// @param input Raw input context.
-		void Bind(std::size_t index, WORD nativeAxis, std::string_view axis, IRawInputContext& input);
+		void Bind(std::size_t index, WORD nativeAxis, AxisID axis) noexcept;
 		/// @brief Binds a trigger.
 		/// @param trigger Trigger axis type.
 		/// @param axis Trigger axis.
-		/// @param input Raw input context.
-		void Bind(TriggerAxis trigger, std::string_view axis, IRawInputContext& input);
+		void Bind(TriggerAxis trigger, AxisID axis) noexcept;
 		/// @brief Binds a stick.
 		/// @param placement Stick placement.
 		/// @param direction Stick direction.
 		/// @param axis Stick axis.
-		/// @param input Raw input context.
-		void Bind(StickPlacement placement, StickDirection direction, std::string_view axis, IRawInputContext& input);
+		void Bind(StickPlacement placement, StickDirection direction, AxisID axis) noexcept;
 
 		std::array<WORD, ButtonCount> nativeAxes; ///< Native button axes.
 		std::array<AxisID, ButtonCount> buttonAxes; ///< Button axes.
@@ -110,37 +107,52 @@ export namespace PonyEngine::RawInput::XInput::Windows
 
 namespace PonyEngine::RawInput::XInput::Windows
 {
-	GamepadAxisMap::GamepadAxisMap(IRawInputContext& input)
+	GamepadAxisMap::GamepadAxisMap([[maybe_unused]] IRawInputContext& input)
 	{
-		constexpr auto buttonMap = std::array<std::pair<WORD, std::string_view>, ButtonCount>
+		// The gamepad axes are presets, so their IDs are known at compile time.
+		constexpr auto buttonMap = std::array<std::pair<WORD, AxisID>, ButtonCount>
 		{
-			std::pair<WORD, std::string_view>(XINPUT_GAMEPAD_DPAD_UP, GamepadLayout::DPadUpPath),
-			std::pair<WORD, std::string_view>(XINPUT_GAMEPAD_DPAD_DOWN, GamepadLayout::DPadDownPath),
-			std::pair<WORD, std::string_view>(XINPUT_GAMEPAD_DPAD_LEFT, GamepadLayout::DPadLeftPath),
-			std::pair<WORD, std::string_view>(XINPUT_GAMEPAD_DPAD_RIGHT, GamepadLayout::DPadRightPath),
-			std::pair<WORD, std::string_view>(XINPUT_GAMEPAD_START, GamepadLayout::SystemMenuPath),
-			std::pair<WORD, std::string_view>(XINPUT_GAMEPAD_BACK, GamepadLayout::SystemSelectPath),
-			std::pair<WORD, std::string_view>(XINPUT_GAMEPAD_LEFT_THUMB, GamepadLayout::LeftStickButtonPath),
-			std::pair<WORD, std::string_view>(XINPUT_GAMEPAD_RIGHT_THUMB, GamepadLayout::RightStickButtonPath),
-			std::pair<WORD, std::string_view>(XINPUT_GAMEPAD_LEFT_SHOULDER, GamepadLayout::BackButtonLeftPath),
-			std::pair<WORD, std::string_view>(XINPUT_GAMEPAD_RIGHT_SHOULDER, GamepadLayout::BackButtonRightPath),
-			std::pair<WORD, std::string_view>(XINPUT_GAMEPAD_A, GamepadLayout::FaceButtonDownPath),
-			std::pair<WORD, std::string_view>(XINPUT_GAMEPAD_B, GamepadLayout::FaceButtonRightPath),
-			std::pair<WORD, std::string_view>(XINPUT_GAMEPAD_X, GamepadLayout::FaceButtonLeftPath),
-			std::pair<WORD, std::string_view>(XINPUT_GAMEPAD_Y, GamepadLayout::FaceButtonUpPath)
+			std::pair<WORD, AxisID>(XINPUT_GAMEPAD_DPAD_UP, MakeAxisID(GamepadLayout::DPadUpPath)),
+			std::pair<WORD, AxisID>(XINPUT_GAMEPAD_DPAD_DOWN, MakeAxisID(GamepadLayout::DPadDownPath)),
+			std::pair<WORD, AxisID>(XINPUT_GAMEPAD_DPAD_LEFT, MakeAxisID(GamepadLayout::DPadLeftPath)),
+			std::pair<WORD, AxisID>(XINPUT_GAMEPAD_DPAD_RIGHT, MakeAxisID(GamepadLayout::DPadRightPath)),
+			std::pair<WORD, AxisID>(XINPUT_GAMEPAD_START, MakeAxisID(GamepadLayout::SystemMenuPath)),
+			std::pair<WORD, AxisID>(XINPUT_GAMEPAD_BACK, MakeAxisID(GamepadLayout::SystemSelectPath)),
+			std::pair<WORD, AxisID>(XINPUT_GAMEPAD_LEFT_THUMB, MakeAxisID(GamepadLayout::LeftStickButtonPath)),
+			std::pair<WORD, AxisID>(XINPUT_GAMEPAD_RIGHT_THUMB, MakeAxisID(GamepadLayout::RightStickButtonPath)),
+			std::pair<WORD, AxisID>(XINPUT_GAMEPAD_LEFT_SHOULDER, MakeAxisID(GamepadLayout::BackButtonLeftPath)),
+			std::pair<WORD, AxisID>(XINPUT_GAMEPAD_RIGHT_SHOULDER, MakeAxisID(GamepadLayout::BackButtonRightPath)),
+			std::pair<WORD, AxisID>(XINPUT_GAMEPAD_A, MakeAxisID(GamepadLayout::FaceButtonDownPath)),
+			std::pair<WORD, AxisID>(XINPUT_GAMEPAD_B, MakeAxisID(GamepadLayout::FaceButtonRightPath)),
+			std::pair<WORD, AxisID>(XINPUT_GAMEPAD_X, MakeAxisID(GamepadLayout::FaceButtonLeftPath)),
+			std::pair<WORD, AxisID>(XINPUT_GAMEPAD_Y, MakeAxisID(GamepadLayout::FaceButtonUpPath))
 		};
 		for (std::size_t i = 0; i < ButtonCount; ++i)
 		{
-			Bind(i, buttonMap[i].first, buttonMap[i].second, input);
+			Bind(i, buttonMap[i].first, buttonMap[i].second);
 		}
 
-		Bind(TriggerAxis::Left, GamepadLayout::TriggerLeftPath, input);
-		Bind(TriggerAxis::Right, GamepadLayout::TriggerRightPath, input);
+		Bind(TriggerAxis::Left, MakeAxisID(GamepadLayout::TriggerLeftPath));
+		Bind(TriggerAxis::Right, MakeAxisID(GamepadLayout::TriggerRightPath));
 
-		Bind(StickPlacement::Left, StickDirection::Horizontal, GamepadLayout::LeftStickHorizontalPath, input);
-		Bind(StickPlacement::Left, StickDirection::Vertical, GamepadLayout::LeftStickVerticalPath, input);
-		Bind(StickPlacement::Right, StickDirection::Horizontal, GamepadLayout::RightStickHorizontalPath, input);
-		Bind(StickPlacement::Right, StickDirection::Vertical, GamepadLayout::RightStickVerticalPath, input);
+		Bind(StickPlacement::Left, StickDirection::Horizontal, MakeAxisID(GamepadLayout::LeftStickHorizontalPath));
+		Bind(StickPlacement::Left, StickDirection::Vertical, MakeAxisID(GamepadLayout::LeftStickVerticalPath));
+		Bind(StickPlacement::Right, StickDirection::Horizontal, MakeAxisID(GamepadLayout::RightStickHorizontalPath));
+		Bind(StickPlacement::Right, StickDirection::Vertical, MakeAxisID(GamepadLayout::RightStickVerticalPath));
+
+#ifndef NDEBUG
+		for (const std::span<const AxisID> axes : {std::span<const AxisID>(buttonAxes), std::span<const AxisID>(triggerAxes),
+			std::span<const AxisID>(stickAxes[0]), std::span<const AxisID>(stickAxes[1])})
+		{
+			for (const AxisID axis : axes)
+			{
+				if (!input.IsValid(axis)) [[unlikely]]
+				{
+					throw std::logic_error("Gamepad axis isn't registered");
+				}
+			}
+		}
+#endif
 	}
 
 	AxisID GamepadAxisMap::Button(const WORD button) const noexcept
@@ -166,19 +178,19 @@ namespace PonyEngine::RawInput::XInput::Windows
 		return stickAxes[static_cast<std::size_t>(placement)];
 	}
 
-	void GamepadAxisMap::Bind(const std::size_t index, const WORD nativeAxis, const std::string_view axis, IRawInputContext& input)
+	void GamepadAxisMap::Bind(const std::size_t index, const WORD nativeAxis, const AxisID axis) noexcept
 	{
 		nativeAxes[index] = nativeAxis;
-		buttonAxes[index] = input.Hash(Axis(axis));
+		buttonAxes[index] = axis;
 	}
 
-	void GamepadAxisMap::Bind(const TriggerAxis trigger, const std::string_view axis, IRawInputContext& input)
+	void GamepadAxisMap::Bind(const TriggerAxis trigger, const AxisID axis) noexcept
 	{
-		triggerAxes[static_cast<std::size_t>(trigger)] = input.Hash(Axis(axis));
+		triggerAxes[static_cast<std::size_t>(trigger)] = axis;
 	}
 
-	void GamepadAxisMap::Bind(const StickPlacement placement, const StickDirection direction, const std::string_view axis, IRawInputContext& input)
+	void GamepadAxisMap::Bind(const StickPlacement placement, const StickDirection direction, const AxisID axis) noexcept
 	{
-		stickAxes[static_cast<std::size_t>(placement)][static_cast<std::size_t>(direction)] = input.Hash(Axis(axis));
+		stickAxes[static_cast<std::size_t>(placement)][static_cast<std::size_t>(direction)] = axis;
 	}
 }
@@ -184,16 +184,16 @@ namespace PonyEngine::RawInput::XInput::Windows
 
 						continue;
 					}
-					else
+					else if (stateResult != ERROR_DEVICE_NOT_CONNECTED)
 					{
-						PONY_LOG_IF(stateResult != ERROR_DEVICE_NOT_CONNECTED, input->Logger(), Log::LogType::Error,
+						PONY_LOG_RATE_LIMITED(input->Logger(), std::chrono::seconds(1), Log::LogType::Error,
 							"Failed to get XInput gamepad state. Error code: '0x{:X}'.", stateResult);
 					}
 				}
 			}
-			else
+			else if (capsResult != ERROR_DEVICE_NOT_CONNECTED)
 			{
-				PONY_LOG_IF(capsResult != ERROR_DEVICE_NOT_CONNECTED, input->Logger(), Log::LogType::Error,
+				PONY_LOG_RATE_LIMITED(input->Logger(), std::chrono::seconds(1), Log::LogType::Error,
 					"Failed to get XInput device capabilities. Error code: '0x{:X}'.", capsResult);
 			}
 
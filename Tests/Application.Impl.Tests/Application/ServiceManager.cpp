@@ -0,0 +1,125 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+import std;
+
+import PonyEngine.Application.Impl;
+import PonyEngine.Testing;
+
+namespace
+{
+	/// @brief Service that records its ticks.
+	class TickService final : public PonyEngine::Application::IService, private PonyEngine::Application::ITickableService
+	{
+	public:
+		[[nodiscard("Pure constructor")]]
+		TickService(std::vector<int>& ticks, const int tickOrder) noexcept :
+			ticks{&ticks},
+			tickOrder{tickOrder}
+		{
+		}
+
+		virtual void Begin() override
+		{
+		}
+
+		virtual void End() override
+		{
+		}
+
+		virtual void AddTickableServices(PonyEngine::Application::ITickableServiceAdder& adder) override
+		{
+			adder.Add(*this, tickOrder);
+		}
+
+	private:
+		virtual void Tick() override
+		{
+			ticks->push_back(tickOrder);
+		}
+
+		std::vector<int>* ticks;
+		int tickOrder;
+	};
+
+	/// @brief Service manager with tick services.
+	class ServiceFixture final
+	{
+	public:
+		explicit ServiceFixture(const std::initializer_list<int> tickOrders) :
+			serviceManager(application)
+		{
+			for (const int tickOrder : tickOrders)
+			{
+				services.push_back(serviceManager.AddService([&](PonyEngine::Application::IApplicationContext&)
+				{
+					return std::make_shared<TickService>(ticks, tickOrder);
+				}));
+			}
+			application.FlowState(PonyEngine::Application::FlowState::Beginning);
+			serviceManager.Begin();
+			application.FlowState(PonyEngine::Application::FlowState::Running);
+		}
+
+		~ServiceFixture() noexcept
+		{
+			application.FlowState(PonyEngine::Application::FlowState::Ending);
+			serviceManager.End();
+			application.FlowState(PonyEngine::Application::FlowState::ShuttingDown);
+			for (const PonyEngine::Application::ServiceHandle service : services)
+			{
+				serviceManager.RemoveService(service);
+			}
+		}
+
+		void Tick()
+		{
+			serviceManager.Tick();
+		}
+
+		[[nodiscard("Pure function")]]
+		std::vector<int>& Ticks() noexcept
+		{
+			return ticks;
+		}
+
+	private:
+		PonyEngine::Testing::MockApplicationContext application;
+		PonyEngine::Application::ServiceManager serviceManager;
+		std::vector<PonyEngine::Application::ServiceHandle> services;
+		std::vector<int> ticks;
+	};
+}
+
+TEST_CASE("ServiceManager: tick order", "[Application][ServiceManager]")
+{
+	auto fixture = ServiceFixture({3, -1, 0, 2});
+	fixture.Tick();
+	REQUIRE(fixture.Ticks() == std::vector{-1, 0, 2, 3});
+
+	fixture.Tick();
+	REQUIRE(fixture.Ticks() == std::vector{-1, 0, 2, 3, -1, 0, 2, 3});
+}
+
+TEST_CASE("ServiceManager: no allocations on tick", "[Application][ServiceManager]")
+{
+	auto fixture = ServiceFixture({3, -1, 0, 2});
+	fixture.Ticks().reserve(4uz * 100uz);
+
+	PonyEngine::Testing::RequireNoAllocations([&]
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			fixture.Tick();
+		}
+	});
+	REQUIRE(fixture.Ticks().size() == 4uz * 100uz);
+}
@@ -0,0 +1,145 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+import std;
+
+import PonyEngine.Hash;
+
+namespace
+{
+	std::vector<std::byte> MakeData(const std::size_t size)
+	{
+		auto data = std::vector<std::byte>(size);
+		for (std::size_t i = 0uz; i < size; ++i)
+		{
+			data[i] = static_cast<std::byte>(i * 31uz + 7uz);
+		}
+
+		return data;
+	}
+
+	constexpr std::uint64_t ConstexprHash(const std::size_t size, const std::uint64_t seed)
+	{
+		auto data = std::array<char, 200>{};
+		for (std::size_t i = 0uz; i < size; ++i)
+		{
+			data[i] = static_cast<char>(i * 31uz + 7uz);
+		}
+
+		return PonyEngine::Hash::WyHash64(std::span<const char>(data.data(), size), seed);
+	}
+}
+
+TEST_CASE("WyHash64: reference vectors", "[Hash][WyHash]")
+{
+	// Test vectors of the reference wyhash final version 4.
+	STATIC_REQUIRE(PonyEngine::Hash::WyHash64("", 0ull) == 0x93228a4de0eec5a2ull);
+	STATIC_REQUIRE(PonyEngine::Hash::WyHash64("a", 1ull) == 0xc5bac3db178713c4ull);
+	STATIC_REQUIRE(PonyEngine::Hash::WyHash64("abc", 2ull) == 0xa97f2f7b1d9b3314ull);
+	STATIC_REQUIRE(PonyEngine::Hash::WyHash64("message digest", 3ull) == 0x786d1f1df3801df4ull);
+	STATIC_REQUIRE(PonyEngine::Hash::WyHash64("abcdefghijklmnopqrstuvwxyz", 4ull) == 0xdca5a8138ad37c87ull);
+	STATIC_REQUIRE(PonyEngine::Hash::WyHash64("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 5ull) == 0xb9e734f117cfaf70ull);
+	STATIC_REQUIRE(PonyEngine::Hash::WyHash64("12345678901234567890123456789012345678901234567890123456789012345678901234567890", 6ull) == 0x6cc5eab49a92d617ull);
+
+	REQUIRE(PonyEngine::Hash::WyHash64("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 5ull) == 0xb9e734f117cfaf70ull);
+	REQUIRE(PonyEngine::Hash::WyHash64("12345678901234567890123456789012345678901234567890123456789012345678901234567890", 6ull) == 0x6cc5eab49a92d617ull);
+}
+
+TEST_CASE("WyHash64: constexpr", "[Hash][WyHash]")
+{
+	STATIC_REQUIRE(PonyEngine::Hash::WyHash64("") != PonyEngine::Hash::WyHash64("", 1ull));
+	STATIC_REQUIRE(PonyEngine::Hash::WyHash64("hello") == PonyEngine::Hash::WyHash64(std::span(std::string_view("hello"))));
+	STATIC_REQUIRE(PonyEngine::Hash::WyHash64("Hello, world!") != PonyEngine::Hash::WyHash64("Hello, world?"));
+
+	constexpr auto hashes = []()
+	{
+		auto result = std::array<std::uint64_t, 200>{};
+		for (std::size_t i = 0uz; i < result.size(); ++i)
+		{
+			result[i] = ConstexprHash(i, 42ull);
+		}
+
+		return result;
+	}();
+	for (std::size_t i = 0uz; i < hashes.size(); ++i)
+	{
+		const std::vector<std::byte> data = MakeData(i);
+		REQUIRE(PonyEngine::Hash::WyHash64(std::span<const std::byte>(data), 42ull) == hashes[i]);
+	}
+}
+
+TEST_CASE("WyHash64: seed", "[Hash][WyHash]")
+{
+	const std::vector<std::byte> data = MakeData(100uz);
+	const std::uint64_t hash = PonyEngine::Hash::WyHash64(std::span<const std::byte>(data));
+	REQUIRE(hash == PonyEngine::Hash::WyHash64(std::span<const std::byte>(data), 0ull));
+	REQUIRE(hash != PonyEngine::Hash::WyHash64(std::span<const std::byte>(data), 1ull));
+	REQUIRE(PonyEngine::Hash::WyHash64(std::span<const std::byte>(data), 1ull) != PonyEngine::Hash::WyHash64(std::span<const std::byte>(data), 2ull));
+}
+
+TEST_CASE("WyHash64: incremental", "[Hash][WyHash]")
+{
+	for (const std::size_t size : {0uz, 1uz, 3uz, 4uz, 15uz, 16uz, 17uz, 47uz, 48uz, 49uz, 95uz, 96uz, 97uz, 150uz})
+	{
+		const std::vector<std::byte> data = MakeData(size);
+		const std::uint64_t expected = PonyEngine::Hash::WyHash64(std::span<const std::byte>(data), 7ull);
+		for (std::size_t split = 0uz; split <= size; ++split)
+		{
+			auto hash = PonyEngine::Hash::WyHash64Hash(7ull);
+			hash.Hash(std::span<const std::byte>(data).first(split));
+			REQUIRE(hash.Hash(std::span<const std::byte>(data).subspan(split)) == expected);
+		}
+
+		auto hash = PonyEngine::Hash::WyHash64Hash(7ull);
+		for (const std::byte value : data)
+		{
+			hash.Hash(std::span<const std::byte>(&value, 1uz));
+		}
+		REQUIRE(hash.Hash() == expected);
+	}
+
+	auto hash = PonyEngine::Hash::WyHash64Hash();
+	hash.Hash("Hello, ");
+	hash.Hash(std::span(std::string_view("world!")));
+	REQUIRE(hash.Hash() == PonyEngine::Hash::WyHash64("Hello, world!"));
+}
+
+TEST_CASE("WyHash64: collisions", "[Hash][WyHash]")
+{
+	auto hashes = std::unordered_set<std::uint64_t>();
+	for (int i = 0; i < 100000; ++i)
+	{
+		REQUIRE(hashes.insert(PonyEngine::Hash::WyHash64(std::format("Asset/Directory/Name{}.extension", i))).second);
+	}
+}
+
+TEST_CASE("WyHash64: performance", "[Hash][WyHash]")
+{
+	[[maybe_unused]] const std::vector<std::byte> large = MakeData(1024uz * 1024uz);
+
+#if PONY_ENGINE_TESTING_BENCHMARK
+	BENCHMARK("Short")
+	{
+		return PonyEngine::Hash::WyHash64("Kinda_typical_length_of_an_asset_directory/on_some_machines/Kinda_typical_length_of_an_asset_name.extension");
+	};
+
+	BENCHMARK("1 MiB")
+	{
+		return PonyEngine::Hash::WyHash64(std::span<const std::byte>(large));
+	};
+
+	BENCHMARK("1 MiB FNV1a64")
+	{
+		return PonyEngine::Hash::FNV1a64(std::span<const std::byte>(large));
+	};
+#endif
+}
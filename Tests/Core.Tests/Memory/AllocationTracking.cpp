@@ -0,0 +1,145 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+import std;
+
+import PonyEngine.Memory;
+
+TEST_CASE("AllocationTracking: register tag", "[Memory][AllocationTracking]")
+{
+	REQUIRE(PonyEngine::Memory::AllocationTagCount() >= 1uz);
+	REQUIRE(PonyEngine::Memory::AllocationTagName(PonyEngine::Memory::GeneralAllocationTag) == "General");
+
+	const PonyEngine::Memory::AllocationTag tag = PonyEngine::Memory::RegisterAllocationTag("Test.Register");
+	REQUIRE(tag != PonyEngine::Memory::GeneralAllocationTag);
+	REQUIRE(tag.id < PonyEngine::Memory::AllocationTagCount());
+	REQUIRE(PonyEngine::Memory::AllocationTagName(tag) == "Test.Register");
+	REQUIRE(PonyEngine::Memory::RegisterAllocationTag("Test.Register") == tag);
+	REQUIRE(PonyEngine::Memory::RegisterAllocationTag("General") == PonyEngine::Memory::GeneralAllocationTag);
+}
+
+TEST_CASE("AllocationTracking: scope", "[Memory][AllocationTracking]")
+{
+	const PonyEngine::Memory::AllocationTag outerTag = PonyEngine::Memory::RegisterAllocationTag("Test.Outer");
+	const PonyEngine::Memory::AllocationTag innerTag = PonyEngine::Memory::RegisterAllocationTag("Test.Inner");
+	REQUIRE(PonyEngine::Memory::CurrentAllocationTag() == PonyEngine::Memory::GeneralAllocationTag);
+	{
+		const auto outerScope = PonyEngine::Memory::AllocationTagScope(outerTag);
+		REQUIRE(PonyEngine::Memory::CurrentAllocationTag() == outerTag);
+		{
+			const auto innerScope = PonyEngine::Memory::AllocationTagScope(innerTag);
+			REQUIRE(PonyEngine::Memory::CurrentAllocationTag() == innerTag);
+			REQUIRE(PonyEngine::Memory::Arena(16uz).Tag() == innerTag);
+		}
+		REQUIRE(PonyEngine::Memory::CurrentAllocationTag() == outerTag);
+		std::thread([&] { REQUIRE(PonyEngine::Memory::CurrentAllocationTag() == PonyEngine::Memory::GeneralAllocationTag); }).join();
+	}
+	REQUIRE(PonyEngine::Memory::CurrentAllocationTag() == PonyEngine::Memory::GeneralAllocationTag);
+	REQUIRE(PonyEngine::Memory::Arena(16uz, 0uz, outerTag).Tag() == outerTag);
+}
+
+TEST_CASE("AllocationTracking: track", "[Memory][AllocationTracking]")
+{
+	const PonyEngine::Memory::AllocationTag tag = PonyEngine::Memory::RegisterAllocationTag("Test.Track");
+	const bool wasEnabled = PonyEngine::Memory::IsAllocationTrackingEnabled();
+
+	PonyEngine::Memory::EnableAllocationTracking(false);
+	REQUIRE(!PonyEngine::Memory::TrackAllocation(tag, 100uz));
+	REQUIRE(PonyEngine::Memory::GetAllocationStatistics(tag).allocationCount == 0ull);
+
+	PonyEngine::Memory::EnableAllocationTracking(true);
+	REQUIRE(PonyEngine::Memory::IsAllocationTrackingEnabled());
+	REQUIRE(PonyEngine::Memory::TrackAllocation(tag, 100uz));
+	REQUIRE(PonyEngine::Memory::TrackAllocation(tag, 50uz));
+	PonyEngine::Memory::AllocationStatistics statistics = PonyEngine::Memory::GetAllocationStatistics(tag);
+	REQUIRE(statistics.liveBytes == 150ll);
+	REQUIRE(statistics.peakBytes == 150ll);
+	REQUIRE(statistics.liveAllocationCount == 2ll);
+	REQUIRE(statistics.allocationCount == 2ull);
+
+	std::thread([&]
+	{
+		PonyEngine::Memory::TrackDeallocation(tag, 100uz);
+		REQUIRE(PonyEngine::Memory::TrackAllocation(tag, 10uz));
+	}).join();
+	statistics = PonyEngine::Memory::GetAllocationStatistics(tag);
+	REQUIRE(statistics.liveBytes == 60ll);
+	REQUIRE(statistics.peakBytes == 150ll);
+	REQUIRE(statistics.liveAllocationCount == 2ll);
+	REQUIRE(statistics.allocationCount == 3ull);
+
+	PonyEngine::Memory::FinishAllocationFrame();
+	REQUIRE(PonyEngine::Memory::GetAllocationStatistics(tag).frameAllocationCount == 3ull);
+	REQUIRE(PonyEngine::Memory::TrackAllocation(tag, 1uz));
+	PonyEngine::Memory::FinishAllocationFrame();
+	REQUIRE(PonyEngine::Memory::GetAllocationStatistics(tag).frameAllocationCount == 1ull);
+	PonyEngine::Memory::FinishAllocationFrame();
+	REQUIRE(PonyEngine::Memory::GetAllocationStatistics(tag).frameAllocationCount == 0ull);
+
+	PonyEngine::Memory::TrackDeallocation(tag, 50uz);
+	PonyEngine::Memory::TrackDeallocation(tag, 10uz);
+	PonyEngine::Memory::TrackDeallocation(tag, 1uz);
+	statistics = PonyEngine::Memory::GetAllocationStatistics(tag);
+	REQUIRE(statistics.liveBytes == 0ll);
+	REQUIRE(statistics.liveAllocationCount == 0ll);
+
+	PonyEngine::Memory::EnableAllocationTracking(wasEnabled);
+}
+
+TEST_CASE("AllocationTracking: threads", "[Memory][AllocationTracking]")
+{
+	const PonyEngine::Memory::AllocationTag tag = PonyEngine::Memory::RegisterAllocationTag("Test.Threads");
+	const bool wasEnabled = PonyEngine::Memory::IsAllocationTrackingEnabled();
+	PonyEngine::Memory::EnableAllocationTracking(true);
+
+	auto threads = std::vector<std::jthread>();
+	for (std::size_t i = 0uz; i < 4uz; ++i)
+	{
+		threads.emplace_back([tag]
+		{
+			for (std::size_t j = 0uz; j < 10000uz; ++j)
+			{
+				[[maybe_unused]] const bool tracked = PonyEngine::Memory::TrackAllocation(tag, 8uz);
+			}
+		});
+	}
+	threads.clear();
+
+	const PonyEngine::Memory::AllocationStatistics statistics = PonyEngine::Memory::GetAllocationStatistics(tag);
+	REQUIRE(statistics.liveBytes == 320000ll);
+	REQUIRE(statistics.allocationCount == 40000ull);
+
+	PonyEngine::Memory::EnableAllocationTracking(wasEnabled);
+}
+
+TEST_CASE("AllocationTracking: performance", "[Memory][AllocationTracking]")
+{
+#if PONY_ENGINE_TESTING_BENCHMARK
+	const PonyEngine::Memory::AllocationTag tag = PonyEngine::Memory::RegisterAllocationTag("Test.Performance");
+	const bool wasEnabled = PonyEngine::Memory::IsAllocationTrackingEnabled();
+	PonyEngine::Memory::EnableAllocationTracking(true);
+
+	BENCHMARK("Track")
+	{
+		const bool tracked = PonyEngine::Memory::TrackAllocation(tag, 64uz);
+		PonyEngine::Memory::TrackDeallocation(tag, 64uz);
+		return tracked;
+	};
+
+	BENCHMARK("Statistics")
+	{
+		return PonyEngine::Memory::GetAllocationStatistics(tag);
+	};
+
+	PonyEngine::Memory::EnableAllocationTracking(wasEnabled);
+#endif
+}
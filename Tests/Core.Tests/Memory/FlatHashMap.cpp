@@ -0,0 +1,341 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+import std;
+
+import PonyEngine.Memory;
+import PonyEngine.Testing;
+
+namespace
+{
+	struct StringHash final
+	{
+		using is_transparent = void;
+
+		[[nodiscard("Pure function")]]
+		std::size_t operator ()(const std::string_view value) const noexcept
+		{
+			return std::hash<std::string_view>()(value);
+		}
+	};
+
+	struct CollidingHash final
+	{
+		[[nodiscard("Pure function")]]
+		std::size_t operator ()(const int value) const noexcept
+		{
+			return static_cast<std::size_t>(value % 4);
+		}
+	};
+}
+
+TEST_CASE("FlatHashMap: create", "[Memory][FlatHashMap]")
+{
+	const auto map = PonyEngine::Memory::FlatHashMap<int, int>();
+	REQUIRE(map.Size() == 0uz);
+	REQUIRE(map.IsEmpty());
+	REQUIRE(map.Capacity() == 0uz);
+	REQUIRE(map.Find(0) == nullptr);
+	REQUIRE(!map.Contains(0));
+	REQUIRE(map.begin() == map.end());
+
+	const auto reserved = PonyEngine::Memory::FlatHashMap<int, int>(100uz);
+	REQUIRE(reserved.IsEmpty());
+	REQUIRE(reserved.Capacity() >= 100uz);
+	REQUIRE(std::has_single_bit(reserved.Capacity()));
+}
+
+TEST_CASE("FlatHashMap: emplace", "[Memory][FlatHashMap]")
+{
+	auto map = PonyEngine::Memory::FlatHashMap<int, std::string>();
+	const auto [zero, isZeroAdded] = map.Emplace(0, "Zero");
+	REQUIRE(isZeroAdded);
+	REQUIRE(*zero == "Zero");
+	const auto [one, isOneAdded] = map.Emplace(1, 3uz, 'O');
+	REQUIRE(isOneAdded);
+	REQUIRE(*one == "OOO");
+	REQUIRE(map.Size() == 2uz);
+
+	const auto [existing, isAdded] = map.Emplace(0, "Other");
+	REQUIRE(!isAdded);
+	REQUIRE(existing == map.Find(0));
+	REQUIRE(*existing == "Zero");
+
+	const auto [assigned, isAssignedAdded] = map.InsertOrAssign(0, "Assigned");
+	REQUIRE(!isAssignedAdded);
+	REQUIRE(*assigned == "Assigned");
+	const auto [inserted, isInserted] = map.InsertOrAssign(2, "Two");
+	REQUIRE(isInserted);
+	REQUIRE(*inserted == "Two");
+	REQUIRE(map.Size() == 3uz);
+	REQUIRE(*map.Find(0) == "Assigned");
+	REQUIRE(*map.Find(1) == "OOO");
+	REQUIRE(*map.Find(2) == "Two");
+	REQUIRE(map.Find(3) == nullptr);
+}
+
+TEST_CASE("FlatHashMap: remove", "[Memory][FlatHashMap]")
+{
+	auto map = PonyEngine::Memory::FlatHashMap<int, int>();
+	for (int i = 0; i < 100; ++i)
+	{
+		map.Emplace(i, i * 2);
+	}
+
+	for (int i = 0; i < 100; i += 2)
+	{
+		REQUIRE(map.Remove(i));
+		REQUIRE(!map.Remove(i));
+	}
+	REQUIRE(map.Size() == 50uz);
+	for (int i = 0; i < 100; ++i)
+	{
+		REQUIRE(map.Contains(i) == (i % 2 == 1));
+	}
+
+	for (auto position = map.begin(); position != map.end(); )
+	{
+		position = position->first % 3 == 0 ? map.Remove(position) : std::next(position);
+	}
+	REQUIRE(map.Size() == 33uz);
+	for (const auto& [key, value] : map)
+	{
+		REQUIRE(key % 2 == 1);
+		REQUIRE(key % 3 != 0);
+		REQUIRE(value == key * 2);
+	}
+
+	const std::size_t capacity = map.Capacity();
+	map.Clear();
+	REQUIRE(map.IsEmpty());
+	REQUIRE(map.Capacity() == capacity);
+	REQUIRE(!map.Contains(1));
+}
+
+TEST_CASE("FlatHashMap: grow", "[Memory][FlatHashMap]")
+{
+	auto map = PonyEngine::Memory::FlatHashMap<int, int>();
+	for (int i = 0; i < 10000; ++i)
+	{
+		map.Emplace(i, -i);
+		REQUIRE(map.Size() * 8uz <= map.Capacity() * 7uz);
+	}
+
+	for (int i = 0; i < 10000; ++i)
+	{
+		REQUIRE(*map.Find(i) == -i);
+	}
+	REQUIRE(map.Find(10000) == nullptr);
+}
+
+TEST_CASE("FlatHashMap: churn", "[Memory][FlatHashMap]")
+{
+	auto map = PonyEngine::Memory::FlatHashMap<int, int>();
+	map.Reserve(64uz);
+	const std::size_t capacity = map.Capacity();
+	for (int i = 0; i < 100000; ++i)
+	{
+		map.Emplace(i, i);
+		if (i >= 32)
+		{
+			REQUIRE(map.Remove(i - 32));
+		}
+	}
+	REQUIRE(map.Size() == 32uz);
+	REQUIRE(map.Capacity() == capacity);
+	for (int i = 100000 - 32; i < 100000; ++i)
+	{
+		REQUIRE(*map.Find(i) == i);
+	}
+}
+
+TEST_CASE("FlatHashMap: collisions", "[Memory][FlatHashMap]")
+{
+	auto map = PonyEngine::Memory::FlatHashMap<int, int, CollidingHash>();
+	for (int i = 0; i < 1000; ++i)
+	{
+		map.Emplace(i, i);
+	}
+	for (int i = 0; i < 1000; i += 3)
+	{
+		REQUIRE(map.Remove(i));
+	}
+	for (int i = 0; i < 1000; ++i)
+	{
+		REQUIRE((map.Find(i) != nullptr) == (i % 3 != 0));
+	}
+}
+
+TEST_CASE("FlatHashMap: heterogeneous lookup", "[Memory][FlatHashMap]")
+{
+	auto map = PonyEngine::Memory::FlatHashMap<std::string, int, StringHash, std::equal_to<>>();
+	map.Emplace("Pony", 1);
+	map.Emplace(std::string("Engine"), 2);
+	REQUIRE(*map.Find(std::string_view("Pony")) == 1);
+	REQUIRE(*map.Find("Engine") == 2);
+	REQUIRE(!map.Contains(std::string_view("Other")));
+	REQUIRE(map.Remove(std::string_view("Pony")));
+	REQUIRE(!map.Contains("Pony"));
+}
+
+TEST_CASE("FlatHashMap: rehash", "[Memory][FlatHashMap]")
+{
+	auto map = PonyEngine::Memory::FlatHashMap<int, int>();
+	for (int i = 0; i < 1000; ++i)
+	{
+		map.Emplace(i, i);
+	}
+	const int* const value = map.Find(500);
+	map.Reserve(map.Size());
+	REQUIRE(map.Find(500) == value);
+
+	for (int i = 10; i < 1000; ++i)
+	{
+		map.Remove(i);
+	}
+	map.Rehash(0uz);
+	REQUIRE(map.Capacity() == 16uz);
+	for (int i = 0; i < 10; ++i)
+	{
+		REQUIRE(*map.Find(i) == i);
+	}
+
+	map.Clear();
+	map.Rehash(0uz);
+	REQUIRE(map.Capacity() == 0uz);
+}
+
+TEST_CASE("FlatHashMap: iterate", "[Memory][FlatHashMap]")
+{
+	auto map = PonyEngine::Memory::FlatHashMap<int, int>();
+	for (int i = 0; i < 10; ++i)
+	{
+		map.Emplace(i, i);
+	}
+
+	auto order = std::vector<int>();
+	for (auto& [key, value] : map)
+	{
+		value *= 2;
+		order.push_back(key);
+	}
+	REQUIRE(order.size() == 10uz);
+	map.Emplace(10, 20);
+	map.Remove(10);
+
+	const auto& constMap = map;
+	auto constOrder = std::vector<int>();
+	for (const auto& [key, value] : constMap)
+	{
+		REQUIRE(value == key * 2);
+		constOrder.push_back(key);
+	}
+	REQUIRE(constOrder == order);
+	STATIC_REQUIRE(std::forward_iterator<PonyEngine::Memory::FlatHashMap<int, int>::Iterator<false>>);
+	STATIC_REQUIRE(std::forward_iterator<PonyEngine::Memory::FlatHashMap<int, int>::Iterator<true>>);
+}
+
+TEST_CASE("FlatHashMap: copy and move", "[Memory][FlatHashMap]")
+{
+	auto map = PonyEngine::Memory::FlatHashMap<int, std::string>();
+	map.Emplace(0, "Zero");
+	map.Emplace(1, "One");
+
+	auto copied = map;
+	REQUIRE(copied.Size() == 2uz);
+	REQUIRE(*copied.Find(0) == "Zero");
+	*copied.Find(0) = "Changed";
+	REQUIRE(*map.Find(0) == "Zero");
+
+	auto moved = std::move(map);
+	REQUIRE(moved.Size() == 2uz);
+	REQUIRE(*moved.Find(1) == "One");
+	REQUIRE(map.IsEmpty());
+	map.Emplace(2, "Two");
+	REQUIRE(*map.Find(2) == "Two");
+
+	moved = copied;
+	REQUIRE(*moved.Find(0) == "Changed");
+	copied = std::move(map);
+	REQUIRE(copied.Size() == 1uz);
+	REQUIRE(*copied.Find(2) == "Two");
+}
+
+TEST_CASE("FlatHashMap: no allocations", "[Memory][FlatHashMap]")
+{
+	auto map = PonyEngine::Memory::FlatHashMap<int, int>(1000uz);
+
+	PonyEngine::Testing::RequireNoAllocations([&]
+	{
+		for (int i = 0; i < 1000; ++i)
+		{
+			map.Emplace(i, i);
+			[[maybe_unused]] const int* const value = map.Find(i);
+		}
+		for (int i = 0; i < 1000; ++i)
+		{
+			map.Remove(i);
+		}
+	});
+}
+
+TEST_CASE("FlatHashMap: find", "[Memory][FlatHashMap]")
+{
+	for (const std::size_t count : {10000uz, 100000uz, 1000000uz})
+	{
+		auto engine = std::mt19937_64(count);
+		auto keys = std::vector<std::uint64_t>(count);
+		std::ranges::generate(keys, engine);
+
+		auto flatMap = PonyEngine::Memory::FlatHashMap<std::uint64_t, std::uint64_t>(count);
+		auto unorderedMap = std::unordered_map<std::uint64_t, std::uint64_t>(count);
+		for (const std::uint64_t key : keys)
+		{
+			flatMap.Emplace(key, key);
+			unorderedMap.emplace(key, key);
+		}
+		REQUIRE(flatMap.Size() == unorderedMap.size());
+		for (const std::uint64_t key : keys)
+		{
+			REQUIRE(*flatMap.Find(key) == unorderedMap.at(key));
+		}
+
+#if PONY_ENGINE_TESTING_BENCHMARK
+		std::ranges::shuffle(keys, engine);
+		std::size_t index = 0uz;
+
+		BENCHMARK(std::format("FlatHashMap {}", count))
+		{
+			index = (index + 1uz) % count;
+			return *flatMap.Find(keys[index]);
+		};
+
+		BENCHMARK(std::format("Unordered map {}", count))
+		{
+			index = (index + 1uz) % count;
+			return unorderedMap.find(keys[index])->second;
+		};
+
+		BENCHMARK(std::format("FlatHashMap miss {}", count))
+		{
+			index = (index + 1uz) % count;
+			return flatMap.Find(~keys[index]);
+		};
+
+		BENCHMARK(std::format("Unordered map miss {}", count))
+		{
+			index = (index + 1uz) % count;
+			return unorderedMap.find(~keys[index]) == unorderedMap.cend();
+		};
+#endif
+	}
+}
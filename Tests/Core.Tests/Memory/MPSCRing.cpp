@@ -0,0 +1,203 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+import std;
+
+import PonyEngine.Memory;
+import PonyEngine.Testing;
+
+TEST_CASE("MPSCRing: create", "[Memory][MPSCRing]")
+{
+	const auto ring = PonyEngine::Memory::MPSCRing<int>(5uz);
+	REQUIRE(ring.Capacity() == 8uz);
+	REQUIRE(ring.Size() == 0uz);
+	REQUIRE(ring.IsEmpty());
+	REQUIRE(PonyEngine::Memory::MPSCRing<int>(1uz).Capacity() == 2uz);
+
+	REQUIRE_THROWS(PonyEngine::Memory::MPSCRing<int>(0uz));
+}
+
+TEST_CASE("MPSCRing: push and pop", "[Memory][MPSCRing]")
+{
+	auto ring = PonyEngine::Memory::MPSCRing<std::string>(4uz);
+	const auto first = std::string("First");
+	REQUIRE(ring.TryPush(first));
+	REQUIRE(ring.TryPush(std::string("Second")));
+	REQUIRE(ring.TryEmplace(3uz, 'T'));
+	REQUIRE(ring.TryEmplace("Fourth"));
+	REQUIRE(ring.Size() == 4uz);
+
+	auto fifth = std::string("Fifth");
+	REQUIRE(!ring.TryPush(std::move(fifth)));
+	REQUIRE(fifth == "Fifth");
+
+	REQUIRE(ring.TryPop() == "First");
+	REQUIRE(ring.TryPop() == "Second");
+	REQUIRE(ring.TryPush(std::move(fifth)));
+	REQUIRE(ring.TryPop() == "TTT");
+	REQUIRE(ring.TryPop() == "Fourth");
+	REQUIRE(ring.TryPop() == "Fifth");
+	REQUIRE(!ring.TryPop());
+	REQUIRE(ring.IsEmpty());
+
+	REQUIRE(ring.TryPush(std::string(100uz, 'L')));
+}
+
+TEST_CASE("MPSCRing: batch", "[Memory][MPSCRing]")
+{
+	auto ring = PonyEngine::Memory::MPSCRing<int>(8uz);
+	constexpr auto values = std::array<int, 6>{0, 1, 2, 3, 4, 5};
+	REQUIRE(ring.TryPushBatch(values));
+	REQUIRE(!ring.TryPushBatch(values));
+	REQUIRE(ring.TryPushBatch(std::span(values).first(2uz)));
+	REQUIRE(ring.Size() == 8uz);
+	REQUIRE(ring.TryPushBatch(std::span<const int>()));
+	REQUIRE(!ring.TryPush(6));
+
+	auto popped = std::array<int, 5>();
+	REQUIRE(ring.TryPopBatch(popped) == 5uz);
+	REQUIRE(popped == std::array<int, 5>{0, 1, 2, 3, 4});
+	REQUIRE(ring.TryPopBatch(popped) == 3uz);
+	REQUIRE(popped[0] == 5);
+	REQUIRE(popped[1] == 0);
+	REQUIRE(popped[2] == 1);
+	REQUIRE(ring.TryPopBatch(popped) == 0uz);
+
+	REQUIRE(!ring.TryPushBatch(std::array<int, 9>()));
+}
+
+TEST_CASE("MPSCRing: no allocations", "[Memory][MPSCRing]")
+{
+	auto ring = PonyEngine::Memory::MPSCRing<int>(8uz);
+
+	PonyEngine::Testing::RequireNoAllocations([&]
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			[[maybe_unused]] const bool pushed = ring.TryPush(i);
+			[[maybe_unused]] const std::optional<int> popped = ring.TryPop();
+		}
+	});
+}
+
+TEST_CASE("MPSCRing: threads", "[Memory][MPSCRing]")
+{
+	constexpr std::size_t producerCount = 4uz;
+	constexpr std::size_t count = 50000uz;
+	auto ring = PonyEngine::Memory::MPSCRing<std::pair<std::size_t, std::size_t>>(64uz);
+
+	auto producers = std::vector<std::jthread>();
+	for (std::size_t producer = 0uz; producer < producerCount; ++producer)
+	{
+		producers.emplace_back([&ring, producer]
+		{
+			for (std::size_t i = 0uz; i < count; )
+			{
+				if (i % 3uz == 0uz && i + 2uz < count)
+				{
+					const auto batch = std::array<std::pair<std::size_t, std::size_t>, 3>{std::pair(producer, i), std::pair(producer, i + 1uz), std::pair(producer, i + 2uz)};
+					if (ring.TryPushBatch(batch))
+					{
+						i += batch.size();
+					}
+				}
+				else if (ring.TryEmplace(producer, i))
+				{
+					++i;
+				}
+			}
+		});
+	}
+
+	auto expected = std::array<std::size_t, producerCount>();
+	bool ordered = true;
+	for (std::size_t popped = 0uz; popped < producerCount * count; )
+	{
+		if (const std::optional<std::pair<std::size_t, std::size_t>> value = ring.TryPop())
+		{
+			ordered &= value->second == expected[value->first]++;
+			++popped;
+		}
+	}
+	producers.clear();
+
+	REQUIRE(ordered);
+	REQUIRE(ring.IsEmpty());
+}
+
+TEST_CASE("MPSCRing: performance", "[Memory][MPSCRing]")
+{
+#if PONY_ENGINE_TESTING_BENCHMARK
+	constexpr std::size_t producerCount = 4uz;
+	constexpr std::size_t count = 25000uz;
+
+	BENCHMARK("Throughput")
+	{
+		auto ring = PonyEngine::Memory::MPSCRing<std::size_t>(1024uz);
+		auto producers = std::vector<std::jthread>();
+		for (std::size_t producer = 0uz; producer < producerCount; ++producer)
+		{
+			producers.emplace_back([&ring]
+			{
+				for (std::size_t i = 0uz; i < count; )
+				{
+					if (ring.TryPush(i))
+					{
+						++i;
+					}
+				}
+			});
+		}
+
+		auto batch = std::array<std::size_t, 32>();
+		for (std::size_t i = 0uz; i < producerCount * count; i += ring.TryPopBatch(batch))
+		{
+		}
+
+		return ring.Size();
+	};
+
+	BENCHMARK("Latency")
+	{
+		auto request = PonyEngine::Memory::MPSCRing<std::size_t>(2uz);
+		auto response = PonyEngine::Memory::MPSCRing<std::size_t>(2uz);
+		auto echo = std::jthread([&]
+		{
+			for (std::size_t i = 0uz; i < 1000uz; )
+			{
+				if (const std::optional<std::size_t> value = request.TryPop())
+				{
+					while (!response.TryPush(*value))
+					{
+					}
+					++i;
+				}
+			}
+		});
+
+		std::size_t sum = 0uz;
+		for (std::size_t i = 0uz; i < 1000uz; ++i)
+		{
+			while (!request.TryPush(i))
+			{
+			}
+			std::optional<std::size_t> value;
+			while (!(value = response.TryPop()))
+			{
+			}
+			sum += *value;
+		}
+
+		return sum;
+	};
+#endif
+}
@@ -17,7 +17,7 @@ import PonyEngine.Memory;
 TEST_CASE("Pool: create", "[Memory][Pool]")
 {
 	const auto pool = PonyEngine::Memory::Pool<int>(
-		[]() { return std::unique_ptr<int, std::function<void(int*)>>(new int(0), [](int* const ptr) { delete ptr; }); },
+		[]() { return PonyEngine::Memory::Pool<int>::Pointer(new int(0), [](int* const ptr) { delete ptr; }); },
 		[](int& object) { object = 42; },
 		[](int& object) { object = 0; },
 		[](const int& object) { return static_cast<std::uint64_t>(object); },
@@ -27,7 +27,7 @@ TEST_CASE("Pool: create", "[Memory][Pool]")
 	REQUIRE(pool.InactiveCount() == 0uz);
 
 	const auto poolS = PonyEngine::Memory::Pool<int>(
-		[]() { return std::unique_ptr<int, std::function<void(int*)>>(new int(0), [](int* const ptr) { delete ptr; }); },
+		[]() { return PonyEngine::Memory::Pool<int>::Pointer(new int(0), [](int* const ptr) { delete ptr; }); },
 		[](int& object) { object = 42; },
 		[](int& object) { object = 0; },
 		[](const int& object) { return static_cast<std::uint64_t>(object); },
@@ -46,7 +46,7 @@ TEST_CASE("Pool: events", "[Memory][Pool]")
 	std::size_t utilityCalled = 0uz;
 
 	auto pool = PonyEngine::Memory::Pool<int>(
-		[&]() { ++createCalled; return std::unique_ptr<int, std::function<void(int*)>>(new int(0), [&](int* const ptr) { ++destroyCalled; delete ptr; }); },
+		[&]() { ++createCalled; return PonyEngine::Memory::Pool<int>::Pointer(new int(0), [&](int* const ptr) { ++destroyCalled; delete ptr; }); },
 		[&](int& object) { ++acquireCalled; object = 42; },
 		[&](int& object) { ++releaseCalled; object = 0; },
 		[&](const int& object) { ++utilityCalled; return static_cast<std::uint64_t>(object); },
@@ -145,7 +145,7 @@ TEST_CASE("Pool: events", "[Memory][Pool]")
 TEST_CASE("Pool: lease", "[Memory][Pool]")
 {
 	auto pool = PonyEngine::Memory::Pool<int>(
-		[]() { return std::unique_ptr<int, std::function<void(int*)>>(new int(0), [](int* const ptr) { delete ptr; }); },
+		[]() { return PonyEngine::Memory::Pool<int>::Pointer(new int(0), [](int* const ptr) { delete ptr; }); },
 		[](int& object) { object = 42; },
 		[](int& object) { object = 0; },
 		[](const int& object) { return static_cast<std::uint64_t>(object); },
@@ -0,0 +1,194 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+import std;
+
+import PonyEngine.Memory;
+import PonyEngine.Testing;
+
+TEST_CASE("RecordRing: create", "[Memory][RecordRing]")
+{
+	const auto ring = PonyEngine::Memory::RecordRing(100uz);
+	REQUIRE(ring.Capacity() == 128uz);
+	REQUIRE(ring.MaxRecordSize() == 56uz);
+	REQUIRE(ring.Size() == 0uz);
+	REQUIRE(ring.IsEmpty());
+	REQUIRE(PonyEngine::Memory::RecordRing(0uz).Capacity() == PonyEngine::Memory::RecordRing::MinCapacity);
+}
+
+TEST_CASE("RecordRing: reserve and commit", "[Memory][RecordRing]")
+{
+	auto ring = PonyEngine::Memory::RecordRing(128uz);
+
+	std::optional<std::span<std::byte>> reserved = ring.Reserve(20uz);
+	REQUIRE(reserved);
+	REQUIRE(reserved->size() == 20uz);
+	REQUIRE(reinterpret_cast<std::uintptr_t>(reserved->data()) % PonyEngine::Memory::RecordRing::RecordAlignment == 0uz);
+	std::ranges::fill(*reserved, std::byte{7});
+	REQUIRE(!ring.Peek());
+	ring.Commit(12uz);
+	REQUIRE(ring.Size() == 24uz);
+
+	reserved = ring.Reserve(0uz);
+	REQUIRE(reserved);
+	ring.Commit();
+	REQUIRE(!ring.Reserve(57uz));
+
+	std::optional<std::span<const std::byte>> record = ring.Peek();
+	REQUIRE(record);
+	REQUIRE(record->size() == 12uz);
+	REQUIRE(std::ranges::all_of(*record, [](const std::byte value) { return value == std::byte{7}; }));
+	REQUIRE(ring.Peek()->data() == record->data());
+	ring.Release();
+
+	record = ring.Peek();
+	REQUIRE(record);
+	REQUIRE(record->empty());
+	ring.Release();
+	REQUIRE(!ring.Peek());
+	REQUIRE(ring.IsEmpty());
+}
+
+TEST_CASE("RecordRing: wrap", "[Memory][RecordRing]")
+{
+	auto ring = PonyEngine::Memory::RecordRing(64uz);
+	const auto record = std::array<std::byte, 16>{std::byte{1}, std::byte{2}, std::byte{3}};
+
+	REQUIRE(ring.TryWrite(record));
+	REQUIRE(ring.TryWrite(record));
+	REQUIRE(!ring.TryWrite(record));
+	REQUIRE(std::ranges::equal(*ring.Peek(), record));
+	ring.Release();
+
+	REQUIRE(ring.TryWrite(std::span(record).first(12uz)));
+	REQUIRE(ring.Size() == 64uz);
+	REQUIRE(!ring.TryWrite(std::span<const std::byte>()));
+
+	REQUIRE(std::ranges::equal(*ring.Peek(), record));
+	ring.Release();
+	const std::optional<std::span<const std::byte>> wrapped = ring.Peek();
+	REQUIRE(wrapped);
+	REQUIRE(std::ranges::equal(*wrapped, std::span(record).first(12uz)));
+	ring.Release();
+	REQUIRE(ring.IsEmpty());
+}
+
+TEST_CASE("RecordRing: no allocations", "[Memory][RecordRing]")
+{
+	auto ring = PonyEngine::Memory::RecordRing(256uz);
+	constexpr auto data = std::array<std::byte, 20>{};
+
+	PonyEngine::Testing::RequireNoAllocations([&]
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			[[maybe_unused]] const bool written = ring.TryWrite(data);
+			if (ring.Peek())
+			{
+				ring.Release();
+			}
+		}
+	});
+}
+
+TEST_CASE("RecordRing: threads", "[Memory][RecordRing]")
+{
+	constexpr std::size_t count = 200000uz;
+	auto ring = PonyEngine::Memory::RecordRing(1024uz);
+
+	auto producer = std::jthread([&]
+	{
+		for (std::size_t i = 0uz; i < count; )
+		{
+			const std::size_t size = sizeof(std::size_t) + i % 100uz;
+			if (const std::optional<std::span<std::byte>> reserved = ring.Reserve(size))
+			{
+				std::memcpy(reserved->data(), &i, sizeof(i));
+				std::ranges::fill(reserved->subspan(sizeof(i)), static_cast<std::byte>(i));
+				ring.Commit();
+				++i;
+			}
+		}
+	});
+
+	bool valid = true;
+	for (std::size_t expected = 0uz; expected < count; )
+	{
+		if (const std::optional<std::span<const std::byte>> record = ring.Peek())
+		{
+			std::size_t value;
+			std::memcpy(&value, record->data(), sizeof(value));
+			valid &= value == expected;
+			valid &= record->size() == sizeof(std::size_t) + expected % 100uz;
+			valid &= std::ranges::all_of(record->subspan(sizeof(value)), [&](const std::byte b) { return b == static_cast<std::byte>(expected); });
+			ring.Release();
+			++expected;
+		}
+	}
+	producer.join();
+
+	REQUIRE(valid);
+	REQUIRE(ring.IsEmpty());
+}
+
+TEST_CASE("RecordRing: performance", "[Memory][RecordRing]")
+{
+#if PONY_ENGINE_TESTING_BENCHMARK
+	constexpr std::size_t count = 100000uz;
+
+	BENCHMARK("Throughput")
+	{
+		auto ring = PonyEngine::Memory::RecordRing(64uz * 1024uz);
+		auto producer = std::jthread([&]
+		{
+			for (std::size_t i = 0uz; i < count; )
+			{
+				if (const std::optional<std::span<std::byte>> reserved = ring.Reserve(16uz + i % 48uz))
+				{
+					std::memcpy(reserved->data(), &i, sizeof(i));
+					ring.Commit();
+					++i;
+				}
+			}
+		});
+
+		std::size_t sum = 0uz;
+		for (std::size_t i = 0uz; i < count; )
+		{
+			if (const std::optional<std::span<const std::byte>> record = ring.Peek())
+			{
+				sum += record->size();
+				ring.Release();
+				++i;
+			}
+		}
+
+		return sum;
+	};
+
+	BENCHMARK("Reserve-Commit-Peek-Release")
+	{
+		auto ring = PonyEngine::Memory::RecordRing(4096uz);
+		std::size_t sum = 0uz;
+		for (std::size_t i = 0uz; i < 1000uz; ++i)
+		{
+			const std::optional<std::span<std::byte>> reserved = ring.Reserve(32uz);
+			reserved->front() = static_cast<std::byte>(i);
+			ring.Commit();
+			sum += std::to_integer<std::size_t>(ring.Peek()->front());
+			ring.Release();
+		}
+
+		return sum;
+	};
+#endif
+}
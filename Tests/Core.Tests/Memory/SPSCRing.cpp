@@ -0,0 +1,176 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+import std;
+
+import PonyEngine.Memory;
+import PonyEngine.Testing;
+
+TEST_CASE("SPSCRing: create", "[Memory][SPSCRing]")
+{
+	const auto ring = PonyEngine::Memory::SPSCRing<int>(5uz);
+	REQUIRE(ring.Capacity() == 8uz);
+	REQUIRE(ring.Size() == 0uz);
+	REQUIRE(ring.IsEmpty());
+
+	REQUIRE_THROWS(PonyEngine::Memory::SPSCRing<int>(0uz));
+}
+
+TEST_CASE("SPSCRing: push and pop", "[Memory][SPSCRing]")
+{
+	auto ring = PonyEngine::Memory::SPSCRing<std::string>(4uz);
+	const auto first = std::string("First");
+	REQUIRE(ring.TryPush(first));
+	REQUIRE(ring.TryPush(std::string("Second")));
+	REQUIRE(ring.TryEmplace(3uz, 'T'));
+	REQUIRE(ring.TryEmplace("Fourth"));
+	REQUIRE(ring.Size() == 4uz);
+
+	auto fifth = std::string("Fifth");
+	REQUIRE(!ring.TryPush(std::move(fifth)));
+	REQUIRE(fifth == "Fifth");
+
+	REQUIRE(ring.TryPop() == "First");
+	REQUIRE(ring.TryPop() == "Second");
+	REQUIRE(ring.TryPush(std::move(fifth)));
+	REQUIRE(ring.TryPop() == "TTT");
+	REQUIRE(ring.TryPop() == "Fourth");
+	REQUIRE(ring.TryPop() == "Fifth");
+	REQUIRE(!ring.TryPop());
+	REQUIRE(ring.IsEmpty());
+
+	REQUIRE(ring.TryPush(std::string(100uz, 'L')));
+}
+
+TEST_CASE("SPSCRing: batch", "[Memory][SPSCRing]")
+{
+	auto ring = PonyEngine::Memory::SPSCRing<int>(8uz);
+	constexpr auto values = std::array<int, 6>{0, 1, 2, 3, 4, 5};
+	REQUIRE(ring.TryPushBatch(values) == 6uz);
+	REQUIRE(ring.TryPushBatch(values) == 2uz);
+	REQUIRE(ring.Size() == 8uz);
+	REQUIRE(ring.TryPushBatch(values) == 0uz);
+
+	auto popped = std::array<int, 5>();
+	REQUIRE(ring.TryPopBatch(popped) == 5uz);
+	REQUIRE(popped == std::array<int, 5>{0, 1, 2, 3, 4});
+	REQUIRE(ring.TryPopBatch(popped) == 3uz);
+	REQUIRE(popped[0] == 5);
+	REQUIRE(popped[1] == 0);
+	REQUIRE(popped[2] == 1);
+	REQUIRE(ring.TryPopBatch(popped) == 0uz);
+}
+
+TEST_CASE("SPSCRing: no allocations", "[Memory][SPSCRing]")
+{
+	auto ring = PonyEngine::Memory::SPSCRing<int>(8uz);
+
+	PonyEngine::Testing::RequireNoAllocations([&]
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			[[maybe_unused]] const bool pushed = ring.TryPush(i);
+			[[maybe_unused]] const std::optional<int> popped = ring.TryPop();
+		}
+	});
+}
+
+TEST_CASE("SPSCRing: threads", "[Memory][SPSCRing]")
+{
+	constexpr std::size_t count = 200000uz;
+	auto ring = PonyEngine::Memory::SPSCRing<std::size_t>(64uz);
+
+	auto producer = std::jthread([&]
+	{
+		for (std::size_t i = 0uz; i < count; )
+		{
+			if (ring.TryPush(i))
+			{
+				++i;
+			}
+		}
+	});
+
+	bool ordered = true;
+	for (std::size_t expected = 0uz; expected < count; )
+	{
+		if (const std::optional<std::size_t> value = ring.TryPop())
+		{
+			ordered &= *value == expected;
+			++expected;
+		}
+	}
+	producer.join();
+
+	REQUIRE(ordered);
+	REQUIRE(ring.IsEmpty());
+}
+
+TEST_CASE("SPSCRing: performance", "[Memory][SPSCRing]")
+{
+#if PONY_ENGINE_TESTING_BENCHMARK
+	constexpr std::size_t count = 100000uz;
+
+	BENCHMARK("Throughput")
+	{
+		auto ring = PonyEngine::Memory::SPSCRing<std::size_t>(1024uz);
+		auto producer = std::jthread([&]
+		{
+			auto batch = std::array<std::size_t, 32>();
+			for (std::size_t i = 0uz; i < count; i += ring.TryPushBatch(std::span(batch).first(std::min(batch.size(), count - i))))
+			{
+			}
+		});
+
+		auto batch = std::array<std::size_t, 32>();
+		for (std::size_t i = 0uz; i < count; i += ring.TryPopBatch(batch))
+		{
+		}
+
+		return ring.Size();
+	};
+
+	BENCHMARK("Latency")
+	{
+		auto request = PonyEngine::Memory::SPSCRing<std::size_t>(2uz);
+		auto response = PonyEngine::Memory::SPSCRing<std::size_t>(2uz);
+		auto echo = std::jthread([&]
+		{
+			for (std::size_t i = 0uz; i < 1000uz; )
+			{
+				if (const std::optional<std::size_t> value = request.TryPop())
+				{
+					while (!response.TryPush(*value))
+					{
+					}
+					++i;
+				}
+			}
+		});
+
+		std::size_t sum = 0uz;
+		for (std::size_t i = 0uz; i < 1000uz; ++i)
+		{
+			while (!request.TryPush(i))
+			{
+			}
+			std::optional<std::size_t> value;
+			while (!(value = response.TryPop()))
+			{
+			}
+			sum += *value;
+		}
+
+		return sum;
+	};
+#endif
+}
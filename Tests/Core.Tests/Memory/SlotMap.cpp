@@ -0,0 +1,184 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+import std;
+
+import PonyEngine.Memory;
+import PonyEngine.Testing;
+
+TEST_CASE("SlotMap: create", "[Memory][SlotMap]")
+{
+	const auto slotMap = PonyEngine::Memory::SlotMap<int>();
+	REQUIRE(slotMap.Size() == 0uz);
+	REQUIRE(slotMap.IsEmpty());
+	REQUIRE(slotMap.Values().empty());
+	REQUIRE(!slotMap.Contains(PonyEngine::Memory::SlotKey{}));
+	REQUIRE(!slotMap.Contains(PonyEngine::Memory::SlotKey{.id = 1u << PonyEngine::Memory::SlotMap<int>::IndexBitCount}));
+}
+
+TEST_CASE("SlotMap: add", "[Memory][SlotMap]")
+{
+	auto slotMap = PonyEngine::Memory::SlotMap<std::string>();
+	const PonyEngine::Memory::SlotKey key0 = slotMap.Add("Zero");
+	const PonyEngine::Memory::SlotKey key1 = slotMap.Add(std::string("One"));
+	const PonyEngine::Memory::SlotKey key2 = slotMap.Emplace(3uz, 'T');
+	REQUIRE(key0.IsValid());
+	REQUIRE(key1.IsValid());
+	REQUIRE(key2.IsValid());
+	REQUIRE(key0 != key1);
+	REQUIRE(key1 != key2);
+	REQUIRE(slotMap.Size() == 3uz);
+	REQUIRE(!slotMap.IsEmpty());
+
+	REQUIRE(slotMap.IndexOf(key0) == 0uz);
+	REQUIRE(slotMap.IndexOf(key1) == 1uz);
+	REQUIRE(slotMap.IndexOf(key2) == 2uz);
+	REQUIRE(slotMap.Key(0uz) == key0);
+	REQUIRE(slotMap.Key(1uz) == key1);
+	REQUIRE(slotMap.Key(2uz) == key2);
+	REQUIRE(*slotMap.Find(key0) == "Zero");
+	REQUIRE(*slotMap.Find(key1) == "One");
+	REQUIRE(*slotMap.Find(key2) == "TTT");
+	REQUIRE(slotMap[1uz] == "One");
+}
+
+TEST_CASE("SlotMap: remove", "[Memory][SlotMap]")
+{
+	auto slotMap = PonyEngine::Memory::SlotMap<int>();
+	const PonyEngine::Memory::SlotKey key0 = slotMap.Add(0);
+	const PonyEngine::Memory::SlotKey key1 = slotMap.Add(1);
+	const PonyEngine::Memory::SlotKey key2 = slotMap.Add(2);
+	const PonyEngine::Memory::SlotKey key3 = slotMap.Add(3);
+
+	slotMap.Remove(slotMap.IndexOf(key0));
+	REQUIRE(slotMap.Size() == 3uz);
+	REQUIRE(!slotMap.Contains(key0));
+	REQUIRE(slotMap.Find(key0) == nullptr);
+	REQUIRE(slotMap.IndexOf(key0) == slotMap.Size());
+	REQUIRE(slotMap[0uz] == 3);
+	REQUIRE(*slotMap.Find(key1) == 1);
+	REQUIRE(*slotMap.Find(key2) == 2);
+	REQUIRE(*slotMap.Find(key3) == 3);
+
+	slotMap.RemoveOrdered(slotMap.IndexOf(key3));
+	REQUIRE(slotMap.Size() == 2uz);
+	REQUIRE(!slotMap.Contains(key3));
+	REQUIRE(slotMap[0uz] == 1);
+	REQUIRE(slotMap[1uz] == 2);
+	REQUIRE(slotMap.Key(0uz) == key1);
+	REQUIRE(slotMap.Key(1uz) == key2);
+
+	const PonyEngine::Memory::SlotKey key4 = slotMap.Add(4);
+	REQUIRE(key4 != key0);
+	REQUIRE(key4 != key3);
+	REQUIRE(!slotMap.Contains(key0));
+	REQUIRE(!slotMap.Contains(key3));
+	REQUIRE(*slotMap.Find(key4) == 4);
+
+	slotMap.Clear();
+	REQUIRE(slotMap.IsEmpty());
+	REQUIRE(!slotMap.Contains(key1));
+	REQUIRE(!slotMap.Contains(key2));
+	REQUIRE(!slotMap.Contains(key4));
+}
+
+TEST_CASE("SlotMap: generation", "[Memory][SlotMap]")
+{
+	auto slotMap = PonyEngine::Memory::SlotMap<int>();
+	auto keys = std::unordered_set<PonyEngine::Memory::SlotKey>();
+	for (int i = 0; i < 10000; ++i)
+	{
+		const PonyEngine::Memory::SlotKey key = slotMap.Add(i);
+		REQUIRE(keys.insert(key).second);
+		REQUIRE(*slotMap.Find(key) == i);
+		slotMap.Remove(slotMap.IndexOf(key));
+		REQUIRE(!slotMap.Contains(key));
+	}
+}
+
+TEST_CASE("SlotMap: iterate", "[Memory][SlotMap]")
+{
+	auto slotMap = PonyEngine::Memory::SlotMap<int>();
+	for (int i = 0; i < 10; ++i)
+	{
+		[[maybe_unused]] const PonyEngine::Memory::SlotKey key = slotMap.Add(i);
+	}
+	slotMap.Remove(4uz);
+
+	int sum = 0;
+	for (const int value : slotMap)
+	{
+		sum += value;
+	}
+	REQUIRE(sum == 41);
+	REQUIRE(std::ranges::fold_left(slotMap.Values(), 0, std::plus<int>()) == 41);
+}
+
+TEST_CASE("SlotMap: copy and move", "[Memory][SlotMap]")
+{
+	auto slotMap = PonyEngine::Memory::SlotMap<int>();
+	const PonyEngine::Memory::SlotKey key0 = slotMap.Add(0);
+	const PonyEngine::Memory::SlotKey key1 = slotMap.Add(1);
+	slotMap.Remove(slotMap.IndexOf(key0));
+
+	const auto copied = slotMap;
+	REQUIRE(copied.Size() == 1uz);
+	REQUIRE(*copied.Find(key1) == 1);
+	REQUIRE(!copied.Contains(key0));
+
+	auto moved = std::move(slotMap);
+	REQUIRE(moved.Size() == 1uz);
+	REQUIRE(*moved.Find(key1) == 1);
+	REQUIRE(!moved.Contains(key0));
+	REQUIRE(slotMap.IsEmpty());
+	const PonyEngine::Memory::SlotKey key2 = slotMap.Add(2);
+	REQUIRE(*slotMap.Find(key2) == 2);
+}
+
+TEST_CASE("SlotMap: no allocations", "[Memory][SlotMap]")
+{
+	auto slotMap = PonyEngine::Memory::SlotMap<int>();
+	slotMap.Remove(slotMap.IndexOf(slotMap.Add(0)));
+
+	PonyEngine::Testing::RequireNoAllocations([&]
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			const PonyEngine::Memory::SlotKey key = slotMap.Add(i);
+			[[maybe_unused]] const int* const value = slotMap.Find(key);
+			slotMap.Remove(slotMap.IndexOf(key));
+		}
+	});
+}
+
+TEST_CASE("SlotMap: find", "[Memory][SlotMap]")
+{
+	auto slotMap = PonyEngine::Memory::SlotMap<int>();
+	auto keys = std::vector<PonyEngine::Memory::SlotKey>();
+	for (int i = 0; i < 4096; ++i)
+	{
+		keys.push_back(slotMap.Add(i));
+	}
+
+#if PONY_ENGINE_TESTING_BENCHMARK
+	BENCHMARK("Find")
+	{
+		return slotMap.Find(keys[2048]);
+	};
+
+	BENCHMARK("Add-Remove")
+	{
+		slotMap.Remove(slotMap.IndexOf(slotMap.Add(0)));
+		return slotMap.Size();
+	};
+#endif
+}
@@ -0,0 +1,158 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+import std;
+
+import PonyEngine.Memory;
+import PonyEngine.Testing;
+
+TEST_CASE("SmallVector: create", "[Memory][SmallVector]")
+{
+	const auto vector = PonyEngine::Memory::SmallVector<int, 4>();
+	REQUIRE(vector.Size() == 0uz);
+	REQUIRE(vector.Capacity() == 4uz);
+	REQUIRE(vector.IsEmpty());
+	REQUIRE(vector.IsInline());
+	REQUIRE(vector.begin() == vector.end());
+
+	const auto listVector = PonyEngine::Memory::SmallVector<int, 2>{1, 2, 3};
+	REQUIRE(listVector.Size() == 3uz);
+	REQUIRE(!listVector.IsInline());
+	REQUIRE(listVector[0] == 1);
+	REQUIRE(listVector[1] == 2);
+	REQUIRE(listVector[2] == 3);
+}
+
+TEST_CASE("SmallVector: add", "[Memory][SmallVector]")
+{
+	auto vector = PonyEngine::Memory::SmallVector<std::string, 2>();
+	REQUIRE(vector.Add("Zero") == "Zero");
+	REQUIRE(vector.Add(std::string("One")) == "One");
+	REQUIRE(vector.IsInline());
+
+	REQUIRE(vector.Emplace(3uz, 'T') == "TTT");
+	REQUIRE(!vector.IsInline());
+	REQUIRE(vector.Capacity() >= 3uz);
+
+	vector.Add(vector[0]);
+	REQUIRE(vector.Size() == 4uz);
+	REQUIRE(vector[0] == "Zero");
+	REQUIRE(vector[1] == "One");
+	REQUIRE(vector[2] == "TTT");
+	REQUIRE(vector[3] == "Zero");
+	REQUIRE(vector.Data() == &vector[0]);
+}
+
+TEST_CASE("SmallVector: remove", "[Memory][SmallVector]")
+{
+	auto vector = PonyEngine::Memory::SmallVector<int, 8>{0, 1, 2, 3, 4};
+	vector.Remove(1uz);
+	REQUIRE(std::ranges::equal(vector, std::array{0, 2, 3, 4}));
+	vector.RemoveLast();
+	REQUIRE(std::ranges::equal(vector, std::array{0, 2, 3}));
+
+	vector.Resize(5uz);
+	REQUIRE(std::ranges::equal(vector, std::array{0, 2, 3, 0, 0}));
+	vector.Resize(1uz);
+	REQUIRE(std::ranges::equal(vector, std::array{0}));
+
+	vector.Clear();
+	REQUIRE(vector.IsEmpty());
+	REQUIRE(vector.Capacity() == 8uz);
+}
+
+TEST_CASE("SmallVector: copy and move", "[Memory][SmallVector]")
+{
+	auto value = std::make_shared<int>(3);
+	auto inlineVector = PonyEngine::Memory::SmallVector<std::shared_ptr<int>, 2>();
+	inlineVector.Add(value);
+	auto heapVector = PonyEngine::Memory::SmallVector<std::shared_ptr<int>, 2>{value, value, value};
+	REQUIRE(value.use_count() == 5);
+
+	auto copied = heapVector;
+	REQUIRE(copied.Size() == 3uz);
+	REQUIRE(value.use_count() == 8);
+
+	auto movedInline = std::move(inlineVector);
+	REQUIRE(movedInline.Size() == 1uz);
+	REQUIRE(movedInline.IsInline());
+	REQUIRE(inlineVector.IsEmpty());
+
+	const std::shared_ptr<int>* const heapData = heapVector.Data();
+	auto movedHeap = std::move(heapVector);
+	REQUIRE(movedHeap.Data() == heapData);
+	REQUIRE(heapVector.IsEmpty());
+	REQUIRE(heapVector.IsInline());
+	REQUIRE(value.use_count() == 8);
+
+	copied = movedInline;
+	REQUIRE(copied.Size() == 1uz);
+	REQUIRE(value.use_count() == 6);
+
+	movedHeap = std::move(copied);
+	REQUIRE(movedHeap.Size() == 1uz);
+	REQUIRE(value.use_count() == 3);
+}
+
+TEST_CASE("SmallVector: span", "[Memory][SmallVector]")
+{
+	auto vector = PonyEngine::Memory::SmallVector<int, 4>{1, 2, 3};
+	const std::span<const int> span = vector;
+	REQUIRE(span.data() == vector.Data());
+	REQUIRE(span.size() == vector.Size());
+	REQUIRE(std::ranges::find(vector, 2) - vector.begin() == 1);
+}
+
+TEST_CASE("SmallVector: allocations", "[Memory][SmallVector]")
+{
+	auto vector = PonyEngine::Memory::SmallVector<int, 4>();
+
+	auto counter = PonyEngine::Testing::AllocationCounter();
+	for (int i = 0; i < 4; ++i)
+	{
+		vector.Add(i);
+	}
+	REQUIRE(counter.AllocationCount() == 0uz);
+
+	vector.Add(4);
+	counter.Stop();
+	REQUIRE(counter.AllocationCount() == 1uz);
+	REQUIRE(counter.AllocatedBytes() >= 5uz * sizeof(int));
+	REQUIRE(counter.Stacktraces().size() == 1uz);
+}
+
+TEST_CASE("SmallVector: performance", "[Memory][SmallVector]")
+{
+#if PONY_ENGINE_TESTING_BENCHMARK
+	BENCHMARK("Add 4 inline")
+	{
+		auto vector = PonyEngine::Memory::SmallVector<int, 4>();
+		for (int i = 0; i < 4; ++i)
+		{
+			vector.Add(i);
+		}
+
+		return vector.Size();
+	};
+
+	BENCHMARK("Add 4 std::vector")
+	{
+		auto vector = std::vector<int>();
+		for (int i = 0; i < 4; ++i)
+		{
+			vector.push_back(i);
+		}
+
+		return vector.size();
+	};
+#endif
+}
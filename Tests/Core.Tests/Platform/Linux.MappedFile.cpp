@@ -0,0 +1,136 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <sys/stat.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+import std;
+
+import PonyEngine.Platform.Linux;
+
+namespace
+{
+	std::filesystem::path TestPath(const std::string_view name)
+	{
+		const std::filesystem::path path = std::filesystem::temp_directory_path() / std::format("PonyEngine.MappedFile.{}.bin", name);
+		std::filesystem::remove(path);
+
+		return path;
+	}
+
+	std::string ReadText(const std::filesystem::path& path)
+	{
+		auto stream = std::ifstream(path, std::ios::binary);
+		return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+	}
+}
+
+TEST_CASE("MappedFile: read", "[Platform][Linux][MappedFile]")
+{
+	const std::filesystem::path path = TestPath("Read");
+	{
+		auto stream = std::ofstream(path, std::ios::binary);
+		stream << "Pony Engine";
+	}
+
+	auto file = PonyEngine::Platform::Linux::MappedFile(path, PonyEngine::Platform::Linux::MappedFileParams{.pattern = PonyEngine::Platform::Linux::AccessPattern::Sequential, .prefetch = true});
+	REQUIRE(file.IsMapped());
+	REQUIRE(!file.IsWritable());
+	REQUIRE(file.Size() == 11uz);
+	REQUIRE(std::string_view(reinterpret_cast<const char*>(file.Data().data()), file.Size()) == "Pony Engine");
+	REQUIRE_NOTHROW(file.Advise(PonyEngine::Platform::Linux::AccessPattern::Random, 5uz, 100uz));
+	REQUIRE_NOTHROW(file.Prefetch(4uz));
+	REQUIRE_NOTHROW(file.Evict());
+
+	const auto moved = std::move(file);
+	REQUIRE(moved.Size() == 11uz);
+	REQUIRE(!file.IsMapped());
+	REQUIRE(file.Data().empty());
+
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("MappedFile: empty", "[Platform][Linux][MappedFile]")
+{
+	const std::filesystem::path path = TestPath("Empty");
+	{
+		auto stream = std::ofstream(path, std::ios::binary);
+	}
+
+	const auto file = PonyEngine::Platform::Linux::MappedFile(path, PonyEngine::Platform::Linux::MappedFileParams{.prefetch = true});
+	REQUIRE(file.IsMapped());
+	REQUIRE(file.Size() == 0uz);
+	REQUIRE(file.Data().empty());
+
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("MappedFile: missing file", "[Platform][Linux][MappedFile]")
+{
+	const std::filesystem::path path = TestPath("Missing");
+	REQUIRE_THROWS_AS(PonyEngine::Platform::Linux::MappedFile(path, PonyEngine::Platform::Linux::MappedFileParams{}), std::runtime_error);
+	REQUIRE(!std::filesystem::exists(path));
+}
+
+TEST_CASE("MappedFile: write", "[Platform][Linux][MappedFile]")
+{
+	const std::filesystem::path path = TestPath("Write");
+	{
+		auto file = PonyEngine::Platform::Linux::MappedFile(path, PonyEngine::Platform::Linux::MappedFileParams
+		{
+			.access = PonyEngine::Platform::Linux::FileAccess::ReadWrite,
+			.pattern = PonyEngine::Platform::Linux::AccessPattern::Random,
+			.hugePages = PonyEngine::Platform::Linux::HugePageMode::Transparent,
+			.size = 4uz
+		});
+		REQUIRE(file.IsWritable());
+		REQUIRE(file.Size() == 4uz);
+		std::ranges::copy(std::as_bytes(std::span<const char>("Pony", 4uz)), file.WritableData().begin());
+		REQUIRE_NOTHROW(file.Flush());
+		REQUIRE(ReadText(path) == "Pony");
+
+		file.Resize(11uz);
+		REQUIRE(file.Size() == 11uz);
+		REQUIRE(std::string_view(reinterpret_cast<const char*>(file.Data().data()), 4uz) == "Pony");
+		REQUIRE(file.Data()[4] == std::byte{0});
+		std::ranges::copy(std::as_bytes(std::span<const char>(" Engine", 7uz)), file.WritableData().begin() + 4);
+
+		file.Resize(0uz);
+		REQUIRE(file.Data().empty());
+		file.Resize(11uz);
+		std::ranges::copy(std::as_bytes(std::span<const char>("Pony Engine", 11uz)), file.WritableData().begin());
+		REQUIRE_NOTHROW(file.Flush(false));
+	}
+	REQUIRE(ReadText(path) == "Pony Engine");
+
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("MappedFile: sparse growth", "[Platform][Linux][MappedFile]")
+{
+	constexpr std::size_t Size = 256uz * 1024uz * 1024uz;
+	const std::filesystem::path path = TestPath("Sparse");
+	{
+		auto file = PonyEngine::Platform::Linux::MappedFile(path, PonyEngine::Platform::Linux::MappedFileParams{.access = PonyEngine::Platform::Linux::FileAccess::ReadWrite, .size = Size});
+		REQUIRE(file.Size() == Size);
+		file.WritableData()[Size / 2uz] = std::byte{42};
+	}
+	REQUIRE(std::filesystem::file_size(path) == Size);
+
+	struct stat status;
+	REQUIRE(stat(path.c_str(), &status) == 0);
+	REQUIRE(static_cast<std::size_t>(status.st_blocks) * 512uz < Size / 16uz);
+
+	const auto file = PonyEngine::Platform::Linux::MappedFile(path, PonyEngine::Platform::Linux::MappedFileParams{});
+	REQUIRE(file.Data()[Size / 2uz] == std::byte{42});
+	REQUIRE(file.Data()[0] == std::byte{0});
+
+	std::filesystem::remove(path);
+}
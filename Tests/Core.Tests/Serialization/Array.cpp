@@ -8,6 +8,7 @@
  ***************************************************/
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 
 import std;
 
@@ -118,3 +119,376 @@ TEST_CASE("Serialize array text", "[Serialization][Array]")
 	std::array<double, 6> doubleArray{ 87., -74., 9., 201., 2341455., -46882.766 };
 	test(std::span<const double, 6>(doubleArray.data(), doubleArray.size()));
 }
+
+TEST_CASE("Array text separators", "[Serialization][Array]")
+{
+	constexpr std::string_view text = "1,22,333,4444,55555,666666,7777777,88888888,999999999,0";
+	REQUIRE(PonyEngine::Serialization::CountArrayTextSeparators(text, ',') == 9uz);
+	REQUIRE(PonyEngine::Serialization::CountArrayTextSeparators(text, ';') == 0uz);
+	REQUIRE(PonyEngine::Serialization::CountArrayTextSeparators(std::string_view(), ',') == 0uz);
+
+	auto positions = std::array<std::size_t, 16>();
+	REQUIRE(PonyEngine::Serialization::FindArrayTextSeparators(text, ',', positions) == 9uz);
+	REQUIRE(std::ranges::equal(std::span(positions.data(), 9uz), std::array{ 1uz, 4uz, 8uz, 13uz, 19uz, 26uz, 34uz, 43uz, 53uz }));
+	REQUIRE(PonyEngine::Serialization::FindArrayTextSeparators(text, ',', std::span(positions.data(), 4uz)) == 4uz);
+	REQUIRE(positions[3] == 13uz);
+	REQUIRE(PonyEngine::Serialization::FindArrayTextSeparators(text, ';', positions) == 0uz);
+}
+
+TEST_CASE("Serialize array text parallel", "[Serialization][Array]")
+{
+	auto test = []<PonyEngine::Type::Arithmetic T>(const std::vector<T>& values)
+	{
+		auto expected = std::string(PonyEngine::Serialization::GetSerializedArrayTextLength<T>(values.size()), ' ');
+		const std::size_t expectedLength = PonyEngine::Serialization::SerializeArrayText<true, T>(values, expected) - expected.data();
+		expected.resize(expectedLength);
+
+		for (const std::size_t threadCount : { 1uz, 3uz, 8uz })
+		{
+			auto data = std::string(PonyEngine::Serialization::GetSerializedArrayTextLength<T>(values.size()), ' ');
+			const char* const serializedPoint = PonyEngine::Serialization::SerializeArrayTextParallel<T>(values, data, PonyEngine::Serialization::SerializedArrayTextSeparator, threadCount);
+			REQUIRE(std::string_view(data.data(), serializedPoint) == expected);
+
+			auto deserialized = std::vector<T>(values.size());
+			const char* const deserializedPoint = PonyEngine::Serialization::DeserializeArrayTextParallel<false, T>(data, deserialized, PonyEngine::Serialization::SerializedArrayTextSeparator, threadCount);
+			REQUIRE(deserialized == values);
+			REQUIRE(deserializedPoint == serializedPoint);
+		}
+	};
+
+	auto engine = std::mt19937_64(42ull);
+	auto intValues = std::vector<std::int32_t>(300000uz);
+	std::ranges::generate(intValues, [&] { return static_cast<std::int32_t>(engine()); });
+	auto uintValues = std::vector<std::uint8_t>(300000uz);
+	std::ranges::generate(uintValues, [&] { return static_cast<std::uint8_t>(engine()); });
+	auto floatValues = std::vector<float>(300000uz);
+	std::ranges::generate(floatValues, [&] { return std::uniform_real_distribution<float>(-1000.f, 1000.f)(engine); });
+	auto doubleValues = std::vector<double>(300000uz);
+	std::ranges::generate(doubleValues, [&] { return std::uniform_real_distribution<double>(-1.e10, 1.e10)(engine); });
+
+	test(intValues);
+	test(uintValues);
+	test(floatValues);
+	test(doubleValues);
+	test(std::vector<std::int32_t>{ 87, -74, 9, 201, 2341455 });
+	test(std::vector<double>{ 87., -74., 9., 201., 2341455., -46882.766 });
+	test(std::vector<std::int32_t>());
+}
+
+TEST_CASE("Serialize bool array text parallel", "[Serialization][Array]")
+{
+	constexpr std::size_t count = 1000000uz;
+	const auto values = std::make_unique<bool[]>(count);
+	for (std::size_t i = 0uz; i < count; ++i)
+	{
+		values[i] = i % 3uz == 0uz;
+	}
+
+	auto data = std::string(count, ' ');
+	const char* const serializedPoint = PonyEngine::Serialization::SerializeArrayTextParallel<bool>(std::span(values.get(), count), data, ',', 4uz);
+	REQUIRE(serializedPoint == data.data() + count);
+	REQUIRE(data.starts_with("100100"));
+
+	const auto deserialized = std::make_unique<bool[]>(count);
+	const char* const deserializedPoint = PonyEngine::Serialization::DeserializeArrayTextParallel<true, bool>(data, std::span(deserialized.get(), count), ',', 4uz);
+	REQUIRE(deserializedPoint == serializedPoint);
+	REQUIRE(std::ranges::equal(std::span(values.get(), count), std::span(deserialized.get(), count)));
+
+	data[777777uz] = '2';
+	try
+	{
+		[[maybe_unused]] const char* const point = PonyEngine::Serialization::DeserializeArrayTextParallel<true, bool>(data, std::span(deserialized.get(), count), ',', 4uz);
+		FAIL("No exception");
+	}
+	catch (const std::runtime_error& e)
+	{
+		REQUIRE(std::string_view(e.what()).contains("Index = '777777'"));
+	}
+}
+
+TEST_CASE("Deserialize array text parallel errors", "[Serialization][Array]")
+{
+	constexpr std::size_t count = 500000uz;
+	auto values = std::vector<std::int32_t>(count);
+	std::iota(values.begin(), values.end(), 0);
+	auto data = std::string(PonyEngine::Serialization::GetSerializedArrayTextLength<std::int32_t>(count), ' ');
+	data.resize(PonyEngine::Serialization::SerializeArrayTextParallel<std::int32_t>(values, data) - data.data());
+
+	auto deserialized = std::vector<std::int32_t>(count, -1);
+	const auto requireError = [&](const std::string& text, const std::size_t index)
+	{
+		try
+		{
+			[[maybe_unused]] const char* const point = PonyEngine::Serialization::DeserializeArrayTextParallel<false, std::int32_t>(text, deserialized, ',', 8uz);
+			FAIL("No exception");
+		}
+		catch (const std::runtime_error& e)
+		{
+			REQUIRE(std::string_view(e.what()).contains(std::format("Index = '{}'", index)));
+		}
+		REQUIRE(std::ranges::all_of(deserialized, [](const std::int32_t value) { return value == -1; }));
+	};
+
+	std::string invalid = data;
+	invalid[data.find(",400000,") + 3uz] = 'x';
+	requireError(invalid, 400000uz);
+	invalid[data.find(",100000,") + 1uz] = '-';
+	invalid[data.find(",100000,") + 2uz] = '-';
+	requireError(invalid, 100000uz);
+
+	invalid = data;
+	invalid.replace(data.find(",250000,"), 8uz, ",250000;");
+	requireError(invalid, 250000uz);
+
+	requireError(data.substr(0uz, data.find(",300000,")), 300000uz);
+	requireError(data.substr(0uz, data.rfind(',') + 1uz), count - 1uz);
+	requireError(std::string(), 0uz);
+
+	const std::string extra = data + ",1,2]";
+	const char* const end = PonyEngine::Serialization::DeserializeArrayTextParallel<true, std::int32_t>(extra, deserialized, ',', 8uz);
+	REQUIRE(end == extra.data() + data.size() + 1uz);
+	REQUIRE(deserialized == values);
+}
+
+TEST_CASE("Array text performance", "[Serialization][Array]")
+{
+	constexpr std::size_t count = 1000000uz;
+	auto engine = std::mt19937_64(7ull);
+	auto values = std::vector<float>(count);
+	std::ranges::generate(values, [&] { return std::uniform_real_distribution<float>(-1000.f, 1000.f)(engine); });
+	auto data = std::string(PonyEngine::Serialization::GetSerializedArrayTextLength<float>(count), ' ');
+	auto deserialized = std::vector<float>(count);
+
+#if PONY_ENGINE_TESTING_BENCHMARK
+	BENCHMARK("Serialize")
+	{
+		return PonyEngine::Serialization::SerializeArrayText<true, float>(values, data);
+	};
+
+	BENCHMARK("Serialize parallel")
+	{
+		return PonyEngine::Serialization::SerializeArrayTextParallel<float>(values, data);
+	};
+
+	BENCHMARK("Deserialize")
+	{
+		return PonyEngine::Serialization::DeserializeArrayText<true, float>(data, deserialized);
+	};
+
+	BENCHMARK("Deserialize parallel")
+	{
+		return PonyEngine::Serialization::DeserializeArrayTextParallel<true, float>(data, deserialized);
+	};
+#endif
+}
+
+TEST_CASE("ZigZag", "[Serialization][Array]")
+{
+	STATIC_REQUIRE(PonyEngine::Serialization::ZigZagEncode(0) == 0u);
+	STATIC_REQUIRE(PonyEngine::Serialization::ZigZagEncode(-1) == 1u);
+	STATIC_REQUIRE(PonyEngine::Serialization::ZigZagEncode(1) == 2u);
+	STATIC_REQUIRE(PonyEngine::Serialization::ZigZagEncode(-2) == 3u);
+	STATIC_REQUIRE(PonyEngine::Serialization::ZigZagEncode(std::numeric_limits<std::int8_t>::min()) == 255u);
+	STATIC_REQUIRE(PonyEngine::Serialization::ZigZagEncode(std::numeric_limits<std::int64_t>::max()) == std::numeric_limits<std::uint64_t>::max() - 1ull);
+	STATIC_REQUIRE(PonyEngine::Serialization::ZigZagDecode(3u) == -2);
+	STATIC_REQUIRE(PonyEngine::Serialization::ZigZagDecode(std::uint8_t{255}) == std::numeric_limits<std::int8_t>::min());
+
+	for (std::int32_t i = -1000; i <= 1000; ++i)
+	{
+		REQUIRE(PonyEngine::Serialization::ZigZagDecode(PonyEngine::Serialization::ZigZagEncode(i)) == i);
+	}
+}
+
+TEST_CASE("Serialize array varint", "[Serialization][Array]")
+{
+	STATIC_REQUIRE(PonyEngine::Serialization::MaxVarintSize<std::uint8_t> == 2uz);
+	STATIC_REQUIRE(PonyEngine::Serialization::MaxVarintSize<std::uint32_t> == 5uz);
+	STATIC_REQUIRE(PonyEngine::Serialization::MaxVarintSize<std::int64_t> == 10uz);
+
+	const auto values = std::vector<std::uint32_t>{ 0u, 1u, 127u, 128u, 300u, 16384u, std::numeric_limits<std::uint32_t>::max() };
+	REQUIRE(PonyEngine::Serialization::GetSerializedArrayVarintSize<std::uint32_t>(values) == 1uz + 1uz + 1uz + 2uz + 2uz + 3uz + 5uz);
+	auto data = std::vector<std::byte>(PonyEngine::Serialization::GetSerializedArrayVarintSize<std::uint32_t>(values));
+	REQUIRE(PonyEngine::Serialization::SerializeArrayVarint<std::uint32_t>(values, data) == data.data() + data.size());
+	REQUIRE(data[3] == std::byte{0x80});
+	REQUIRE(data[4] == std::byte{0x01});
+	REQUIRE(data[5] == std::byte{0xAC});
+	REQUIRE(data[6] == std::byte{0x02});
+	auto deserialized = std::vector<std::uint32_t>(values.size());
+	REQUIRE(PonyEngine::Serialization::DeserializeArrayVarint<std::uint32_t>(data, deserialized) == data.data() + data.size());
+	REQUIRE(deserialized == values);
+
+	const auto signedValues = std::vector<std::int16_t>{ 0, -1, 63, -64, 64, std::numeric_limits<std::int16_t>::min(), std::numeric_limits<std::int16_t>::max() };
+	auto signedData = std::vector<std::byte>(PonyEngine::Serialization::GetSerializedArrayVarintSize<std::int16_t>(signedValues));
+	REQUIRE(signedData.size() == 1uz + 1uz + 1uz + 1uz + 2uz + 3uz + 3uz);
+	PonyEngine::Serialization::SerializeArrayVarint<std::int16_t>(signedValues, signedData);
+	auto signedDeserialized = std::vector<std::int16_t>(signedValues.size());
+	PonyEngine::Serialization::DeserializeArrayVarint<std::int16_t>(signedData, signedDeserialized);
+	REQUIRE(signedDeserialized == signedValues);
+
+	auto small = std::vector<std::byte>(data.size() - 1uz);
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::SerializeArrayVarint<std::uint32_t>(values, small), std::invalid_argument);
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::DeserializeArrayVarint<std::uint32_t>(std::span<const std::byte>(data).first(data.size() - 1uz), deserialized), std::invalid_argument);
+	const auto overflow = std::vector<std::byte>{ std::byte{0xFF}, std::byte{0xFF}, std::byte{0x7F} };
+	auto byteValue = std::array<std::uint8_t, 1>();
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::DeserializeArrayVarint<std::uint8_t>(overflow, byteValue), std::invalid_argument);
+}
+
+TEST_CASE("Serialize array delta", "[Serialization][Array]")
+{
+	auto values = std::vector<std::uint64_t>(1000uz);
+	std::uint64_t value = 1700000000000ull;
+	for (std::size_t i = 0uz; i < values.size(); ++i)
+	{
+		value += 16ull + i % 3uz;
+		values[i] = value;
+	}
+	values[500] = 5ull;
+
+	auto data = std::vector<std::byte>(PonyEngine::Serialization::GetSerializedArrayDeltaSize<std::uint64_t>(values));
+	REQUIRE(data.size() < values.size() * 2uz + 32uz);
+	REQUIRE(PonyEngine::Serialization::SerializeArrayDelta<std::uint64_t>(values, data) == data.data() + data.size());
+	auto deserialized = std::vector<std::uint64_t>(values.size());
+	REQUIRE(PonyEngine::Serialization::DeserializeArrayDelta<std::uint64_t>(data, deserialized) == data.data() + data.size());
+	REQUIRE(deserialized == values);
+
+	const auto extremes = std::vector<std::int32_t>{ std::numeric_limits<std::int32_t>::max(), std::numeric_limits<std::int32_t>::min(), 0, -1, std::numeric_limits<std::int32_t>::max() };
+	auto extremeData = std::vector<std::byte>(PonyEngine::Serialization::GetSerializedArrayDeltaSize<std::int32_t>(extremes));
+	PonyEngine::Serialization::SerializeArrayDelta<std::int32_t>(extremes, extremeData);
+	auto extremeDeserialized = std::vector<std::int32_t>(extremes.size());
+	PonyEngine::Serialization::DeserializeArrayDelta<std::int32_t>(extremeData, extremeDeserialized);
+	REQUIRE(extremeDeserialized == extremes);
+
+	auto small = std::vector<std::byte>(data.size() - 1uz);
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::SerializeArrayDelta<std::uint64_t>(values, small), std::invalid_argument);
+}
+
+TEST_CASE("Serialize array delta of delta", "[Serialization][Array]")
+{
+	auto values = std::vector<std::int64_t>(1000uz);
+	for (std::size_t i = 0uz; i < values.size(); ++i)
+	{
+		values[i] = 1700000000000ll + static_cast<std::int64_t>(i) * 16667ll;
+	}
+	values[700] += 3ll;
+
+	auto data = std::vector<std::byte>(PonyEngine::Serialization::GetSerializedArrayDeltaOfDeltaSize<std::int64_t>(values));
+	REQUIRE(data.size() == 6uz + 3uz + 998uz);
+	REQUIRE(PonyEngine::Serialization::SerializeArrayDeltaOfDelta<std::int64_t>(values, data) == data.data() + data.size());
+	auto deserialized = std::vector<std::int64_t>(values.size());
+	REQUIRE(PonyEngine::Serialization::DeserializeArrayDeltaOfDelta<std::int64_t>(data, deserialized) == data.data() + data.size());
+	REQUIRE(deserialized == values);
+
+	const auto extremes = std::vector<std::uint16_t>{ 0u, 65535u, 1u, 65534u, 2u };
+	auto extremeData = std::vector<std::byte>(PonyEngine::Serialization::GetSerializedArrayDeltaOfDeltaSize<std::uint16_t>(extremes));
+	PonyEngine::Serialization::SerializeArrayDeltaOfDelta<std::uint16_t>(extremes, extremeData);
+	auto extremeDeserialized = std::vector<std::uint16_t>(extremes.size());
+	PonyEngine::Serialization::DeserializeArrayDeltaOfDelta<std::uint16_t>(extremeData, extremeDeserialized);
+	REQUIRE(extremeDeserialized == extremes);
+
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::DeserializeArrayDeltaOfDelta<std::int64_t>(std::span<const std::byte>(data).first(data.size() - 1uz), deserialized), std::invalid_argument);
+}
+
+TEST_CASE("Serialize array frame of reference", "[Serialization][Array]")
+{
+	auto values = std::vector<std::int32_t>(1001uz);
+	for (std::size_t i = 0uz; i < values.size(); ++i)
+	{
+		values[i] = -500 + static_cast<std::int32_t>(i * 7919uz % 1000uz);
+	}
+
+	auto data = std::vector<std::byte>(PonyEngine::Serialization::GetSerializedArrayFrameOfReferenceSize<std::int32_t>(values));
+	REQUIRE(data.size() == 1uz + 4uz + (1001uz * 10uz + 7uz) / 8uz);
+	REQUIRE(PonyEngine::Serialization::SerializeArrayFrameOfReference<std::int32_t>(values, data) == data.data() + data.size());
+	auto deserialized = std::vector<std::int32_t>(values.size());
+	REQUIRE(PonyEngine::Serialization::DeserializeArrayFrameOfReference<std::int32_t>(data, deserialized) == data.data() + data.size());
+	REQUIRE(deserialized == values);
+
+	const auto same = std::vector<std::uint16_t>(100uz, 42u);
+	auto sameData = std::vector<std::byte>(PonyEngine::Serialization::GetSerializedArrayFrameOfReferenceSize<std::uint16_t>(same));
+	REQUIRE(sameData.size() == 3uz);
+	PonyEngine::Serialization::SerializeArrayFrameOfReference<std::uint16_t>(same, sameData);
+	auto sameDeserialized = std::vector<std::uint16_t>(same.size());
+	PonyEngine::Serialization::DeserializeArrayFrameOfReference<std::uint16_t>(sameData, sameDeserialized);
+	REQUIRE(sameDeserialized == same);
+
+	const auto wide = std::vector<std::int64_t>{ std::numeric_limits<std::int64_t>::min(), 0ll, std::numeric_limits<std::int64_t>::max(), -1ll, 1ll };
+	auto wideData = std::vector<std::byte>(PonyEngine::Serialization::GetSerializedArrayFrameOfReferenceSize<std::int64_t>(wide));
+	REQUIRE(wideData.size() == 1uz + 8uz + 40uz);
+	PonyEngine::Serialization::SerializeArrayFrameOfReference<std::int64_t>(wide, wideData);
+	auto wideDeserialized = std::vector<std::int64_t>(wide.size());
+	PonyEngine::Serialization::DeserializeArrayFrameOfReference<std::int64_t>(wideData, wideDeserialized);
+	REQUIRE(wideDeserialized == wide);
+
+	auto small = std::vector<std::byte>(data.size() - 1uz);
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::SerializeArrayFrameOfReference<std::int32_t>(values, small), std::invalid_argument);
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::DeserializeArrayFrameOfReference<std::int32_t>(std::span<const std::byte>(data).first(data.size() - 1uz), deserialized), std::invalid_argument);
+	data[0] = std::byte{33};
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::DeserializeArrayFrameOfReference<std::int32_t>(data, deserialized), std::invalid_argument);
+}
+
+TEST_CASE("Serialize array stream VByte", "[Serialization][Array]")
+{
+	auto engine = std::mt19937(11u);
+	auto values = std::vector<std::uint32_t>(1003uz);
+	std::ranges::generate(values, [&] { return engine() >> std::uniform_int_distribution<std::uint32_t>(0u, 31u)(engine); });
+	values[0] = 0u;
+	values[1] = std::numeric_limits<std::uint32_t>::max();
+
+	auto data = std::vector<std::byte>(PonyEngine::Serialization::GetSerializedArrayStreamVByteSize<std::uint32_t>(values));
+	REQUIRE(PonyEngine::Serialization::SerializeArrayStreamVByte<std::uint32_t>(values, data) == data.data() + data.size());
+	auto deserialized = std::vector<std::uint32_t>(values.size());
+	REQUIRE(PonyEngine::Serialization::DeserializeArrayStreamVByte<std::uint32_t>(data, deserialized) == data.data() + data.size());
+	REQUIRE(deserialized == values);
+
+	auto signedValues = std::vector<std::int32_t>(257uz);
+	std::ranges::generate(signedValues, [&] { return static_cast<std::int32_t>(engine()) >> std::uniform_int_distribution<std::int32_t>(0, 31)(engine); });
+	signedValues[0] = std::numeric_limits<std::int32_t>::min();
+	auto signedData = std::vector<std::byte>(PonyEngine::Serialization::GetSerializedArrayStreamVByteSize<std::int32_t>(signedValues));
+	PonyEngine::Serialization::SerializeArrayStreamVByte<std::int32_t>(signedValues, signedData);
+	auto signedDeserialized = std::vector<std::int32_t>(signedValues.size());
+	PonyEngine::Serialization::DeserializeArrayStreamVByte<std::int32_t>(signedData, signedDeserialized);
+	REQUIRE(signedDeserialized == signedValues);
+
+	auto small = std::vector<std::byte>(data.size() - 1uz);
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::SerializeArrayStreamVByte<std::uint32_t>(values, small), std::invalid_argument);
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::DeserializeArrayStreamVByte<std::uint32_t>(std::span<const std::byte>(data).first(data.size() - 1uz), deserialized), std::invalid_argument);
+}
+
+TEST_CASE("Array integer encoding performance", "[Serialization][Array]")
+{
+	constexpr std::size_t count = 1000000uz;
+	auto engine = std::mt19937(7u);
+	auto values = std::vector<std::uint32_t>(count);
+	std::ranges::generate(values, [&] { return std::uniform_int_distribution<std::uint32_t>(0u, 100000u)(engine); });
+	auto binaryData = std::vector<std::byte>(count * sizeof(std::uint32_t));
+	PonyEngine::Serialization::SerializeArrayBinary(std::span<const std::uint32_t>(values), std::span<std::byte>(binaryData));
+	auto varintData = std::vector<std::byte>(PonyEngine::Serialization::GetSerializedArrayVarintSize<std::uint32_t>(values));
+	PonyEngine::Serialization::SerializeArrayVarint<std::uint32_t>(values, varintData);
+	auto streamVByteData = std::vector<std::byte>(PonyEngine::Serialization::GetSerializedArrayStreamVByteSize<std::uint32_t>(values));
+	PonyEngine::Serialization::SerializeArrayStreamVByte<std::uint32_t>(values, streamVByteData);
+	auto frameOfReferenceData = std::vector<std::byte>(PonyEngine::Serialization::GetSerializedArrayFrameOfReferenceSize<std::uint32_t>(values));
+	PonyEngine::Serialization::SerializeArrayFrameOfReference<std::uint32_t>(values, frameOfReferenceData);
+	auto deserialized = std::vector<std::uint32_t>(count);
+
+#if PONY_ENGINE_TESTING_BENCHMARK
+	BENCHMARK("Deserialize binary")
+	{
+		return PonyEngine::Serialization::DeserializeArrayBinary(std::span<const std::byte>(binaryData), std::span<std::uint32_t>(deserialized));
+	};
+
+	BENCHMARK("Deserialize varint")
+	{
+		return PonyEngine::Serialization::DeserializeArrayVarint<std::uint32_t>(varintData, deserialized);
+	};
+
+	BENCHMARK("Deserialize stream VByte")
+	{
+		return PonyEngine::Serialization::DeserializeArrayStreamVByte<std::uint32_t>(streamVByteData, deserialized);
+	};
+
+	BENCHMARK("Deserialize frame of reference")
+	{
+		return PonyEngine::Serialization::DeserializeArrayFrameOfReference<std::uint32_t>(frameOfReferenceData, deserialized);
+	};
+#endif
+}
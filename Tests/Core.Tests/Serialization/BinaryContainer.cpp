@@ -0,0 +1,244 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+import std;
+
+import PonyEngine.Meta;
+import PonyEngine.Serialization;
+
+namespace
+{
+	enum class TestEnum : std::uint16_t
+	{
+		First = 0x0102,
+		Second = 0x0304
+	};
+
+	struct TestPair final
+	{
+		std::uint16_t first;
+		std::uint16_t second;
+	};
+
+	std::vector<std::byte> WriteContainer(const PonyEngine::Serialization::BinaryContainerWriter& writer)
+	{
+		auto data = std::vector<std::byte>(writer.Size());
+		REQUIRE(writer.Write(data) == data.data() + data.size());
+
+		return data;
+	}
+
+	void FlipEndian(std::span<std::byte> data)
+	{
+		data[6] = data[6] == std::byte{0} ? std::byte{1} : std::byte{0};
+	}
+}
+
+TEST_CASE("Binary container round trip", "[Serialization][BinaryContainer]")
+{
+	const auto ints = std::vector<std::int32_t>{ 1, -2, 3, -4, 5 };
+	const auto doubles = std::vector<double>{ 1.5, -2.25, 1e+100 };
+	const auto enums = std::vector<TestEnum>{ TestEnum::First, TestEnum::Second };
+	const auto text = std::string_view("Pony");
+
+	auto writer = PonyEngine::Serialization::BinaryContainerWriter(PonyEngine::Meta::Version(1u, 2u, 3u, 4u));
+	writer.AddSection(1ull, std::span<const std::int32_t>(ints));
+	writer.AddSection(2ull, std::span<const double>(doubles), 64uz);
+	writer.AddSection(3ull, std::span<const TestEnum>(enums));
+	writer.AddSection(4ull, std::span<const char>(text));
+	writer.AddSection(5ull, std::span<const float>());
+	const auto data = WriteContainer(writer);
+
+	const auto reader = PonyEngine::Serialization::BinaryContainerReader(data);
+	REQUIRE(reader.Version() == PonyEngine::Meta::Version(1u, 2u, 3u, 4u));
+	REQUIRE(reader.Endian() == std::endian::native);
+	REQUIRE(reader.Size() == data.size());
+	REQUIRE(reader.SectionCount() == 5uz);
+	REQUIRE(reader.SectionID(0uz) == 1ull);
+	REQUIRE(reader.SectionID(4uz) == 5ull);
+	REQUIRE(reader.HasSection(3ull));
+	REQUIRE(!reader.HasSection(6ull));
+
+	REQUIRE(std::ranges::equal(reader.View<std::int32_t>(1ull), ints));
+	REQUIRE(std::ranges::equal(reader.View<double>(2ull), doubles));
+	REQUIRE(std::ranges::equal(reader.View<TestEnum>(3ull), enums));
+	REQUIRE(std::ranges::equal(reader.View<char>(4ull), text));
+	REQUIRE(reader.View<float>(5ull).empty());
+	REQUIRE((reader.SectionData(2ull).data() - data.data()) % 64 == 0);
+
+	for (std::size_t i = 0uz; i < reader.SectionCount(); ++i)
+	{
+		const std::span<const std::byte> section = reader.SectionData(reader.SectionID(i));
+		REQUIRE(section.data() >= data.data());
+		REQUIRE(section.data() + section.size() <= data.data() + data.size());
+	}
+}
+
+TEST_CASE("Binary container zero copy", "[Serialization][BinaryContainer]")
+{
+	const auto values = std::vector<std::uint64_t>{ 10ull, 20ull, 30ull };
+	auto writer = PonyEngine::Serialization::BinaryContainerWriter(PonyEngine::Meta::Version(1u));
+	writer.AddSection(7ull, std::span<const std::uint64_t>(values));
+	const auto data = WriteContainer(writer);
+
+	const auto reader = PonyEngine::Serialization::BinaryContainerReader(data);
+	REQUIRE(reader.CanView<std::uint64_t>(7ull));
+	REQUIRE(!reader.CanView<std::uint32_t>(7ull));
+	REQUIRE(!reader.CanView<std::uint64_t>(8ull));
+
+	auto buffer = std::vector<std::uint64_t>();
+	const std::span<const std::uint64_t> read = reader.Read(7ull, buffer);
+	REQUIRE(buffer.empty());
+	REQUIRE(reinterpret_cast<const std::byte*>(read.data()) == reader.SectionData(7ull).data());
+	REQUIRE(std::ranges::equal(read, values));
+}
+
+TEST_CASE("Binary container misaligned", "[Serialization][BinaryContainer]")
+{
+	const auto values = std::vector<std::uint32_t>{ 0x01020304u, 0x05060708u };
+	auto writer = PonyEngine::Serialization::BinaryContainerWriter(PonyEngine::Meta::Version(1u));
+	writer.AddSection(1ull, std::span<const std::uint32_t>(values));
+	const auto data = WriteContainer(writer);
+
+	auto shifted = std::vector<std::byte>(data.size() + 1uz);
+	std::ranges::copy(data, shifted.begin() + 1);
+	const auto reader = PonyEngine::Serialization::BinaryContainerReader(std::span<const std::byte>(shifted).subspan(1uz));
+	REQUIRE(!reader.CanView<std::uint32_t>(1ull));
+	REQUIRE_THROWS_AS(reader.View<std::uint32_t>(1ull), std::invalid_argument);
+
+	auto buffer = std::vector<std::uint32_t>();
+	REQUIRE(std::ranges::equal(reader.Read(1ull, buffer), values));
+	REQUIRE(std::ranges::equal(buffer, values));
+}
+
+TEST_CASE("Binary container foreign byte order", "[Serialization][BinaryContainer]")
+{
+	const auto ints = std::vector<std::uint32_t>{ 0x01020304u, 0xA0B0C0D0u };
+	const auto floats = std::vector<float>{ 1.f, -0.5f, 3.25f };
+	const auto enums = std::vector<TestEnum>{ TestEnum::First, TestEnum::Second };
+	const auto bytes = std::vector<std::uint8_t>{ 1u, 2u, 3u };
+	auto writer = PonyEngine::Serialization::BinaryContainerWriter(PonyEngine::Meta::Version(2u));
+	writer.AddSection(1ull, std::span<const std::uint32_t>(ints));
+	writer.AddSection(2ull, std::span<const float>(floats));
+	writer.AddSection(3ull, std::span<const TestEnum>(enums));
+	writer.AddSection(4ull, std::span<const std::uint8_t>(bytes));
+	auto data = WriteContainer(writer);
+
+	FlipEndian(data);
+	{
+		const auto reader = PonyEngine::Serialization::BinaryContainerReader(data);
+		for (std::size_t i = 0uz; i < reader.SectionCount(); ++i)
+		{
+			const std::span<const std::byte> section = reader.SectionData(reader.SectionID(i));
+			const std::size_t elementSize = i == 2uz ? sizeof(TestEnum) : i == 3uz ? 1uz : 4uz;
+			auto* const begin = const_cast<std::byte*>(section.data());
+			for (std::size_t j = 0uz; j < section.size(); j += elementSize)
+			{
+				std::ranges::reverse(begin + j, begin + j + elementSize);
+			}
+		}
+	}
+
+	const auto reader = PonyEngine::Serialization::BinaryContainerReader(data);
+	REQUIRE(reader.Endian() != std::endian::native);
+	REQUIRE(!reader.CanView<std::uint32_t>(1ull));
+	REQUIRE(!reader.CanView<float>(2ull));
+	REQUIRE(reader.CanView<std::uint8_t>(4ull));
+	REQUIRE(!reader.CanView<TestPair>(1ull));
+	REQUIRE_THROWS_AS(reader.View<TestPair>(1ull), std::invalid_argument);
+	auto pairBuffer = std::vector<TestPair>();
+	REQUIRE_THROWS_AS(reader.Read(1ull, pairBuffer), std::invalid_argument);
+
+	auto intBuffer = std::vector<std::uint32_t>();
+	REQUIRE(std::ranges::equal(reader.Read(1ull, intBuffer), ints));
+	auto floatBuffer = std::vector<float>();
+	REQUIRE(std::ranges::equal(reader.Read(2ull, floatBuffer), floats));
+	auto enumBuffer = std::vector<TestEnum>();
+	REQUIRE(std::ranges::equal(reader.Read(3ull, enumBuffer), enums));
+	auto byteBuffer = std::vector<std::uint8_t>();
+	REQUIRE(std::ranges::equal(reader.Read(4ull, byteBuffer), bytes));
+	REQUIRE(byteBuffer.empty());
+}
+
+TEST_CASE("Binary container invalid", "[Serialization][BinaryContainer]")
+{
+	const auto values = std::vector<std::uint32_t>{ 1u, 2u, 3u };
+	auto writer = PonyEngine::Serialization::BinaryContainerWriter(PonyEngine::Meta::Version(1u));
+	writer.AddSection(1ull, std::span<const std::uint32_t>(values));
+	REQUIRE_THROWS_AS(writer.AddSection(1ull, std::span<const std::uint32_t>(values)), std::invalid_argument);
+	REQUIRE_THROWS_AS(writer.AddSection(2ull, std::span<const std::uint32_t>(values), 3uz), std::invalid_argument);
+	REQUIRE_THROWS_AS(writer.AddSection(2ull, std::as_bytes(std::span<const std::uint32_t>(values)), 5uz, 4uz), std::invalid_argument);
+	auto small = std::vector<std::byte>(writer.Size() - 1uz);
+	REQUIRE_THROWS_AS(writer.Write(small), std::invalid_argument);
+	const auto data = WriteContainer(writer);
+
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::BinaryContainerReader(std::span<const std::byte>()), std::invalid_argument);
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::BinaryContainerReader(std::span<const std::byte>(data).first(data.size() - 1uz)), std::invalid_argument);
+
+	auto corrupted = data;
+	corrupted[0] = std::byte{'X'};
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::BinaryContainerReader(corrupted), std::invalid_argument);
+
+	corrupted = data;
+	corrupted[4] = std::byte{2};
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::BinaryContainerReader(corrupted), std::invalid_argument);
+
+	corrupted = data;
+	corrupted[6] = std::byte{2};
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::BinaryContainerReader(corrupted), std::invalid_argument);
+
+	corrupted = data;
+	corrupted[24] = std::byte{100};
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::BinaryContainerReader(corrupted), std::invalid_argument);
+
+	corrupted = data;
+	corrupted[48 + 16] = std::byte{100};
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::BinaryContainerReader(corrupted), std::invalid_argument);
+
+	corrupted = data;
+	corrupted[48 + 8] = std::byte{1};
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::BinaryContainerReader(corrupted), std::invalid_argument);
+
+	const auto reader = PonyEngine::Serialization::BinaryContainerReader(data);
+	REQUIRE_THROWS_AS(reader.SectionData(2ull), std::out_of_range);
+	REQUIRE_THROWS_AS(reader.View<std::uint32_t>(2ull), std::out_of_range);
+	REQUIRE_THROWS_AS(reader.View<std::uint64_t>(1ull), std::invalid_argument);
+	auto buffer = std::vector<std::uint16_t>();
+	REQUIRE_THROWS_AS(reader.Read(1ull, buffer), std::invalid_argument);
+}
+
+TEST_CASE("Binary container load", "[Serialization][BinaryContainer]")
+{
+	auto values = std::vector<float>(1000000uz);
+	std::iota(values.begin(), values.end(), 0.f);
+	auto writer = PonyEngine::Serialization::BinaryContainerWriter(PonyEngine::Meta::Version(1u));
+	for (std::uint64_t i = 0ull; i < 16ull; ++i)
+	{
+		writer.AddSection(i, std::span<const float>(values));
+	}
+	const auto data = WriteContainer(writer);
+
+#if PONY_ENGINE_TESTING_BENCHMARK
+	BENCHMARK("Open and view")
+	{
+		const auto reader = PonyEngine::Serialization::BinaryContainerReader(data);
+		return reader.View<float>(15ull).size();
+	};
+
+	auto copy = std::vector<std::byte>(data.size());
+	BENCHMARK("Copy")
+	{
+		std::ranges::copy(data, copy.begin());
+		return copy.size();
+	};
+#endif
+}
@@ -0,0 +1,276 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+import std;
+
+import PonyEngine.Serialization;
+
+namespace
+{
+	std::vector<std::byte> MakeRandom(const std::size_t size, const std::uint32_t seed = 0u)
+	{
+		auto engine = std::mt19937(seed);
+		auto data = std::vector<std::byte>(size);
+		for (std::byte& value : data)
+		{
+			value = static_cast<std::byte>(engine());
+		}
+
+		return data;
+	}
+
+	std::vector<std::byte> MakeText(const std::size_t size)
+	{
+		constexpr std::array<std::string_view, 8> words = { "pony ", "engine ", "render ", "frame ", "mesh ", "shader ", "texture ", "buffer\n" };
+
+		auto engine = std::mt19937(42u);
+		auto data = std::vector<std::byte>();
+		data.reserve(size + 8uz);
+		while (data.size() < size)
+		{
+			const std::string_view word = words[engine() % words.size()];
+			for (const char c : word)
+			{
+				data.push_back(static_cast<std::byte>(c));
+			}
+		}
+		data.resize(size);
+
+		return data;
+	}
+
+	std::vector<std::byte> CompressBlock(const std::span<const std::byte> source)
+	{
+		auto compressed = std::vector<std::byte>(PonyEngine::Serialization::GetMaxCompressedBlockSize(source.size()));
+		compressed.resize(PonyEngine::Serialization::CompressBlock(source, compressed) - compressed.data());
+
+		return compressed;
+	}
+
+	std::vector<std::byte> DecompressBlock(const std::span<const std::byte> source, const std::size_t size)
+	{
+		auto decompressed = std::vector<std::byte>(size);
+		REQUIRE(PonyEngine::Serialization::DecompressBlock(source, decompressed) == decompressed.data() + decompressed.size());
+
+		return decompressed;
+	}
+
+	std::vector<std::byte> CompressFrame(const std::span<const std::byte> source, const std::size_t blockSize, const std::size_t threadCount)
+	{
+		auto compressed = std::vector<std::byte>(PonyEngine::Serialization::GetMaxCompressedFrameSize(source.size(), blockSize));
+		compressed.resize(PonyEngine::Serialization::CompressFrame(source, compressed, blockSize, threadCount) - compressed.data());
+
+		return compressed;
+	}
+
+	std::vector<std::byte> DecompressFrame(const std::span<const std::byte> source, const std::size_t threadCount)
+	{
+		auto decompressed = std::vector<std::byte>(PonyEngine::Serialization::GetDecompressedFrameSize(source));
+		REQUIRE(PonyEngine::Serialization::DecompressFrame(source, decompressed, threadCount) == decompressed.data() + decompressed.size());
+
+		return decompressed;
+	}
+}
+
+TEST_CASE("Compress block", "[Serialization][Compression]")
+{
+	REQUIRE(PonyEngine::Serialization::GetMaxCompressedBlockSize(0uz) == 16uz);
+	REQUIRE(PonyEngine::Serialization::GetMaxCompressedBlockSize(1000uz) == 1019uz);
+
+	for (const std::size_t size : { 0uz, 1uz, 5uz, 12uz, 13uz, 100uz, 4096uz, 100000uz })
+	{
+		const auto random = MakeRandom(size);
+		const auto text = MakeText(size);
+		const auto zeros = std::vector<std::byte>(size);
+
+		const auto randomCompressed = CompressBlock(random);
+		const auto textCompressed = CompressBlock(text);
+		const auto zerosCompressed = CompressBlock(zeros);
+		REQUIRE(DecompressBlock(randomCompressed, size) == random);
+		REQUIRE(DecompressBlock(textCompressed, size) == text);
+		REQUIRE(DecompressBlock(zerosCompressed, size) == zeros);
+
+		if (size >= 4096uz)
+		{
+			REQUIRE(textCompressed.size() < size / 2uz);
+			REQUIRE(zerosCompressed.size() < size / 100uz);
+		}
+	}
+}
+
+TEST_CASE("Compress block patterns", "[Serialization][Compression]")
+{
+	for (const std::size_t period : { 1uz, 2uz, 3uz, 7uz, 8uz, 9uz, 31uz, 1000uz, 70000uz })
+	{
+		const auto pattern = MakeRandom(period, static_cast<std::uint32_t>(period));
+		auto data = std::vector<std::byte>(200000uz);
+		for (std::size_t i = 0uz; i < data.size(); ++i)
+		{
+			data[i] = pattern[i % period];
+		}
+
+		REQUIRE(DecompressBlock(CompressBlock(data), data.size()) == data);
+	}
+}
+
+TEST_CASE("Compress block errors", "[Serialization][Compression]")
+{
+	const auto text = MakeText(10000uz);
+	const auto compressed = CompressBlock(text);
+
+	auto small = std::vector<std::byte>(100uz);
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::CompressBlock(text, small), std::invalid_argument);
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::DecompressBlock(compressed, small), std::invalid_argument);
+
+	auto decompressed = std::vector<std::byte>(text.size());
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::DecompressBlock(std::span(compressed).first(compressed.size() / 2uz), decompressed), std::invalid_argument);
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::DecompressBlock(std::span<const std::byte>(), decompressed), std::invalid_argument);
+
+	const auto badOffset = std::array<std::byte, 4>{ std::byte{0x10}, std::byte{'A'}, std::byte{0x05}, std::byte{0x00} };
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::DecompressBlock(badOffset, decompressed), std::invalid_argument);
+	const auto zeroOffset = std::array<std::byte, 4>{ std::byte{0x10}, std::byte{'A'}, std::byte{0x00}, std::byte{0x00} };
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::DecompressBlock(zeroOffset, decompressed), std::invalid_argument);
+
+	for (std::size_t i = 0uz; i < 1000uz; ++i)
+	{
+		auto corrupted = compressed;
+		corrupted[(i * 7919uz) % corrupted.size()] ^= static_cast<std::byte>(i | 1uz);
+		try
+		{
+			[[maybe_unused]] const std::byte* const end = PonyEngine::Serialization::DecompressBlock(corrupted, decompressed);
+		}
+		catch (const std::invalid_argument&)
+		{
+		}
+	}
+}
+
+TEST_CASE("Compress frame", "[Serialization][Compression]")
+{
+	constexpr std::size_t blockSize = PonyEngine::Serialization::MinCompressionBlockSize;
+
+	for (const std::size_t size : { 0uz, 1uz, 1000uz, blockSize, blockSize + 1uz, blockSize * 5uz + 123uz })
+	{
+		auto data = MakeText(size);
+		if (size > blockSize)
+		{
+			const auto random = MakeRandom(blockSize);
+			std::ranges::copy(random, data.begin());
+		}
+
+		const auto compressed = CompressFrame(data, blockSize, 1uz);
+		REQUIRE(compressed.size() <= PonyEngine::Serialization::GetMaxCompressedFrameSize(size, blockSize));
+		REQUIRE(PonyEngine::Serialization::GetDecompressedFrameSize(compressed) == size);
+		REQUIRE(DecompressFrame(compressed, 1uz) == data);
+		REQUIRE(DecompressFrame(compressed, 4uz) == data);
+		REQUIRE(CompressFrame(data, blockSize, 4uz) == compressed);
+	}
+}
+
+TEST_CASE("Compress frame errors", "[Serialization][Compression]")
+{
+	constexpr std::size_t blockSize = PonyEngine::Serialization::MinCompressionBlockSize;
+	const auto text = MakeText(blockSize * 3uz);
+	const auto compressed = CompressFrame(text, blockSize, 2uz);
+	auto decompressed = std::vector<std::byte>(text.size());
+
+	auto output = std::vector<std::byte>(PonyEngine::Serialization::GetMaxCompressedFrameSize(text.size(), blockSize));
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::CompressFrame(text, output, 1000uz), std::invalid_argument);
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::CompressFrame(text, std::span(output).first(100uz), blockSize), std::invalid_argument);
+
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::GetDecompressedFrameSize(std::span(compressed).first(8uz)), std::invalid_argument);
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::DecompressFrame(compressed, std::span(decompressed).first(100uz)), std::invalid_argument);
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::DecompressFrame(std::span(compressed).first(compressed.size() - 1uz), decompressed), std::invalid_argument);
+
+	auto badMagic = compressed;
+	badMagic[0] = std::byte{'X'};
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::GetDecompressedFrameSize(badMagic), std::invalid_argument);
+
+	auto badBlock = compressed;
+	badBlock[compressed.size() / 2uz] ^= std::byte{0x40};
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::DecompressFrame(badBlock, decompressed), std::invalid_argument);
+
+	auto badHash = compressed;
+	badHash.back() ^= std::byte{1};
+	REQUIRE_THROWS_AS(PonyEngine::Serialization::DecompressFrame(badHash, decompressed), std::invalid_argument);
+}
+
+TEST_CASE("Compression frame writer", "[Serialization][Compression]")
+{
+	constexpr std::size_t blockSize = PonyEngine::Serialization::MinCompressionBlockSize;
+	const auto text = MakeText(blockSize * 2uz + 5000uz);
+
+	auto output = std::vector<std::byte>{ std::byte{1}, std::byte{2} };
+	auto writer = PonyEngine::Serialization::CompressionFrameWriter(output, blockSize);
+	for (std::size_t offset = 0uz; offset < text.size(); offset += 777uz)
+	{
+		writer.Write(std::span(text).subspan(offset, std::min(777uz, text.size() - offset)));
+	}
+	REQUIRE(writer.ContentSize() == text.size());
+	writer.Finish();
+	REQUIRE_THROWS_AS(writer.Write(text), std::logic_error);
+	REQUIRE_THROWS_AS(writer.Finish(), std::logic_error);
+
+	REQUIRE(output[0] == std::byte{1});
+	REQUIRE(output[1] == std::byte{2});
+	const auto frame = std::span<const std::byte>(output).subspan(2uz);
+	REQUIRE(std::ranges::equal(frame, CompressFrame(text, blockSize, 1uz)));
+	REQUIRE(DecompressFrame(frame, 2uz) == text);
+
+	auto emptyOutput = std::vector<std::byte>();
+	auto emptyWriter = PonyEngine::Serialization::CompressionFrameWriter(emptyOutput);
+	emptyWriter.Finish();
+	REQUIRE(DecompressFrame(emptyOutput, 1uz).empty());
+}
+
+TEST_CASE("Compression", "[Serialization][Compression]")
+{
+	const auto text = MakeText(16uz * 1024uz * 1024uz);
+	const auto block = std::span(text).first(PonyEngine::Serialization::DefaultCompressionBlockSize);
+	const auto compressedBlock = CompressBlock(block);
+	const auto compressedFrame = CompressFrame(text, PonyEngine::Serialization::DefaultCompressionBlockSize, std::thread::hardware_concurrency());
+	REQUIRE(DecompressFrame(compressedFrame, std::thread::hardware_concurrency()) == text);
+
+#if PONY_ENGINE_TESTING_BENCHMARK
+	auto output = std::vector<std::byte>(PonyEngine::Serialization::GetMaxCompressedFrameSize(text.size()));
+
+	BENCHMARK("Compress block")
+	{
+		return PonyEngine::Serialization::CompressBlock(block, output);
+	};
+
+	BENCHMARK("Decompress block")
+	{
+		return PonyEngine::Serialization::DecompressBlock(compressedBlock, output);
+	};
+
+	BENCHMARK("Compress frame single-threaded")
+	{
+		return PonyEngine::Serialization::CompressFrame(text, output, PonyEngine::Serialization::DefaultCompressionBlockSize, 1uz);
+	};
+
+	BENCHMARK("Compress frame multi-threaded")
+	{
+		return PonyEngine::Serialization::CompressFrame(text, output);
+	};
+
+	BENCHMARK("Decompress frame single-threaded")
+	{
+		return PonyEngine::Serialization::DecompressFrame(compressedFrame, output, 1uz);
+	};
+
+	BENCHMARK("Decompress frame multi-threaded")
+	{
+		return PonyEngine::Serialization::DecompressFrame(compressedFrame, output);
+	};
+#endif
+}
@@ -21,6 +21,15 @@ TEST_CASE("Arithmetic concept", "[Type][Common]")
 	STATIC_REQUIRE_FALSE(PonyEngine::Type::Arithmetic<void*>);
 }
 
+TEST_CASE("Integer concept", "[Type][Common]")
+{
+	STATIC_REQUIRE(PonyEngine::Type::Integer<std::int8_t>);
+	STATIC_REQUIRE(PonyEngine::Type::Integer<std::uint64_t>);
+	STATIC_REQUIRE(PonyEngine::Type::Integer<char>);
+	STATIC_REQUIRE_FALSE(PonyEngine::Type::Integer<bool>);
+	STATIC_REQUIRE_FALSE(PonyEngine::Type::Integer<float>);
+}
+
 TEST_CASE("Signed concept", "[Type][Common]")
 {
 	STATIC_REQUIRE(PonyEngine::Type::Signed<std::int16_t>);
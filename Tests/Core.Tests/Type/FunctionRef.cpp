@@ -0,0 +1,60 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+import std;
+
+import PonyEngine.Type;
+
+namespace
+{
+	int Twice(const int value) noexcept
+	{
+		return value * 2;
+	}
+
+	int Call(const PonyEngine::Type::FunctionRef<int(int)> function, const int value)
+	{
+		return function(value);
+	}
+}
+
+TEST_CASE("FunctionRef: call", "[Type][FunctionRef]")
+{
+	STATIC_REQUIRE(sizeof(PonyEngine::Type::FunctionRef<void()>) == 2uz * sizeof(void*));
+
+	REQUIRE(Call(Twice, 3) == 6);
+	REQUIRE(Call(&Twice, 4) == 8);
+	REQUIRE(Call([](const int value) { return value + 1; }, 4) == 5);
+
+	int counter = 0;
+	auto lambda = [&counter](const int value) mutable { counter += value; return counter; };
+	REQUIRE(Call(lambda, 2) == 2);
+	REQUIRE(Call(lambda, 3) == 5);
+	REQUIRE(counter == 5);
+
+	const auto noexceptFunction = PonyEngine::Type::FunctionRef<int(int) noexcept>(Twice);
+	STATIC_REQUIRE(noexcept(noexceptFunction(1)));
+	REQUIRE(noexceptFunction(5) == 10);
+}
+
+TEST_CASE("FunctionRef: copy", "[Type][FunctionRef]")
+{
+	int counter = 0;
+	const auto lambda = [&counter]() { return ++counter; };
+	const auto function = PonyEngine::Type::FunctionRef<int()>(lambda);
+	const PonyEngine::Type::FunctionRef<int()> copied = function;
+	REQUIRE(function() == 1);
+	REQUIRE(copied() == 2);
+
+	auto other = PonyEngine::Type::FunctionRef<int()>(+[]() { return 0; });
+	other = copied;
+	REQUIRE(other() == 3);
+}
@@ -0,0 +1,121 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+import std;
+
+import PonyEngine.Testing;
+import PonyEngine.Type;
+
+namespace
+{
+	int Twice(const int value) noexcept
+	{
+		return value * 2;
+	}
+}
+
+TEST_CASE("InplaceFunction: empty", "[Type][InplaceFunction]")
+{
+	auto function = PonyEngine::Type::InplaceFunction<int(int)>();
+	REQUIRE(function.IsEmpty());
+	REQUIRE(!function);
+
+	function = nullptr;
+	REQUIRE(function.IsEmpty());
+
+	const auto nullFunction = PonyEngine::Type::InplaceFunction<int(int)>(static_cast<int(*)(int)>(nullptr));
+	REQUIRE(nullFunction.IsEmpty());
+}
+
+TEST_CASE("InplaceFunction: call", "[Type][InplaceFunction]")
+{
+	const auto lambda = PonyEngine::Type::InplaceFunction<int(int)>([offset = 3](const int value) { return value + offset; });
+	REQUIRE(!lambda.IsEmpty());
+	REQUIRE(static_cast<bool>(lambda));
+	REQUIRE(lambda(4) == 7);
+
+	const auto pointer = PonyEngine::Type::InplaceFunction<int(int) noexcept>(&Twice);
+	STATIC_REQUIRE(noexcept(pointer(1)));
+	REQUIRE(pointer(4) == 8);
+
+	int counter = 0;
+	const auto mutableLambda = PonyEngine::Type::InplaceFunction<int()>([&counter, calls = 0]() mutable { ++counter; return ++calls; });
+	REQUIRE(mutableLambda() == 1);
+	REQUIRE(mutableLambda() == 2);
+	REQUIRE(counter == 2);
+}
+
+TEST_CASE("InplaceFunction: move", "[Type][InplaceFunction]")
+{
+	auto value = std::make_shared<int>(5);
+	auto function = PonyEngine::Type::InplaceFunction<int()>([captured = std::make_unique<int>(5), value]() { return *captured + *value; });
+	REQUIRE(value.use_count() == 2);
+
+	auto moved = std::move(function);
+	REQUIRE(function.IsEmpty());
+	REQUIRE(moved() == 10);
+	REQUIRE(value.use_count() == 2);
+
+	function.Swap(moved);
+	REQUIRE(moved.IsEmpty());
+	REQUIRE(function() == 10);
+
+	moved = std::move(function);
+	REQUIRE(function.IsEmpty());
+	REQUIRE(moved() == 10);
+
+	moved.Reset();
+	REQUIRE(moved.IsEmpty());
+	REQUIRE(value.use_count() == 1);
+}
+
+TEST_CASE("InplaceFunction: capacity", "[Type][InplaceFunction]")
+{
+	STATIC_REQUIRE(sizeof(PonyEngine::Type::InplaceFunction<void()>) >= PonyEngine::Type::DefaultInplaceFunctionCapacity);
+	STATIC_REQUIRE(std::is_constructible_v<PonyEngine::Type::InplaceFunction<void(), 16uz>, void(*)()>);
+	STATIC_REQUIRE(!std::is_copy_constructible_v<PonyEngine::Type::InplaceFunction<void()>>);
+	STATIC_REQUIRE(std::is_nothrow_move_constructible_v<PonyEngine::Type::InplaceFunction<void()>>);
+
+	auto array = std::array<std::uint64_t, 8>{1, 2, 3, 4, 5, 6, 7, 8};
+	const auto big = PonyEngine::Type::InplaceFunction<std::uint64_t(), sizeof(array)>([array]() { return std::ranges::fold_left(array, std::uint64_t{0}, std::plus<std::uint64_t>()); });
+	REQUIRE(big() == 36);
+}
+
+TEST_CASE("InplaceFunction: no allocations", "[Type][InplaceFunction]")
+{
+	PonyEngine::Testing::RequireNoAllocations([]
+	{
+		const auto captured = std::array<int, 3>{1, 2, 3};
+		auto function = PonyEngine::Type::InplaceFunction<int()>([captured] { return captured[0] + captured[1] + captured[2]; });
+		auto moved = std::move(function);
+		[[maybe_unused]] const int result = moved();
+	});
+}
+
+TEST_CASE("InplaceFunction: performance", "[Type][InplaceFunction]")
+{
+#if PONY_ENGINE_TESTING_BENCHMARK
+	int counter = 0;
+
+	BENCHMARK("Construct and call")
+	{
+		const auto function = PonyEngine::Type::InplaceFunction<int()>([&counter]() { return ++counter; });
+		return function();
+	};
+
+	BENCHMARK("Construct and call std::function")
+	{
+		const auto function = std::function<int()>([&counter]() { return ++counter; });
+		return function();
+	};
+#endif
+}
@@ -0,0 +1,196 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+#include <catch2/catch_test_macros.hpp>
+
+import std;
+
+import PonyEngine.Log.Ext;
+
+namespace
+{
+	struct TestLog final
+	{
+		std::string message;
+		std::chrono::time_point<std::chrono::system_clock> timePoint;
+		std::uint64_t frameCount;
+		PonyEngine::Log::LogType logType;
+	};
+
+	std::vector<TestLog> MakeLogs(const std::size_t count)
+	{
+		auto logs = std::vector<TestLog>();
+		auto timePoint = std::chrono::system_clock::now();
+		std::uint64_t frameCount = 10ull;
+		for (std::size_t i = 0uz; i < count; ++i)
+		{
+			timePoint += std::chrono::microseconds(i % 7uz * 100uz);
+			frameCount += i % 3uz == 0uz ? 1ull : 0ull;
+			std::string message = i % 2uz == 0uz ? std::format("Unique message {}", i) : std::string("Repeated message");
+			logs.push_back(TestLog{.message = std::move(message), .timePoint = timePoint, .frameCount = frameCount, .logType = static_cast<PonyEngine::Log::LogType>(i % 6uz)});
+		}
+
+		return logs;
+	}
+
+	void WriteLogs(PonyEngine::Log::BinaryLogWriter& writer, const std::span<const TestLog> logs)
+	{
+		for (const TestLog& log : logs)
+		{
+			writer.Write(PonyEngine::Log::LogEntry{.formattedMessage = log.message, .message = log.message, .timePoint = log.timePoint, .frameCount = log.frameCount, .logType = log.logType});
+		}
+	}
+
+	void RequireLog(const PonyEngine::Log::BinaryLogRecord& record, const TestLog& log)
+	{
+		REQUIRE(record.message == log.message);
+		REQUIRE(record.timePoint == std::chrono::time_point_cast<std::chrono::nanoseconds>(log.timePoint));
+		REQUIRE(record.frameCount == log.frameCount);
+		REQUIRE(record.logType == log.logType);
+	}
+}
+
+TEST_CASE("BinaryLog: round trip", "[Log][BinaryLog]")
+{
+	const std::vector<TestLog> logs = MakeLogs(500uz);
+	auto data = std::vector<std::byte>();
+	auto writer = PonyEngine::Log::BinaryLogWriter(data, PonyEngine::Log::BinaryLogWriterParams{.indexInterval = 100uz});
+	WriteLogs(writer, logs);
+	writer.Finish();
+	REQUIRE(writer.LogCount() == logs.size());
+	REQUIRE(writer.Size() == data.size());
+	REQUIRE(writer.Index().size() == 5uz);
+
+	auto reader = PonyEngine::Log::BinaryLogReader(data);
+	REQUIRE(reader.IsFinished());
+	REQUIRE(reader.Index().size() == 5uz);
+	auto record = PonyEngine::Log::BinaryLogRecord();
+	std::size_t count = 0uz;
+	while (reader.Next(record))
+	{
+		RequireLog(record, logs[count]);
+		REQUIRE(record.stacktrace.empty());
+		REQUIRE(!record.hasException);
+		++count;
+	}
+	REQUIRE(count == logs.size());
+}
+
+TEST_CASE("BinaryLog: interning", "[Log][BinaryLog]")
+{
+	const auto message = std::string(200uz, 'M');
+	const auto timePoint = std::chrono::system_clock::now();
+	auto data = std::vector<std::byte>();
+	auto writer = PonyEngine::Log::BinaryLogWriter(data);
+	writer.Write(PonyEngine::Log::LogEntry{.formattedMessage = message, .message = message, .timePoint = timePoint});
+	const std::uint64_t firstSize = writer.Size();
+	writer.Write(PonyEngine::Log::LogEntry{.formattedMessage = message, .message = message, .timePoint = timePoint});
+	const std::uint64_t secondSize = writer.Size();
+	REQUIRE(secondSize - firstSize > message.size());
+	writer.Write(PonyEngine::Log::LogEntry{.formattedMessage = message, .message = message, .timePoint = timePoint});
+	REQUIRE(writer.Size() - secondSize < 16ull);
+	writer.Finish();
+
+	auto reader = PonyEngine::Log::BinaryLogReader(data);
+	auto record = PonyEngine::Log::BinaryLogRecord();
+	for (int i = 0; i < 3; ++i)
+	{
+		REQUIRE(reader.Next(record));
+		REQUIRE(record.message == message);
+	}
+	REQUIRE(!reader.Next(record));
+}
+
+TEST_CASE("BinaryLog: one-off messages aren't interned", "[Log][BinaryLog]")
+{
+	const auto timePoint = std::chrono::system_clock::now();
+	auto data = std::vector<std::byte>();
+	auto writer = PonyEngine::Log::BinaryLogWriter(data, PonyEngine::Log::BinaryLogWriterParams{.maxInternedStringCount = 4uz});
+	auto messages = std::vector<std::string>();
+	for (std::size_t i = 0uz; i < 16uz; ++i)
+	{
+		messages.push_back(std::format("Unique message {}", i));
+		writer.Write(PonyEngine::Log::LogEntry{.formattedMessage = messages.back(), .message = messages.back(), .timePoint = timePoint});
+	}
+
+	const auto repeated = std::string(200uz, 'R');
+	writer.Write(PonyEngine::Log::LogEntry{.formattedMessage = repeated, .message = repeated, .timePoint = timePoint});
+	writer.Write(PonyEngine::Log::LogEntry{.formattedMessage = repeated, .message = repeated, .timePoint = timePoint});
+	const std::uint64_t size = writer.Size();
+	writer.Write(PonyEngine::Log::LogEntry{.formattedMessage = repeated, .message = repeated, .timePoint = timePoint});
+	REQUIRE(writer.Size() - size < 16ull);
+}
+
+TEST_CASE("BinaryLog: exception", "[Log][BinaryLog]")
+{
+	auto data = std::vector<std::byte>();
+	auto writer = PonyEngine::Log::BinaryLogWriter(data);
+	writer.Write(PonyEngine::Log::LogEntry{.formattedMessage = "Exception", .message = "Exception", .exception = std::make_exception_ptr(std::runtime_error("Error")),
+		.timePoint = std::chrono::system_clock::now(), .logType = PonyEngine::Log::LogType::Exception});
+	writer.Finish();
+
+	auto reader = PonyEngine::Log::BinaryLogReader(data);
+	auto record = PonyEngine::Log::BinaryLogRecord();
+	REQUIRE(reader.Next(record));
+	REQUIRE(record.hasException);
+	REQUIRE(record.logType == PonyEngine::Log::LogType::Exception);
+	REQUIRE(!reader.Next(record));
+}
+
+TEST_CASE("BinaryLog: seek", "[Log][BinaryLog]")
+{
+	const std::vector<TestLog> logs = MakeLogs(500uz);
+	auto data = std::vector<std::byte>();
+	auto writer = PonyEngine::Log::BinaryLogWriter(data, PonyEngine::Log::BinaryLogWriterParams{.indexInterval = 100uz});
+	WriteLogs(writer, logs);
+	writer.Finish();
+
+	auto reader = PonyEngine::Log::BinaryLogReader(data);
+	auto record = PonyEngine::Log::BinaryLogRecord();
+	reader.Seek(reader.Index()[3]);
+	REQUIRE(reader.Index()[3].frameCount == logs[300].frameCount);
+	for (std::size_t i = 300uz; i < logs.size(); ++i)
+	{
+		REQUIRE(reader.Next(record));
+		RequireLog(record, logs[i]);
+	}
+	REQUIRE(!reader.Next(record));
+
+	reader.Seek(reader.Index()[1]);
+	REQUIRE(reader.Next(record));
+	RequireLog(record, logs[100]);
+}
+
+TEST_CASE("BinaryLog: truncated", "[Log][BinaryLog]")
+{
+	const std::vector<TestLog> logs = MakeLogs(100uz);
+	auto data = std::vector<std::byte>();
+	auto writer = PonyEngine::Log::BinaryLogWriter(data);
+	WriteLogs(writer, logs);
+	data.resize(data.size() - 2uz);
+
+	auto reader = PonyEngine::Log::BinaryLogReader(data);
+	REQUIRE(!reader.IsFinished());
+	REQUIRE(reader.Index().empty());
+	auto record = PonyEngine::Log::BinaryLogRecord();
+	std::size_t count = 0uz;
+	while (reader.Next(record))
+	{
+		RequireLog(record, logs[count]);
+		++count;
+	}
+	REQUIRE(count == logs.size() - 1uz);
+}
+
+TEST_CASE("BinaryLog: invalid header", "[Log][BinaryLog]")
+{
+	const auto data = std::vector<std::byte>(16uz, std::byte{0x42});
+	REQUIRE_THROWS_AS(PonyEngine::Log::BinaryLogReader(data), std::invalid_argument);
+}
@@ -0,0 +1,130 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+import std;
+
+import PonyEngine.Log.Ext;
+import PonyEngine.Testing;
+
+namespace
+{
+	std::chrono::time_point<std::chrono::system_clock> MakeTime()
+	{
+		using namespace std::chrono_literals;
+
+		return std::chrono::time_point_cast<std::chrono::system_clock::duration>(std::chrono::sys_days(2024y / 1 / 2) + 3h + 4min + 5s + 6789ns);
+	}
+}
+
+TEST_CASE("JsonLog: plain entry", "[Log][JsonLog]")
+{
+	std::string output;
+	auto writer = PonyEngine::Log::JsonLogWriter(output);
+	writer.Write(PonyEngine::Log::LogEntry{.formattedMessage = "Message", .message = "Message", .timePoint = MakeTime(), .frameCount = 7ull,
+		.logType = PonyEngine::Log::LogType::Warning});
+
+	const std::string thread = std::to_string(std::hash<std::thread::id>()(std::thread::id()));
+	REQUIRE(output == R"({"time":"2024-01-02T03:04:05.000006789Z","frame":7,"thread":)" + thread + R"(,"type":"Warning","message":"Message"})" + "\n");
+	REQUIRE(writer.LogCount() == 1ull);
+}
+
+TEST_CASE("JsonLog: symbolized record", "[Log][JsonLog]")
+{
+	std::string output;
+	auto writer = PonyEngine::Log::JsonLogWriter(output);
+	writer.Write(PonyEngine::Log::JsonLogRecord{.message = "Message", .stacktrace = "   0# Main", .timePoint = MakeTime(), .frameCount = 7ull,
+		.logType = PonyEngine::Log::LogType::Exception, .hasException = true});
+
+	REQUIRE(output == R"({"time":"2024-01-02T03:04:05.000006789Z","frame":7,"type":"Exception","message":"Message","exception":true,"stacktrace":"   0# Main"})" "\n");
+	REQUIRE(writer.LogCount() == 1ull);
+}
+
+TEST_CASE("JsonLog: fields", "[Log][JsonLog]")
+{
+	const auto fields = std::array
+	{
+		PonyEngine::Log::LogField("frame", 42ull),
+		PonyEngine::Log::LogField("delta", -3),
+		PonyEngine::Log::LogField("time", 16.5),
+		PonyEngine::Log::LogField("nan", std::numeric_limits<double>::quiet_NaN()),
+		PonyEngine::Log::LogField("vsync", true),
+		PonyEngine::Log::LogField("service", "Render")
+	};
+
+	std::string output;
+	auto writer = PonyEngine::Log::JsonLogWriter(output);
+	writer.Write(PonyEngine::Log::LogEntry{.message = "Frame", .timePoint = MakeTime(), .fields = fields});
+
+	REQUIRE(output.ends_with(R"("message":"Frame","fields":{"frame":42,"delta":-3,"time":16.5,"nan":null,"vsync":true,"service":"Render"}})" "\n"));
+}
+
+TEST_CASE("JsonLog: escaping", "[Log][JsonLog]")
+{
+	std::string output;
+	auto writer = PonyEngine::Log::JsonLogWriter(output);
+	writer.Write(PonyEngine::Log::LogEntry{.message = "Quote \" slash \\ line\n tab\t bell\x07 end", .timePoint = MakeTime()});
+
+	REQUIRE(output.ends_with(R"("message":"Quote \" slash \\ line\n tab\t bell\u0007 end"})" "\n"));
+	REQUIRE(std::ranges::count(output, '\n') == 1);
+}
+
+TEST_CASE("JsonLog: no allocations", "[Log][JsonLog]")
+{
+	const auto fields = std::array
+	{
+		PonyEngine::Log::LogField("frame", 42ull),
+		PonyEngine::Log::LogField("frameTime", 16.6),
+		PonyEngine::Log::LogField("service", "Render")
+	};
+	const auto entry = PonyEngine::Log::LogEntry{.message = "Frame finished.", .timePoint = std::chrono::system_clock::now(), .fields = fields};
+
+	std::string output;
+	output.reserve(64uz * 1024uz);
+	auto writer = PonyEngine::Log::JsonLogWriter(output);
+
+	PonyEngine::Testing::RequireNoAllocations([&]
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			writer.Write(entry);
+		}
+	});
+	REQUIRE(writer.LogCount() == 100ull);
+}
+
+TEST_CASE("JsonLog: throughput", "[Log][JsonLog]")
+{
+	const auto fields = std::array
+	{
+		PonyEngine::Log::LogField("frame", 42ull),
+		PonyEngine::Log::LogField("frameTime", 16.6),
+		PonyEngine::Log::LogField("drawCalls", 1234),
+		PonyEngine::Log::LogField("service", "Render")
+	};
+	const auto entry = PonyEngine::Log::LogEntry{.message = "Frame finished.", .timePoint = std::chrono::system_clock::now(), .fields = fields};
+
+#if PONY_ENGINE_TESTING_BENCHMARK
+	std::string output;
+	output.reserve(1024uz * 1024uz);
+	auto writer = PonyEngine::Log::JsonLogWriter(output);
+
+	BENCHMARK("1000 records")
+	{
+		output.clear();
+		for (std::size_t i = 0uz; i < 1000uz; ++i)
+		{
+			writer.Write(entry);
+		}
+		return output.size();
+	};
+#endif
+}
@@ -0,0 +1,190 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+import std;
+
+import PonyEngine.Log.Ext;
+import PonyEngine.Testing;
+
+namespace
+{
+	std::vector<std::uint64_t> MakeRingMemory(const std::size_t slotCount, const std::size_t slotSize)
+	{
+		return std::vector<std::uint64_t>(PonyEngine::Log::LogRingSize(slotCount, slotSize) / sizeof(std::uint64_t));
+	}
+
+	std::vector<PonyEngine::Log::LogRingRecord> ReadAll(const std::span<const std::byte> data)
+	{
+		auto reader = PonyEngine::Log::LogRingReader(data);
+		auto records = std::vector<PonyEngine::Log::LogRingRecord>();
+		for (auto record = PonyEngine::Log::LogRingRecord(); reader.Next(record); )
+		{
+			records.push_back(record);
+		}
+
+		return records;
+	}
+}
+
+TEST_CASE("LogRing: round trip", "[Log][LogRing]")
+{
+	auto memory = MakeRingMemory(8uz, 64uz);
+	const std::span<std::byte> data = std::as_writable_bytes(std::span(memory));
+	auto writer = PonyEngine::Log::LogRingWriter(data, 64uz);
+	REQUIRE(writer.SlotCount() == 8uz);
+	REQUIRE(writer.MaxMessageSize() == 64uz - PonyEngine::Log::LogRingSlotHeaderSize);
+
+	const auto timePoint = std::chrono::system_clock::now();
+	writer.Write(PonyEngine::Log::LogEntry{.message = "First", .timePoint = timePoint, .frameCount = 3ull, .logType = PonyEngine::Log::LogType::Info});
+	writer.Write(PonyEngine::Log::LogEntry{.message = "Second", .exception = std::make_exception_ptr(std::runtime_error("Test")), .timePoint = timePoint,
+		.frameCount = 4ull, .logType = PonyEngine::Log::LogType::Exception, .threadId = std::this_thread::get_id()});
+
+	const std::vector<PonyEngine::Log::LogRingRecord> records = ReadAll(data);
+	REQUIRE(records.size() == 2uz);
+	REQUIRE(records[0].message == "First");
+	REQUIRE(records[0].timePoint == std::chrono::time_point_cast<std::chrono::nanoseconds>(timePoint));
+	REQUIRE(records[0].frameCount == 3ull);
+	REQUIRE(records[0].sequence == 1ull);
+	REQUIRE(records[0].logType == PonyEngine::Log::LogType::Info);
+	REQUIRE_FALSE(records[0].hasException);
+	REQUIRE(records[1].message == "Second");
+	REQUIRE(records[1].thread == std::hash<std::thread::id>()(std::this_thread::get_id()));
+	REQUIRE(records[1].logType == PonyEngine::Log::LogType::Exception);
+	REQUIRE(records[1].hasException);
+	REQUIRE_FALSE(records[1].isTruncated);
+}
+
+TEST_CASE("LogRing: wrap around", "[Log][LogRing]")
+{
+	auto memory = MakeRingMemory(4uz, 64uz);
+	const std::span<std::byte> data = std::as_writable_bytes(std::span(memory));
+	auto writer = PonyEngine::Log::LogRingWriter(data, 64uz);
+
+	auto messages = std::vector<std::string>();
+	for (std::size_t i = 0uz; i < 10uz; ++i)
+	{
+		messages.push_back(std::format("Message {}", i));
+		writer.Write(PonyEngine::Log::LogEntry{.message = messages.back(), .frameCount = i});
+	}
+
+	const auto reader = PonyEngine::Log::LogRingReader(data);
+	REQUIRE(reader.LogCount() == 10ull);
+	const std::vector<PonyEngine::Log::LogRingRecord> records = ReadAll(data);
+	REQUIRE(records.size() == 4uz);
+	for (std::size_t i = 0uz; i < records.size(); ++i)
+	{
+		REQUIRE(records[i].message == messages[6uz + i]);
+		REQUIRE(records[i].frameCount == 6uz + i);
+		REQUIRE(records[i].sequence == 7ull + i);
+	}
+}
+
+TEST_CASE("LogRing: truncation", "[Log][LogRing]")
+{
+	auto memory = MakeRingMemory(2uz, 64uz);
+	const std::span<std::byte> data = std::as_writable_bytes(std::span(memory));
+	auto writer = PonyEngine::Log::LogRingWriter(data, 64uz);
+
+	const auto message = std::string(100uz, 'x');
+	writer.Write(PonyEngine::Log::LogEntry{.message = message});
+
+	const std::vector<PonyEngine::Log::LogRingRecord> records = ReadAll(data);
+	REQUIRE(records.size() == 1uz);
+	REQUIRE(records[0].isTruncated);
+	REQUIRE(records[0].message == std::string_view(message).substr(0uz, writer.MaxMessageSize()));
+}
+
+TEST_CASE("LogRing: interrupted slot", "[Log][LogRing]")
+{
+	auto memory = MakeRingMemory(4uz, 64uz);
+	const std::span<std::byte> data = std::as_writable_bytes(std::span(memory));
+	auto writer = PonyEngine::Log::LogRingWriter(data, 64uz);
+	for (std::size_t i = 0uz; i < 6uz; ++i)
+	{
+		writer.Write(PonyEngine::Log::LogEntry{.message = "Message", .frameCount = i});
+	}
+
+	// A crash in the middle of the write leaves the slot sequence cleared.
+	memory[PonyEngine::Log::LogRingSize(1uz, 64uz) / sizeof(std::uint64_t)] = 0ull;
+
+	const std::vector<PonyEngine::Log::LogRingRecord> records = ReadAll(data);
+	REQUIRE(records.size() == 3uz);
+	REQUIRE(records[0].frameCount == 2ull);
+	REQUIRE(records[1].frameCount == 3ull);
+	REQUIRE(records[2].frameCount == 4ull);
+}
+
+TEST_CASE("LogRing: reset", "[Log][LogRing]")
+{
+	auto memory = MakeRingMemory(4uz, 64uz);
+	const std::span<std::byte> data = std::as_writable_bytes(std::span(memory));
+	{
+		auto writer = PonyEngine::Log::LogRingWriter(data, 64uz);
+		writer.Write(PonyEngine::Log::LogEntry{.message = "Old"});
+	}
+
+	auto writer = PonyEngine::Log::LogRingWriter(data, 64uz);
+	REQUIRE(ReadAll(data).empty());
+	writer.Write(PonyEngine::Log::LogEntry{.message = "New"});
+	const std::vector<PonyEngine::Log::LogRingRecord> records = ReadAll(data);
+	REQUIRE(records.size() == 1uz);
+	REQUIRE(records[0].message == "New");
+}
+
+TEST_CASE("LogRing: incorrect data", "[Log][LogRing]")
+{
+	auto memory = MakeRingMemory(4uz, 64uz);
+	const std::span<std::byte> data = std::as_writable_bytes(std::span(memory));
+	REQUIRE_THROWS_AS(PonyEngine::Log::LogRingWriter(data, 60uz), std::invalid_argument);
+	REQUIRE_THROWS_AS(PonyEngine::Log::LogRingWriter(data.first(PonyEngine::Log::LogRingHeaderSize), 64uz), std::invalid_argument);
+	REQUIRE_THROWS_AS(PonyEngine::Log::LogRingReader(data), std::invalid_argument);
+
+	{
+		auto writer = PonyEngine::Log::LogRingWriter(data, 64uz);
+	}
+	REQUIRE_THROWS_AS(PonyEngine::Log::LogRingReader(data.first(PonyEngine::Log::LogRingSize(3uz, 64uz))), std::invalid_argument);
+}
+
+TEST_CASE("LogRing: no allocations", "[Log][LogRing]")
+{
+	auto memory = MakeRingMemory(64uz, 256uz);
+	auto writer = PonyEngine::Log::LogRingWriter(std::as_writable_bytes(std::span(memory)), 256uz);
+	const auto entry = PonyEngine::Log::LogEntry{.message = "Frame finished.", .timePoint = std::chrono::system_clock::now(), .threadId = std::this_thread::get_id()};
+
+	PonyEngine::Testing::RequireNoAllocations([&]
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			writer.Write(entry);
+		}
+	});
+	REQUIRE(writer.LogCount() == 100ull);
+}
+
+TEST_CASE("LogRing: throughput", "[Log][LogRing]")
+{
+	auto memory = MakeRingMemory(65536uz, 256uz);
+	auto writer = PonyEngine::Log::LogRingWriter(std::as_writable_bytes(std::span(memory)), 256uz);
+	const auto entry = PonyEngine::Log::LogEntry{.message = "Frame finished.", .timePoint = std::chrono::system_clock::now(), .threadId = std::this_thread::get_id()};
+
+#if PONY_ENGINE_TESTING_BENCHMARK
+	BENCHMARK("1000 records")
+	{
+		for (std::size_t i = 0uz; i < 1000uz; ++i)
+		{
+			writer.Write(entry);
+		}
+		return writer.LogCount();
+	};
+#endif
+}
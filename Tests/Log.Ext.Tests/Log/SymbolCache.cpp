@@ -0,0 +1,70 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+import std;
+
+import PonyEngine.Log.Ext;
+
+TEST_CASE("SymbolCache: append", "[Log][SymbolCache]")
+{
+	auto cache = PonyEngine::Log::SymbolCache();
+	const std::stacktrace stacktrace = std::stacktrace::current();
+
+	std::string first;
+	cache.Append(first, stacktrace);
+	REQUIRE(cache.MissCount() > 0ull);
+	REQUIRE(cache.FrameCount() > 0uz);
+	REQUIRE(cache.FrameCount() <= stacktrace.size());
+	REQUIRE(first == std::format("{}", stacktrace));
+
+	const std::uint64_t missCount = cache.MissCount();
+	const std::uint64_t hitCount = cache.HitCount();
+	std::string second;
+	cache.Append(second, stacktrace);
+	REQUIRE(cache.MissCount() == missCount);
+	REQUIRE(cache.HitCount() - hitCount == stacktrace.size());
+	REQUIRE(second == first);
+}
+
+TEST_CASE("SymbolCache: limit", "[Log][SymbolCache]")
+{
+	auto cache = PonyEngine::Log::SymbolCache(1uz);
+	const std::stacktrace stacktrace = std::stacktrace::current();
+
+	std::string text;
+	cache.Append(text, stacktrace);
+	cache.Append(text, stacktrace);
+	REQUIRE(cache.FrameCount() == std::min(stacktrace.size(), 1uz));
+}
+
+TEST_CASE("SymbolCache: symbolize", "[Log][SymbolCache]")
+{
+	const std::stacktrace stacktrace = std::stacktrace::current();
+
+#if PONY_ENGINE_TESTING_BENCHMARK
+	std::string text;
+
+	BENCHMARK("Uncached")
+	{
+		text.clear();
+		std::format_to(std::back_inserter(text), "{}", stacktrace);
+		return text.size();
+	};
+
+	BENCHMARK("Cached")
+	{
+		text.clear();
+		PonyEngine::Log::SymbolCache::Shared().Append(text, stacktrace);
+		return text.size();
+	};
+#endif
+}
@@ -0,0 +1,139 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+import std;
+
+import PonyEngine.Log.File.Impl;
+import PonyEngine.Testing;
+
+namespace
+{
+	std::vector<PonyEngine::Log::LogEntry> MakeEntries(const std::vector<std::string>& messages)
+	{
+		auto entries = std::vector<PonyEngine::Log::LogEntry>();
+		auto timePoint = std::chrono::system_clock::now();
+		for (std::size_t i = 0uz; i < messages.size(); ++i)
+		{
+			timePoint += std::chrono::microseconds(i % 3uz * 10uz);
+			entries.push_back(PonyEngine::Log::LogEntry{.formattedMessage = messages[i], .message = messages[i], .timePoint = timePoint, .frameCount = i / 2uz,
+				.logType = i % 5uz == 4uz ? PonyEngine::Log::LogType::Warning : PonyEngine::Log::LogType::Info});
+		}
+
+		return entries;
+	}
+
+	std::vector<std::string> MakeMessages(const std::size_t count)
+	{
+		auto messages = std::vector<std::string>();
+		for (std::size_t i = 0uz; i < count; ++i)
+		{
+			messages.push_back(i % 2uz == 0uz ? std::format("Message {}", i) : std::string("Repeated message"));
+		}
+
+		return messages;
+	}
+
+	void RequireRecord(const PonyEngine::Log::BinaryLogRecord& record, const PonyEngine::Log::LogEntry& entry)
+	{
+		REQUIRE(record.message == entry.message);
+		REQUIRE(record.timePoint == entry.timePoint);
+		REQUIRE(record.frameCount == entry.frameCount);
+		REQUIRE(record.logType == entry.logType);
+	}
+}
+
+TEST_CASE("BinaryFileSubLogger: finished log", "[Log][BinaryFileSubLogger]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("BinaryFileSubLogger.Finished");
+	const std::vector<std::string> messages = MakeMessages(20uz);
+	const std::vector<PonyEngine::Log::LogEntry> entries = MakeEntries(messages);
+
+	auto context = PonyEngine::Testing::MockSubLoggerContext();
+	{
+		const auto params = PonyEngine::Log::File::BinaryFileSubLoggerParams
+		{
+			.path = directory.Path() / "Log.pnlb",
+			.bufferSize = 64uz,
+			.writerParams = PonyEngine::Log::BinaryLogWriterParams{.indexInterval = 4uz}
+		};
+		auto subLogger = PonyEngine::Log::File::BinaryFileSubLogger(context, params);
+		for (const PonyEngine::Log::LogEntry& entry : entries)
+		{
+			subLogger.Log(entry);
+		}
+	}
+	REQUIRE(context.ConsoleLogCount() == 0uz);
+
+	const std::string data = directory.Read("Log.pnlb");
+	auto reader = PonyEngine::Log::BinaryLogReader(std::as_bytes(std::span(data)));
+	REQUIRE(reader.IsFinished());
+
+	auto record = PonyEngine::Log::BinaryLogRecord();
+	for (const PonyEngine::Log::LogEntry& entry : entries)
+	{
+		REQUIRE(reader.Next(record));
+		RequireRecord(record, entry);
+	}
+	REQUIRE_FALSE(reader.Next(record));
+
+	const std::span<const PonyEngine::Log::BinaryLogIndexEntry> index = reader.Index();
+	REQUIRE(index.size() == entries.size() / 4uz);
+	for (const PonyEngine::Log::BinaryLogIndexEntry& indexEntry : index)
+	{
+		reader.Seek(indexEntry);
+		REQUIRE(reader.Next(record));
+		REQUIRE(record.offset == indexEntry.offset);
+		REQUIRE(record.timePoint == indexEntry.timePoint);
+		REQUIRE(record.frameCount == indexEntry.frameCount);
+	}
+}
+
+TEST_CASE("BinaryFileSubLogger: unfinished log", "[Log][BinaryFileSubLogger]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("BinaryFileSubLogger.Unfinished");
+	const std::vector<std::string> messages = MakeMessages(10uz);
+	const std::vector<PonyEngine::Log::LogEntry> entries = MakeEntries(messages);
+
+	auto context = PonyEngine::Testing::MockSubLoggerContext();
+	const auto params = PonyEngine::Log::File::BinaryFileSubLoggerParams
+	{
+		.path = directory.Path() / "Log.pnlb",
+		.flushPeriod = std::chrono::hours(1),
+		.writerParams = PonyEngine::Log::BinaryLogWriterParams{.indexInterval = 4uz}
+	};
+	auto subLogger = PonyEngine::Log::File::BinaryFileSubLogger(context, params);
+	for (const PonyEngine::Log::LogEntry& entry : entries)
+	{
+		subLogger.Log(entry);
+	}
+	REQUIRE(directory.Read("Log.pnlb").empty());
+
+	// An error is flushed right away, so the log is readable as if the process crashed after it.
+	auto error = entries.back();
+	error.logType = PonyEngine::Log::LogType::Error;
+	subLogger.Log(error);
+	REQUIRE(context.ConsoleLogCount() == 0uz);
+
+	const std::string data = directory.Read("Log.pnlb");
+	auto reader = PonyEngine::Log::BinaryLogReader(std::as_bytes(std::span(data)));
+	REQUIRE_FALSE(reader.IsFinished());
+	REQUIRE(reader.Index().empty());
+
+	auto record = PonyEngine::Log::BinaryLogRecord();
+	for (const PonyEngine::Log::LogEntry& entry : entries)
+	{
+		REQUIRE(reader.Next(record));
+		RequireRecord(record, entry);
+	}
+	REQUIRE(reader.Next(record));
+	RequireRecord(record, error);
+	REQUIRE_FALSE(reader.Next(record));
+}
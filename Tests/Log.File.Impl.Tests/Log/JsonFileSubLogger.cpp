@@ -0,0 +1,80 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+import std;
+
+import PonyEngine.Log.File.Impl;
+import PonyEngine.Testing;
+
+namespace
+{
+	PonyEngine::Log::LogEntry MakeEntry(const std::string_view message, const std::span<const PonyEngine::Log::LogField> fields = {},
+		const PonyEngine::Log::LogType logType = PonyEngine::Log::LogType::Info)
+	{
+		return PonyEngine::Log::LogEntry{.formattedMessage = message, .message = message, .timePoint = std::chrono::system_clock::now(), .frameCount = 3ull,
+			.logType = logType, .fields = fields, .threadId = std::this_thread::get_id()};
+	}
+}
+
+TEST_CASE("JsonFileSubLogger: lines", "[Log][JsonFileSubLogger]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("JsonFileSubLogger.Lines");
+	const auto fields = std::array
+	{
+		PonyEngine::Log::LogField("frame", 42ull),
+		PonyEngine::Log::LogField("service", "Render")
+	};
+	const auto entries = std::array
+	{
+		MakeEntry("First"),
+		MakeEntry("Quoted \"second\"", fields),
+		MakeEntry("Third", {}, PonyEngine::Log::LogType::Warning)
+	};
+
+	auto context = PonyEngine::Testing::MockSubLoggerContext();
+	{
+		const auto params = PonyEngine::Log::File::JsonFileSubLoggerParams{.path = directory.Path() / "Log.jsonl", .bufferSize = 64uz};
+		auto subLogger = PonyEngine::Log::File::JsonFileSubLogger(context, params);
+		for (const PonyEngine::Log::LogEntry& entry : entries)
+		{
+			subLogger.Log(entry);
+		}
+	}
+	REQUIRE(context.ConsoleLogCount() == 0uz);
+
+	auto expected = std::string();
+	auto writer = PonyEngine::Log::JsonLogWriter(expected);
+	for (const PonyEngine::Log::LogEntry& entry : entries)
+	{
+		writer.Write(entry);
+	}
+	const std::string data = directory.Read("Log.jsonl");
+	REQUIRE(data == expected);
+	REQUIRE(std::ranges::count(data, '\n') == static_cast<std::ptrdiff_t>(entries.size()));
+}
+
+TEST_CASE("JsonFileSubLogger: flush", "[Log][JsonFileSubLogger]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("JsonFileSubLogger.Flush");
+	auto context = PonyEngine::Testing::MockSubLoggerContext();
+	const auto params = PonyEngine::Log::File::JsonFileSubLoggerParams{.path = directory.Path() / "Log.jsonl", .flushPeriod = std::chrono::hours(1)};
+	auto subLogger = PonyEngine::Log::File::JsonFileSubLogger(context, params);
+
+	subLogger.Log(MakeEntry("Info"));
+	REQUIRE(directory.Read("Log.jsonl").empty());
+
+	subLogger.Log(MakeEntry("Error", {}, PonyEngine::Log::LogType::Error));
+	const std::string data = directory.Read("Log.jsonl");
+	REQUIRE(std::ranges::count(data, '\n') == 2);
+	REQUIRE(data.contains(R"("type":"Info","message":"Info"})"));
+	REQUIRE(data.contains(R"("type":"Error","message":"Error"})"));
+	REQUIRE(context.ConsoleLogCount() == 0uz);
+}
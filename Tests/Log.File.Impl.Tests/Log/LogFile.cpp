@@ -0,0 +1,90 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+import std;
+
+import PonyEngine.Log.File.Impl;
+import PonyEngine.Testing;
+
+namespace
+{
+	std::span<const std::byte> Bytes(const std::string_view text)
+	{
+		return std::as_bytes(std::span(text));
+	}
+}
+
+TEST_CASE("LogFile: closed", "[Log][LogFile]")
+{
+	const auto file = PonyEngine::Log::File::LogFile();
+	REQUIRE_FALSE(file.IsOpen());
+	REQUIRE(file.Size() == 0ull);
+}
+
+TEST_CASE("LogFile: gathered write", "[Log][LogFile]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("LogFile.GatheredWrite");
+	{
+		auto file = PonyEngine::Log::File::LogFile(directory.Path() / "Log.log");
+		REQUIRE(file.IsOpen());
+		REQUIRE(file.Size() == 0ull);
+
+		file.Write(std::array{Bytes("First "), Bytes(""), Bytes("second ")});
+		REQUIRE(file.Size() == 13ull);
+
+		auto parts = std::array<std::span<const std::byte>, PonyEngine::Log::File::LogFile::MaxWritePartCount>();
+		std::ranges::fill(parts, Bytes("x"));
+		file.Write(parts);
+		REQUIRE(file.Size() == 13ull + PonyEngine::Log::File::LogFile::MaxWritePartCount);
+		REQUIRE_NOTHROW(file.Sync());
+	}
+
+	REQUIRE(directory.Read("Log.log") == "First second " + std::string(PonyEngine::Log::File::LogFile::MaxWritePartCount, 'x'));
+}
+
+TEST_CASE("LogFile: append", "[Log][LogFile]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("LogFile.Append");
+	directory.Write("Log.log", "Old\n");
+
+	auto file = PonyEngine::Log::File::LogFile(directory.Path() / "Log.log");
+	REQUIRE(file.Size() == 4ull);
+	file.Write(std::array{Bytes("New\n")});
+	REQUIRE(file.Size() == 8ull);
+	file.Close();
+	REQUIRE_FALSE(file.IsOpen());
+
+	REQUIRE(directory.Read("Log.log") == "Old\nNew\n");
+}
+
+TEST_CASE("LogFile: move", "[Log][LogFile]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("LogFile.Move");
+	auto file = PonyEngine::Log::File::LogFile(directory.Path() / "Log.log");
+	file.Write(std::array{Bytes("Message\n")});
+
+	auto movedFile = std::move(file);
+	REQUIRE_FALSE(file.IsOpen());
+	REQUIRE(movedFile.IsOpen());
+	REQUIRE(movedFile.Size() == 8ull);
+
+	file = PonyEngine::Log::File::LogFile(directory.Path() / "Other.log");
+	movedFile = std::move(file);
+	REQUIRE_FALSE(file.IsOpen());
+	REQUIRE(movedFile.Size() == 0ull);
+	REQUIRE(directory.Read("Log.log") == "Message\n");
+}
+
+TEST_CASE("LogFile: open failure", "[Log][LogFile]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("LogFile.OpenFailure");
+	REQUIRE_THROWS_AS(PonyEngine::Log::File::LogFile(directory.Path() / "Missing" / "Log.log"), std::runtime_error);
+}
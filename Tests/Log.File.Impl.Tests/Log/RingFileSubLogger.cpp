@@ -0,0 +1,103 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+import std;
+
+import PonyEngine.Log.File.Impl;
+import PonyEngine.Testing;
+
+namespace
+{
+	constexpr std::size_t SlotCount = 4uz;
+	constexpr std::size_t SlotSize = 64uz;
+
+	PonyEngine::Log::LogEntry MakeEntry(const std::string_view message, const std::uint64_t frameCount)
+	{
+		return PonyEngine::Log::LogEntry{.formattedMessage = message, .message = message, .timePoint = std::chrono::system_clock::now(), .frameCount = frameCount,
+			.logType = PonyEngine::Log::LogType::Info};
+	}
+}
+
+TEST_CASE("RingFileSubLogger: last logs", "[Log][RingFileSubLogger]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("RingFileSubLogger.LastLogs");
+	const std::string longMessage(SlotSize, 'x');
+	auto messages = std::vector<std::string>();
+	for (std::size_t i = 0uz; i < 5uz; ++i)
+	{
+		messages.push_back(std::format("Message {}", i));
+	}
+	messages.push_back(longMessage);
+
+	auto context = PonyEngine::Testing::MockSubLoggerContext();
+	std::string crashData;
+	{
+		const auto params = PonyEngine::Log::File::RingFileSubLoggerParams{.path = directory.Path() / "Log.pnlr", .slotCount = SlotCount, .slotSize = SlotSize};
+		auto subLogger = PonyEngine::Log::File::RingFileSubLogger(context, params);
+		for (std::size_t i = 0uz; i < messages.size(); ++i)
+		{
+			subLogger.Log(MakeEntry(messages[i], i));
+		}
+
+		// The logs are in the file before the sub-logger is destroyed, as if the process was killed.
+		crashData = directory.Read("Log.pnlr");
+	}
+	REQUIRE(context.ConsoleLogCount() == 0uz);
+	REQUIRE(crashData.size() == PonyEngine::Log::LogRingSize(SlotCount, SlotSize));
+
+	for (const std::string& data : {crashData, directory.Read("Log.pnlr")})
+	{
+		auto reader = PonyEngine::Log::LogRingReader(std::as_bytes(std::span(data)));
+		REQUIRE(reader.SlotCount() == SlotCount);
+		REQUIRE(reader.SlotSize() == SlotSize);
+		REQUIRE(reader.LogCount() == messages.size());
+
+		auto record = PonyEngine::Log::LogRingRecord();
+		for (std::size_t i = messages.size() - SlotCount; i < messages.size() - 1uz; ++i)
+		{
+			REQUIRE(reader.Next(record));
+			REQUIRE(record.message == messages[i]);
+			REQUIRE(record.sequence == i + 1uz);
+			REQUIRE(record.frameCount == i);
+			REQUIRE_FALSE(record.isTruncated);
+		}
+
+		REQUIRE(reader.Next(record));
+		REQUIRE(record.isTruncated);
+		REQUIRE(longMessage.starts_with(record.message));
+		REQUIRE(record.message.size() < longMessage.size());
+		REQUIRE_FALSE(reader.Next(record));
+	}
+}
+
+TEST_CASE("RingFileSubLogger: previous ring", "[Log][RingFileSubLogger]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("RingFileSubLogger.PreviousRing");
+	const auto params = PonyEngine::Log::File::RingFileSubLoggerParams{.path = directory.Path() / "Log.pnlr", .slotCount = SlotCount, .slotSize = SlotSize};
+	auto context = PonyEngine::Testing::MockSubLoggerContext();
+	{
+		auto subLogger = PonyEngine::Log::File::RingFileSubLogger(context, params);
+		subLogger.Log(MakeEntry("Old", 0ull));
+	}
+	{
+		auto subLogger = PonyEngine::Log::File::RingFileSubLogger(context, params);
+		subLogger.Log(MakeEntry("New", 1ull));
+	}
+	REQUIRE(context.ConsoleLogCount() == 0uz);
+
+	const std::string data = directory.Read("Log.pnlr");
+	auto reader = PonyEngine::Log::LogRingReader(std::as_bytes(std::span(data)));
+	REQUIRE(reader.LogCount() == 1ull);
+	auto record = PonyEngine::Log::LogRingRecord();
+	REQUIRE(reader.Next(record));
+	REQUIRE(record.message == "New");
+	REQUIRE_FALSE(reader.Next(record));
+}
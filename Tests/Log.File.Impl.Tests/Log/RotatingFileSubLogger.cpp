@@ -0,0 +1,192 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+import std;
+
+import PonyEngine.Log.File.Impl;
+import PonyEngine.Serialization;
+import PonyEngine.Testing;
+
+namespace
+{
+	constexpr std::size_t MessageSize = 40uz;
+
+	std::string MakeMessage(const std::size_t index)
+	{
+		return std::format("{:<{}}\n", std::format("Message {}", index), MessageSize - 1uz);
+	}
+
+	PonyEngine::Log::LogEntry MakeEntry(const std::string_view message, const PonyEngine::Log::LogType logType = PonyEngine::Log::LogType::Info)
+	{
+		return PonyEngine::Log::LogEntry{.formattedMessage = message, .message = message, .timePoint = std::chrono::system_clock::now(), .logType = logType};
+	}
+
+	// The file is rotated on every log.
+	PonyEngine::Log::File::RotatingFileSubLoggerParams MakeParams(const PonyEngine::Testing::TemporaryDirectory& directory)
+	{
+		return PonyEngine::Log::File::RotatingFileSubLoggerParams
+		{
+			.path = directory.Path() / "Log.log",
+			.bufferSize = 1024uz,
+			.flushPeriod = std::chrono::hours(1),
+			.rotationSize = MessageSize + MessageSize / 2uz,
+			.retentionCount = 0uz,
+			.syncPolicy = PonyEngine::Log::File::LogFileSyncPolicy::None
+		};
+	}
+
+	void LogMessages(const PonyEngine::Log::File::RotatingFileSubLoggerParams& params, const std::size_t first, const std::size_t count)
+	{
+		auto context = PonyEngine::Testing::MockSubLoggerContext();
+		{
+			auto subLogger = PonyEngine::Log::File::RotatingFileSubLogger(context, params);
+			for (std::size_t i = first; i < first + count; ++i)
+			{
+				const std::string message = MakeMessage(i);
+				subLogger.Log(MakeEntry(message));
+			}
+		}
+		REQUIRE(context.ConsoleLogCount() == 0uz);
+	}
+}
+
+TEST_CASE("RotatingFileSubLogger: rotation naming and order", "[Log][RotatingFileSubLogger]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("RotatingFileSubLogger.Rotation");
+	LogMessages(MakeParams(directory), 0uz, 4uz);
+
+	REQUIRE(directory.FileNames() == std::vector<std::string>{"Log.000001.log", "Log.000002.log", "Log.000003.log", "Log.log"});
+	REQUIRE(directory.Read("Log.000001.log") == MakeMessage(0uz));
+	REQUIRE(directory.Read("Log.000002.log") == MakeMessage(1uz));
+	REQUIRE(directory.Read("Log.000003.log") == MakeMessage(2uz));
+	REQUIRE(directory.Read("Log.log") == MakeMessage(3uz));
+}
+
+TEST_CASE("RotatingFileSubLogger: previous run", "[Log][RotatingFileSubLogger]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("RotatingFileSubLogger.PreviousRun");
+	directory.Write("Log.000007.log", "Older\n");
+	directory.Write("Log.log", "Old\n");
+	LogMessages(MakeParams(directory), 0uz, 2uz);
+
+	REQUIRE(directory.FileNames() == std::vector<std::string>{"Log.000007.log", "Log.000008.log", "Log.000009.log", "Log.log"});
+	REQUIRE(directory.Read("Log.000007.log") == "Older\n");
+	REQUIRE(directory.Read("Log.000008.log") == "Old\n");
+	REQUIRE(directory.Read("Log.000009.log") == MakeMessage(0uz));
+	REQUIRE(directory.Read("Log.log") == MakeMessage(1uz));
+}
+
+TEST_CASE("RotatingFileSubLogger: retention count", "[Log][RotatingFileSubLogger]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("RotatingFileSubLogger.RetentionCount");
+	auto params = MakeParams(directory);
+	params.retentionCount = 2uz;
+	LogMessages(params, 0uz, 6uz);
+
+	REQUIRE(directory.FileNames() == std::vector<std::string>{"Log.000004.log", "Log.000005.log", "Log.log"});
+	REQUIRE(directory.Read("Log.000004.log") == MakeMessage(3uz));
+	REQUIRE(directory.Read("Log.000005.log") == MakeMessage(4uz));
+	REQUIRE(directory.Read("Log.log") == MakeMessage(5uz));
+}
+
+TEST_CASE("RotatingFileSubLogger: retention size", "[Log][RotatingFileSubLogger]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("RotatingFileSubLogger.RetentionSize");
+	auto params = MakeParams(directory);
+	params.retentionSize = MessageSize * 3uz;
+	LogMessages(params, 0uz, 6uz);
+
+	REQUIRE(directory.FileNames() == std::vector<std::string>{"Log.000003.log", "Log.000004.log", "Log.000005.log", "Log.log"});
+	REQUIRE(directory.Read("Log.000003.log") == MakeMessage(2uz));
+}
+
+TEST_CASE("RotatingFileSubLogger: compression", "[Log][RotatingFileSubLogger]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("RotatingFileSubLogger.Compression");
+	auto params = MakeParams(directory);
+	params.rotationSize = MessageSize * 100uz;
+	params.retentionCount = 2uz;
+	params.compress = true;
+	for (std::size_t run = 0uz; run < 4uz; ++run)
+	{
+		LogMessages(params, run * 100uz, 100uz);
+	}
+
+	// Every run rotates the file of the previous one when it starts, and the retention removes the file of the first run.
+	REQUIRE(directory.FileNames() == std::vector<std::string>{"Log.000002.log.lz", "Log.000003.log.lz", "Log.log"});
+
+	const std::string compressed = directory.Read("Log.000002.log.lz");
+	const std::span<const std::byte> source = std::as_bytes(std::span(compressed));
+	auto decompressed = std::string(PonyEngine::Serialization::GetDecompressedFrameSize(source), '\0');
+	PonyEngine::Serialization::DecompressFrame(source, std::as_writable_bytes(std::span(decompressed)));
+	auto expected = std::string();
+	for (std::size_t i = 100uz; i < 200uz; ++i)
+	{
+		expected += MakeMessage(i);
+	}
+	REQUIRE(decompressed == expected);
+	REQUIRE(compressed.size() < expected.size());
+}
+
+TEST_CASE("RotatingFileSubLogger: flush", "[Log][RotatingFileSubLogger]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("RotatingFileSubLogger.Flush");
+	auto params = MakeParams(directory);
+	params.rotationSize = 0ull;
+
+	SECTION("None")
+	{
+		params.syncPolicy = PonyEngine::Log::File::LogFileSyncPolicy::None;
+	}
+	SECTION("OnError")
+	{
+		params.syncPolicy = PonyEngine::Log::File::LogFileSyncPolicy::OnError;
+	}
+	SECTION("Periodic")
+	{
+		params.syncPolicy = PonyEngine::Log::File::LogFileSyncPolicy::Periodic;
+		params.syncPeriod = std::chrono::milliseconds(0);
+	}
+
+	auto context = PonyEngine::Testing::MockSubLoggerContext();
+	{
+		auto subLogger = PonyEngine::Log::File::RotatingFileSubLogger(context, params);
+		subLogger.Log(MakeEntry("Info\n"));
+		REQUIRE(directory.Read("Log.log").empty());
+
+		subLogger.Log(MakeEntry("Error\n", PonyEngine::Log::LogType::Error));
+		REQUIRE(directory.Read("Log.log") == "Info\nError\n");
+
+		subLogger.Log(MakeEntry("Last\n"));
+	}
+	REQUIRE(context.ConsoleLogCount() == 0uz);
+	REQUIRE(directory.Read("Log.log") == "Info\nError\nLast\n");
+}
+
+TEST_CASE("RotatingFileSubLogger: rotation failure", "[Log][RotatingFileSubLogger]")
+{
+	const auto directory = PonyEngine::Testing::TemporaryDirectory("RotatingFileSubLogger.RotationFailure");
+	// A rotated file can't replace a non-empty directory.
+	std::filesystem::create_directory(directory.Path() / "Log.000001.log");
+	directory.Write("Log.000001.log/Blocker", "");
+
+	auto context = PonyEngine::Testing::MockSubLoggerContext();
+	{
+		auto subLogger = PonyEngine::Log::File::RotatingFileSubLogger(context, MakeParams(directory));
+		for (std::size_t i = 0uz; i < 3uz; ++i)
+		{
+			const std::string message = MakeMessage(i);
+			subLogger.Log(MakeEntry(message));
+		}
+	}
+
+	REQUIRE(directory.Read("Log.log") == MakeMessage(0uz) + MakeMessage(1uz) + MakeMessage(2uz));
+}
@@ -0,0 +1,96 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+import std;
+
+import PonyEngine.Log.Impl;
+
+namespace
+{
+	PonyEngine::Log::LogEntry MakeEntry(const std::string_view message, const std::chrono::time_point<std::chrono::system_clock> timePoint,
+		const PonyEngine::Log::LogType logType = PonyEngine::Log::LogType::Info)
+	{
+		return PonyEngine::Log::LogEntry{.formattedMessage = message, .message = message, .timePoint = timePoint, .frameCount = 7ull, .logType = logType};
+	}
+}
+
+TEST_CASE("LogCoalescer: repeats", "[Log][LogCoalescer]")
+{
+	const auto timePoint = std::chrono::system_clock::now();
+	auto coalescer = PonyEngine::Log::LogCoalescer(std::chrono::seconds(1));
+	const PonyEngine::Log::LogEntry entry = MakeEntry("Message", timePoint);
+	REQUIRE_FALSE(coalescer.IsRepeat(entry));
+	coalescer.Remember(entry);
+	REQUIRE(coalescer.IsRepeat(entry));
+	REQUIRE_FALSE(coalescer.IsRepeat(MakeEntry("Other", timePoint)));
+	REQUIRE_FALSE(coalescer.IsRepeat(MakeEntry("Message", timePoint, PonyEngine::Log::LogType::Warning)));
+
+	coalescer.CountRepeat(MakeEntry("Message", timePoint + std::chrono::milliseconds(1)));
+	coalescer.CountRepeat(MakeEntry("Message", timePoint + std::chrono::milliseconds(2)));
+	REQUIRE(coalescer.RepeatCount() == 2ull);
+	REQUIRE(coalescer.CoalescedCount() == 2ull);
+
+	auto report = PonyEngine::Log::LogEntry();
+	auto reportString = std::string();
+	coalescer.FillReport(report, reportString);
+	REQUIRE(report.message == "Previous message repeated 2 times.");
+	REQUIRE(report.formattedMessage.contains(report.message));
+	REQUIRE(report.logType == PonyEngine::Log::LogType::Info);
+	REQUIRE(report.timePoint == timePoint + std::chrono::milliseconds(2));
+	REQUIRE(report.frameCount == 7ull);
+	REQUIRE(coalescer.RepeatCount() == 0ull);
+	REQUIRE(coalescer.CoalescedCount() == 2ull);
+	REQUIRE(coalescer.IsRepeat(entry));
+}
+
+TEST_CASE("LogCoalescer: report period", "[Log][LogCoalescer]")
+{
+	const auto timePoint = std::chrono::system_clock::now();
+	auto coalescer = PonyEngine::Log::LogCoalescer(std::chrono::seconds(1));
+	coalescer.Remember(MakeEntry("Message", timePoint));
+	REQUIRE_FALSE(coalescer.IsReportDue(timePoint + std::chrono::seconds(10)));
+
+	coalescer.CountRepeat(MakeEntry("Message", timePoint + std::chrono::milliseconds(100)));
+	REQUIRE_FALSE(coalescer.IsReportDue(timePoint + std::chrono::milliseconds(100)));
+	REQUIRE_FALSE(coalescer.IsReportDue(timePoint + std::chrono::milliseconds(1099)));
+	// No more repeats are needed: the idle dispatcher checks the period with the current time.
+	REQUIRE(coalescer.IsReportDue(timePoint + std::chrono::milliseconds(1100)));
+
+	auto report = PonyEngine::Log::LogEntry();
+	auto reportString = std::string();
+	coalescer.FillReport(report, reportString);
+	REQUIRE_FALSE(coalescer.IsReportDue(timePoint + std::chrono::seconds(10)));
+}
+
+TEST_CASE("LogCoalescer: not coalesced", "[Log][LogCoalescer]")
+{
+	const auto timePoint = std::chrono::system_clock::now();
+
+	auto disabled = PonyEngine::Log::LogCoalescer(std::chrono::nanoseconds::zero());
+	disabled.Remember(MakeEntry("Message", timePoint));
+	REQUIRE_FALSE(disabled.IsRepeat(MakeEntry("Message", timePoint)));
+
+	auto coalescer = PonyEngine::Log::LogCoalescer(std::chrono::seconds(1));
+	PonyEngine::Log::LogEntry exception = MakeEntry("Message", timePoint);
+	exception.exception = std::make_exception_ptr(std::runtime_error("Error"));
+	coalescer.Remember(exception);
+	REQUIRE_FALSE(coalescer.IsRepeat(MakeEntry("Message", timePoint)));
+
+	coalescer.Remember(MakeEntry("Message", timePoint));
+	REQUIRE_FALSE(coalescer.IsRepeat(exception));
+
+	const auto fields = std::array{PonyEngine::Log::LogField("Key", 1)};
+	PonyEngine::Log::LogEntry withFields = MakeEntry("Message", timePoint);
+	withFields.fields = fields;
+	REQUIRE_FALSE(coalescer.IsRepeat(withFields));
+	coalescer.Remember(withFields);
+	REQUIRE_FALSE(coalescer.IsRepeat(MakeEntry("Message", timePoint)));
+}
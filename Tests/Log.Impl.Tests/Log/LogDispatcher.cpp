@@ -0,0 +1,322 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+import std;
+
+import PonyEngine.Log.Impl;
+
+namespace
+{
+	/// @brief Collects the handled records. It may hold the dispatcher thread in the handler to let the records pile up in the queues.
+	class RecordCollector final
+	{
+	public:
+		void Handle(const std::span<PonyEngine::Log::LogRecord> records) noexcept
+		{
+			if (!isOpen.load())
+			{
+				isWaiting.store(true);
+				isWaiting.notify_all();
+				isOpen.wait(false);
+			}
+
+			const auto lock = std::lock_guard(mutex);
+			for (const PonyEngine::Log::LogRecord& record : records)
+			{
+				handled.emplace_back(record.Message());
+			}
+		}
+
+		/// @brief Makes the next handler call wait till the collector is opened.
+		void Close() noexcept
+		{
+			isOpen.store(false);
+			isWaiting.store(false);
+		}
+
+		/// @brief Waits till the handler waits.
+		void WaitHandler() const noexcept
+		{
+			isWaiting.wait(false);
+		}
+
+		void Open() noexcept
+		{
+			isOpen.store(true);
+			isOpen.notify_all();
+		}
+
+		std::vector<std::string> Handled() const
+		{
+			const auto lock = std::lock_guard(mutex);
+			return handled;
+		}
+
+	private:
+		std::vector<std::string> handled;
+		mutable std::mutex mutex;
+		std::atomic<bool> isOpen = true;
+		std::atomic<bool> isWaiting = false;
+	};
+
+	PonyEngine::Log::LogDispatcher::Handler MakeHandler(RecordCollector& collector)
+	{
+		return [&collector](const std::span<PonyEngine::Log::LogRecord> records) noexcept { collector.Handle(records); };
+	}
+
+	PonyEngine::Log::LogRecord MakeRecord(const std::string_view message, const std::chrono::time_point<std::chrono::system_clock> timePoint = std::chrono::system_clock::now())
+	{
+		auto record = PonyEngine::Log::LogRecord();
+		record.Message(message);
+		record.timePoint = timePoint;
+		record.threadId = std::this_thread::get_id();
+		record.logType = PonyEngine::Log::LogType::Info;
+
+		return record;
+	}
+
+	/// @brief Pushes a record and waits till the dispatcher thread holds it in the closed collector.
+	void HoldDispatcher(PonyEngine::Log::LogDispatcher& dispatcher, RecordCollector& collector)
+	{
+		collector.Close();
+		dispatcher.Push(MakeRecord("Hold"));
+		collector.WaitHandler();
+	}
+}
+
+TEST_CASE("LogDispatcher: flush", "[Log][LogDispatcher]")
+{
+	auto collector = RecordCollector();
+	auto dispatcher = PonyEngine::Log::LogDispatcher(PonyEngine::Log::LogDispatcherParams{}, MakeHandler(collector));
+	for (std::size_t i = 0uz; i < 1000uz; ++i)
+	{
+		dispatcher.Push(MakeRecord(std::format("Message {}", i)));
+	}
+	dispatcher.Flush();
+
+	const std::vector<std::string> handled = collector.Handled();
+	REQUIRE(handled.size() == 1000uz);
+	for (std::size_t i = 0uz; i < handled.size(); ++i)
+	{
+		REQUIRE(handled[i] == std::format("Message {}", i));
+	}
+	REQUIRE(dispatcher.QueueSize() == 0uz);
+	REQUIRE(dispatcher.DroppedCount() == 0ull);
+}
+
+TEST_CASE("LogDispatcher: destruction handles queued records", "[Log][LogDispatcher]")
+{
+	auto collector = RecordCollector();
+	{
+		auto dispatcher = PonyEngine::Log::LogDispatcher(PonyEngine::Log::LogDispatcherParams{}, MakeHandler(collector));
+		for (std::size_t i = 0uz; i < 100uz; ++i)
+		{
+			dispatcher.Push(MakeRecord("Message"));
+		}
+	}
+
+	REQUIRE(collector.Handled().size() == 100uz);
+}
+
+TEST_CASE("LogDispatcher: merge order", "[Log][LogDispatcher]")
+{
+	auto collector = RecordCollector();
+	auto dispatcher = PonyEngine::Log::LogDispatcher(PonyEngine::Log::LogDispatcherParams{}, MakeHandler(collector));
+	HoldDispatcher(dispatcher, collector);
+
+	constexpr std::size_t count = 100uz;
+	const auto timePoint = std::chrono::system_clock::now();
+	{
+		// The producers exit together, so that a queue isn't given from one producer to another.
+		auto pushed = std::latch(2);
+		auto producers = std::vector<std::jthread>();
+		for (std::size_t producer = 0uz; producer < 2uz; ++producer)
+		{
+			producers.emplace_back([&dispatcher, &pushed, timePoint, producer]
+			{
+				for (std::size_t i = 0uz; i < count; ++i)
+				{
+					const std::size_t order = i * 2uz + producer;
+					dispatcher.Push(MakeRecord(std::format("{}", order), timePoint + std::chrono::microseconds(order)));
+				}
+				pushed.arrive_and_wait();
+			});
+		}
+	}
+	collector.Open();
+	dispatcher.Flush();
+
+	const std::vector<std::string> handled = collector.Handled();
+	REQUIRE(handled.size() == count * 2uz + 1uz);
+	REQUIRE(handled[0] == "Hold");
+	for (std::size_t i = 1uz; i < handled.size(); ++i)
+	{
+		REQUIRE(handled[i] == std::format("{}", i - 1uz));
+	}
+}
+
+TEST_CASE("LogDispatcher: drop on overflow", "[Log][LogDispatcher]")
+{
+	auto collector = RecordCollector();
+	auto dispatcher = PonyEngine::Log::LogDispatcher(PonyEngine::Log::LogDispatcherParams{.queueSize = 4uz, .overflowPolicy = PonyEngine::Log::LogOverflowPolicy::Drop}, MakeHandler(collector));
+	HoldDispatcher(dispatcher, collector);
+
+	for (std::size_t i = 0uz; i < 100uz; ++i)
+	{
+		dispatcher.Push(MakeRecord(std::format("Message {}", i)));
+	}
+	REQUIRE(dispatcher.DroppedCount() > 0ull);
+	REQUIRE(dispatcher.BlockedCount() == 0ull);
+	collector.Open();
+	dispatcher.Flush();
+
+	const std::vector<std::string> handled = collector.Handled();
+	REQUIRE(handled.size() + dispatcher.DroppedCount() == 101uz);
+	for (std::size_t i = 1uz; i < handled.size(); ++i)
+	{
+		REQUIRE(handled[i] == std::format("Message {}", i - 1uz));
+	}
+}
+
+TEST_CASE("LogDispatcher: drops don't complete a flush", "[Log][LogDispatcher]")
+{
+	auto collector = RecordCollector();
+	auto dispatcher = PonyEngine::Log::LogDispatcher(PonyEngine::Log::LogDispatcherParams{.queueSize = 4uz, .overflowPolicy = PonyEngine::Log::LogOverflowPolicy::Drop}, MakeHandler(collector));
+	HoldDispatcher(dispatcher, collector);
+
+	std::size_t pushedCount = 0uz;
+	while (dispatcher.DroppedCount() == 0ull)
+	{
+		dispatcher.Push(MakeRecord(std::format("Message {}", pushedCount++)));
+	}
+
+	std::atomic<bool> isFlushed = false;
+	auto flusher = std::jthread([&]
+	{
+		dispatcher.Flush();
+		isFlushed.store(true);
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	for (std::size_t i = 0uz; i < 100uz; ++i)
+	{
+		dispatcher.Push(MakeRecord("Dropped"));
+	}
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	const bool isFlushedEarly = isFlushed.load();
+
+	collector.Open();
+	flusher.join();
+	REQUIRE_FALSE(isFlushedEarly);
+	REQUIRE(collector.Handled().size() + dispatcher.DroppedCount() == pushedCount + 101uz);
+}
+
+TEST_CASE("LogDispatcher: block on overflow", "[Log][LogDispatcher]")
+{
+	auto collector = RecordCollector();
+	auto dispatcher = PonyEngine::Log::LogDispatcher(PonyEngine::Log::LogDispatcherParams{.queueSize = 4uz, .overflowPolicy = PonyEngine::Log::LogOverflowPolicy::Block}, MakeHandler(collector));
+	HoldDispatcher(dispatcher, collector);
+
+	{
+		auto producer = std::jthread([&dispatcher]
+		{
+			for (std::size_t i = 0uz; i < 100uz; ++i)
+			{
+				dispatcher.Push(MakeRecord(std::format("Message {}", i)));
+			}
+		});
+		while (dispatcher.BlockedCount() == 0ull)
+		{
+			std::this_thread::yield();
+		}
+		collector.Open();
+	}
+	dispatcher.Flush();
+
+	const std::vector<std::string> handled = collector.Handled();
+	REQUIRE(handled.size() == 101uz);
+	REQUIRE(dispatcher.DroppedCount() == 0ull);
+	REQUIRE(dispatcher.BlockedCount() > 0ull);
+	for (std::size_t i = 1uz; i < handled.size(); ++i)
+	{
+		REQUIRE(handled[i] == std::format("Message {}", i - 1uz));
+	}
+}
+
+TEST_CASE("LogDispatcher: queue hand-over on thread exit", "[Log][LogDispatcher]")
+{
+	auto collector = RecordCollector();
+	auto dispatcher = PonyEngine::Log::LogDispatcher(PonyEngine::Log::LogDispatcherParams{.queueSize = 64uz}, MakeHandler(collector));
+	const auto produce = [&dispatcher]
+	{
+		for (std::size_t i = 0uz; i < 10uz; ++i)
+		{
+			dispatcher.Push(MakeRecord(std::format("Message {}", i)));
+		}
+	};
+
+	std::jthread(produce).join();
+	const std::size_t capacity = dispatcher.QueueCapacity();
+	REQUIRE(capacity >= 64uz);
+	std::jthread(produce).join();
+	REQUIRE(dispatcher.QueueCapacity() == capacity);
+
+	std::atomic<bool> isProduced = false;
+	auto first = std::jthread([&](const std::stop_token stopToken)
+	{
+		produce();
+		isProduced.store(true);
+		isProduced.notify_all();
+		while (!stopToken.stop_requested())
+		{
+			std::this_thread::yield();
+		}
+	});
+	isProduced.wait(false);
+	std::jthread(produce).join();
+	REQUIRE(dispatcher.QueueCapacity() == capacity * 2uz);
+	first.request_stop();
+	first.join();
+	dispatcher.Flush();
+
+	const std::vector<std::string> handled = collector.Handled();
+	REQUIRE(handled.size() == 40uz);
+}
+
+TEST_CASE("LogDispatcher: flush on dispatcher thread", "[Log][LogDispatcher]")
+{
+	PonyEngine::Log::LogDispatcher* dispatcherPointer = nullptr;
+	std::atomic<std::size_t> handledCount = 0uz;
+	auto dispatcher = PonyEngine::Log::LogDispatcher(PonyEngine::Log::LogDispatcherParams{}, [&](const std::span<PonyEngine::Log::LogRecord> records) noexcept
+	{
+		dispatcherPointer->Flush();
+		handledCount.fetch_add(records.size());
+	});
+	dispatcherPointer = &dispatcher;
+
+	dispatcher.Push(MakeRecord("Message"));
+	dispatcher.Flush();
+	REQUIRE(handledCount.load() == 1uz);
+}
+
+TEST_CASE("LogDispatcher: idle handler", "[Log][LogDispatcher]")
+{
+	auto collector = RecordCollector();
+	std::atomic<std::size_t> idleCount = 0uz;
+	auto dispatcher = PonyEngine::Log::LogDispatcher(PonyEngine::Log::LogDispatcherParams{}, MakeHandler(collector), [&]() noexcept { idleCount.fetch_add(1uz); });
+
+	// The idle handler is called at least once per sleep period even if there are no logs.
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while (idleCount.load() < 3uz && std::chrono::steady_clock::now() < deadline)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	REQUIRE(idleCount.load() >= 3uz);
+}
@@ -0,0 +1,147 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "PonyEngine/Log/Log.h"
+
+import std;
+
+import PonyEngine.Log.Impl;
+import PonyEngine.Testing;
+
+namespace
+{
+	/// @brief Logging threads that log together on every run. The threads are started once, so a run measures only the logging.
+	class LogProducers final
+	{
+	public:
+		LogProducers(const PonyEngine::Log::ILogger& logger, const std::size_t producerCount, const std::size_t logCount) :
+			barrier(static_cast<std::ptrdiff_t>(producerCount + 1uz)),
+			isStopped{false}
+		{
+			for (std::size_t producer = 0uz; producer < producerCount; ++producer)
+			{
+				threads.emplace_back([this, &logger, producer, logCount]
+				{
+					while (true)
+					{
+						barrier.arrive_and_wait();
+						if (isStopped.load())
+						{
+							break;
+						}
+
+						for (std::size_t i = 0uz; i < logCount; ++i)
+						{
+							PONY_LOG_PUSH(logger, PonyEngine::Log::LogType::Info, "Producer {} log {}.", producer, i);
+						}
+						barrier.arrive_and_wait();
+					}
+				});
+			}
+		}
+
+		~LogProducers() noexcept
+		{
+			isStopped.store(true);
+			barrier.arrive_and_wait();
+		}
+
+		/// @brief Makes all the threads log and waits for them.
+		void Run()
+		{
+			barrier.arrive_and_wait();
+			barrier.arrive_and_wait();
+		}
+
+	private:
+		std::barrier<> barrier;
+		std::atomic<bool> isStopped;
+		std::vector<std::jthread> threads;
+	};
+}
+
+TEST_CASE("Logger: synchronous logs", "[Log][Logger]")
+{
+	auto loggerContext = PonyEngine::Testing::MockLoggerContext();
+	auto logger = PonyEngine::Log::Logger(loggerContext, std::nullopt);
+	logger.Log(PonyEngine::Log::LogType::Info, "Message");
+	logger.Log(PonyEngine::Log::LogType::Warning, "Message");
+
+	const PonyEngine::Log::LogStatistics statistics = logger.Statistics();
+	REQUIRE(statistics.logCount == 2ull);
+	REQUIRE(statistics.queueCapacity == 0uz);
+}
+
+TEST_CASE("Logger: idle repeat report", "[Log][Logger]")
+{
+	auto loggerContext = PonyEngine::Testing::MockLoggerContext();
+	auto logger = PonyEngine::Log::Logger(loggerContext, PonyEngine::Log::LogDispatcherParams{.repeatReportPeriod = std::chrono::milliseconds(10)});
+	for (int i = 0; i < 3; ++i)
+	{
+		logger.Log(PonyEngine::Log::LogType::Info, "Message");
+	}
+	logger.Flush();
+	REQUIRE(logger.Statistics().repeatedLogCount == 2ull);
+
+	// The report is passed by the idle dispatcher thread without another log.
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while (logger.Statistics().logCount < 2ull && std::chrono::steady_clock::now() < deadline)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	REQUIRE(logger.Statistics().logCount == 2ull);
+}
+
+TEST_CASE("Logger: no allocations on logging threads", "[Log][Logger]")
+{
+	auto loggerContext = PonyEngine::Testing::MockLoggerContext();
+	auto logger = PonyEngine::Log::Logger(loggerContext, PonyEngine::Log::LogDispatcherParams{.repeatReportPeriod = std::chrono::milliseconds::zero()});
+	logger.Log(PonyEngine::Log::LogType::Info, "Frame finished.");
+	logger.Flush();
+
+	// Only the logging thread is counted. The dispatcher thread formats the logs, and the time formatting may allocate.
+	PonyEngine::Testing::RequireNoAllocations([&]
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			logger.Log(PonyEngine::Log::LogType::Info, "Frame finished.");
+		}
+	});
+	logger.Flush();
+	REQUIRE(logger.Statistics().logCount == 101ull);
+}
+
+TEST_CASE("Logger: asynchronous logs from threads", "[Log][Logger]")
+{
+	constexpr std::size_t logCount = 64000uz;
+	auto loggerContext = PonyEngine::Testing::MockLoggerContext();
+	auto logger = PonyEngine::Log::Logger(loggerContext, PonyEngine::Log::LogDispatcherParams{.repeatReportPeriod = std::chrono::milliseconds::zero()});
+
+	std::uint64_t expectedCount = 0ull;
+	for (const std::size_t producerCount : {1uz, 2uz, 4uz, 8uz, 16uz, 32uz, 64uz})
+	{
+		auto producers = LogProducers(logger, producerCount, logCount / producerCount);
+		producers.Run();
+		logger.Flush();
+		expectedCount += logCount / producerCount * producerCount;
+		REQUIRE(logger.Statistics().logCount == expectedCount);
+		REQUIRE(logger.Statistics().droppedLogCount == 0ull);
+
+#if PONY_ENGINE_TESTING_BENCHMARK
+		BENCHMARK(std::format("Logger::Log: {} logs, {} threads", logCount, producerCount))
+		{
+			producers.Run();
+			logger.Flush();
+		};
+#endif
+	}
+}
@@ -50,6 +50,7 @@
 import std;
 
 import PonyEngine.Log;
+import PonyEngine.Math;
 
 class MockLogger final : public PonyEngine::Log::ILogger
 {
@@ -58,8 +59,21 @@ public:
 	mutable std::string lastMsg;
 	mutable std::exception_ptr lastException;
 	mutable std::stacktrace lastStacktrace;
+	mutable std::vector<std::string> lastFields;
 	mutable bool logCalled = false;
 	mutable bool logExceptionCalled = false;
+	mutable bool logDeferredCalled = false;
+	PonyEngine::Log::LogFilter filter;
+
+	virtual PonyEngine::Log::LogFilter& Filter() noexcept override
+	{
+		return filter;
+	}
+
+	virtual const PonyEngine::Log::LogFilter& Filter() const noexcept override
+	{
+		return filter;
+	}
 
 	virtual void Log(const PonyEngine::Log::LogType logType, const std::string_view message) const noexcept override
 	{
@@ -91,6 +105,37 @@ public:
 		lastStacktrace = stacktrace;
 	}
 
+	virtual void Log(const PonyEngine::Log::LogType logType, const PonyEngine::Log::DeferredMessage& message) const noexcept override
+	{
+		logCalled = true;
+		logDeferredCalled = true;
+		lastLogType = logType;
+		lastMsg.clear();
+		message.FormatTo(lastMsg);
+	}
+
+	virtual void Log(const PonyEngine::Log::LogType logType, const PonyEngine::Log::DeferredMessage& message, const std::stacktrace& stacktrace) const noexcept override
+	{
+		logCalled = true;
+		logDeferredCalled = true;
+		lastLogType = logType;
+		lastMsg.clear();
+		message.FormatTo(lastMsg);
+		lastStacktrace = stacktrace;
+	}
+
+	virtual void Log(const PonyEngine::Log::LogType logType, const std::string_view message, const std::span<const PonyEngine::Log::LogField> fields) const noexcept override
+	{
+		logCalled = true;
+		lastLogType = logType;
+		lastMsg = message;
+		lastFields.clear();
+		for (const PonyEngine::Log::LogField& field : fields)
+		{
+			lastFields.push_back(std::format("{}", field));
+		}
+	}
+
 	virtual void Log(const std::exception_ptr& exception) const noexcept override
 	{
 		logExceptionCalled = true;
@@ -164,6 +209,55 @@ TEST_CASE("PONY_LOG format", "[Log][LogMacro]")
 	REQUIRE(logger.lastStacktrace.empty());
 }
 
+TEST_CASE("PONY_LOG deferred format", "[Log][LogMacro]")
+{
+	MockLogger logger;
+	const std::string name = "Pony";
+	const char* const title = "Engine";
+	PONY_LOG(logger, PonyEngine::Log::LogType::Info, "{} {} {} {:.2f} {} {} '{}'", name, title, 42, 3.14159, true, 'c', std::string_view());
+
+	REQUIRE(logger.logCalled);
+	REQUIRE(logger.logDeferredCalled);
+	REQUIRE(logger.lastLogType == PonyEngine::Log::LogType::Info);
+	REQUIRE(logger.lastMsg == "Pony Engine 42 3.14 true c ''");
+}
+
+TEST_CASE("PONY_LOG deferred format fallback", "[Log][LogMacro]")
+{
+	MockLogger logger;
+	const auto longString = std::string(PonyEngine::Log::MaxDeferredArgumentsSize, 'a');
+	PONY_LOG(logger, PonyEngine::Log::LogType::Info, "{}", longString);
+	REQUIRE(logger.logCalled);
+	REQUIRE_FALSE(logger.logDeferredCalled);
+	REQUIRE(logger.lastMsg == longString);
+
+	logger.logDeferredCalled = false;
+	const auto values = std::vector<int>{1, 2};
+	PONY_LOG(logger, PonyEngine::Log::LogType::Info, "{}", values);
+	REQUIRE_FALSE(logger.logDeferredCalled);
+	REQUIRE(logger.lastMsg == "[1, 2]");
+
+	logger.logDeferredCalled = false;
+	const std::string service = "Render";
+	PONY_LOG(logger, PonyEngine::Log::LogType::Info, "{}", PonyEngine::Log::LogField("service", service));
+	REQUIRE_FALSE(logger.logDeferredCalled);
+	REQUIRE(logger.lastMsg == "service=Render");
+}
+
+TEST_CASE("DeferredArgument", "[Log][LogMacro]")
+{
+	STATIC_REQUIRE(PonyEngine::Log::DeferredArgument<int>);
+	STATIC_REQUIRE(PonyEngine::Log::DeferredArgument<double>);
+	STATIC_REQUIRE(PonyEngine::Log::DeferredArgument<PonyEngine::Log::LogType>);
+	STATIC_REQUIRE(PonyEngine::Log::DeferredArgument<const void*>);
+	STATIC_REQUIRE(PonyEngine::Log::DeferredArgument<std::string>);
+	STATIC_REQUIRE(PonyEngine::Log::DeferredArgument<PonyEngine::Math::Vector3<float>>);
+	STATIC_REQUIRE(PonyEngine::Log::DeferredArgument<PonyEngine::Math::Quaternion<float>>);
+	STATIC_REQUIRE_FALSE(PonyEngine::Log::DeferredArgument<PonyEngine::Log::LogField>);
+	STATIC_REQUIRE_FALSE(PonyEngine::Log::DeferredArgument<std::span<const int>>);
+	STATIC_REQUIRE_FALSE(PonyEngine::Log::DeferredArgument<int*>);
+}
+
 TEST_CASE("PONY_LOG_IF", "[Log][LogMacro]")
 {
 	MockLogger logger;
@@ -268,3 +362,143 @@ TEST_CASE("PONY_LOG_X_IF", "[Log][LogMacro]")
 	REQUIRE(logger.lastException == exception);
 	REQUIRE(logger.lastStacktrace.empty());
 }
+
+TEST_CASE("PONY_LOG runtime filter", "[Log][LogMacro]")
+{
+	MockLogger logger;
+	int evaluated = 0;
+	const auto argument = [&evaluated]() noexcept { ++evaluated; return 42; };
+
+	logger.Filter().MinType(PonyEngine::Log::LogType::Warning);
+	REQUIRE(logger.Filter().TypeMask() == (PonyEngine::Log::LogTypeMask::Warning | PonyEngine::Log::LogTypeMask::Error | PonyEngine::Log::LogTypeMask::Exception));
+	PONY_LOG(logger, PonyEngine::Log::LogType::Info, "Value: {}.", argument());
+	PONY_LOG_IF(true, logger, PonyEngine::Log::LogType::Debug, "Value: {}.", argument());
+	REQUIRE_FALSE(logger.logCalled);
+	REQUIRE(evaluated == 0);
+
+	PONY_LOG(logger, PonyEngine::Log::LogType::Warning, "Value: {}.", argument());
+	REQUIRE(logger.logCalled);
+	REQUIRE(evaluated == 1);
+	REQUIRE(logger.lastMsg == "Value: 42.");
+
+	logger.Filter().TypeMask(PonyEngine::Log::LogTypeMask::None);
+	logger.logExceptionCalled = false;
+	PONY_LOG_X(logger, std::make_exception_ptr(std::runtime_error("Test exception.")), "Value: {}.", argument());
+	REQUIRE_FALSE(logger.logExceptionCalled);
+	REQUIRE(evaluated == 1);
+}
+
+TEST_CASE("PONY_LOG_C", "[Log][LogMacro]")
+{
+	MockLogger logger;
+	const PonyEngine::Log::LogCategory render = logger.Filter().RegisterCategory("Render");
+	const PonyEngine::Log::LogCategory audio = logger.Filter().RegisterCategory("Audio");
+	REQUIRE(render != PonyEngine::Log::DefaultLogCategory);
+	REQUIRE(render != audio);
+	REQUIRE(logger.Filter().RegisterCategory("Render") == render);
+	REQUIRE(logger.Filter().FindCategory("Audio") == audio);
+	REQUIRE_FALSE(logger.Filter().FindCategory("Physics"));
+	REQUIRE(logger.Filter().CategoryCount() == 3uz);
+	REQUIRE(logger.Filter().CategoryName(PonyEngine::Log::DefaultLogCategory) == PonyEngine::Log::LogFilter::DefaultCategoryName);
+	REQUIRE(logger.Filter().CategoryName(render) == "Render");
+
+	logger.Filter().EnableCategory(render, false);
+	REQUIRE_FALSE(logger.Filter().IsCategoryEnabled(render));
+	PONY_LOG_C(logger, render, PonyEngine::Log::LogType::Info, "Render message.");
+	PONY_LOG_C_IF(true, logger, render, PonyEngine::Log::LogType::Info, "Render message.");
+	REQUIRE_FALSE(logger.logCalled);
+
+	PONY_LOG_C(logger, audio, PonyEngine::Log::LogType::Info, "Audio message.");
+	REQUIRE(logger.logCalled);
+	REQUIRE(logger.lastMsg == "Audio message.");
+
+	logger.Filter().EnableCategory(render, true);
+	PONY_LOG_C_IF(true, logger, render, PonyEngine::Log::LogType::Info, "Render message.");
+	REQUIRE(logger.lastMsg == "Render message.");
+}
+
+TEST_CASE("LogFilter category limit", "[Log][LogFilter]")
+{
+	auto filter = PonyEngine::Log::LogFilter();
+	for (std::size_t i = filter.CategoryCount(); i < PonyEngine::Log::LogFilter::MaxCategoryCount; ++i)
+	{
+		const PonyEngine::Log::LogCategory category = filter.RegisterCategory(std::format("Category{}", i));
+		REQUIRE(filter.IsEnabled(PonyEngine::Log::LogType::Info, category));
+	}
+	REQUIRE_THROWS_AS(filter.RegisterCategory("Overflow"), std::length_error);
+	REQUIRE(filter.IsEnabled(PonyEngine::Log::LogType::Info));
+}
+
+TEST_CASE("PONY_LOG_EVERY_N", "[Log][LogMacro]")
+{
+	MockLogger logger;
+	int evaluated = 0;
+	const auto argument = [&evaluated]() noexcept { return ++evaluated; };
+
+	std::size_t logCount = 0uz;
+	for (int i = 0; i < 10; ++i)
+	{
+		logger.logCalled = false;
+		PONY_LOG_EVERY_N(logger, 4u, PonyEngine::Log::LogType::Info, "Value: {}.", argument());
+		logCount += logger.logCalled;
+	}
+	REQUIRE(logCount == 3uz);
+	REQUIRE(evaluated == 3);
+	REQUIRE(logger.lastMsg == "Value: 3.");
+}
+
+TEST_CASE("PONY_LOG_RATE_LIMITED", "[Log][LogMacro]")
+{
+	MockLogger logger;
+	int evaluated = 0;
+	const auto argument = [&evaluated]() noexcept { return ++evaluated; };
+
+	std::size_t logCount = 0uz;
+	for (int i = 0; i < 10; ++i)
+	{
+		logger.logCalled = false;
+		PONY_LOG_RATE_LIMITED(logger, std::chrono::hours(1), PonyEngine::Log::LogType::Warning, "Value: {}.", argument());
+		logCount += logger.logCalled;
+	}
+	REQUIRE(logCount == 1uz);
+	REQUIRE(evaluated == 1);
+
+	auto limiter = PonyEngine::Log::LogRateLimiter();
+	REQUIRE(limiter.TryPass(std::chrono::nanoseconds::zero()));
+	REQUIRE(limiter.TryPass(std::chrono::nanoseconds::zero()));
+	REQUIRE(limiter.TryPass(std::chrono::hours(1)));
+	REQUIRE_FALSE(limiter.TryPass(std::chrono::hours(1)));
+	REQUIRE(limiter.RejectedCount() == 1ull);
+}
+
+TEST_CASE("PONY_LOG_FIELDS", "[Log][LogMacro]")
+{
+	MockLogger logger;
+	const std::string service = "Render";
+	PONY_LOG_FIELDS(logger, PonyEngine::Log::LogType::Info, "Frame finished.", {"frame", 42ull}, {"delta", -3}, {"time", 16.5}, {"vsync", true},
+		{"service", service}, {"scene", "Main"});
+	REQUIRE(logger.logCalled);
+	REQUIRE(logger.lastLogType == PonyEngine::Log::LogType::Info);
+	REQUIRE(logger.lastMsg == "Frame finished.");
+	REQUIRE(logger.lastFields == std::vector<std::string>{"frame=42", "delta=-3", "time=16.5", "vsync=true", "service=Render", "scene=Main"});
+
+	logger.logCalled = false;
+	int evaluated = 0;
+	logger.filter.MinType(PonyEngine::Log::LogType::Warning);
+	PONY_LOG_FIELDS(logger, PonyEngine::Log::LogType::Info, "Filtered.", {"value", ++evaluated});
+	REQUIRE_FALSE(logger.logCalled);
+	REQUIRE(evaluated == 0);
+}
+
+TEST_CASE("LogField", "[Log][LogField]")
+{
+	constexpr auto intField = PonyEngine::Log::LogField("int", -5);
+	STATIC_REQUIRE(intField.Type() == PonyEngine::Log::LogFieldType::Int);
+	STATIC_REQUIRE(intField.Int() == -5ll);
+	STATIC_REQUIRE(PonyEngine::Log::LogField("uint", 5u).Type() == PonyEngine::Log::LogFieldType::UInt);
+	STATIC_REQUIRE(PonyEngine::Log::LogField("float", 1.5f).Type() == PonyEngine::Log::LogFieldType::Float);
+	STATIC_REQUIRE(PonyEngine::Log::LogField("bool", false).Type() == PonyEngine::Log::LogFieldType::Bool);
+	STATIC_REQUIRE(PonyEngine::Log::LogField("string", "text").Type() == PonyEngine::Log::LogFieldType::String);
+	STATIC_REQUIRE(PonyEngine::Log::LogField("string", "text").String() == "text");
+	STATIC_REQUIRE(PonyEngine::Log::LogField("key", "text").Key() == "key");
+}
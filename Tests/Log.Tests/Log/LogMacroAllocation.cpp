@@ -0,0 +1,72 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#ifndef PONY_LOG_VERBOSE
+#define PONY_LOG_VERBOSE
+#endif
+#ifndef PONY_LOG_DEBUG
+#define PONY_LOG_DEBUG
+#endif
+#ifndef PONY_LOG_INFO
+#define PONY_LOG_INFO
+#endif
+#ifndef PONY_LOG_WARNING
+#define PONY_LOG_WARNING
+#endif
+#ifndef PONY_LOG_ERROR
+#define PONY_LOG_ERROR
+#endif
+#ifndef PONY_LOG_EXCEPTION
+#define PONY_LOG_EXCEPTION
+#endif
+#ifdef PONY_LOG_STACKTRACE_VERBOSE
+#undef PONY_LOG_STACKTRACE_VERBOSE
+#endif
+#ifdef PONY_LOG_STACKTRACE_DEBUG
+#undef PONY_LOG_STACKTRACE_DEBUG
+#endif
+#ifdef PONY_LOG_STACKTRACE_INFO
+#undef PONY_LOG_STACKTRACE_INFO
+#endif
+#ifdef PONY_LOG_STACKTRACE_WARNING
+#undef PONY_LOG_STACKTRACE_WARNING
+#endif
+#ifdef PONY_LOG_STACKTRACE_ERROR
+#undef PONY_LOG_STACKTRACE_ERROR
+#endif
+#ifdef PONY_LOG_STACKTRACE_EXCEPTION
+#undef PONY_LOG_STACKTRACE_EXCEPTION
+#endif
+#include "PonyEngine/Log/Log.h"
+
+import std;
+
+import PonyEngine.Log;
+import PonyEngine.Testing;
+
+TEST_CASE("PONY_LOG no allocations", "[Log][LogMacro]")
+{
+	auto logger = PonyEngine::Testing::MockLogger();
+	const auto exception = std::make_exception_ptr(std::runtime_error("Exception"));
+
+	PonyEngine::Testing::RequireNoAllocations([&]
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			PONY_LOG(logger, PonyEngine::Log::LogType::Info, "Message");
+			PONY_LOG(logger, PonyEngine::Log::LogType::Warning, "Format {} {}", i, 3.14f);
+			PONY_LOG_IF(i % 2 == 0, logger, PonyEngine::Log::LogType::Error, "Conditional");
+			PONY_LOG_X(logger, exception, "Exception {}", i);
+			PONY_LOG_FIELDS(logger, PonyEngine::Log::LogType::Info, "Frame", {"frame", i}, {"service", "Render"}, {"time", 16.6});
+		}
+	});
+	REQUIRE(logger.LogCount() == 450uz);
+}
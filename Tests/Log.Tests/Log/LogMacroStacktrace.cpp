@@ -60,6 +60,17 @@ public:
 	mutable std::stacktrace lastStacktrace;
 	mutable bool logCalled = false;
 	mutable bool logExceptionCalled = false;
+	PonyEngine::Log::LogFilter filter;
+
+	virtual PonyEngine::Log::LogFilter& Filter() noexcept override
+	{
+		return filter;
+	}
+
+	virtual const PonyEngine::Log::LogFilter& Filter() const noexcept override
+	{
+		return filter;
+	}
 
 	virtual void Log(const PonyEngine::Log::LogType logType, const std::string_view message) const noexcept override
 	{
@@ -91,6 +102,30 @@ public:
 		lastStacktrace = stacktrace;
 	}
 
+	virtual void Log(const PonyEngine::Log::LogType logType, const PonyEngine::Log::DeferredMessage& message) const noexcept override
+	{
+		logCalled = true;
+		lastLogType = logType;
+		lastMsg.clear();
+		message.FormatTo(lastMsg);
+	}
+
+	virtual void Log(const PonyEngine::Log::LogType logType, const PonyEngine::Log::DeferredMessage& message, const std::stacktrace& stacktrace) const noexcept override
+	{
+		logCalled = true;
+		lastLogType = logType;
+		lastMsg.clear();
+		message.FormatTo(lastMsg);
+		lastStacktrace = stacktrace;
+	}
+
+	virtual void Log(const PonyEngine::Log::LogType logType, const std::string_view message, const std::span<const PonyEngine::Log::LogField>) const noexcept override
+	{
+		logCalled = true;
+		lastLogType = logType;
+		lastMsg = message;
+	}
+
 	virtual void Log(const std::exception_ptr& exception) const noexcept override
 	{
 		logExceptionCalled = true;
@@ -0,0 +1,123 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+import std;
+
+import PonyEngine.Application.Ext;
+import PonyEngine.RawInput;
+import PonyEngine.RawInput.Ext;
+import PonyEngine.RawInput.Impl;
+import PonyEngine.Testing;
+
+namespace
+{
+	/// @brief Keyboard provider that presses 'A' on every tick.
+	class KeyboardProvider final : public PonyEngine::RawInput::IInputProvider
+	{
+	public:
+		[[nodiscard("Pure constructor")]]
+		explicit KeyboardProvider(PonyEngine::RawInput::IRawInputContext& input) noexcept :
+			input{&input}
+		{
+		}
+
+		virtual void Begin() override
+		{
+			keyboard = input->RegisterDevice(PonyEngine::RawInput::MakeDeviceTypeID(PonyEngine::RawInput::KeyboardDevice::GenericType), "Keyboard", true);
+		}
+
+		virtual void End() override
+		{
+			input->UnregisterDevice(keyboard);
+		}
+
+		virtual void Tick() override
+		{
+			input->AddInput(keyboard, PonyEngine::RawInput::RawInputEvent{.axes = axes, .values = values, .timePoint = std::chrono::steady_clock::now()});
+		}
+
+	private:
+		static constexpr std::array<PonyEngine::RawInput::AxisID, 1> axes = {PonyEngine::RawInput::MakeAxisID(PonyEngine::RawInput::KeyboardLayout::MainAPath)};
+		static constexpr std::array<float, 1> values = {1.f};
+
+		PonyEngine::RawInput::IRawInputContext* input;
+		PonyEngine::RawInput::DeviceHandle keyboard;
+	};
+
+	/// @brief Raw input service with a keyboard provider.
+	class RawInputFixture final
+	{
+	public:
+		RawInputFixture() :
+			service(application)
+		{
+			service.AddTickableServices(adder);
+			service.AddInterfaces(adder);
+			provider = service.AddProvider([](PonyEngine::RawInput::IRawInputContext& input)
+			{
+				return std::make_shared<KeyboardProvider>(input);
+			});
+			application.FlowState(PonyEngine::Application::FlowState::Beginning);
+			service.Begin();
+			application.FlowState(PonyEngine::Application::FlowState::Running);
+		}
+
+		~RawInputFixture() noexcept
+		{
+			application.FlowState(PonyEngine::Application::FlowState::Ending);
+			service.End();
+			application.FlowState(PonyEngine::Application::FlowState::ShuttingDown);
+			service.RemoveProvider(provider);
+		}
+
+		void Tick()
+		{
+			adder.TickableServices()[0]->Tick();
+		}
+
+		[[nodiscard("Pure function")]]
+		const PonyEngine::RawInput::IRawInputService& Input() const noexcept
+		{
+			return *adder.FindInterface<PonyEngine::RawInput::IRawInputService>();
+		}
+
+	private:
+		PonyEngine::Testing::MockApplicationContext application;
+		PonyEngine::RawInput::RawInputService service;
+		PonyEngine::Testing::MockServiceAdder adder;
+		PonyEngine::RawInput::InputProviderHandle provider;
+	};
+}
+
+TEST_CASE("RawInputService: tick", "[RawInput][RawInputService]")
+{
+	auto fixture = RawInputFixture();
+	REQUIRE(fixture.Input().DeviceCount() == 1uz);
+	REQUIRE(fixture.Input().Value(PonyEngine::RawInput::MakeAxisID(PonyEngine::RawInput::KeyboardLayout::MainAPath)) == 0.f);
+
+	fixture.Tick();
+	REQUIRE(fixture.Input().Value(PonyEngine::RawInput::MakeAxisID(PonyEngine::RawInput::KeyboardLayout::MainAPath)) == 1.f);
+	REQUIRE(fixture.Input().LastInputDevice() == fixture.Input().Device(0uz));
+}
+
+TEST_CASE("RawInputService: no allocations on tick", "[RawInput][RawInputService]")
+{
+	auto fixture = RawInputFixture();
+	fixture.Tick();
+
+	PonyEngine::Testing::RequireNoAllocations([&]
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			fixture.Tick();
+		}
+	});
+}
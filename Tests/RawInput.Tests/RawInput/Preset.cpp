@@ -0,0 +1,50 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+import std;
+
+import PonyEngine.RawInput;
+
+TEST_CASE("MakeAxisID", "[RawInput][Preset]")
+{
+	STATIC_REQUIRE(PonyEngine::RawInput::MakeAxisID("Keyboard/Main/A") == PonyEngine::RawInput::MakeAxisID(PonyEngine::RawInput::KeyboardLayout::MainAPath));
+	STATIC_REQUIRE(PonyEngine::RawInput::MakeAxisID("Keyboard/Main/A") != PonyEngine::RawInput::MakeAxisID("Keyboard/Main/B"));
+	STATIC_REQUIRE(PonyEngine::RawInput::MakeAxisID("Keyboard/Main/A").index == 0u);
+}
+
+TEST_CASE("MakeDeviceTypeID", "[RawInput][Preset]")
+{
+	STATIC_REQUIRE(PonyEngine::RawInput::MakeDeviceTypeID("Gamepad") == PonyEngine::RawInput::MakeDeviceTypeID(PonyEngine::RawInput::GamepadDevice::GenericType));
+	STATIC_REQUIRE(PonyEngine::RawInput::MakeDeviceTypeID("Gamepad") != PonyEngine::RawInput::MakeDeviceTypeID("Gamepad/Xbox"));
+}
+
+TEST_CASE("Preset axes", "[RawInput][Preset]")
+{
+	auto ids = std::unordered_set<PonyEngine::RawInput::AxisID>();
+	for (const std::string_view path : PonyEngine::RawInput::PresetAxisPaths)
+	{
+		REQUIRE(PonyEngine::RawInput::Axis(path).Path() == path);
+		REQUIRE(ids.insert(PonyEngine::RawInput::MakeAxisID(path)).second);
+	}
+	REQUIRE(std::ranges::contains(PonyEngine::RawInput::PresetAxisPaths, PonyEngine::RawInput::MouseLayout::ButtonLeftPath));
+	REQUIRE(std::ranges::contains(PonyEngine::RawInput::PresetAxisPaths, PonyEngine::RawInput::GamepadLayout::SystemGuidePath));
+	REQUIRE(!std::ranges::contains(PonyEngine::RawInput::PresetAxisPaths, PonyEngine::RawInput::KeyboardLayout::MainPath));
+}
+
+TEST_CASE("Preset device types", "[RawInput][Preset]")
+{
+	auto ids = std::unordered_set<PonyEngine::RawInput::DeviceTypeID>();
+	for (const std::string_view type : PonyEngine::RawInput::PresetDeviceTypes)
+	{
+		REQUIRE(PonyEngine::RawInput::DeviceType(type).Type() == type);
+		REQUIRE(ids.insert(PonyEngine::RawInput::MakeDeviceTypeID(type)).second);
+	}
+}
@@ -0,0 +1,187 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+import std;
+
+import PonyEngine.RenderDevice;
+import PonyEngine.Testing;
+
+TEST_CASE("HeapAllocator: create", "[RenderDevice][HeapAllocator]")
+{
+	const auto allocator = PonyEngine::RenderDevice::HeapAllocator(1024ull * 1024ull + 100ull, 4096ull);
+	REQUIRE(allocator.HeapSize() == 1024ull * 1024ull);
+	REQUIRE(allocator.Granularity() == 4096ull);
+
+	const PonyEngine::RenderDevice::HeapAllocatorStatistics statistics = allocator.Statistics();
+	REQUIRE(statistics.heapSize == 1024ull * 1024ull);
+	REQUIRE(statistics.usedSize == 0ull);
+	REQUIRE(statistics.freeSize == 1024ull * 1024ull);
+	REQUIRE(statistics.largestFreeBlockSize == 1024ull * 1024ull);
+	REQUIRE(statistics.allocationCount == 0u);
+	REQUIRE(statistics.freeBlockCount == 1u);
+	REQUIRE(statistics.Fragmentation() == 0.f);
+
+	REQUIRE_THROWS(PonyEngine::RenderDevice::HeapAllocator(1024ull, 4096ull));
+	REQUIRE_THROWS(PonyEngine::RenderDevice::HeapAllocator(1024ull * 1024ull, 3000ull));
+}
+
+TEST_CASE("HeapAllocator: allocate", "[RenderDevice][HeapAllocator]")
+{
+	auto allocator = PonyEngine::RenderDevice::HeapAllocator(16ull * 1024ull * 1024ull, 4096ull);
+
+	const std::optional<PonyEngine::RenderDevice::HeapAllocation> small = allocator.Allocate(100ull, 4096ull);
+	REQUIRE(small);
+	REQUIRE(small->offset == 0ull);
+	REQUIRE(small->size == 4096ull);
+
+	const std::optional<PonyEngine::RenderDevice::HeapAllocation> buffer = allocator.Allocate(70000ull, PonyEngine::RenderDevice::HeapAllocator::DefaultResourceAlignment);
+	REQUIRE(buffer);
+	REQUIRE(buffer->offset % PonyEngine::RenderDevice::HeapAllocator::DefaultResourceAlignment == 0ull);
+	REQUIRE(buffer->offset >= small->offset + small->size);
+	REQUIRE(buffer->size == 73728ull);
+
+	const std::optional<PonyEngine::RenderDevice::HeapAllocation> multisample = allocator.Allocate(4096ull, PonyEngine::RenderDevice::HeapAllocator::MultisampleResourceAlignment);
+	REQUIRE(multisample);
+	REQUIRE(multisample->offset % PonyEngine::RenderDevice::HeapAllocator::MultisampleResourceAlignment == 0ull);
+
+	const PonyEngine::RenderDevice::HeapAllocatorStatistics statistics = allocator.Statistics();
+	REQUIRE(statistics.allocationCount == 3u);
+	REQUIRE(statistics.usedSize == small->size + buffer->size + multisample->size);
+	REQUIRE(statistics.freeSize == statistics.heapSize - statistics.usedSize);
+	REQUIRE(statistics.Fragmentation() > 0.f);
+
+	REQUIRE(!allocator.Allocate(32ull * 1024ull * 1024ull, 4096ull));
+}
+
+TEST_CASE("HeapAllocator: free", "[RenderDevice][HeapAllocator]")
+{
+	auto allocator = PonyEngine::RenderDevice::HeapAllocator(1024ull * 1024ull, 4096ull);
+
+	auto allocations = std::vector<PonyEngine::RenderDevice::HeapAllocation>();
+	for (std::optional<PonyEngine::RenderDevice::HeapAllocation> allocation = allocator.Allocate(4096ull, 4096ull); allocation; allocation = allocator.Allocate(4096ull, 4096ull))
+	{
+		allocations.push_back(*allocation);
+	}
+	REQUIRE(allocations.size() == 256uz);
+	REQUIRE(allocator.Statistics().freeSize == 0ull);
+
+	for (std::size_t i = 0uz; i < allocations.size(); i += 2uz)
+	{
+		allocator.Free(allocations[i]);
+	}
+	PonyEngine::RenderDevice::HeapAllocatorStatistics statistics = allocator.Statistics();
+	REQUIRE(statistics.freeBlockCount == 128u);
+	REQUIRE(statistics.largestFreeBlockSize == 4096ull);
+	REQUIRE(!allocator.Allocate(8192ull, 4096ull));
+
+	for (std::size_t i = 1uz; i < allocations.size(); i += 2uz)
+	{
+		allocator.Free(allocations[i]);
+	}
+	statistics = allocator.Statistics();
+	REQUIRE(statistics.allocationCount == 0u);
+	REQUIRE(statistics.freeBlockCount == 1u);
+	REQUIRE(statistics.largestFreeBlockSize == allocator.HeapSize());
+
+	const std::optional<PonyEngine::RenderDevice::HeapAllocation> whole = allocator.Allocate(allocator.HeapSize(), 4096ull);
+	REQUIRE(whole);
+	REQUIRE(whole->offset == 0ull);
+}
+
+TEST_CASE("HeapAllocator: random", "[RenderDevice][HeapAllocator]")
+{
+	auto allocator = PonyEngine::RenderDevice::HeapAllocator(64ull * 1024ull * 1024ull, 4096ull);
+	auto random = std::mt19937_64(42ull);
+	auto allocations = std::vector<PonyEngine::RenderDevice::HeapAllocation>();
+
+	for (std::size_t i = 0uz; i < 10000uz; ++i)
+	{
+		if (allocations.empty() || random() % 3ull)
+		{
+			const std::uint64_t size = 1ull + random() % (1024ull * 1024ull);
+			const std::uint64_t alignment = 1ull << (12ull + random() % 7ull);
+			if (const std::optional<PonyEngine::RenderDevice::HeapAllocation> allocation = allocator.Allocate(size, alignment))
+			{
+				REQUIRE(allocation->offset % alignment == 0ull);
+				REQUIRE(allocation->size >= size);
+				REQUIRE(allocation->offset + allocation->size <= allocator.HeapSize());
+				allocations.push_back(*allocation);
+			}
+		}
+		else
+		{
+			const std::size_t index = random() % allocations.size();
+			allocator.Free(allocations[index]);
+			allocations[index] = allocations.back();
+			allocations.pop_back();
+		}
+	}
+
+	std::ranges::sort(allocations, std::less<std::uint64_t>(), &PonyEngine::RenderDevice::HeapAllocation::offset);
+	for (std::size_t i = 1uz; i < allocations.size(); ++i)
+	{
+		REQUIRE(allocations[i - 1uz].offset + allocations[i - 1uz].size <= allocations[i].offset);
+	}
+
+	const PonyEngine::RenderDevice::HeapAllocatorStatistics statistics = allocator.Statistics();
+	REQUIRE(statistics.allocationCount == allocations.size());
+	REQUIRE(statistics.usedSize == std::ranges::fold_left(allocations | std::views::transform(&PonyEngine::RenderDevice::HeapAllocation::size), 0ull, std::plus<std::uint64_t>()));
+
+	for (const PonyEngine::RenderDevice::HeapAllocation& allocation : allocations)
+	{
+		allocator.Free(allocation);
+	}
+	REQUIRE(allocator.Statistics().freeBlockCount == 1u);
+}
+
+TEST_CASE("HeapAllocator: no allocations", "[RenderDevice][HeapAllocator]")
+{
+	auto allocator = PonyEngine::RenderDevice::HeapAllocator(16ull * 1024ull * 1024ull, 4096ull);
+	allocator.Free(*allocator.Allocate(70000ull));
+
+	PonyEngine::Testing::RequireNoAllocations([&]
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			const std::optional<PonyEngine::RenderDevice::HeapAllocation> allocation = allocator.Allocate(70000ull);
+			allocator.Free(*allocation);
+		}
+	});
+}
+
+TEST_CASE("HeapAllocator: performance", "[RenderDevice][HeapAllocator]")
+{
+#if PONY_ENGINE_TESTING_BENCHMARK
+	auto allocator = PonyEngine::RenderDevice::HeapAllocator(256ull * 1024ull * 1024ull, 4096ull);
+	auto allocations = std::vector<PonyEngine::RenderDevice::HeapAllocation>();
+	for (std::size_t i = 0uz; i < 1000uz; ++i)
+	{
+		allocations.push_back(*allocator.Allocate(4096ull * (1ull + i % 16ull), 65536ull));
+	}
+	for (std::size_t i = 0uz; i < allocations.size(); i += 2uz)
+	{
+		allocator.Free(allocations[i]);
+	}
+
+	BENCHMARK("Allocate-Free")
+	{
+		const std::optional<PonyEngine::RenderDevice::HeapAllocation> allocation = allocator.Allocate(65536ull, 65536ull);
+		allocator.Free(*allocation);
+		return allocation->offset;
+	};
+
+	BENCHMARK("Statistics")
+	{
+		return allocator.Statistics();
+	};
+#endif
+}
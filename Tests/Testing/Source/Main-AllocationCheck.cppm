@@ -0,0 +1,48 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+module;
+
+#include <catch2/catch_test_macros.hpp>
+
+export module PonyEngine.Testing:AllocationCheck;
+
+import std;
+
+import :AllocationCounter;
+
+export namespace PonyEngine::Testing
+{
+	/// @brief Requires the @p counter to count no allocations. On failure, the counter report is shown.
+	/// @param counter Allocation counter.
+	void RequireNoAllocations(const AllocationCounter& counter);
+	/// @brief Calls the @p function and requires it not to allocate on the current thread. On failure, the counter report is shown.
+	/// @tparam Function Function type.
+	/// @param function Function.
+	template<std::invocable Function>
+	void RequireNoAllocations(Function&& function);
+}
+
+namespace PonyEngine::Testing
+{
+	void RequireNoAllocations(const AllocationCounter& counter)
+	{
+		INFO(counter.Report());
+		REQUIRE(counter.AllocationCount() == 0uz);
+	}
+
+	template<std::invocable Function>
+	void RequireNoAllocations(Function&& function)
+	{
+		auto counter = AllocationCounter();
+		std::invoke(std::forward<Function>(function));
+		counter.Stop();
+		RequireNoAllocations(counter);
+	}
+}
@@ -0,0 +1,202 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+module;
+
+#include <cassert>
+
+export module PonyEngine.Testing:AllocationCounter;
+
+import std;
+
+export namespace PonyEngine::Testing
+{
+	/// @brief Records the allocation in the active counters of the current thread.
+	/// @param size Allocation size.
+	/// @note It's called by the replaced global operator new.
+	void RecordAllocation(std::size_t size) noexcept;
+
+	/// @brief Counts global operator new calls made by the current thread while it's active.
+	/// @details Counters can be nested; an allocation is counted by every active counter of the thread.
+	///          Stacktraces of the first allocations are captured to show where they come from.
+	/// @note It works only if the test executable links PonyEngine.Testing that replaces the global operator new.
+	class AllocationCounter final
+	{
+	public:
+		static constexpr std::size_t DefaultStacktraceCount = 4uz; ///< Default max captured stacktrace count.
+
+		/// @brief Creates a counter and starts counting.
+		/// @param maxStacktraceCount Max captured stacktrace count.
+		[[nodiscard("Pure constructor")]]
+		explicit AllocationCounter(std::size_t maxStacktraceCount = DefaultStacktraceCount);
+		AllocationCounter(const AllocationCounter&) = delete;
+		AllocationCounter(AllocationCounter&&) = delete;
+
+		~AllocationCounter() noexcept;
+
+		/// @brief Gets the allocation count.
+		/// @return Allocation count.
+		[[nodiscard("Pure function")]]
+		std::size_t AllocationCount() const noexcept;
+		/// @brief Gets the allocated byte count.
+		/// @return Allocated byte count.
+		[[nodiscard("Pure function")]]
+		std::size_t AllocatedBytes() const noexcept;
+		/// @brief Gets the captured stacktraces.
+		/// @return Stacktraces of the first allocations.
+		[[nodiscard("Pure function")]]
+		std::span<const std::stacktrace> Stacktraces() const noexcept;
+
+		/// @brief Checks if the counter is counting.
+		/// @return @a True if it's counting; @a false otherwise.
+		[[nodiscard("Pure function")]]
+		bool IsActive() const noexcept;
+		/// @brief Stops counting.
+		/// @note Nested counters must be stopped in the reverse order.
+		void Stop() noexcept;
+
+		/// @brief Resets the counts and the stacktraces. The counter stays active.
+		void Reset() noexcept;
+
+		/// @brief Creates a human-readable report with the counts and the stacktraces.
+		/// @return Report.
+		[[nodiscard("Pure function")]]
+		std::string Report() const;
+
+		AllocationCounter& operator =(const AllocationCounter&) = delete;
+		AllocationCounter& operator =(AllocationCounter&&) = delete;
+
+	private:
+		/// @brief Records the allocation in this counter and in the outer ones.
+		/// @param size Allocation size.
+		void Record(std::size_t size) noexcept;
+
+		std::vector<std::stacktrace> stacktraces; ///< Captured stacktraces.
+		std::size_t maxStacktraceCount; ///< Max captured stacktrace count.
+		std::size_t allocationCount; ///< Allocation count.
+		std::size_t allocatedBytes; ///< Allocated byte count.
+
+		AllocationCounter* outer; ///< Outer active counter or nullptr.
+		bool isActive; ///< Is the counter counting?
+
+		friend void RecordAllocation(std::size_t size) noexcept;
+	};
+}
+
+namespace PonyEngine::Testing
+{
+	/// @brief Innermost active counter of the thread.
+	thread_local AllocationCounter* activeCounter = nullptr;
+	/// @brief Is the thread recording an allocation? Allocations made while recording aren't counted.
+	thread_local bool isRecording = false;
+
+	AllocationCounter::AllocationCounter(const std::size_t maxStacktraceCount) :
+		maxStacktraceCount{maxStacktraceCount},
+		allocationCount{0uz},
+		allocatedBytes{0uz},
+		outer{activeCounter},
+		isActive{true}
+	{
+		stacktraces.reserve(maxStacktraceCount);
+		activeCounter = this;
+	}
+
+	AllocationCounter::~AllocationCounter() noexcept
+	{
+		Stop();
+	}
+
+	std::size_t AllocationCounter::AllocationCount() const noexcept
+	{
+		return allocationCount;
+	}
+
+	std::size_t AllocationCounter::AllocatedBytes() const noexcept
+	{
+		return allocatedBytes;
+	}
+
+	std::span<const std::stacktrace> AllocationCounter::Stacktraces() const noexcept
+	{
+		return stacktraces;
+	}
+
+	bool AllocationCounter::IsActive() const noexcept
+	{
+		return isActive;
+	}
+
+	void AllocationCounter::Stop() noexcept
+	{
+		if (!isActive)
+		{
+			return;
+		}
+
+		assert(activeCounter == this && "Nested allocation counters are stopped in the wrong order.");
+		activeCounter = outer;
+		outer = nullptr;
+		isActive = false;
+	}
+
+	void AllocationCounter::Reset() noexcept
+	{
+		stacktraces.clear();
+		allocationCount = 0uz;
+		allocatedBytes = 0uz;
+	}
+
+	std::string AllocationCounter::Report() const
+	{
+		auto report = std::format("{} allocation(s), {} byte(s).", allocationCount, allocatedBytes);
+		for (std::size_t i = 0uz; i < stacktraces.size(); ++i)
+		{
+			std::format_to(std::back_inserter(report), "\nAllocation {}:\n{}", i, std::to_string(stacktraces[i]));
+		}
+		if (allocationCount > stacktraces.size())
+		{
+			std::format_to(std::back_inserter(report), "\n{} more allocation(s) without stacktraces.", allocationCount - stacktraces.size());
+		}
+
+		return report;
+	}
+
+	void AllocationCounter::Record(const std::size_t size) noexcept
+	{
+		for (AllocationCounter* counter = this; counter; counter = counter->outer)
+		{
+			++counter->allocationCount;
+			counter->allocatedBytes += size;
+
+			if (counter->stacktraces.size() < counter->maxStacktraceCount)
+			{
+				try
+				{
+					counter->stacktraces.push_back(std::stacktrace::current(2uz));
+				}
+				catch (...)
+				{
+					// The stacktrace is optional. The count is enough to fail the test.
+				}
+			}
+		}
+	}
+
+	void RecordAllocation(const std::size_t size) noexcept
+	{
+		if (!activeCounter || isRecording)
+		{
+			return;
+		}
+
+		isRecording = true;
+		activeCounter->Record(size);
+		isRecording = false;
+	}
+}
@@ -0,0 +1,246 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Testing:MockApplicationContext;
+
+import std;
+
+import PonyEngine.Application.Ext;
+import PonyEngine.Log;
+import PonyEngine.Memory;
+import PonyEngine.Meta;
+
+import :MockLogger;
+
+export namespace PonyEngine::Testing
+{
+	/// @brief Application context for services under test. It logs to a mock logger, and its flow state is set by the test.
+	class MockApplicationContext final : public Application::IApplicationContext
+	{
+	public:
+		/// @brief Creates an application context. The calling thread becomes its main thread.
+		[[nodiscard("Pure constructor")]]
+		MockApplicationContext() noexcept;
+		MockApplicationContext(const MockApplicationContext&) = delete;
+		MockApplicationContext(MockApplicationContext&&) = delete;
+
+		~MockApplicationContext() noexcept = default;
+
+		[[nodiscard("Pure function")]]
+		virtual std::string_view EngineName() const noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual Meta::Version EngineVersion() const noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual std::string_view EngineTitle() const noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual std::string_view CompanyName() const noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual std::string_view ProjectName() const noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual Meta::Version ProjectVersion() const noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual std::string_view CompanyTitle() const noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual std::string_view ProjectTitle() const noexcept override;
+
+		[[nodiscard("Pure function")]]
+		virtual const std::filesystem::path& ExecutableFile() const noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual const std::filesystem::path& ExecutableDirectory() const noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual const std::filesystem::path& RootDirectory() const noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual const std::filesystem::path& LocalDataDirectory() const noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual const std::filesystem::path& UserDataDirectory() const noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual const std::filesystem::path& TempDataDirectory() const noexcept override;
+
+		[[nodiscard("Pure function")]]
+		virtual std::thread::id MainThreadID() const noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual std::string_view CommandLine() const noexcept override;
+
+		[[nodiscard("Pure function")]]
+		virtual MockLogger& Logger() noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual const MockLogger& Logger() const noexcept override;
+
+		[[nodiscard("Pure function")]]
+		virtual void* FindService(std::type_index type) noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual const void* FindService(std::type_index type) const noexcept override;
+
+		[[nodiscard("Pure function")]]
+		virtual Application::FlowState FlowState() const noexcept override;
+		/// @brief Sets the flow state.
+		/// @param state Flow state.
+		void FlowState(Application::FlowState state) noexcept;
+		[[nodiscard("Pure function")]]
+		virtual int ExitCode() const noexcept override;
+		virtual void Stop(int exitCode) override;
+
+		[[nodiscard("Pure function")]]
+		virtual std::uint64_t FrameCount() const noexcept override;
+
+		[[nodiscard("Pure function")]]
+		virtual Memory::AllocationStatistics AllocationStatistics(Memory::AllocationTag tag) const noexcept override;
+
+		MockApplicationContext& operator =(const MockApplicationContext&) = delete;
+		MockApplicationContext& operator =(MockApplicationContext&&) = delete;
+
+	private:
+		MockLogger logger; ///< Logger.
+		std::filesystem::path path; ///< Path of all the directories and files. It's empty.
+		std::thread::id mainThreadId; ///< Main thread ID.
+		Application::FlowState flowState; ///< Flow state.
+		int exitCode; ///< Exit code.
+	};
+}
+
+namespace PonyEngine::Testing
+{
+	MockApplicationContext::MockApplicationContext() noexcept :
+		mainThreadId{std::this_thread::get_id()},
+		flowState{Application::FlowState::StartingUp},
+		exitCode{0}
+	{
+	}
+
+	std::string_view MockApplicationContext::EngineName() const noexcept
+	{
+		return "PonyEngine";
+	}
+
+	Meta::Version MockApplicationContext::EngineVersion() const noexcept
+	{
+		return Meta::Version();
+	}
+
+	std::string_view MockApplicationContext::EngineTitle() const noexcept
+	{
+		return "Pony Engine";
+	}
+
+	std::string_view MockApplicationContext::CompanyName() const noexcept
+	{
+		return "Company";
+	}
+
+	std::string_view MockApplicationContext::ProjectName() const noexcept
+	{
+		return "Project";
+	}
+
+	Meta::Version MockApplicationContext::ProjectVersion() const noexcept
+	{
+		return Meta::Version();
+	}
+
+	std::string_view MockApplicationContext::CompanyTitle() const noexcept
+	{
+		return "Company";
+	}
+
+	std::string_view MockApplicationContext::ProjectTitle() const noexcept
+	{
+		return "Project";
+	}
+
+	const std::filesystem::path& MockApplicationContext::ExecutableFile() const noexcept
+	{
+		return path;
+	}
+
+	const std::filesystem::path& MockApplicationContext::ExecutableDirectory() const noexcept
+	{
+		return path;
+	}
+
+	const std::filesystem::path& MockApplicationContext::RootDirectory() const noexcept
+	{
+		return path;
+	}
+
+	const std::filesystem::path& MockApplicationContext::LocalDataDirectory() const noexcept
+	{
+		return path;
+	}
+
+	const std::filesystem::path& MockApplicationContext::UserDataDirectory() const noexcept
+	{
+		return path;
+	}
+
+	const std::filesystem::path& MockApplicationContext::TempDataDirectory() const noexcept
+	{
+		return path;
+	}
+
+	std::thread::id MockApplicationContext::MainThreadID() const noexcept
+	{
+		return mainThreadId;
+	}
+
+	std::string_view MockApplicationContext::CommandLine() const noexcept
+	{
+		return "";
+	}
+
+	MockLogger& MockApplicationContext::Logger() noexcept
+	{
+		return logger;
+	}
+
+	const MockLogger& MockApplicationContext::Logger() const noexcept
+	{
+		return logger;
+	}
+
+	void* MockApplicationContext::FindService(std::type_index) noexcept
+	{
+		return nullptr;
+	}
+
+	const void* MockApplicationContext::FindService(std::type_index) const noexcept
+	{
+		return nullptr;
+	}
+
+	Application::FlowState MockApplicationContext::FlowState() const noexcept
+	{
+		return flowState;
+	}
+
+	void MockApplicationContext::FlowState(const Application::FlowState state) noexcept
+	{
+		flowState = state;
+	}
+
+	int MockApplicationContext::ExitCode() const noexcept
+	{
+		return exitCode;
+	}
+
+	void MockApplicationContext::Stop(const int exitCode)
+	{
+		this->exitCode = exitCode;
+		flowState = Application::FlowState::Stopped;
+	}
+
+	std::uint64_t MockApplicationContext::FrameCount() const noexcept
+	{
+		return 0ull;
+	}
+
+	Memory::AllocationStatistics MockApplicationContext::AllocationStatistics(Memory::AllocationTag) const noexcept
+	{
+		return Memory::AllocationStatistics();
+	}
+}
@@ -0,0 +1,144 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Testing:MockLogger;
+
+import std;
+
+import PonyEngine.Log;
+
+export namespace PonyEngine::Testing
+{
+	/// @brief Logger that only counts the logs. It never allocates.
+	class MockLogger final : public Log::ILogger
+	{
+	public:
+		[[nodiscard("Pure constructor")]]
+		MockLogger() noexcept = default;
+		MockLogger(const MockLogger&) = delete;
+		MockLogger(MockLogger&&) = delete;
+
+		~MockLogger() noexcept = default;
+
+		/// @brief Gets the log count.
+		/// @return Log count.
+		[[nodiscard("Pure function")]]
+		std::size_t LogCount() const noexcept;
+
+		[[nodiscard("Pure function")]]
+		virtual Log::LogFilter& Filter() noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual const Log::LogFilter& Filter() const noexcept override;
+
+		virtual void Log(Log::LogType logType, std::string_view message) const noexcept override;
+		virtual void Log(Log::LogType logType, std::string_view format, std::format_args formatArgs) const noexcept override;
+		virtual void Log(Log::LogType logType, std::string_view message, const std::stacktrace& stacktrace) const noexcept override;
+		virtual void Log(Log::LogType logType, std::string_view format, std::format_args formatArgs, const std::stacktrace& stacktrace) const noexcept override;
+		virtual void Log(Log::LogType logType, const Log::DeferredMessage& message) const noexcept override;
+		virtual void Log(Log::LogType logType, const Log::DeferredMessage& message, const std::stacktrace& stacktrace) const noexcept override;
+		virtual void Log(Log::LogType logType, std::string_view message, std::span<const Log::LogField> fields) const noexcept override;
+
+		virtual void Log(const std::exception_ptr& exception) const noexcept override;
+		virtual void Log(const std::exception_ptr& exception, std::string_view message) const noexcept override;
+		virtual void Log(const std::exception_ptr& exception, std::string_view format, std::format_args formatArgs) const noexcept override;
+		virtual void Log(const std::exception_ptr& exception, const std::stacktrace& stacktrace) const noexcept override;
+		virtual void Log(const std::exception_ptr& exception, std::string_view message, const std::stacktrace& stacktrace) const noexcept override;
+		virtual void Log(const std::exception_ptr& exception, std::string_view format, std::format_args formatArgs, const std::stacktrace& stacktrace) const noexcept override;
+
+		MockLogger& operator =(const MockLogger&) = delete;
+		MockLogger& operator =(MockLogger&&) = delete;
+
+	private:
+		Log::LogFilter filter; ///< Log filter.
+		mutable std::size_t logCount = 0uz; ///< Log count.
+	};
+}
+
+namespace PonyEngine::Testing
+{
+	std::size_t MockLogger::LogCount() const noexcept
+	{
+		return logCount;
+	}
+
+	Log::LogFilter& MockLogger::Filter() noexcept
+	{
+		return filter;
+	}
+
+	const Log::LogFilter& MockLogger::Filter() const noexcept
+	{
+		return filter;
+	}
+
+	void MockLogger::Log(Log::LogType, std::string_view) const noexcept
+	{
+		++logCount;
+	}
+
+	void MockLogger::Log(Log::LogType, std::string_view, std::format_args) const noexcept
+	{
+		++logCount;
+	}
+
+	void MockLogger::Log(Log::LogType, std::string_view, const std::stacktrace&) const noexcept
+	{
+		++logCount;
+	}
+
+	void MockLogger::Log(Log::LogType, std::string_view, std::format_args, const std::stacktrace&) const noexcept
+	{
+		++logCount;
+	}
+
+	void MockLogger::Log(Log::LogType, const Log::DeferredMessage&) const noexcept
+	{
+		++logCount;
+	}
+
+	void MockLogger::Log(Log::LogType, const Log::DeferredMessage&, const std::stacktrace&) const noexcept
+	{
+		++logCount;
+	}
+
+	void MockLogger::Log(Log::LogType, std::string_view, std::span<const Log::LogField>) const noexcept
+	{
+		++logCount;
+	}
+
+	void MockLogger::Log(const std::exception_ptr&) const noexcept
+	{
+		++logCount;
+	}
+
+	void MockLogger::Log(const std::exception_ptr&, std::string_view) const noexcept
+	{
+		++logCount;
+	}
+
+	void MockLogger::Log(const std::exception_ptr&, std::string_view, std::format_args) const noexcept
+	{
+		++logCount;
+	}
+
+	void MockLogger::Log(const std::exception_ptr&, const std::stacktrace&) const noexcept
+	{
+		++logCount;
+	}
+
+	void MockLogger::Log(const std::exception_ptr&, std::string_view, const std::stacktrace&) const noexcept
+	{
+		++logCount;
+	}
+
+	void MockLogger::Log(const std::exception_ptr&, std::string_view, std::format_args, const std::stacktrace&) const noexcept
+	{
+		++logCount;
+	}
+}
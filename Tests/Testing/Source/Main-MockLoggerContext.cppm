@@ -0,0 +1,62 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Testing:MockLoggerContext;
+
+import std;
+
+import PonyEngine.Application.Ext;
+import PonyEngine.Log;
+
+import :MockApplicationContext;
+
+export namespace PonyEngine::Testing
+{
+	/// @brief Logger context for loggers under test. It drops the console logs.
+	class MockLoggerContext final : public PonyEngine::Application::ILoggerContext
+	{
+	public:
+		[[nodiscard("Pure constructor")]]
+		MockLoggerContext() noexcept = default;
+		MockLoggerContext(const MockLoggerContext&) = delete;
+		MockLoggerContext(MockLoggerContext&&) = delete;
+
+		~MockLoggerContext() noexcept = default;
+
+		[[nodiscard("Pure function")]]
+		virtual MockApplicationContext& Application() noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual const MockApplicationContext& Application() const noexcept override;
+
+		virtual void LogToConsole(Log::LogType logType, std::string_view message) const noexcept override;
+
+		MockLoggerContext& operator =(const MockLoggerContext&) = delete;
+		MockLoggerContext& operator =(MockLoggerContext&&) = delete;
+
+	private:
+		MockApplicationContext application; ///< Application context.
+	};
+}
+
+namespace PonyEngine::Testing
+{
+	MockApplicationContext& MockLoggerContext::Application() noexcept
+	{
+		return application;
+	}
+
+	const MockApplicationContext& MockLoggerContext::Application() const noexcept
+	{
+		return application;
+	}
+
+	void MockLoggerContext::LogToConsole(Log::LogType, std::string_view) const noexcept
+	{
+	}
+}
@@ -0,0 +1,75 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Testing:MockServiceAdder;
+
+import std;
+
+import PonyEngine.Application.Ext;
+
+export namespace PonyEngine::Testing
+{
+	/// @brief Collects the tickable services and the interfaces that a service under test adds.
+	class MockServiceAdder final : public Application::ITickableServiceAdder, public Application::IServiceInterfaceAdder
+	{
+	public:
+		[[nodiscard("Pure constructor")]]
+		MockServiceAdder() noexcept = default;
+		MockServiceAdder(const MockServiceAdder&) = delete;
+		MockServiceAdder(MockServiceAdder&&) = delete;
+
+		~MockServiceAdder() noexcept = default;
+
+		/// @brief Gets the added tickable services.
+		/// @return Tickable services in the order they were added.
+		[[nodiscard("Pure function")]]
+		std::span<Application::ITickableService* const> TickableServices() const noexcept;
+		/// @brief Finds an added interface.
+		/// @tparam T Interface type.
+		/// @return Interface; nullptr if it's not added.
+		template<typename T> [[nodiscard("Pure function")]]
+		T* FindInterface() const noexcept;
+
+		virtual void Add(Application::ITickableService& tickable, std::int32_t tickOrder) override;
+		virtual void AddInterface(std::type_index type, void* interface) override;
+
+		MockServiceAdder& operator =(const MockServiceAdder&) = delete;
+		MockServiceAdder& operator =(MockServiceAdder&&) = delete;
+
+	private:
+		std::vector<Application::ITickableService*> tickableServices; ///< Added tickable services.
+		std::vector<std::pair<std::type_index, void*>> interfaces; ///< Added interfaces.
+	};
+}
+
+namespace PonyEngine::Testing
+{
+	std::span<Application::ITickableService* const> MockServiceAdder::TickableServices() const noexcept
+	{
+		return tickableServices;
+	}
+
+	template<typename T>
+	T* MockServiceAdder::FindInterface() const noexcept
+	{
+		const auto position = std::ranges::find(interfaces, std::type_index(typeid(T)), &std::pair<std::type_index, void*>::first);
+
+		return position != interfaces.cend() ? static_cast<T*>(position->second) : nullptr;
+	}
+
+	void MockServiceAdder::Add(Application::ITickableService& tickable, std::int32_t)
+	{
+		tickableServices.push_back(&tickable);
+	}
+
+	void MockServiceAdder::AddInterface(const std::type_index type, void* const interface)
+	{
+		interfaces.emplace_back(type, interface);
+	}
+}
@@ -0,0 +1,129 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Testing:MockSubLoggerContext;
+
+import std;
+
+import PonyEngine.Log;
+import PonyEngine.Log.Ext;
+
+import :MockApplicationContext;
+
+export namespace PonyEngine::Testing
+{
+	/// @brief Logger context for sub-loggers under test. It only counts the console logs, so a test can check that a sub-logger reported no errors.
+	class MockSubLoggerContext final : public Log::ILoggerContext
+	{
+	public:
+		[[nodiscard("Pure constructor")]]
+		MockSubLoggerContext() noexcept = default;
+		MockSubLoggerContext(const MockSubLoggerContext&) = delete;
+		MockSubLoggerContext(MockSubLoggerContext&&) = delete;
+
+		~MockSubLoggerContext() noexcept = default;
+
+		/// @brief Gets the console log count.
+		/// @return Console log count.
+		[[nodiscard("Pure function")]]
+		std::size_t ConsoleLogCount() const noexcept;
+
+		[[nodiscard("Pure function")]]
+		virtual MockApplicationContext& Application() noexcept override;
+		[[nodiscard("Pure function")]]
+		virtual const MockApplicationContext& Application() const noexcept override;
+
+		virtual void LogToConsole(Log::LogType logType, std::string_view message) const noexcept override;
+		virtual void LogToConsole(Log::LogType logType, std::string_view format, std::format_args formatArgs) const noexcept override;
+		virtual void LogToConsole(Log::LogType logType, std::string_view message, const std::stacktrace& stacktrace) const noexcept override;
+		virtual void LogToConsole(Log::LogType logType, std::string_view format, std::format_args formatArgs, const std::stacktrace& stacktrace) const noexcept override;
+
+		virtual void LogToConsole(const std::exception_ptr& exception) const noexcept override;
+		virtual void LogToConsole(const std::exception_ptr& exception, std::string_view message) const noexcept override;
+		virtual void LogToConsole(const std::exception_ptr& exception, std::string_view format, std::format_args formatArgs) const noexcept override;
+		virtual void LogToConsole(const std::exception_ptr& exception, const std::stacktrace& stacktrace) const noexcept override;
+		virtual void LogToConsole(const std::exception_ptr& exception, std::string_view message, const std::stacktrace& stacktrace) const noexcept override;
+		virtual void LogToConsole(const std::exception_ptr& exception, std::string_view format, std::format_args formatArgs, const std::stacktrace& stacktrace) const noexcept override;
+
+		MockSubLoggerContext& operator =(const MockSubLoggerContext&) = delete;
+		MockSubLoggerContext& operator =(MockSubLoggerContext&&) = delete;
+
+	private:
+		MockApplicationContext application; ///< Application context.
+		mutable std::size_t consoleLogCount = 0uz; ///< Console log count.
+	};
+}
+
+namespace PonyEngine::Testing
+{
+	std::size_t MockSubLoggerContext::ConsoleLogCount() const noexcept
+	{
+		return consoleLogCount;
+	}
+
+	MockApplicationContext& MockSubLoggerContext::Application() noexcept
+	{
+		return application;
+	}
+
+	const MockApplicationContext& MockSubLoggerContext::Application() const noexcept
+	{
+		return application;
+	}
+
+	void MockSubLoggerContext::LogToConsole(Log::LogType, std::string_view) const noexcept
+	{
+		++consoleLogCount;
+	}
+
+	void MockSubLoggerContext::LogToConsole(Log::LogType, std::string_view, std::format_args) const noexcept
+	{
+		++consoleLogCount;
+	}
+
+	void MockSubLoggerContext::LogToConsole(Log::LogType, std::string_view, const std::stacktrace&) const noexcept
+	{
+		++consoleLogCount;
+	}
+
+	void MockSubLoggerContext::LogToConsole(Log::LogType, std::string_view, std::format_args, const std::stacktrace&) const noexcept
+	{
+		++consoleLogCount;
+	}
+
+	void MockSubLoggerContext::LogToConsole(const std::exception_ptr&) const noexcept
+	{
+		++consoleLogCount;
+	}
+
+	void MockSubLoggerContext::LogToConsole(const std::exception_ptr&, std::string_view) const noexcept
+	{
+		++consoleLogCount;
+	}
+
+	void MockSubLoggerContext::LogToConsole(const std::exception_ptr&, std::string_view, std::format_args) const noexcept
+	{
+		++consoleLogCount;
+	}
+
+	void MockSubLoggerContext::LogToConsole(const std::exception_ptr&, const std::stacktrace&) const noexcept
+	{
+		++consoleLogCount;
+	}
+
+	void MockSubLoggerContext::LogToConsole(const std::exception_ptr&, std::string_view, const std::stacktrace&) const noexcept
+	{
+		++consoleLogCount;
+	}
+
+	void MockSubLoggerContext::LogToConsole(const std::exception_ptr&, std::string_view, std::format_args, const std::stacktrace&) const noexcept
+	{
+		++consoleLogCount;
+	}
+}
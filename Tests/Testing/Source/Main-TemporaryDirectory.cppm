@@ -0,0 +1,109 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Testing:TemporaryDirectory;
+
+import std;
+
+export namespace PonyEngine::Testing
+{
+	/// @brief Empty directory in the system temporary directory. It's removed with its content on destruction.
+	class TemporaryDirectory final
+	{
+	public:
+		/// @brief Creates an empty directory. If it exists, its content is removed.
+		/// @param name Directory name. It must be unique among the tests that may run in parallel.
+		[[nodiscard("Pure constructor")]]
+		explicit TemporaryDirectory(std::string_view name);
+		TemporaryDirectory(const TemporaryDirectory&) = delete;
+		TemporaryDirectory(TemporaryDirectory&&) = delete;
+
+		~TemporaryDirectory() noexcept;
+
+		/// @brief Gets the directory path.
+		/// @return Directory path.
+		[[nodiscard("Pure function")]]
+		const std::filesystem::path& Path() const noexcept;
+
+		/// @brief Gets the names of the files in the directory.
+		/// @return File names in ascending order.
+		[[nodiscard("Pure function")]]
+		std::vector<std::string> FileNames() const;
+		/// @brief Reads the file in the directory.
+		/// @param fileName File name.
+		/// @return File content.
+		[[nodiscard("Pure function")]]
+		std::string Read(std::string_view fileName) const;
+		/// @brief Writes the file in the directory. The existing file is overwritten.
+		/// @param fileName File name.
+		/// @param content File content.
+		void Write(std::string_view fileName, std::string_view content) const;
+
+		TemporaryDirectory& operator =(const TemporaryDirectory&) = delete;
+		TemporaryDirectory& operator =(TemporaryDirectory&&) = delete;
+
+	private:
+		std::filesystem::path path; ///< Directory path.
+	};
+}
+
+namespace PonyEngine::Testing
+{
+	TemporaryDirectory::TemporaryDirectory(const std::string_view name) :
+		path(std::filesystem::temp_directory_path() / "PonyEngine.Tests" / name)
+	{
+		std::filesystem::remove_all(path);
+		std::filesystem::create_directories(path);
+	}
+
+	TemporaryDirectory::~TemporaryDirectory() noexcept
+	{
+		std::error_code error;
+		std::filesystem::remove_all(path, error);
+	}
+
+	const std::filesystem::path& TemporaryDirectory::Path() const noexcept
+	{
+		return path;
+	}
+
+	std::vector<std::string> TemporaryDirectory::FileNames() const
+	{
+		auto fileNames = std::vector<std::string>();
+		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(path))
+		{
+			fileNames.push_back(entry.path().filename().string());
+		}
+		std::ranges::sort(fileNames);
+
+		return fileNames;
+	}
+
+	std::string TemporaryDirectory::Read(const std::string_view fileName) const
+	{
+		auto input = std::ifstream(path / fileName, std::ios::binary);
+		if (!input.is_open()) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to open file: Name = '{}'", fileName));
+		}
+
+		return std::string(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+	}
+
+	void TemporaryDirectory::Write(const std::string_view fileName, const std::string_view content) const
+	{
+		auto output = std::ofstream(path / fileName, std::ios::binary | std::ios::trunc);
+		output.write(content.data(), static_cast<std::streamsize>(content.size()));
+		output.close();
+		if (!output) [[unlikely]]
+		{
+			throw std::runtime_error(std::format("Failed to write file: Name = '{}'", fileName));
+		}
+	}
+}
@@ -0,0 +1,19 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+export module PonyEngine.Testing;
+
+export import :AllocationCheck;
+export import :AllocationCounter;
+export import :MockApplicationContext;
+export import :MockLogger;
+export import :MockLoggerContext;
+export import :MockServiceAdder;
+export import :MockSubLoggerContext;
+export import :TemporaryDirectory;
@@ -0,0 +1,202 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+import std;
+
+import PonyEngine.Testing;
+
+namespace
+{
+	constexpr std::size_t DefaultAlignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__; ///< Alignment of the raw allocations.
+
+	/// @brief Allocates memory and records the allocation.
+	/// @param size Size.
+	/// @param alignment Alignment.
+	/// @return Memory or nullptr if there's not enough memory.
+	void* Allocate(std::size_t size, std::size_t alignment) noexcept;
+	/// @brief Allocates memory and records the allocation. It calls the new handler while there's not enough memory.
+	/// @param size Size.
+	/// @param alignment Alignment.
+	/// @return Memory.
+	void* AllocateOrThrow(std::size_t size, std::size_t alignment);
+	/// @brief Deallocates memory.
+	/// @param memory Memory. May be nullptr.
+	/// @param alignment Alignment the memory was allocated with.
+	void Deallocate(void* memory, std::size_t alignment) noexcept;
+}
+
+void* operator new(const std::size_t size)
+{
+	return AllocateOrThrow(size, DefaultAlignment);
+}
+
+void* operator new[](const std::size_t size)
+{
+	return AllocateOrThrow(size, DefaultAlignment);
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment)
+{
+	return AllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment)
+{
+	return AllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(const std::size_t size, const std::nothrow_t&) noexcept
+{
+	return Allocate(size, DefaultAlignment);
+}
+
+void* operator new[](const std::size_t size, const std::nothrow_t&) noexcept
+{
+	return Allocate(size, DefaultAlignment);
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* const memory) noexcept
+{
+	Deallocate(memory, DefaultAlignment);
+}
+
+void operator delete[](void* const memory) noexcept
+{
+	Deallocate(memory, DefaultAlignment);
+}
+
+void operator delete(void* const memory, std::size_t) noexcept
+{
+	Deallocate(memory, DefaultAlignment);
+}
+
+void operator delete[](void* const memory, std::size_t) noexcept
+{
+	Deallocate(memory, DefaultAlignment);
+}
+
+void operator delete(void* const memory, const std::align_val_t alignment) noexcept
+{
+	Deallocate(memory, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* const memory, const std::align_val_t alignment) noexcept
+{
+	Deallocate(memory, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* const memory, std::size_t, const std::align_val_t alignment) noexcept
+{
+	Deallocate(memory, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* const memory, std::size_t, const std::align_val_t alignment) noexcept
+{
+	Deallocate(memory, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* const memory, const std::nothrow_t&) noexcept
+{
+	Deallocate(memory, DefaultAlignment);
+}
+
+void operator delete[](void* const memory, const std::nothrow_t&) noexcept
+{
+	Deallocate(memory, DefaultAlignment);
+}
+
+void operator delete(void* const memory, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	Deallocate(memory, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* const memory, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	Deallocate(memory, static_cast<std::size_t>(alignment));
+}
+
+namespace
+{
+	void* Allocate(const std::size_t size, const std::size_t alignment) noexcept
+	{
+		if (alignment <= DefaultAlignment)
+		{
+			void* const memory = std::malloc(size == 0uz ? 1uz : size);
+			if (memory) [[likely]]
+			{
+				PonyEngine::Testing::RecordAllocation(size);
+			}
+
+			return memory;
+		}
+
+		// The raw pointer is stored right before the aligned memory.
+		if (size > std::numeric_limits<std::size_t>::max() - alignment) [[unlikely]]
+		{
+			return nullptr;
+		}
+
+		std::byte* const raw = static_cast<std::byte*>(std::malloc(size + alignment));
+		if (!raw) [[unlikely]]
+		{
+			return nullptr;
+		}
+
+		const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*);
+		std::byte* const memory = raw + (((address + alignment - 1uz) & ~(alignment - 1uz)) - reinterpret_cast<std::uintptr_t>(raw));
+		std::memcpy(memory - sizeof(void*), &raw, sizeof(void*));
+		PonyEngine::Testing::RecordAllocation(size);
+
+		return memory;
+	}
+
+	void* AllocateOrThrow(const std::size_t size, const std::size_t alignment)
+	{
+		while (true)
+		{
+			if (void* const memory = Allocate(size, alignment)) [[likely]]
+			{
+				return memory;
+			}
+
+			if (const std::new_handler handler = std::get_new_handler())
+			{
+				handler();
+			}
+			else
+			{
+				throw std::bad_alloc();
+			}
+		}
+	}
+
+	void Deallocate(void* const memory, const std::size_t alignment) noexcept
+	{
+		if (!memory || alignment <= DefaultAlignment)
+		{
+			std::free(memory);
+
+			return;
+		}
+
+		void* raw;
+		std::memcpy(&raw, static_cast<std::byte*>(memory) - sizeof(void*), sizeof(void*));
+		std::free(raw);
+	}
+}
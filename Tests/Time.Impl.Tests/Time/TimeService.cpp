@@ -0,0 +1,66 @@
+/***************************************************
+ * MIT License                                     *
+ *                                                 *
+ * Copyright (c) 2023-present Vladimir Popov       *
+ *                                                 *
+ * Email: zor1994@gmail.com                        *
+ * Repo: https://github.com/ZorPastaman/PonyEngine *
+ ***************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+import std;
+
+import PonyEngine.Application.Ext;
+import PonyEngine.Testing;
+import PonyEngine.Time;
+import PonyEngine.Time.Impl;
+
+TEST_CASE("TimeService: tick", "[Time][TimeService]")
+{
+	auto application = PonyEngine::Testing::MockApplicationContext();
+	auto service = PonyEngine::Time::TimeService(application);
+	auto adder = PonyEngine::Testing::MockServiceAdder();
+	service.AddTickableServices(adder);
+	service.AddInterfaces(adder);
+	REQUIRE(adder.TickableServices().size() == 1uz);
+	PonyEngine::Time::ITimeService* const timeService = adder.FindInterface<PonyEngine::Time::ITimeService>();
+	REQUIRE(timeService);
+
+	timeService->TargetFrameTime(std::chrono::milliseconds(2));
+	timeService->FixedStepPeriod(std::chrono::milliseconds(1));
+	timeService->TimeScale(0.5);
+	service.Begin();
+	for (int i = 0; i < 3; ++i)
+	{
+		adder.TickableServices()[0]->Tick();
+	}
+	service.End();
+
+	REQUIRE(timeService->RealDeltaTime() >= std::chrono::milliseconds(2));
+	REQUIRE(timeService->RealTime() >= std::chrono::milliseconds(6));
+	REQUIRE(timeService->FrameTimePoint() - timeService->StartTimePoint() == timeService->RealTime());
+	REQUIRE(timeService->UnscaledVirtualTime() == timeService->RealTime());
+	REQUIRE(timeService->VirtualTime() < timeService->UnscaledVirtualTime());
+	REQUIRE(timeService->RealFixedStepCount() == static_cast<std::uint64_t>(timeService->RealTime() / timeService->FixedStepPeriod()));
+}
+
+TEST_CASE("TimeService: no allocations on tick", "[Time][TimeService]")
+{
+	auto application = PonyEngine::Testing::MockApplicationContext();
+	auto service = PonyEngine::Time::TimeService(application);
+	auto adder = PonyEngine::Testing::MockServiceAdder();
+	service.AddTickableServices(adder);
+	PonyEngine::Application::ITickableService& tickable = *adder.TickableServices()[0];
+	service.Begin();
+	tickable.Tick();
+
+	PonyEngine::Testing::RequireNoAllocations([&]
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			tickable.Tick();
+		}
+	});
+	service.End();
+}